@@ -0,0 +1,149 @@
+// Copyright (C) <2026> Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "talk/owt/sdk/base/asynclogsink.h"
+#include "webrtc/rtc_base/checks.h"
+
+namespace owt {
+namespace base {
+// Upper bound of a batch handed to the target in one call.
+static const size_t kMaxBatchBytes = 256 * 1024;
+
+static size_t RoundUpToPowerOfTwo(size_t value) {
+  size_t result = 2;
+  while (result < value)
+    result <<= 1;
+  return result;
+}
+
+AsyncLogSink::AsyncLogSink(std::unique_ptr<rtc::LogSink> target,
+                           size_t capacity)
+    : target_(std::move(target)),
+      slots_(RoundUpToPowerOfTwo(capacity)),
+      mask_(slots_.size() - 1) {
+  RTC_DCHECK(target_);
+  for (size_t i = 0; i < slots_.size(); i++)
+    slots_[i].sequence.store(i, std::memory_order_relaxed);
+  writer_ = rtc::PlatformThread::SpawnJoinable(
+      [this] { WriterLoop(); }, "OwtAsyncLogWriter",
+      rtc::ThreadAttributes().SetPriority(rtc::ThreadPriority::kLow));
+}
+
+AsyncLogSink::~AsyncLogSink() {
+  running_.store(false, std::memory_order_release);
+  wake_.Set();
+  writer_.Finalize();
+}
+
+void AsyncLogSink::OnLogMessage(const std::string& message) {
+  if (!TryEnqueue(message)) {
+    dropped_.fetch_add(1, std::memory_order_relaxed);
+    dropped_total_.fetch_add(1, std::memory_order_relaxed);
+    return;
+  }
+  WakeWriter();
+}
+
+void AsyncLogSink::WakeWriter() {
+  // Pairs with the fence in WriterLoop: either the writer sees the message
+  // just enqueued, or this sees |writer_waiting_| set. Only the producer that
+  // clears the flag signals, so a busy writer costs producers one load.
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  if (writer_waiting_.load(std::memory_order_relaxed) &&
+      writer_waiting_.exchange(false, std::memory_order_relaxed)) {
+    wake_.Set();
+  }
+}
+
+bool AsyncLogSink::HasQueuedMessages() const {
+  const Slot& slot = slots_[dequeue_pos_ & mask_];
+  return slot.sequence.load(std::memory_order_acquire) == dequeue_pos_ + 1;
+}
+
+bool AsyncLogSink::TryEnqueue(const std::string& message) {
+  size_t pos = enqueue_pos_.load(std::memory_order_relaxed);
+  for (;;) {
+    Slot& slot = slots_[pos & mask_];
+    size_t sequence = slot.sequence.load(std::memory_order_acquire);
+    intptr_t diff =
+        static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos);
+    if (diff == 0) {
+      if (enqueue_pos_.compare_exchange_weak(pos, pos + 1,
+                                             std::memory_order_relaxed)) {
+        slot.text.assign(message);
+        slot.sequence.store(pos + 1, std::memory_order_release);
+        return true;
+      }
+    } else if (diff < 0) {
+      // Writer has not freed this slot yet: queue is full.
+      return false;
+    } else {
+      pos = enqueue_pos_.load(std::memory_order_relaxed);
+    }
+  }
+}
+
+size_t AsyncLogSink::Drain(std::string& batch) {
+  size_t count = 0;
+  while (batch.size() < kMaxBatchBytes) {
+    Slot& slot = slots_[dequeue_pos_ & mask_];
+    size_t sequence = slot.sequence.load(std::memory_order_acquire);
+    if (sequence != dequeue_pos_ + 1)
+      break;
+    batch.append(slot.text);
+    slot.sequence.store(dequeue_pos_ + slots_.size(),
+                        std::memory_order_release);
+    dequeue_pos_++;
+    count++;
+  }
+  return count;
+}
+
+void AsyncLogSink::Flush() {
+  uint64_t ticket = flush_requested_.fetch_add(1) + 1;
+  wake_.Set();
+  std::unique_lock<std::mutex> lock(flush_mutex_);
+  flushed_.wait(lock, [this, ticket] { return flush_done_ >= ticket; });
+}
+
+void AsyncLogSink::WriterLoop() {
+  std::string batch;
+  batch.reserve(kMaxBatchBytes);
+  for (;;) {
+    bool running = running_.load(std::memory_order_acquire);
+    uint64_t flush_ticket = flush_requested_.load(std::memory_order_acquire);
+    size_t taken;
+    do {
+      batch.clear();
+      taken = Drain(batch);
+      uint64_t dropped = dropped_.exchange(0, std::memory_order_relaxed);
+      if (dropped > 0) {
+        batch.append("(async log sink) " + std::to_string(dropped) +
+                     " messages dropped, queue full.\n");
+      }
+      if (!batch.empty())
+        target_->OnLogMessage(batch);
+    } while (taken > 0);
+    {
+      std::lock_guard<std::mutex> lock(flush_mutex_);
+      if (flush_ticket > flush_done_) {
+        flush_done_ = flush_ticket;
+        flushed_.notify_all();
+      }
+    }
+    if (!running)
+      return;
+    writer_waiting_.store(true, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (HasQueuedMessages()) {
+      // A producer may have cleared the flag and signaled already; the
+      // extra wake-up only costs one empty pass.
+      writer_waiting_.store(false, std::memory_order_relaxed);
+      continue;
+    }
+    wake_.Wait(rtc::Event::kForever);
+  }
+}
+}  // namespace base
+}  // namespace owt
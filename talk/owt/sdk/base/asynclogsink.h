@@ -0,0 +1,82 @@
+// Copyright (C) <2026> Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef OWT_BASE_ASYNCLOGSINK_H_
+#define OWT_BASE_ASYNCLOGSINK_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include "webrtc/rtc_base/event.h"
+#include "webrtc/rtc_base/logging.h"
+#include "webrtc/rtc_base/platform_thread.h"
+
+namespace owt {
+namespace base {
+// Log sink that hands formatted messages to a writer thread. rtc::LogMessage
+// calls sinks under its global lock, so a file sink makes every RTC_LOG on
+// media and network threads wait for disk I/O. Producers here only copy the
+// message into a bounded lock-free queue; the writer thread passes batches to
+// |target|, which does the file writes and rotation. The writer sleeps while
+// the queue is empty, and only the producer that finds it asleep wakes it.
+// When the queue is full messages are dropped and counted rather than
+// blocking the caller.
+class AsyncLogSink : public rtc::LogSink {
+ public:
+  // |capacity| is rounded up to a power of two.
+  AsyncLogSink(std::unique_ptr<rtc::LogSink> target, size_t capacity);
+  // Writes queued messages before returning.
+  ~AsyncLogSink() override;
+
+  // Implements rtc::LogSink.
+  void OnLogMessage(const std::string& message) override;
+
+  uint64_t DroppedMessages() const {
+    return dropped_total_.load(std::memory_order_relaxed);
+  }
+  // Blocks until messages queued before the call are passed to |target|.
+  void Flush();
+
+ private:
+  // Slot of a bounded multi-producer queue (D. Vyukov). |sequence| tells
+  // whether the slot is free for the producer at a position or ready for the
+  // consumer. |text| keeps its capacity, so steady-state enqueues do not
+  // allocate.
+  struct Slot {
+    std::atomic<size_t> sequence;
+    std::string text;
+  };
+  bool TryEnqueue(const std::string& message);
+  // Wakes the writer if it is waiting for messages.
+  void WakeWriter();
+  // Returns true if the writer's next slot holds a message.
+  bool HasQueuedMessages() const;
+  // Moves ready messages into |batch|. Returns number of messages taken.
+  size_t Drain(std::string& batch);
+  void WriterLoop();
+
+  std::unique_ptr<rtc::LogSink> target_;
+  std::vector<Slot> slots_;
+  const size_t mask_;
+  alignas(64) std::atomic<size_t> enqueue_pos_{0};
+  alignas(64) size_t dequeue_pos_ = 0;
+  // Drops since the writer last reported them, and in total.
+  std::atomic<uint64_t> dropped_{0};
+  std::atomic<uint64_t> dropped_total_{0};
+  std::atomic<bool> running_{true};
+  // Set by the writer before it waits on |wake_|.
+  alignas(64) std::atomic<bool> writer_waiting_{false};
+  std::atomic<uint64_t> flush_requested_{0};
+  rtc::Event wake_;
+  std::mutex flush_mutex_;
+  std::condition_variable flushed_;
+  uint64_t flush_done_ = 0;
+  rtc::PlatformThread writer_;
+};
+}  // namespace base
+}  // namespace owt
+#endif  // OWT_BASE_ASYNCLOGSINK_H_
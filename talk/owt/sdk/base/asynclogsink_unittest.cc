@@ -0,0 +1,119 @@
+// Copyright (C) <2026> Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+#include <algorithm>
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "talk/owt/sdk/base/asynclogsink.h"
+#include "testing/gtest/include/gtest/gtest.h"
+#include "testing/gmock/include/gmock/gmock.h"
+#include "webrtc/rtc_base/event.h"
+#include "webrtc/rtc_base/logging.h"
+namespace owt {
+namespace base {
+namespace {
+// Collects batches, optionally taking |delay| per write like a slow disk.
+class CollectingSink : public rtc::LogSink {
+ public:
+  explicit CollectingSink(std::chrono::microseconds delay = {})
+      : delay_(delay) {}
+  void OnLogMessage(const std::string& message) override {
+    if (delay_.count() > 0)
+      std::this_thread::sleep_for(delay_);
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      text_.append(message);
+    }
+    written.Set();
+  }
+  std::string Text() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return text_;
+  }
+  // Signaled after every write.
+  rtc::Event written;
+
+ private:
+  const std::chrono::microseconds delay_;
+  std::mutex mutex_;
+  std::string text_;
+};
+
+size_t CountLines(const std::string& text) {
+  return std::count(text.begin(), text.end(), '\n');
+}
+}  // namespace
+
+TEST(AsyncLogSinkTest, DeliversMessagesInOrder) {
+  auto* target = new CollectingSink();
+  AsyncLogSink sink(std::unique_ptr<rtc::LogSink>(target), 64);
+  std::string expected;
+  for (int i = 0; i < 1000; i++) {
+    std::string message = "message " + std::to_string(i) + "\n";
+    sink.OnLogMessage(message);
+    expected += message;
+    // Give the writer a chance, as the queue holds only 64 messages.
+    if (i % 32 == 31)
+      sink.Flush();
+  }
+  sink.Flush();
+  EXPECT_EQ(expected, target->Text());
+  EXPECT_EQ(0u, sink.DroppedMessages());
+}
+
+TEST(AsyncLogSinkTest, IdleWriterWakesForNewMessage) {
+  auto* target = new CollectingSink();
+  AsyncLogSink sink(std::unique_ptr<rtc::LogSink>(target), 64);
+  std::string expected;
+  // Each message arrives after the writer found the queue empty, and is
+  // written without a Flush.
+  for (int i = 0; i < 10; i++) {
+    std::string message = "message " + std::to_string(i) + "\n";
+    sink.OnLogMessage(message);
+    expected += message;
+    ASSERT_TRUE(target->written.Wait(5000));
+  }
+  EXPECT_EQ(expected, target->Text());
+}
+
+TEST(AsyncLogSinkTest, MultipleProducers) {
+  auto* target = new CollectingSink();
+  {
+    AsyncLogSink sink(std::unique_ptr<rtc::LogSink>(target), 1 << 16);
+    std::vector<std::thread> producers;
+    for (int t = 0; t < 4; t++) {
+      producers.emplace_back([&sink, t]() {
+        for (int i = 0; i < 10000; i++)
+          sink.OnLogMessage("thread " + std::to_string(t) + "\n");
+      });
+    }
+    for (auto& producer : producers)
+      producer.join();
+    sink.Flush();
+    EXPECT_EQ(40000u, CountLines(target->Text()) + sink.DroppedMessages());
+    EXPECT_EQ(0u, sink.DroppedMessages());
+  }
+}
+
+TEST(AsyncLogSinkTest, DropsAndReportsWhenFull) {
+  auto* target = new CollectingSink(std::chrono::milliseconds(50));
+  AsyncLogSink sink(std::unique_ptr<rtc::LogSink>(target), 16);
+  for (int i = 0; i < 1000; i++)
+    sink.OnLogMessage("message\n");
+  EXPECT_GT(sink.DroppedMessages(), 0u);
+  uint64_t dropped = sink.DroppedMessages();
+  sink.Flush();
+  std::string text = target->Text();
+  size_t delivered = 0;
+  for (size_t pos = text.find("message\n"); pos != std::string::npos;
+       pos = text.find("message\n", pos + 1)) {
+    delivered++;
+  }
+  EXPECT_EQ(1000u - dropped, delivered);
+  EXPECT_NE(std::string::npos, text.find("messages dropped, queue full."));
+}
+}  // namespace base
+}  // namespace owt
@@ -0,0 +1,146 @@
+// Copyright (C) <2026> Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "talk/owt/sdk/base/asyncvideodecoderproxy.h"
+#include "talk/owt/sdk/include/cpp/owt/base/videodecoderinterface.h"
+#include "testing/gtest/include/gtest/gtest.h"
+#include "testing/gmock/include/gmock/gmock.h"
+#include "webrtc/api/video/i420_buffer.h"
+#include "webrtc/api/video/video_frame.h"
+#include "webrtc/api/video_codecs/builtin_video_encoder_factory.h"
+#include "webrtc/api/video_codecs/sdp_video_format.h"
+#include "webrtc/api/video_codecs/video_encoder.h"
+#include "webrtc/media/base/media_constants.h"
+
+namespace owt {
+namespace base {
+namespace {
+constexpr int kWidth = 320;
+constexpr int kHeight = 240;
+constexpr int kFrameCount = 30;
+
+class FrameCollector : public webrtc::EncodedImageCallback {
+ public:
+  Result OnEncodedImage(
+      const webrtc::EncodedImage& encoded_image,
+      const webrtc::CodecSpecificInfo* codec_specific_info) override {
+    // Encoder reuses its output buffer, so keep a copy.
+    webrtc::EncodedImage image(encoded_image);
+    image.SetEncodedData(webrtc::EncodedImageBuffer::Create(
+        encoded_image.data(), encoded_image.size()));
+    images.push_back(image);
+    return Result(Result::OK);
+  }
+  std::vector<webrtc::EncodedImage> images;
+};
+
+// Encodes |kFrameCount| moving gradient frames with the built-in VP8 encoder.
+std::vector<webrtc::EncodedImage> EncodeTestStream() {
+  FrameCollector collector;
+  std::unique_ptr<webrtc::VideoEncoder> encoder =
+      webrtc::CreateBuiltinVideoEncoderFactory()->CreateVideoEncoder(
+          webrtc::SdpVideoFormat(cricket::kVp8CodecName));
+  webrtc::VideoCodec codec;
+  codec.codecType = webrtc::kVideoCodecVP8;
+  codec.width = kWidth;
+  codec.height = kHeight;
+  codec.maxFramerate = 30;
+  codec.startBitrate = 2000;
+  codec.minBitrate = 100;
+  codec.maxBitrate = 4000;
+  *codec.VP8() = webrtc::VideoEncoder::GetDefaultVp8Settings();
+  encoder->InitEncode(&codec,
+                      webrtc::VideoEncoder::Settings(
+                          webrtc::VideoEncoder::Capabilities(false), 4, 0));
+  encoder->RegisterEncodeCompleteCallback(&collector);
+  webrtc::VideoBitrateAllocation allocation;
+  allocation.SetBitrate(0, 0, 2000000);
+  encoder->SetRates(
+      webrtc::VideoEncoder::RateControlParameters(allocation, 30.0));
+  for (int i = 0; i < kFrameCount; i++) {
+    rtc::scoped_refptr<webrtc::I420Buffer> buffer =
+        webrtc::I420Buffer::Create(kWidth, kHeight);
+    for (int y = 0; y < kHeight; y++) {
+      for (int x = 0; x < kWidth; x++) {
+        buffer->MutableDataY()[y * buffer->StrideY() + x] =
+            static_cast<uint8_t>(x + y + i * 4);
+      }
+    }
+    memset(buffer->MutableDataU(), 128,
+           buffer->StrideU() * buffer->ChromaHeight());
+    memset(buffer->MutableDataV(), 128,
+           buffer->StrideV() * buffer->ChromaHeight());
+    webrtc::VideoFrame frame = webrtc::VideoFrame::Builder()
+                                   .set_video_frame_buffer(buffer)
+                                   .set_timestamp_rtp(i * 3000)
+                                   .build();
+    std::vector<webrtc::VideoFrameType> types{
+        i == 0 ? webrtc::VideoFrameType::kVideoFrameKey
+               : webrtc::VideoFrameType::kVideoFrameDelta};
+    encoder->Encode(frame, &types);
+  }
+  encoder->Release();
+  return collector.images;
+}
+
+class CountingDecodedCallback : public webrtc::DecodedImageCallback {
+ public:
+  int32_t Decoded(webrtc::VideoFrame& decoded_image) override {
+    std::lock_guard<std::mutex> lock(mutex);
+    timestamps.push_back(decoded_image.timestamp());
+    cv.notify_all();
+    return 0;
+  }
+  bool WaitFor(size_t count) {
+    std::unique_lock<std::mutex> lock(mutex);
+    return cv.wait_for(lock, std::chrono::seconds(30),
+                       [&] { return timestamps.size() >= count; });
+  }
+  std::mutex mutex;
+  std::condition_variable cv;
+  std::vector<uint32_t> timestamps;
+};
+
+webrtc::VideoDecoder::Settings Vp8Settings(int number_of_cores) {
+  webrtc::VideoDecoder::Settings settings;
+  settings.set_codec_type(webrtc::kVideoCodecVP8);
+  settings.set_number_of_cores(number_of_cores);
+  return settings;
+}
+
+// Decodes |images| with |decoder| and expects all of them back in order.
+void DecodeAll(webrtc::VideoDecoder* decoder,
+               const std::vector<webrtc::EncodedImage>& images) {
+  CountingDecodedCallback callback;
+  decoder->RegisterDecodeCompleteCallback(&callback);
+  for (const auto& image : images) {
+    // A full queue is back pressure here, not loss.
+    while (decoder->Decode(image, false, 0) != WEBRTC_VIDEO_CODEC_OK)
+      std::this_thread::yield();
+  }
+  EXPECT_TRUE(callback.WaitFor(images.size()));
+  std::lock_guard<std::mutex> lock(callback.mutex);
+  ASSERT_EQ(images.size(), callback.timestamps.size());
+  for (size_t i = 0; i < callback.timestamps.size(); i++)
+    EXPECT_EQ(images[i].Timestamp(), callback.timestamps[i]);
+  decoder->Release();
+}
+}  // namespace
+
+TEST(AsyncVideoDecoderTest, ReturnsFramesThroughProxy) {
+  std::vector<webrtc::EncodedImage> images = EncodeTestStream();
+  ASSERT_EQ(static_cast<size_t>(kFrameCount), images.size());
+  AsyncVideoDecoderProxy proxy(
+      webrtc::kVideoCodecVP8,
+      AsyncVideoDecoderInterface::CreateBuiltin(4).release());
+  ASSERT_TRUE(proxy.Configure(Vp8Settings(4)));
+  DecodeAll(&proxy, images);
+}
+}  // namespace base
+}  // namespace owt
@@ -0,0 +1,207 @@
+// Copyright (C) <2026> Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+#include "talk/owt/sdk/base/asyncvideodecoderproxy.h"
+#include <unordered_map>
+#include "libyuv/convert.h"
+#include "talk/owt/sdk/base/nativehandlebuffer.h"
+#include "webrtc/api/make_ref_counted.h"
+#include "webrtc/api/video/i420_buffer.h"
+#include "webrtc/api/video/video_frame.h"
+#include "webrtc/common_video/include/video_frame_buffer.h"
+#include "webrtc/rtc_base/logging.h"
+
+namespace owt {
+namespace base {
+extern std::unordered_map<webrtc::VideoCodecType, owt::base::VideoCodec>
+    video_codec_map;
+namespace {
+// NV12 planes owned by the external decoder. |release| runs on destruction.
+class WrappedNV12Buffer : public NV12BufferInterface {
+ public:
+  WrappedNV12Buffer(int width,
+                    int height,
+                    const uint8_t* y,
+                    int stride_y,
+                    const uint8_t* uv,
+                    int stride_uv,
+                    std::function<void()> release)
+      : width_(width),
+        height_(height),
+        y_(y),
+        stride_y_(stride_y),
+        uv_(uv),
+        stride_uv_(stride_uv),
+        release_(std::move(release)) {}
+  ~WrappedNV12Buffer() override {
+    if (release_)
+      release_();
+  }
+  int width() const override { return width_; }
+  int height() const override { return height_; }
+  const uint8_t* DataY() const override { return y_; }
+  const uint8_t* DataUV() const override { return uv_; }
+  int StrideY() const override { return stride_y_; }
+  int StrideUV() const override { return stride_uv_; }
+  rtc::scoped_refptr<I420BufferInterface> ToI420() override {
+    rtc::scoped_refptr<I420Buffer> i420 = I420Buffer::Create(width_, height_);
+    libyuv::NV12ToI420(y_, stride_y_, uv_, stride_uv_, i420->MutableDataY(),
+                       i420->StrideY(), i420->MutableDataU(), i420->StrideU(),
+                       i420->MutableDataV(), i420->StrideV(), width_, height_);
+    return i420;
+  }
+
+ private:
+  const int width_;
+  const int height_;
+  const uint8_t* y_;
+  const int stride_y_;
+  const uint8_t* uv_;
+  const int stride_uv_;
+  std::function<void()> release_;
+};
+
+class ReleasableNativeHandleBuffer : public NativeHandleBuffer {
+ public:
+  ReleasableNativeHandleBuffer(void* native_handle,
+                               int width,
+                               int height,
+                               std::function<void()> release)
+      : NativeHandleBuffer(native_handle, width, height),
+        release_(std::move(release)) {}
+  ~ReleasableNativeHandleBuffer() override {
+    if (release_)
+      release_();
+  }
+
+ private:
+  std::function<void()> release_;
+};
+
+rtc::scoped_refptr<VideoFrameBuffer> WrapDecodedFrame(
+    VideoDecodedFrame& frame) {
+  switch (frame.format) {
+    case VideoDecodedFrameFormat::kI420:
+      return WrapI420Buffer(frame.width, frame.height, frame.planes[0],
+                            frame.strides[0], frame.planes[1], frame.strides[1],
+                            frame.planes[2], frame.strides[2],
+                            std::move(frame.release));
+    case VideoDecodedFrameFormat::kNV12:
+      return rtc::make_ref_counted<WrappedNV12Buffer>(
+          frame.width, frame.height, frame.planes[0], frame.strides[0],
+          frame.planes[1], frame.strides[1], std::move(frame.release));
+    case VideoDecodedFrameFormat::kNative:
+      return rtc::make_ref_counted<ReleasableNativeHandleBuffer>(
+          frame.native_handle, frame.width, frame.height,
+          std::move(frame.release));
+  }
+  return nullptr;
+}
+}  // namespace
+
+AsyncVideoDecoderProxy::AsyncVideoDecoderProxy(
+    VideoCodecType type,
+    AsyncVideoDecoderInterface* external_video_decoder)
+    : codec_type_(type),
+      external_decoder_(external_video_decoder),
+      decoded_image_callback_(nullptr) {}
+
+AsyncVideoDecoderProxy::~AsyncVideoDecoderProxy() {
+  Release();
+}
+
+bool AsyncVideoDecoderProxy::Configure(const Settings& codec_settings) {
+  RTC_CHECK(codec_settings.codec_type() == codec_type_)
+      << "Unsupported codec type" << codec_settings.codec_type() << " for "
+      << codec_type_;
+  RTC_DCHECK(video_codec_map.contains(codec_type_));
+  return external_decoder_ &&
+         external_decoder_->InitDecodeContext(
+             video_codec_map[codec_type_], codec_settings.number_of_cores(),
+             this);
+}
+
+int32_t AsyncVideoDecoderProxy::Decode(const EncodedImage& input_image,
+                                       bool missing_frames,
+                                       int64_t render_time_ms) {
+  if (!decoded_image_callback_ || !external_decoder_) {
+    return WEBRTC_VIDEO_CODEC_UNINITIALIZED;
+  }
+  if (!input_image.data() || !input_image.size()) {
+    return WEBRTC_VIDEO_CODEC_ERR_PARAMETER;
+  }
+  // Share the reference counted bitstream with the decoder. Images that do not
+  // own their buffer are copied once.
+  rtc::scoped_refptr<EncodedImageBufferInterface> encoded_data =
+      input_image.GetEncodedData();
+  if (!encoded_data) {
+    encoded_data =
+        EncodedImageBuffer::Create(input_image.data(), input_image.size());
+  }
+  std::unique_ptr<VideoEncodedFrame> frame(new VideoEncodedFrame{
+      encoded_data->data(), input_image.size(), input_image.Timestamp(),
+      input_image._frameType == webrtc::VideoFrameType::kVideoFrameKey});
+  frame->buffer_holder = std::shared_ptr<const void>(
+      encoded_data->data(), [encoded_data](const void*) {});
+  // A rejected frame breaks the reference chain. Returning an error makes
+  // WebRTC request a key frame.
+  if (!external_decoder_->Decode(std::move(frame))) {
+    RTC_LOG(LS_WARNING) << "Async decoder rejected frame "
+                        << input_image.Timestamp();
+    return WEBRTC_VIDEO_CODEC_ERROR;
+  }
+  return WEBRTC_VIDEO_CODEC_OK;
+}
+
+int32_t AsyncVideoDecoderProxy::RegisterDecodeCompleteCallback(
+    DecodedImageCallback* callback) {
+  std::lock_guard<std::mutex> lock(callback_mutex_);
+  decoded_image_callback_ = callback;
+  return WEBRTC_VIDEO_CODEC_OK;
+}
+
+int32_t AsyncVideoDecoderProxy::Release() {
+  bool released = external_decoder_ ? external_decoder_->Release() : true;
+  // Frames still in flight are dropped after this point.
+  std::lock_guard<std::mutex> lock(callback_mutex_);
+  decoded_image_callback_ = nullptr;
+  return released ? WEBRTC_VIDEO_CODEC_OK : WEBRTC_VIDEO_CODEC_ERROR;
+}
+
+const char* AsyncVideoDecoderProxy::ImplementationName() const {
+  return "AsyncCustomizedDecoder";
+}
+
+void AsyncVideoDecoderProxy::OnFrameDecoded(
+    std::unique_ptr<VideoDecodedFrame> frame) {
+  if (!frame)
+    return;
+  const uint32_t time_stamp = frame->time_stamp;
+  const int decode_time_ms = frame->decode_time_ms;
+  rtc::scoped_refptr<VideoFrameBuffer> buffer = WrapDecodedFrame(*frame);
+  if (!buffer)
+    return;
+  VideoFrame video_frame = VideoFrame::Builder()
+                               .set_video_frame_buffer(buffer)
+                               .set_timestamp_rtp(time_stamp)
+                               .set_timestamp_ms(0)
+                               .set_rotation(kVideoRotation_0)
+                               .build();
+  std::lock_guard<std::mutex> lock(callback_mutex_);
+  if (!decoded_image_callback_)
+    return;
+  decoded_image_callback_->Decoded(
+      video_frame,
+      decode_time_ms >= 0 ? absl::optional<int32_t>(decode_time_ms)
+                          : absl::nullopt,
+      absl::nullopt);
+}
+
+std::unique_ptr<AsyncVideoDecoderProxy> AsyncVideoDecoderProxy::Create(
+    VideoCodecType type,
+    AsyncVideoDecoderInterface* external_video_decoder) {
+  return std::make_unique<AsyncVideoDecoderProxy>(type,
+                                                  external_video_decoder);
+}
+}  // namespace base
+}  // namespace owt
@@ -0,0 +1,49 @@
+// Copyright (C) <2026> Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef OWT_BASE_ASYNCVIDEODECODERPROXY_H_
+#define OWT_BASE_ASYNCVIDEODECODERPROXY_H_
+
+#include <memory>
+#include <mutex>
+#include "webrtc/modules/video_coding/include/video_codec_interface.h"
+#include "talk/owt/sdk/include/cpp/owt/base/videodecoderinterface.h"
+
+namespace owt {
+namespace base {
+using namespace webrtc;
+// Adapts an AsyncVideoDecoderInterface to webrtc::VideoDecoder. Encoded
+// buffers are shared with the external decoder instead of copied, and frames
+// returned by the external decoder are wrapped, not copied, before they are
+// handed to WebRTC's decode complete callback.
+class AsyncVideoDecoderProxy : public VideoDecoder,
+                               public VideoDecodeCompleteCallback {
+ public:
+  static std::unique_ptr<AsyncVideoDecoderProxy> Create(
+      VideoCodecType type,
+      AsyncVideoDecoderInterface* external_video_decoder);
+  AsyncVideoDecoderProxy(VideoCodecType type,
+                         AsyncVideoDecoderInterface* external_video_decoder);
+  ~AsyncVideoDecoderProxy() override;
+  bool Configure(const Settings& settings) override;
+  int32_t Decode(const EncodedImage& input,
+                 bool missing_frames,
+                 int64_t render_time_ms) override;
+  int32_t RegisterDecodeCompleteCallback(
+      DecodedImageCallback* callback) override;
+  int32_t Release() override;
+  const char* ImplementationName() const override;
+  // Implements VideoDecodeCompleteCallback. Called on decoder's thread.
+  void OnFrameDecoded(std::unique_ptr<VideoDecodedFrame> frame) override;
+
+ private:
+  VideoCodecType codec_type_;
+  std::unique_ptr<AsyncVideoDecoderInterface> external_decoder_;
+  // Guards |decoded_image_callback_| against decoder threads.
+  std::mutex callback_mutex_;
+  DecodedImageCallback* decoded_image_callback_;
+};
+
+}  // namespace base
+}  // namespace owt
+#endif  // OWT_BASE_ASYNCVIDEODECODERPROXY_H_
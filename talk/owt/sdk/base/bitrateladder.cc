@@ -0,0 +1,93 @@
+// Copyright (C) <2026> Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "talk/owt/sdk/base/bitrateladder.h"
+
+namespace owt {
+namespace base {
+BitrateLadder::BitrateLadder() : BitrateLadder(Config()) {}
+
+BitrateLadder::BitrateLadder(const Config& config) : config_(config) {}
+
+int BitrateLadder::AddRendition(uint32_t bitrate_kbps) {
+  bitrates_kbps_.push_back(bitrate_kbps);
+  // Until the first rate update, start with the smallest rendition.
+  if (!rate_known_)
+    target_ = Fitting(0);
+  return static_cast<int>(bitrates_kbps_.size()) - 1;
+}
+
+void BitrateLadder::OnRateUpdate(uint64_t bitrate_bps, int64_t now_ms) {
+  if (bitrates_kbps_.empty())
+    return;
+  rate_known_ = true;
+  const double kbps = bitrate_bps / 1000.0;
+  const int fitting = Fitting(kbps);
+  if (bitrates_kbps_[fitting] < bitrates_kbps_[target_]) {
+    target_ = fitting;
+    upswitch_since_ms_ = -1;
+    return;
+  }
+  const int larger = Fitting(kbps / config_.upswitch_headroom);
+  if (bitrates_kbps_[larger] <= bitrates_kbps_[target_]) {
+    upswitch_since_ms_ = -1;
+    return;
+  }
+  if (upswitch_since_ms_ < 0)
+    upswitch_since_ms_ = now_ms;
+  if (now_ms - upswitch_since_ms_ >= config_.upswitch_hold_ms) {
+    target_ = larger;
+    upswitch_since_ms_ = -1;
+  }
+}
+
+void BitrateLadder::OnKeyFrameRequest() {
+  key_frame_needed_ = true;
+}
+
+bool BitrateLadder::OnFrame(int rendition,
+                            bool key_frame,
+                            bool last_fragment,
+                            uint16_t* picture_id) {
+  if (rendition < 0 || rendition >= static_cast<int>(bitrates_kbps_.size()))
+    return false;
+  if (in_frame_) {
+    // Finish the frame being sent before switching.
+    if (rendition != current_)
+      return false;
+    in_frame_ = !last_fragment;
+    *picture_id = picture_id_;
+    return true;
+  }
+  if (key_frame && rendition != current_ &&
+      (rendition == target_ ||
+       (key_frame_needed_ &&
+        bitrates_kbps_[rendition] <= bitrates_kbps_[target_]))) {
+    current_ = rendition;
+  }
+  if (rendition != current_)
+    return false;
+  if (key_frame)
+    key_frame_needed_ = false;
+  picture_id_ = (picture_id_ + 1) & 0x7FFF;
+  *picture_id = picture_id_;
+  in_frame_ = !last_fragment;
+  return true;
+}
+
+int BitrateLadder::Fitting(double bitrate_kbps) const {
+  int fitting = -1;
+  int smallest = 0;
+  for (int i = 0; i < static_cast<int>(bitrates_kbps_.size()); i++) {
+    if (bitrates_kbps_[i] < bitrates_kbps_[smallest])
+      smallest = i;
+    if (bitrates_kbps_[i] <= bitrate_kbps &&
+        (fitting < 0 || bitrates_kbps_[i] > bitrates_kbps_[fitting])) {
+      fitting = i;
+    }
+  }
+  return fitting >= 0 ? fitting : smallest;
+}
+}  // namespace base
+}  // namespace owt
@@ -0,0 +1,69 @@
+// Copyright (C) <2026> Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef OWT_BASE_BITRATELADDER_H_
+#define OWT_BASE_BITRATELADDER_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace owt {
+namespace base {
+// Selects which of several renditions of the same pre-encoded content is
+// sent, following the target bitrate of webrtc's bandwidth estimation.
+//
+// Frames of every rendition are passed to OnFrame(), which forwards those of
+// the current rendition. A switch only takes effect on a key frame of the new
+// rendition, and never in the middle of a frame sent in fragments. Forwarded
+// frames get consecutive picture IDs, so the receiver sees one stream.
+//
+// A lower target bitrate switches down at the next key frame. A higher one
+// switches up only after it leaves |upswitch_headroom| over the next
+// rendition's bitrate for |upswitch_hold_ms|.
+class BitrateLadder {
+ public:
+  struct Config {
+    double upswitch_headroom = 1.15;
+    int64_t upswitch_hold_ms = 5000;
+  };
+  BitrateLadder();
+  explicit BitrateLadder(const Config& config);
+  // Returns the index of the new rendition.
+  int AddRendition(uint32_t bitrate_kbps);
+  size_t size() const { return bitrates_kbps_.size(); }
+  // Rendition being sent, -1 before the first key frame.
+  int current() const { return current_; }
+  // Rendition to switch to at its next key frame.
+  int target() const { return target_; }
+  void OnRateUpdate(uint64_t bitrate_bps, int64_t now_ms);
+  // The receiver needs a key frame. The first key frame of the current
+  // rendition, or of a rendition no larger than the target, is sent.
+  void OnKeyFrameRequest();
+  // Returns true if the frame should be sent, and sets |picture_id| to the
+  // picture ID to send it with.
+  bool OnFrame(int rendition,
+               bool key_frame,
+               bool last_fragment,
+               uint16_t* picture_id);
+
+ private:
+  // Largest rendition that fits |bitrate_kbps|, or the smallest one.
+  int Fitting(double bitrate_kbps) const;
+
+  const Config config_;
+  std::vector<uint32_t> bitrates_kbps_;
+  int current_ = -1;
+  int target_ = -1;
+  bool rate_known_ = false;
+  // Start of the period the rate allowed a larger rendition, -1 if none.
+  int64_t upswitch_since_ms_ = -1;
+  bool key_frame_needed_ = false;
+  // A fragmented frame of the current rendition is being sent.
+  bool in_frame_ = false;
+  uint16_t picture_id_ = 0;
+};
+}  // namespace base
+}  // namespace owt
+#endif  // OWT_BASE_BITRATELADDER_H_
@@ -0,0 +1,97 @@
+// Copyright (C) <2026> Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+#include "talk/owt/sdk/base/bitrateladder.h"
+#include "testing/gtest/include/gtest/gtest.h"
+namespace owt {
+namespace base {
+namespace {
+class BitrateLadderTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    high_ = ladder_.AddRendition(4000);
+    low_ = ladder_.AddRendition(500);
+    mid_ = ladder_.AddRendition(1500);
+  }
+  // Sends one frame of every rendition and returns the last one forwarded, -1
+  // if none is. Two are forwarded when the ladder switches to a rendition sent
+  // after the current one.
+  int SendFrames(bool key_frame) {
+    int sent = -1;
+    for (int rendition : {high_, low_, mid_}) {
+      uint16_t picture_id = 0;
+      if (ladder_.OnFrame(rendition, key_frame, true, &picture_id)) {
+        EXPECT_EQ(static_cast<uint16_t>(last_picture_id_ + 1), picture_id);
+        last_picture_id_ = picture_id;
+        sent = rendition;
+      }
+    }
+    return sent;
+  }
+
+  BitrateLadder ladder_;
+  int high_;
+  int low_;
+  int mid_;
+  uint16_t last_picture_id_ = 0;
+};
+}  // namespace
+
+TEST_F(BitrateLadderTest, StartsWithSmallestRenditionAtKeyFrame) {
+  EXPECT_EQ(-1, SendFrames(false));
+  EXPECT_EQ(low_, SendFrames(true));
+  EXPECT_EQ(low_, SendFrames(false));
+  EXPECT_EQ(low_, ladder_.current());
+}
+
+TEST_F(BitrateLadderTest, SwitchesUpAfterHoldAndDownImmediately) {
+  SendFrames(true);
+  ladder_.OnRateUpdate(2000000, 0);
+  ladder_.OnRateUpdate(2000000, 4000);
+  EXPECT_EQ(low_, ladder_.target());
+  ladder_.OnRateUpdate(2000000, 5000);
+  EXPECT_EQ(mid_, ladder_.target());
+  // The switch waits for a key frame.
+  EXPECT_EQ(low_, SendFrames(false));
+  EXPECT_EQ(mid_, SendFrames(true));
+  // Not enough headroom for the next rendition.
+  ladder_.OnRateUpdate(4200000, 6000);
+  ladder_.OnRateUpdate(4200000, 20000);
+  EXPECT_EQ(mid_, ladder_.target());
+
+  ladder_.OnRateUpdate(1000000, 21000);
+  EXPECT_EQ(low_, ladder_.target());
+  EXPECT_EQ(mid_, SendFrames(false));
+  EXPECT_EQ(low_, SendFrames(true));
+}
+
+TEST_F(BitrateLadderTest, KeyFrameRequestTakesFirstFittingKeyFrame) {
+  ladder_.OnRateUpdate(8000000, 0);
+  ladder_.OnRateUpdate(8000000, 5000);
+  EXPECT_EQ(high_, ladder_.target());
+  SendFrames(true);
+  ladder_.OnKeyFrameRequest();
+  uint16_t picture_id;
+  // A key frame of a smaller rendition answers the request.
+  EXPECT_TRUE(ladder_.OnFrame(low_, true, true, &picture_id));
+  EXPECT_EQ(low_, ladder_.current());
+  // Later key frames of smaller renditions do not.
+  EXPECT_FALSE(ladder_.OnFrame(mid_, true, true, &picture_id));
+  EXPECT_TRUE(ladder_.OnFrame(high_, true, true, &picture_id));
+  EXPECT_EQ(high_, ladder_.current());
+}
+
+TEST_F(BitrateLadderTest, DoesNotSwitchInsideFragmentedFrame) {
+  SendFrames(true);
+  ladder_.OnRateUpdate(100000000, 0);
+  ladder_.OnRateUpdate(100000000, 5000);
+  uint16_t first, second;
+  EXPECT_TRUE(ladder_.OnFrame(low_, false, false, &first));
+  EXPECT_FALSE(ladder_.OnFrame(high_, true, true, &second));
+  EXPECT_TRUE(ladder_.OnFrame(low_, false, true, &second));
+  EXPECT_EQ(first, second);
+  EXPECT_TRUE(ladder_.OnFrame(high_, true, true, &second));
+  EXPECT_EQ(first + 1, second);
+}
+}  // namespace base
+}  // namespace owt
@@ -0,0 +1,315 @@
+// Copyright (C) <2026> Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "talk/owt/sdk/base/bitstreamdumpwriter.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+#include "owt/base/globalconfiguration.h"
+#include "webrtc/rtc_base/logging.h"
+#include "webrtc/rtc_base/time_utils.h"
+
+namespace owt {
+namespace base {
+static const size_t kIvfFileHeaderSize = 32;
+static const size_t kIvfFrameHeaderSize = 12;
+static const size_t kDefaultMaxQueuedBytes = 16 * 1024 * 1024;
+// A VP9 superframe holds at most 8 frames.
+static const size_t kMaxVp9SuperframeFrames = 8;
+
+static void WriteLe16(uint8_t* out, uint16_t value) {
+  out[0] = value & 0xff;
+  out[1] = (value >> 8) & 0xff;
+}
+
+static void WriteLe32(uint8_t* out, uint32_t value) {
+  for (int i = 0; i < 4; i++)
+    out[i] = (value >> (8 * i)) & 0xff;
+}
+
+static void WriteLe64(uint8_t* out, uint64_t value) {
+  for (int i = 0; i < 8; i++)
+    out[i] = (value >> (8 * i)) & 0xff;
+}
+
+// IVF FourCC, or nullptr for codecs dumped as Annex-B.
+static const char* IvfFourCc(webrtc::VideoCodecType codec) {
+  switch (codec) {
+    case webrtc::kVideoCodecVP8:
+      return "VP80";
+    case webrtc::kVideoCodecVP9:
+      return "VP90";
+    case webrtc::kVideoCodecAV1:
+      return "AV01";
+    default:
+      return nullptr;
+  }
+}
+
+static const char* FileExtension(webrtc::VideoCodecType codec) {
+  switch (codec) {
+    case webrtc::kVideoCodecH264:
+      return ".h264";
+#ifdef WEBRTC_USE_H265
+    case webrtc::kVideoCodecH265:
+      return ".h265";
+#endif
+    default:
+      return IvfFourCc(codec) ? ".ivf" : ".bin";
+  }
+}
+
+// File of one dump stream. Only touched on the writer thread, and closed
+// there once the stream and all its queued frames are gone.
+// IVF frames hold one picture. Spatial layers of an SVC picture arrive as
+// separate images with the same RTP timestamp, so they are collected and
+// written together: AV1 layers are plain OBU sequences and are concatenated
+// into one temporal unit, VP9 layers get a superframe index.
+class BitstreamDumpFile {
+ public:
+  BitstreamDumpFile(const std::string& path, webrtc::VideoCodecType codec)
+      : path_(path),
+        fourcc_(IvfFourCc(codec)),
+        vp9_(codec == webrtc::kVideoCodecVP9) {}
+  ~BitstreamDumpFile() {
+    if (!file_)
+      return;
+    if (fourcc_) {
+      WritePicture();
+      // The first picture may only have had its lowest spatial layer.
+      uint8_t size[4];
+      WriteLe16(size, static_cast<uint16_t>(max_width_));
+      WriteLe16(size + 2, static_cast<uint16_t>(max_height_));
+      fseek(file_, 12, SEEK_SET);
+      fwrite(size, 1, sizeof(size), file_);
+      uint8_t count[4];
+      WriteLe32(count, frame_count_);
+      fseek(file_, 24, SEEK_SET);
+      fwrite(count, 1, sizeof(count), file_);
+    }
+    fclose(file_);
+  }
+
+  void Write(const webrtc::EncodedImage& image) {
+    if (!file_ && !Open(image))
+      return;
+    if (!fourcc_) {
+      fwrite(image.data(), 1, image.size(), file_);
+      return;
+    }
+    if (!layer_sizes_.empty() && image.Timestamp() != picture_timestamp_)
+      WritePicture();
+    if (vp9_ && layer_sizes_.size() == kMaxVp9SuperframeFrames) {
+      RTC_LOG(LS_WARNING) << "Too many VP9 layers in one picture for "
+                          << path_;
+      return;
+    }
+    picture_timestamp_ = image.Timestamp();
+    picture_.insert(picture_.end(), image.data(), image.data() + image.size());
+    layer_sizes_.push_back(image.size());
+    max_width_ = std::max(max_width_, image._encodedWidth);
+    max_height_ = std::max(max_height_, image._encodedHeight);
+  }
+
+ private:
+  // Writes the layers collected for the current picture as one IVF frame.
+  void WritePicture() {
+    if (layer_sizes_.empty())
+      return;
+    if (vp9_ && layer_sizes_.size() > 1)
+      AppendVp9SuperframeIndex();
+    if (last_rtp_timestamp_ >= 0) {
+      unwrapped_rtp_timestamp_ += static_cast<int32_t>(
+          picture_timestamp_ - static_cast<uint32_t>(last_rtp_timestamp_));
+    }
+    last_rtp_timestamp_ = picture_timestamp_;
+    uint8_t header[kIvfFrameHeaderSize];
+    WriteLe32(header, static_cast<uint32_t>(picture_.size()));
+    WriteLe64(header + 4, static_cast<uint64_t>(unwrapped_rtp_timestamp_));
+    fwrite(header, 1, sizeof(header), file_);
+    fwrite(picture_.data(), 1, picture_.size(), file_);
+    frame_count_++;
+    picture_.clear();
+    layer_sizes_.clear();
+  }
+
+  // VP9 spec, Annex B: marker, little-endian frame sizes, marker.
+  void AppendVp9SuperframeIndex() {
+    size_t max_size =
+        *std::max_element(layer_sizes_.begin(), layer_sizes_.end());
+    uint8_t size_bytes = 1;
+    while (size_bytes < 4 && (max_size >> (8 * size_bytes)) > 0)
+      size_bytes++;
+    uint8_t marker = 0xc0 | ((size_bytes - 1) << 3) |
+                     static_cast<uint8_t>(layer_sizes_.size() - 1);
+    picture_.push_back(marker);
+    for (size_t size : layer_sizes_) {
+      for (uint8_t i = 0; i < size_bytes; i++)
+        picture_.push_back((size >> (8 * i)) & 0xff);
+    }
+    picture_.push_back(marker);
+  }
+
+  bool Open(const webrtc::EncodedImage& image) {
+    if (failed_)
+      return false;
+    file_ = fopen(path_.c_str(), "wb");
+    if (!file_) {
+      RTC_LOG(LS_ERROR) << "Failed to open dump file " << path_;
+      failed_ = true;
+      return false;
+    }
+    if (fourcc_) {
+      uint8_t header[kIvfFileHeaderSize] = {'D', 'K', 'I', 'F'};
+      WriteLe16(header + 4, 0);
+      WriteLe16(header + 6, kIvfFileHeaderSize);
+      memcpy(header + 8, fourcc_, 4);
+      WriteLe16(header + 12, static_cast<uint16_t>(image._encodedWidth));
+      WriteLe16(header + 14, static_cast<uint16_t>(image._encodedHeight));
+      // Time base is the 90 kHz RTP clock.
+      WriteLe32(header + 16, 90000);
+      WriteLe32(header + 20, 1);
+      fwrite(header, 1, sizeof(header), file_);
+    }
+    return true;
+  }
+
+  const std::string path_;
+  const char* const fourcc_;
+  const bool vp9_;
+  FILE* file_ = nullptr;
+  bool failed_ = false;
+  uint32_t frame_count_ = 0;
+  uint32_t max_width_ = 0;
+  uint32_t max_height_ = 0;
+  // Layers of the picture not written yet, and their sizes.
+  std::vector<uint8_t> picture_;
+  std::vector<size_t> layer_sizes_;
+  uint32_t picture_timestamp_ = 0;
+  int64_t last_rtp_timestamp_ = -1;
+  int64_t unwrapped_rtp_timestamp_ = 0;
+};
+
+BitstreamDumpStream::BitstreamDumpStream(
+    BitstreamDumpWriter* writer,
+    std::shared_ptr<BitstreamDumpFile> file)
+    : writer_(writer), file_(std::move(file)) {}
+
+BitstreamDumpStream::~BitstreamDumpStream() {
+  writer_->Enqueue({std::move(file_), absl::nullopt});
+}
+
+void BitstreamDumpStream::Write(const webrtc::EncodedImage& image) {
+  bool key_frame = image._frameType == webrtc::VideoFrameType::kVideoFrameKey;
+  if (waiting_for_key_frame_ && !key_frame)
+    return;
+  waiting_for_key_frame_ = !writer_->Enqueue({file_, image});
+}
+
+BitstreamDumpWriter* BitstreamDumpWriter::Get() {
+  static BitstreamDumpWriter* writer = [] {
+    std::string directory = GlobalConfiguration::GetBitstreamDumpDirectory();
+    size_t max_queued_bytes =
+        GlobalConfiguration::GetBitstreamDumpMaxQueuedBytes();
+    return new BitstreamDumpWriter(
+        directory.empty() ? "." : directory,
+        max_queued_bytes ? max_queued_bytes : kDefaultMaxQueuedBytes);
+  }();
+  return writer;
+}
+
+bool BitstreamDumpWriter::PreDecodeDumpEnabled() {
+  return GlobalConfiguration::GetPreDecodeDumpEnabled();
+}
+
+bool BitstreamDumpWriter::PostEncodeDumpEnabled() {
+  return GlobalConfiguration::GetPostEncodeDumpEnabled();
+}
+
+BitstreamDumpWriter::BitstreamDumpWriter(const std::string& directory,
+                                         size_t max_queued_bytes)
+    : directory_(directory), max_queued_bytes_(max_queued_bytes) {
+  writer_ = rtc::PlatformThread::SpawnJoinable(
+      [this] { WriterLoop(); }, "OwtBitstreamDumpWriter",
+      rtc::ThreadAttributes().SetPriority(rtc::ThreadPriority::kLow));
+}
+
+BitstreamDumpWriter::~BitstreamDumpWriter() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    running_ = false;
+  }
+  wake_.Set();
+  writer_.Finalize();
+}
+
+std::unique_ptr<BitstreamDumpStream> BitstreamDumpWriter::CreateStream(
+    const std::string& direction,
+    webrtc::VideoCodecType codec) {
+  std::string path = directory_ + "/" + direction + "_" +
+                     std::to_string(rtc::TimeUTCMillis()) + "_" +
+                     std::to_string(next_stream_id_++) + FileExtension(codec);
+  RTC_LOG(LS_INFO) << "Dumping bitstream to " << path;
+  return std::unique_ptr<BitstreamDumpStream>(new BitstreamDumpStream(
+      this, std::make_shared<BitstreamDumpFile>(path, codec)));
+}
+
+bool BitstreamDumpWriter::Enqueue(Task task) {
+  size_t size = task.image ? task.image->size() : 0;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (size > 0 && queued_bytes_ + size > max_queued_bytes_) {
+      dropped_frames_.fetch_add(1, std::memory_order_relaxed);
+      return false;
+    }
+    queued_bytes_ += size;
+    enqueued_++;
+    tasks_.push_back(std::move(task));
+  }
+  wake_.Set();
+  return true;
+}
+
+void BitstreamDumpWriter::Flush() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  uint64_t target = enqueued_;
+  written_cv_.wait(lock, [this, target] { return written_ >= target; });
+}
+
+void BitstreamDumpWriter::WriterLoop() {
+  for (;;) {
+    Task task;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (tasks_.empty()) {
+        if (!running_)
+          return;
+      } else {
+        task = std::move(tasks_.front());
+        tasks_.pop_front();
+      }
+    }
+    if (!task.file) {
+      wake_.Wait(rtc::Event::kForever);
+      continue;
+    }
+    size_t size = 0;
+    if (task.image) {
+      task.file->Write(*task.image);
+      size = task.image->size();
+    }
+    // Releases the encoded buffer, and closes the file if this was the last
+    // reference, before the task counts as written.
+    task = Task();
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      queued_bytes_ -= size;
+      written_++;
+    }
+    written_cv_.notify_all();
+  }
+}
+}  // namespace base
+}  // namespace owt
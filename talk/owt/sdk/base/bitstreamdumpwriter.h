@@ -0,0 +1,93 @@
+// Copyright (C) <2026> Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef OWT_BASE_BITSTREAMDUMPWRITER_H_
+#define OWT_BASE_BITSTREAMDUMPWRITER_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include "absl/types/optional.h"
+#include "webrtc/api/video/encoded_image.h"
+#include "webrtc/api/video/video_codec_type.h"
+#include "webrtc/rtc_base/event.h"
+#include "webrtc/rtc_base/platform_thread.h"
+
+namespace owt {
+namespace base {
+class BitstreamDumpWriter;
+class BitstreamDumpFile;
+
+// Dump of one encoded stream. VP8, VP9 and AV1 are written as IVF, H.264 and
+// H.265 as Annex-B elementary streams. Write() only queues a reference to the
+// encoded buffer; the file is written and closed by the writer thread.
+class BitstreamDumpStream {
+ public:
+  ~BitstreamDumpStream();
+  // Queues |image| unless the writer's byte budget is exhausted. After a drop
+  // frames are skipped until the next key frame, so the dump stays decodable.
+  void Write(const webrtc::EncodedImage& image);
+
+ private:
+  friend class BitstreamDumpWriter;
+  BitstreamDumpStream(BitstreamDumpWriter* writer,
+                      std::shared_ptr<BitstreamDumpFile> file);
+  BitstreamDumpWriter* const writer_;
+  std::shared_ptr<BitstreamDumpFile> file_;
+  bool waiting_for_key_frame_ = true;
+};
+
+// Background writer shared by all dump streams. Queued bytes are bounded, so
+// a slow disk drops dump frames instead of stalling encoders and decoders.
+class BitstreamDumpWriter {
+ public:
+  // Writer configured from GlobalConfiguration. Never destroyed.
+  static BitstreamDumpWriter* Get();
+  static bool PreDecodeDumpEnabled();
+  static bool PostEncodeDumpEnabled();
+  BitstreamDumpWriter(const std::string& directory, size_t max_queued_bytes);
+  // Writes everything queued and closes all files. Streams must be destroyed
+  // before their writer.
+  ~BitstreamDumpWriter();
+  // |direction| is part of the file name, e.g. "send" or "recv".
+  std::unique_ptr<BitstreamDumpStream> CreateStream(
+      const std::string& direction,
+      webrtc::VideoCodecType codec);
+  // Blocks until frames queued before the call are written.
+  void Flush();
+  uint64_t DroppedFrames() const {
+    return dropped_frames_.load(std::memory_order_relaxed);
+  }
+
+ private:
+  friend class BitstreamDumpStream;
+  struct Task {
+    std::shared_ptr<BitstreamDumpFile> file;
+    // Holds a reference to the encoder's or depacketizer's buffer. Tasks
+    // without image only release |file|, closing it on the writer thread.
+    absl::optional<webrtc::EncodedImage> image;
+  };
+  bool Enqueue(Task task);
+  void WriterLoop();
+
+  const std::string directory_;
+  const size_t max_queued_bytes_;
+  std::atomic<int> next_stream_id_{0};
+  std::atomic<uint64_t> dropped_frames_{0};
+  std::mutex mutex_;
+  std::deque<Task> tasks_;
+  size_t queued_bytes_ = 0;
+  uint64_t enqueued_ = 0;
+  uint64_t written_ = 0;
+  bool running_ = true;
+  rtc::Event wake_;
+  std::condition_variable written_cv_;
+  rtc::PlatformThread writer_;
+};
+}  // namespace base
+}  // namespace owt
+#endif  // OWT_BASE_BITSTREAMDUMPWRITER_H_
@@ -0,0 +1,171 @@
+// Copyright (C) <2026> Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+#include <chrono>
+#include <cstdio>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "talk/owt/sdk/base/bitstreamdumpwriter.h"
+#include "testing/gtest/include/gtest/gtest.h"
+#include "webrtc/test/testsupport/file_utils.h"
+namespace owt {
+namespace base {
+namespace {
+webrtc::EncodedImage Image(size_t size, bool key_frame, uint32_t timestamp) {
+  webrtc::EncodedImage image;
+  image.SetEncodedData(webrtc::EncodedImageBuffer::Create(size));
+  memset(image.GetEncodedData()->data(), key_frame ? 0xaa : 0x55, size);
+  image._frameType = key_frame ? webrtc::VideoFrameType::kVideoFrameKey
+                               : webrtc::VideoFrameType::kVideoFrameDelta;
+  image._encodedWidth = 320;
+  image._encodedHeight = 240;
+  image.SetTimestamp(timestamp);
+  return image;
+}
+
+uint32_t ReadLe32(const uint8_t* data) {
+  return data[0] | (data[1] << 8) | (data[2] << 16) |
+         (static_cast<uint32_t>(data[3]) << 24);
+}
+
+class BitstreamDumpWriterTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    directory_ =
+        webrtc::test::OutputPath() + "owt_bitstream_dump_" +
+        ::testing::UnitTest::GetInstance()->current_test_info()->name();
+    ASSERT_TRUE(webrtc::test::CreateDir(directory_));
+  }
+  void TearDown() override {
+    for (const std::string& file : Files())
+      webrtc::test::RemoveFile(file);
+    webrtc::test::RemoveDir(directory_);
+  }
+  std::vector<std::string> Files() {
+    return webrtc::test::ReadDirectory(directory_)
+        .value_or(std::vector<std::string>());
+  }
+  std::vector<uint8_t> ReadOnlyFile() {
+    std::vector<std::string> files = Files();
+    EXPECT_EQ(1u, files.size());
+    std::vector<uint8_t> content;
+    if (files.size() != 1)
+      return content;
+    FILE* file = fopen(files[0].c_str(), "rb");
+    uint8_t buffer[4096];
+    size_t read;
+    while ((read = fread(buffer, 1, sizeof(buffer), file)) > 0)
+      content.insert(content.end(), buffer, buffer + read);
+    fclose(file);
+    return content;
+  }
+  std::string directory_;
+};
+}  // namespace
+
+TEST_F(BitstreamDumpWriterTest, WritesIvfStartingAtKeyFrame) {
+  BitstreamDumpWriter writer(directory_, 1024 * 1024);
+  auto stream = writer.CreateStream("send", webrtc::kVideoCodecVP8);
+  stream->Write(Image(10, false, 0));
+  stream->Write(Image(100, true, 3000));
+  stream->Write(Image(20, false, 6000));
+  stream.reset();
+  writer.Flush();
+  std::vector<uint8_t> ivf = ReadOnlyFile();
+  ASSERT_EQ(32u + 12 + 100 + 12 + 20, ivf.size());
+  EXPECT_EQ(0, memcmp(ivf.data(), "DKIF", 4));
+  EXPECT_EQ(0, memcmp(ivf.data() + 8, "VP80", 4));
+  EXPECT_EQ(320, ivf[12] | (ivf[13] << 8));
+  EXPECT_EQ(240, ivf[14] | (ivf[15] << 8));
+  EXPECT_EQ(2u, ReadLe32(&ivf[24]));
+  EXPECT_EQ(100u, ReadLe32(&ivf[32]));
+  EXPECT_EQ(0xaa, ivf[44]);
+  EXPECT_EQ(20u, ReadLe32(&ivf[144]));
+  // Timestamps are relative to the first written frame.
+  EXPECT_EQ(3000u, ReadLe32(&ivf[148]));
+  EXPECT_EQ(0u, writer.DroppedFrames());
+}
+
+TEST_F(BitstreamDumpWriterTest, WritesH264AsAnnexB) {
+  BitstreamDumpWriter writer(directory_, 1024 * 1024);
+  auto stream = writer.CreateStream("recv", webrtc::kVideoCodecH264);
+  stream->Write(Image(50, true, 0));
+  stream->Write(Image(30, false, 3000));
+  stream.reset();
+  writer.Flush();
+  std::vector<uint8_t> annexb = ReadOnlyFile();
+  ASSERT_EQ(80u, annexb.size());
+  EXPECT_EQ(0xaa, annexb[49]);
+  EXPECT_EQ(0x55, annexb[50]);
+}
+
+TEST_F(BitstreamDumpWriterTest, ResumesAtKeyFrameAfterBudgetDrop) {
+  BitstreamDumpWriter writer(directory_, 100);
+  auto stream = writer.CreateStream("send", webrtc::kVideoCodecVP9);
+  stream->Write(Image(50, true, 0));
+  // Larger than the whole budget, so always dropped.
+  stream->Write(Image(200, false, 3000));
+  stream->Write(Image(50, false, 6000));
+  stream->Write(Image(50, true, 9000));
+  stream.reset();
+  writer.Flush();
+  EXPECT_EQ(1u, writer.DroppedFrames());
+  std::vector<uint8_t> ivf = ReadOnlyFile();
+  ASSERT_EQ(32u + 2 * (12 + 50), ivf.size());
+  EXPECT_EQ(2u, ReadLe32(&ivf[24]));
+  EXPECT_EQ(0xaa, ivf[32 + 12 + 50 + 12]);
+}
+
+TEST_F(BitstreamDumpWriterTest, MergesVp9SpatialLayersIntoSuperframe) {
+  BitstreamDumpWriter writer(directory_, 1024 * 1024);
+  auto stream = writer.CreateStream("send", webrtc::kVideoCodecVP9);
+  webrtc::EncodedImage base_layer = Image(30, true, 0);
+  webrtc::EncodedImage top_layer = Image(300, false, 0);
+  top_layer._encodedWidth = 640;
+  top_layer._encodedHeight = 480;
+  stream->Write(base_layer);
+  stream->Write(top_layer);
+  stream->Write(Image(20, false, 3000));
+  stream.reset();
+  writer.Flush();
+  std::vector<uint8_t> ivf = ReadOnlyFile();
+  // Superframe index of two frames with 2-byte sizes: marker, 2 * 2 bytes,
+  // marker.
+  const size_t superframe_size = 30 + 300 + 6;
+  ASSERT_EQ(32u + 12 + superframe_size + 12 + 20, ivf.size());
+  // File header has the size of the top layer.
+  EXPECT_EQ(640, ivf[12] | (ivf[13] << 8));
+  EXPECT_EQ(480, ivf[14] | (ivf[15] << 8));
+  EXPECT_EQ(2u, ReadLe32(&ivf[24]));
+  EXPECT_EQ(superframe_size, ReadLe32(&ivf[32]));
+  const uint8_t* index = &ivf[44 + 330];
+  EXPECT_EQ(0xc9, index[0]);
+  EXPECT_EQ(30, index[1] | (index[2] << 8));
+  EXPECT_EQ(300, index[3] | (index[4] << 8));
+  EXPECT_EQ(0xc9, index[5]);
+  EXPECT_EQ(20u, ReadLe32(&ivf[44 + superframe_size]));
+}
+
+TEST_F(BitstreamDumpWriterTest, EnqueueCost) {
+  // Cost on the encoder thread, which only queues a buffer reference.
+  const int kFrames = 20000;
+  BitstreamDumpWriter writer(directory_, 64 * 1024 * 1024);
+  auto stream = writer.CreateStream("send", webrtc::kVideoCodecH264);
+  webrtc::EncodedImage key_frame = Image(1000, true, 0);
+  webrtc::EncodedImage delta_frame = Image(1000, false, 0);
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < kFrames; i++)
+    stream->Write(i % 100 == 0 ? key_frame : delta_frame);
+  double elapsed_us = std::chrono::duration<double, std::micro>(
+                          std::chrono::steady_clock::now() - start)
+                          .count();
+  stream.reset();
+  writer.Flush();
+  std::cout << "Write(): " << elapsed_us / kFrames << " us/frame, "
+            << writer.DroppedFrames() << " of " << kFrames << " dropped."
+            << std::endl;
+  EXPECT_LT(writer.DroppedFrames(), static_cast<uint64_t>(kFrames));
+}
+}  // namespace base
+}  // namespace owt
@@ -0,0 +1,185 @@
+// Copyright (C) <2026> Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+#include "talk/owt/sdk/base/builtinasyncvideodecoder.h"
+#include "media/base/media_constants.h"
+#include "webrtc/api/make_ref_counted.h"
+#include "webrtc/api/task_queue/default_task_queue_factory.h"
+#include "webrtc/api/video/encoded_image.h"
+#include "webrtc/api/video/video_frame.h"
+#include "webrtc/api/video_codecs/builtin_video_decoder_factory.h"
+#include "webrtc/api/video_codecs/sdp_video_format.h"
+#include "webrtc/modules/video_coding/include/video_error_codes.h"
+#include "webrtc/rtc_base/logging.h"
+
+namespace owt {
+namespace base {
+namespace {
+// Exposes a VideoEncodedFrame's bitstream as an EncodedImage buffer without
+// copying. |holder| keeps the bytes alive while the decoder references them.
+class SharedEncodedBuffer : public webrtc::EncodedImageBufferInterface {
+ public:
+  SharedEncodedBuffer(const uint8_t* data,
+                      size_t size,
+                      std::shared_ptr<const void> holder)
+      : data_(data), size_(size), holder_(std::move(holder)) {}
+  const uint8_t* data() const override { return data_; }
+  // Decoders never write to the bitstream.
+  uint8_t* data() override { return const_cast<uint8_t*>(data_); }
+  size_t size() const override { return size_; }
+
+ private:
+  const uint8_t* data_;
+  const size_t size_;
+  std::shared_ptr<const void> holder_;
+};
+
+const char* ToCodecName(VideoCodec codec) {
+  switch (codec) {
+    case VideoCodec::kVp8:
+      return cricket::kVp8CodecName;
+    case VideoCodec::kVp9:
+      return cricket::kVp9CodecName;
+    case VideoCodec::kAv1:
+      return cricket::kAv1CodecName;
+    default:
+      return nullptr;
+  }
+}
+
+webrtc::VideoCodecType ToCodecType(VideoCodec codec) {
+  switch (codec) {
+    case VideoCodec::kVp8:
+      return webrtc::kVideoCodecVP8;
+    case VideoCodec::kVp9:
+      return webrtc::kVideoCodecVP9;
+    case VideoCodec::kAv1:
+      return webrtc::kVideoCodecAV1;
+    default:
+      return webrtc::kVideoCodecGeneric;
+  }
+}
+}  // namespace
+
+std::unique_ptr<AsyncVideoDecoderInterface>
+AsyncVideoDecoderInterface::CreateBuiltin(size_t max_pending_frames) {
+  return std::make_unique<BuiltinAsyncVideoDecoder>(max_pending_frames);
+}
+
+BuiltinAsyncVideoDecoder::BuiltinAsyncVideoDecoder(size_t max_pending_frames)
+    : max_pending_frames_(max_pending_frames > 0 ? max_pending_frames : 1),
+      pending_frames_(0),
+      callback_(nullptr) {}
+
+BuiltinAsyncVideoDecoder::~BuiltinAsyncVideoDecoder() {
+  Release();
+}
+
+bool BuiltinAsyncVideoDecoder::InitDecodeContext(
+    VideoCodec video_codec,
+    int number_of_cores,
+    VideoDecodeCompleteCallback* callback) {
+  Release();
+  const char* codec_name = ToCodecName(video_codec);
+  if (!codec_name || !callback) {
+    RTC_LOG(LS_ERROR) << "Codec is not supported by built-in async decoder.";
+    return false;
+  }
+  decoder_ = webrtc::CreateBuiltinVideoDecoderFactory()->CreateVideoDecoder(
+      webrtc::SdpVideoFormat(codec_name));
+  webrtc::VideoDecoder::Settings settings;
+  settings.set_codec_type(ToCodecType(video_codec));
+  settings.set_number_of_cores(number_of_cores);
+  if (!decoder_ || !decoder_->Configure(settings)) {
+    RTC_LOG(LS_ERROR) << "Failed to configure built-in decoder.";
+    decoder_.reset();
+    return false;
+  }
+  decoder_->RegisterDecodeCompleteCallback(this);
+  {
+    std::lock_guard<std::mutex> lock(callback_mutex_);
+    callback_ = callback;
+  }
+  auto task_queue_factory = webrtc::CreateDefaultTaskQueueFactory();
+  decode_queue_ =
+      std::make_unique<rtc::TaskQueue>(task_queue_factory->CreateTaskQueue(
+          "AsyncVideoDecoderQueue", webrtc::TaskQueueFactory::Priority::HIGH));
+  return true;
+}
+
+bool BuiltinAsyncVideoDecoder::Decode(std::unique_ptr<VideoEncodedFrame> frame) {
+  if (!decode_queue_ || !frame || !frame->buffer)
+    return false;
+  if (pending_frames_.fetch_add(1) >= max_pending_frames_) {
+    pending_frames_--;
+    return false;
+  }
+  webrtc::EncodedImage image;
+  image.SetEncodedData(rtc::make_ref_counted<SharedEncodedBuffer>(
+      frame->buffer, frame->length, frame->buffer_holder));
+  image.SetTimestamp(frame->time_stamp);
+  image._frameType = frame->is_key_frame
+                         ? webrtc::VideoFrameType::kVideoFrameKey
+                         : webrtc::VideoFrameType::kVideoFrameDelta;
+  decode_queue_->PostTask([this, image = std::move(image)]() {
+    int32_t result = decoder_->Decode(image, false, 0);
+    if (result != WEBRTC_VIDEO_CODEC_OK) {
+      RTC_LOG(LS_WARNING) << "Built-in decoder returned " << result;
+    }
+    pending_frames_--;
+  });
+  return true;
+}
+
+bool BuiltinAsyncVideoDecoder::Release() {
+  // Destroying the queue waits for the running task and drops queued ones.
+  decode_queue_.reset();
+  pending_frames_ = 0;
+  {
+    std::lock_guard<std::mutex> lock(callback_mutex_);
+    callback_ = nullptr;
+  }
+  if (decoder_) {
+    decoder_->Release();
+    decoder_.reset();
+  }
+  return true;
+}
+
+AsyncVideoDecoderInterface* BuiltinAsyncVideoDecoder::Copy() {
+  return new BuiltinAsyncVideoDecoder(max_pending_frames_);
+}
+
+int32_t BuiltinAsyncVideoDecoder::Decoded(webrtc::VideoFrame& decoded_image) {
+  Decoded(decoded_image, absl::nullopt, absl::nullopt);
+  return WEBRTC_VIDEO_CODEC_OK;
+}
+
+void BuiltinAsyncVideoDecoder::Decoded(webrtc::VideoFrame& decoded_image,
+                                       absl::optional<int32_t> decode_time_ms,
+                                       absl::optional<uint8_t> qp) {
+  // libvpx and dav1d produce I420, so ToI420() does not convert here.
+  rtc::scoped_refptr<webrtc::I420BufferInterface> buffer =
+      decoded_image.video_frame_buffer()->ToI420();
+  if (!buffer)
+    return;
+  std::unique_ptr<VideoDecodedFrame> frame(new VideoDecodedFrame());
+  frame->format = VideoDecodedFrameFormat::kI420;
+  frame->width = buffer->width();
+  frame->height = buffer->height();
+  frame->planes[0] = buffer->DataY();
+  frame->planes[1] = buffer->DataU();
+  frame->planes[2] = buffer->DataV();
+  frame->strides[0] = buffer->StrideY();
+  frame->strides[1] = buffer->StrideU();
+  frame->strides[2] = buffer->StrideV();
+  frame->time_stamp = decoded_image.timestamp();
+  frame->decode_time_ms = decode_time_ms.value_or(-1);
+  // Decoder's frame pool reuses the buffer once the last reference is gone.
+  frame->release = [buffer]() {};
+  std::lock_guard<std::mutex> lock(callback_mutex_);
+  if (callback_)
+    callback_->OnFrameDecoded(std::move(frame));
+}
+}  // namespace base
+}  // namespace owt
@@ -0,0 +1,51 @@
+// Copyright (C) <2026> Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef OWT_BASE_BUILTINASYNCVIDEODECODER_H_
+#define OWT_BASE_BUILTINASYNCVIDEODECODER_H_
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include "webrtc/api/video_codecs/video_decoder.h"
+#include "webrtc/rtc_base/task_queue.h"
+#include "talk/owt/sdk/include/cpp/owt/base/videodecoderinterface.h"
+
+namespace owt {
+namespace base {
+// Reference AsyncVideoDecoderInterface implementation. Runs WebRTC's built-in
+// VP8/VP9 (libvpx) and AV1 (dav1d) decoders on a dedicated task queue, so
+// depacketization of the next frame overlaps with decoding of the current
+// one. Inter-frame dependencies keep decoding of a single stream serial;
+// parallelism inside a frame comes from libvpx/dav1d threads sized by
+// |number_of_cores|.
+class BuiltinAsyncVideoDecoder : public AsyncVideoDecoderInterface,
+                                 public webrtc::DecodedImageCallback {
+ public:
+  explicit BuiltinAsyncVideoDecoder(size_t max_pending_frames);
+  ~BuiltinAsyncVideoDecoder() override;
+  bool InitDecodeContext(VideoCodec video_codec,
+                         int number_of_cores,
+                         VideoDecodeCompleteCallback* callback) override;
+  bool Decode(std::unique_ptr<VideoEncodedFrame> frame) override;
+  bool Release() override;
+  AsyncVideoDecoderInterface* Copy() override;
+  // Implements webrtc::DecodedImageCallback. Called on |decode_queue_|.
+  int32_t Decoded(webrtc::VideoFrame& decoded_image) override;
+  void Decoded(webrtc::VideoFrame& decoded_image,
+               absl::optional<int32_t> decode_time_ms,
+               absl::optional<uint8_t> qp) override;
+
+ private:
+  const size_t max_pending_frames_;
+  std::atomic<size_t> pending_frames_;
+  std::unique_ptr<webrtc::VideoDecoder> decoder_;
+  std::mutex callback_mutex_;
+  VideoDecodeCompleteCallback* callback_;
+  // Declared last so it is destroyed first, while members used by queued
+  // tasks are still valid.
+  std::unique_ptr<rtc::TaskQueue> decode_queue_;
+};
+}  // namespace base
+}  // namespace owt
+#endif  // OWT_BASE_BUILTINASYNCVIDEODECODER_H_
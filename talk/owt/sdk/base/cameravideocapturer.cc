@@ -11,6 +11,7 @@
 #include "talk/owt/sdk/base/cameravideocapturer.h"
 
 #include <algorithm>
+#include <utility>
 
 #include "api/scoped_refptr.h"
 #include "api/video/i420_buffer.h"
@@ -41,7 +42,14 @@ void CameraVideoCapturer::OnFrame(const webrtc::VideoFrame& frame) {
     // return scaled version.
     rtc::scoped_refptr<webrtc::I420Buffer> scaled_buffer =
         webrtc::I420Buffer::Create(out_width, out_height);
-    scaled_buffer->ScaleFrom(*frame.video_frame_buffer()->ToI420());
+    if (crop_to_aspect_ratio_) {
+      scaled_buffer->CropAndScaleFrom(*frame.video_frame_buffer()->ToI420(),
+                                      (frame.width() - cropped_width) / 2,
+                                      (frame.height() - cropped_height) / 2,
+                                      cropped_width, cropped_height);
+    } else {
+      scaled_buffer->ScaleFrom(*frame.video_frame_buffer()->ToI420());
+    }
     broadcaster_.OnFrame(webrtc::VideoFrame::Builder()
                              .set_video_frame_buffer(scaled_buffer)
                              .set_rotation(webrtc::kVideoRotation_0)
@@ -58,6 +66,18 @@ rtc::VideoSinkWants CameraVideoCapturer::GetSinkWants() {
   return broadcaster_.wants();
 }
 
+void CameraVideoCapturer::RequestOutputFormat(int width, int height, int fps) {
+  absl::optional<std::pair<int, int>> aspect_ratio;
+  absl::optional<int> max_pixel_count;
+  if (width > 0 && height > 0) {
+    aspect_ratio = std::make_pair(width, height);
+    max_pixel_count = width * height;
+  }
+  video_adapter_.OnOutputFormatRequest(
+      aspect_ratio, max_pixel_count,
+      fps > 0 ? absl::optional<int>(fps) : absl::nullopt);
+}
+
 void CameraVideoCapturer::AddOrUpdateSink(
     rtc::VideoSinkInterface<webrtc::VideoFrame>* sink,
     const rtc::VideoSinkWants& wants) {
@@ -35,12 +35,20 @@ class CameraVideoCapturer : public rtc::VideoSourceInterface<webrtc::VideoFrame>
  protected:
   void OnFrame(const webrtc::VideoFrame& frame);
   rtc::VideoSinkWants GetSinkWants();
+  // Scales frames to at most |width|x|height| and drops frames above |fps|,
+  // on top of what sinks want. 0 leaves that dimension unlimited.
+  void RequestOutputFormat(int width, int height, int fps);
+  // If true, a frame whose aspect ratio differs from the output is center
+  // cropped to it. Otherwise the whole frame is stretched, which is the
+  // default.
+  void SetCropToAspectRatio(bool crop) { crop_to_aspect_ratio_ = crop; }
 
  private:
   void UpdateVideoAdapter();
 
   rtc::VideoBroadcaster broadcaster_;
   cricket::VideoAdapter video_adapter_;
+  bool crop_to_aspect_ratio_ = false;
 };
 }  // namespace base
 }  // namespace owt
@@ -23,12 +23,21 @@ VideoCodecParameters::VideoCodecParameters(const VideoCodec& codec,
 VideoCodecParameters::~VideoCodecParameters() = default;
 
 VideoEncodingParameters::VideoEncodingParameters()
-    : codec(), max_bitrate(0), hardware_accelerated(false) {}
+    : codec(),
+      max_bitrate(0),
+      start_bitrate(0),
+      hardware_accelerated(false),
+      encoder_policy(VideoEncoderPolicy::kAuto) {}
 VideoEncodingParameters::VideoEncodingParameters(
     const VideoCodecParameters& codec_param,
     unsigned long bitrate_bps,
     bool hw)
-    : codec(codec_param), max_bitrate(bitrate_bps), hardware_accelerated(hw) {}
+    : codec(codec_param),
+      max_bitrate(bitrate_bps),
+      start_bitrate(0),
+      hardware_accelerated(hw),
+      encoder_policy(hw ? VideoEncoderPolicy::kHardware
+                        : VideoEncoderPolicy::kAuto) {}
 VideoEncodingParameters::~VideoEncodingParameters() = default;
 }  // namespace base
 }  // namespace owt
\ No newline at end of file
@@ -3,7 +3,11 @@
 // SPDX-License-Identifier: Apache-2.0
 #ifndef OWT_BASE_CUSTOMIZEDENCODER_BUFFER_HANDLE_H
 #define OWT_BASE_CUSTOMIZEDENCODER_BUFFER_HANDLE_H
+#include <memory>
+#include <mutex>
+#include "api/video/video_codec_type.h"
 #include "rtc_base/ref_count.h"
+#include "talk/owt/sdk/base/memoryaccount.h"
 #include "talk/owt/sdk/base/nativehandlebuffer.h"
 #include "talk/owt/sdk/include/cpp/owt/base/videoencoderinterface.h"
 namespace owt {
@@ -29,25 +33,41 @@ class CustomizedEncoderBufferHandle2 {
         fps_(0),
         bitrate_kbps_(0),
         buffer_(nullptr),
-        buffer_length_(0) {}
+        buffer_length_(0),
+        buffer_headroom_(0) {}
 
   virtual ~CustomizedEncoderBufferHandle2() {
     if (buffer_ != nullptr) {
-      delete[] buffer_;
+      MemoryAccount::Process()->Release(MemoryCategory::kEncodedFrames,
+                                        buffer_headroom_ + buffer_length_);
+      delete[] (buffer_ - buffer_headroom_);
       buffer_ = nullptr;
     }
+    meta_data_.cursor_data_free();
     encoder_event_callback_ = nullptr;
   }
 
  public:
   EncoderEventCallback* encoder_event_callback_;
+  // Optional owner of |encoder_event_callback_|. Set when the callback's
+  // lifetime is not managed by the application.
+  std::shared_ptr<EncoderEventCallback> encoder_event_callback_owner_;
   size_t width_;
   size_t height_;
   uint32_t fps_;
   uint32_t bitrate_kbps_;
   uint8_t* buffer_;
   size_t buffer_length_;
+  // Writable bytes allocated in front of |buffer_|. Encoder proxy composes the
+  // SEI there instead of copying the bitstream.
+  size_t buffer_headroom_;
   EncodedImageMetaData meta_data_;
+  // Every encoder proxy the frame is delivered to sends the same SEI. The
+  // first one composes it in front of |buffer_| and records its size and
+  // codec here, the others reuse it. Guarded by |sei_mutex_|.
+  std::mutex sei_mutex_;
+  size_t sei_size_ = 0;
+  webrtc::VideoCodecType sei_codec_ = webrtc::kVideoCodecGeneric;
 };
 
 // Deprecated.
@@ -80,7 +100,17 @@ class EncodedFrameBuffer : public VideoFrameBuffer {
   size_t height_ = 0;
 };
 
-class EncodedFrameBuffer2 : public VideoFrameBuffer {
+// Native buffers the SDK feeds to encoders. They are the only native buffers
+// reaching SelectingVideoEncoder, which tells them apart by kind() since RTTI
+// is not available.
+class EncoderInputBuffer : public VideoFrameBuffer {
+ public:
+  enum class Kind { kEncodedFrame, kEncoderPolicy };
+  virtual Kind kind() const = 0;
+  Type type() const override { return Type::kNative; }
+};
+
+class EncodedFrameBuffer2 : public EncoderInputBuffer {
  public:
   EncodedFrameBuffer2(CustomizedEncoderBufferHandle2* native_handle)
       : native_handle_(native_handle) {
@@ -95,7 +125,7 @@ class EncodedFrameBuffer2 : public VideoFrameBuffer {
       native_handle_ = nullptr;
     }
   }
-  Type type() const override { return Type::kNative; }
+  Kind kind() const override { return Kind::kEncodedFrame; }
   int width() const override { return width_; }
   int height() const override { return height_; }
   rtc::scoped_refptr<I420BufferInterface> ToI420() override {
@@ -5,7 +5,13 @@
 #include "api/make_ref_counted.h"
 #include "talk/owt/sdk/base/customizedframescapturer.h"
 #include "talk/owt/sdk/base/customizedencoderbufferhandle.h"
+#include "talk/owt/sdk/base/memoryaccount.h"
+#include "talk/owt/sdk/base/metricsregistry.h"
 #include "talk/owt/sdk/base/nativehandlebuffer.h"
+#include "talk/owt/sdk/base/seicomposer.h"
+#include "webrtc/api/video/i010_buffer.h"
+#include "webrtc/api/video/i444_buffer.h"
+#include "webrtc/api/video/nv12_buffer.h"
 #include "webrtc/common_video/include/video_frame_buffer.h"
 #include "webrtc/media/base/video_common.h"
 #include "webrtc/rtc_base/logging.h"
@@ -17,6 +23,31 @@
 using namespace rtc;
 namespace owt {
 namespace base {
+namespace {
+MetricCounter* CapturedFrames(bool encoded) {
+  static MetricCounter* raw = MetricsRegistry::Get()->Counter(
+      "owt_capturer_frames_captured_total",
+      "Frames delivered by customized frame capturers.", {{"input", "raw"}});
+  static MetricCounter* encoded_frames = MetricsRegistry::Get()->Counter(
+      "owt_capturer_frames_captured_total",
+      "Frames delivered by customized frame capturers.",
+      {{"input", "encoded"}});
+  return encoded ? encoded_frames : raw;
+}
+
+MetricCounter* DroppedFrames(bool encoded) {
+  static MetricCounter* raw = MetricsRegistry::Get()->Counter(
+      "owt_capturer_frames_dropped_total",
+      "Invalid frames dropped by customized frame capturers.",
+      {{"input", "raw"}});
+  static MetricCounter* encoded_frames = MetricsRegistry::Get()->Counter(
+      "owt_capturer_frames_dropped_total",
+      "Invalid frames dropped by customized frame capturers.",
+      {{"input", "encoded"}});
+  return encoded ? encoded_frames : raw;
+}
+}  // namespace
+
 ///////////////////////////////////////////////////////////////////////
 // Definition of private class CustomizedFramesThread that periodically
 // generates frames.
@@ -128,6 +159,8 @@ CustomizedFramesCapturer::~CustomizedFramesCapturer() {
     delete encoder_event_callback_;
     encoder_event_callback_ = nullptr;
   }
+  MemoryAccount::Process()->Release(MemoryCategory::kCapturerFrameBuffers,
+                                    frame_buffer_capacity_);
 }
 
 void CustomizedFramesCapturer::RegisterCaptureDataCallback(
@@ -203,7 +236,9 @@ int32_t CustomizedFramesCapturer::CaptureSettings(
   settings.width = width_;
   settings.height = height_;
   settings.maxFPS = fps_;
-  settings.videoType = webrtc::VideoType::kI420;
+  settings.videoType = frame_type_ == VideoFrameGeneratorInterface::NV12
+                            ? webrtc::VideoType::kNV12
+                            : webrtc::VideoType::kI420;
 
   return 0;
 }
@@ -217,8 +252,10 @@ int32_t CustomizedFramesCapturer::SetCaptureRotation(
 void CustomizedFramesCapturer::OnStreamProviderFrame(
     const std::vector<uint8_t>& buffer,
     const EncodedImageMetaData& meta_data) {
-  if (buffer.size() == 0)
+  if (buffer.size() == 0) {
+    DroppedFrames(true)->Increment();
     return;
+  }
 
   CustomizedEncoderBufferHandle2* encoder_context =
       new CustomizedEncoderBufferHandle2;
@@ -253,19 +290,29 @@ void CustomizedFramesCapturer::OnStreamProviderFrame(
     memcpy(encoder_context->meta_data_.encoded_image_sidedata_get(),
            meta_data.encoded_image_sidedata_get(),
            meta_data.encoded_image_sidedata_size());
-    // sidedata will be freed by encoder proxy.
   }
-  uint8_t* frame_buffer = new uint8_t[buffer.size()];
-  std::copy(buffer.begin(), buffer.end(), frame_buffer);
+  // Reserve room for the SEI carrying side data, so it can be prepended
+  // without another copy of the bitstream.
+  size_t headroom =
+      meta_data.encoded_image_sidedata_size() > 0
+          ? SeiComposer::MaxSize(meta_data.encoded_image_sidedata_size(), 0)
+          : 0;
+  uint8_t* frame_buffer = new uint8_t[headroom + buffer.size()];
+  // Released by |encoder_context|.
+  MemoryAccount::Process()->Add(MemoryCategory::kEncodedFrames,
+                                headroom + buffer.size());
+  std::copy(buffer.begin(), buffer.end(), frame_buffer + headroom);
 
-  encoder_context->buffer_ = frame_buffer;
+  encoder_context->buffer_ = frame_buffer + headroom;
   encoder_context->buffer_length_ = buffer.size();
+  encoder_context->buffer_headroom_ = headroom;
 
   rtc::scoped_refptr<owt::base::EncodedFrameBuffer2> rtc_buffer =
       rtc::make_ref_counted<owt::base::EncodedFrameBuffer2>(encoder_context);
   webrtc::VideoFrame pending_frame(rtc_buffer, 0, rtc::TimeMillis(),
                                    webrtc::kVideoRotation_0);
   data_callback_->OnFrame(pending_frame);
+  CapturedFrames(true)->Increment();
 }
 
 int CustomizedFramesCapturer::I420DataSize(int height,
@@ -275,17 +322,56 @@ int CustomizedFramesCapturer::I420DataSize(int height,
   return stride_y * height + (stride_u + stride_v) * ((height + 1) / 2);
 }
 
+uint32_t CustomizedFramesCapturer::CreateFrameBuffer() {
+  int chroma_height = (height_ + 1) / 2;
+  switch (frame_type_) {
+    case VideoFrameGeneratorInterface::NV12: {
+      rtc::scoped_refptr<webrtc::NV12Buffer> buffer =
+          webrtc::NV12Buffer::Create(width_, height_);
+      frame_data_ = buffer->MutableDataY();
+      frame_buffer_ = buffer;
+      return buffer->StrideY() * height_ + buffer->StrideUV() * chroma_height;
+    }
+    case VideoFrameGeneratorInterface::I444: {
+      rtc::scoped_refptr<webrtc::I444Buffer> buffer =
+          webrtc::I444Buffer::Create(width_, height_);
+      frame_data_ = buffer->MutableDataY();
+      frame_buffer_ = buffer;
+      return (buffer->StrideY() + buffer->StrideU() + buffer->StrideV()) *
+             height_;
+    }
+    case VideoFrameGeneratorInterface::I010: {
+      rtc::scoped_refptr<webrtc::I010Buffer> buffer =
+          webrtc::I010Buffer::Create(width_, height_);
+      frame_data_ = reinterpret_cast<uint8_t*>(buffer->MutableDataY());
+      frame_buffer_ = buffer;
+      return sizeof(uint16_t) * I420DataSize(height_, buffer->StrideY(),
+                                             buffer->StrideU(),
+                                             buffer->StrideV());
+    }
+    default: {
+      int stride_y = width_;
+      int stride_uv = (width_ + 1) / 2;
+      rtc::scoped_refptr<webrtc::I420Buffer> buffer =
+          webrtc::I420Buffer::Create(width_, height_, stride_y, stride_uv,
+                                     stride_uv);
+      frame_data_ = buffer->MutableDataY();
+      frame_buffer_ = buffer;
+      return I420DataSize(height_, stride_y, stride_uv, stride_uv);
+    }
+  }
+}
+
 void CustomizedFramesCapturer::AdjustFrameBuffer(uint32_t size) {
   if (size > frame_buffer_capacity_ || !frame_buffer_) {
     RTC_LOG(LS_VERBOSE) << "Allocate new memory for frame buffer.";
     width_ = frame_generator_->GetWidth();
     height_ = frame_generator_->GetHeight();
-    int stride_y = width_;
-    int stride_uv = (width_ + 1) / 2;
-    frame_buffer_ = webrtc::I420Buffer::Create(width_, height_, stride_y,
-                                               stride_uv, stride_uv);
-    frame_buffer_capacity_ =
-        I420DataSize(height_, stride_y, stride_uv, stride_uv);
+    MemoryAccount::Process()->Release(MemoryCategory::kCapturerFrameBuffers,
+                                      frame_buffer_capacity_);
+    frame_buffer_capacity_ = CreateFrameBuffer();
+    MemoryAccount::Process()->Add(MemoryCategory::kCapturerFrameBuffers,
+                                  frame_buffer_capacity_);
     if (frame_buffer_capacity_ < size) {
       RTC_LOG(LS_ERROR) << "User provides invalid data size. Expected size: "
                         << frame_buffer_capacity_ << ", user wants: " << size;
@@ -302,11 +388,12 @@ void CustomizedFramesCapturer::ReadFrame() {
   if (frame_generator_ != nullptr) {
     auto frame_size = frame_generator_->GetNextFrameSize();
     AdjustFrameBuffer(frame_size);
-    if (frame_generator_->GenerateNextFrame(frame_buffer_->MutableDataY(),
+    if (frame_generator_->GenerateNextFrame(frame_data_,
                                             frame_buffer_capacity_) !=
         frame_size) {
       RTC_DCHECK(false);
       RTC_LOG(LS_ERROR) << "Failed to get video frame.";
+      DroppedFrames(false)->Increment();
       return;
     }
 
@@ -314,12 +401,13 @@ void CustomizedFramesCapturer::ReadFrame() {
         webrtc::VideoFrame::Builder()
             .set_video_frame_buffer(frame_buffer_)
             .set_timestamp_rtp(0)
-            .set_timestamp_ms(rtc::TimeMillis())
+            .set_timestamp_us(rtc::TimeMicros())
             .set_rotation(webrtc::kVideoRotation_0)
             .build();
 
     capture_frame.set_ntp_time_ms(0);
     data_callback_->OnFrame(capture_frame);
+    CapturedFrames(false)->Increment();
   } else {
     // For encoded input, we use push mode so it will not be delivered in capture thread.
   }
@@ -84,6 +84,9 @@ class CustomizedFramesCapturer : public webrtc::VideoCaptureModule, public Encod
  private:
   class CustomizedFramesThread;  // Forward declaration, defined in .cc.
   int I420DataSize(int height, int stride_y, int stride_u, int stride_v);
+  // Allocates |frame_buffer_| in the layout of |frame_type_|, sets
+  // |frame_data_| to its first byte and returns its size.
+  uint32_t CreateFrameBuffer();
 
   rtc::VideoSinkInterface<webrtc::VideoFrame>* data_callback_;
   std::unique_ptr<VideoFrameGeneratorInterface> frame_generator_;
@@ -96,8 +99,10 @@ class CustomizedFramesCapturer : public webrtc::VideoCaptureModule, public Encod
   bool capture_started_ = false;
   VideoFrameGeneratorInterface::VideoFrameCodec frame_type_;
   uint32_t frame_buffer_capacity_;
-  rtc::scoped_refptr<webrtc::I420Buffer>
-      frame_buffer_;  // Reuseable buffer for video frames.
+  // Reuseable buffer for video frames. Its planes are contiguous, starting
+  // at |frame_data_|, so the generator fills it in place.
+  rtc::scoped_refptr<webrtc::VideoFrameBuffer> frame_buffer_;
+  uint8_t* frame_data_ = nullptr;
 
   webrtc::Mutex lock_;
   webrtc::Mutex capture_lock_;
@@ -8,6 +8,7 @@
 #include "modules/video_coding/codecs/vp8/include/vp8.h"
 #include "modules/video_coding/codecs/vp9/include/vp9.h"
 #include "owt/base/globalconfiguration.h"
+#include "talk/owt/sdk/base/asyncvideodecoderproxy.h"
 #include "talk/owt/sdk/base/codecutils.h"
 #include "talk/owt/sdk/base/customizedvideodecoderfactory.h"
 #include "talk/owt/sdk/base/customizedvideodecoderproxy.h"
@@ -19,13 +20,25 @@ CustomizedVideoDecoderFactory::CustomizedVideoDecoderFactory(
     : external_decoder_(std::move(external_decoder)) {
 }
 
+CustomizedVideoDecoderFactory::CustomizedVideoDecoderFactory(
+    std::unique_ptr<owt::base::AsyncVideoDecoderInterface>
+        external_async_decoder)
+    : external_async_decoder_(std::move(external_async_decoder)) {}
+
 CustomizedVideoDecoderFactory::~CustomizedVideoDecoderFactory() {}
 
 std::unique_ptr<webrtc::VideoDecoder>
 CustomizedVideoDecoderFactory::CreateVideoDecoder(
     const webrtc::SdpVideoFormat& format) {
   VideoCodecType type = owt::base::CodecUtils::ConvertSdpFormatToCodecType(format);
-  if (type != kVideoCodecGeneric) {
+  if (type == kVideoCodecGeneric) {
+    return nullptr;
+  }
+  if (external_async_decoder_) {
+    return AsyncVideoDecoderProxy::Create(type,
+                                          external_async_decoder_->Copy());
+  }
+  if (external_decoder_) {
     return CustomizedVideoDecoderProxy::Create(type, external_decoder_->Copy());
   }
   return nullptr;
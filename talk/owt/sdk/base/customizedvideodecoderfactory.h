@@ -20,6 +20,9 @@ class CustomizedVideoDecoderFactory : public webrtc::VideoDecoderFactory {
  public:
   CustomizedVideoDecoderFactory(
       std::unique_ptr<owt::base::VideoDecoderInterface> external_decoder);
+  CustomizedVideoDecoderFactory(
+      std::unique_ptr<owt::base::AsyncVideoDecoderInterface>
+          external_async_decoder);
   virtual ~CustomizedVideoDecoderFactory();
   // WebRtcVideoDecoderFactory implementation.
   std::unique_ptr<webrtc::VideoDecoder> CreateVideoDecoder(
@@ -27,6 +30,8 @@ class CustomizedVideoDecoderFactory : public webrtc::VideoDecoderFactory {
   std::vector<SdpVideoFormat> GetSupportedFormats() const override;
  private:
   std::unique_ptr<owt::base::VideoDecoderInterface> external_decoder_;
+  std::unique_ptr<owt::base::AsyncVideoDecoderInterface>
+      external_async_decoder_;
 };
 
 }  // namespace base
@@ -2,8 +2,11 @@
 //
 // SPDX-License-Identifier: Apache-2.0
 
+#include <mutex>
 #include <string>
 #include <vector>
+#include "webrtc/api/make_ref_counted.h"
+#include "webrtc/api/video/encoded_image.h"
 #include "webrtc/api/video/video_frame.h"
 #include "webrtc/modules/include/module_common_types.h"
 #include "webrtc/modules/video_coding/include/video_codec_interface.h"
@@ -14,7 +17,9 @@
 #include "talk/owt/sdk/base/customizedencoderbufferhandle.h"
 #include "talk/owt/sdk/base/customizedvideoencoderproxy.h"
 #include "talk/owt/sdk/base/mediautils.h"
+#include "talk/owt/sdk/base/metricsregistry.h"
 #include "talk/owt/sdk/base/nativehandlebuffer.h"
+#include "talk/owt/sdk/base/seicomposer.h"
 #include "talk/owt/sdk/include/cpp/owt/base/commontypes.h"
 
 // H.264 start code length.
@@ -24,16 +29,45 @@
 using namespace rtc;
 namespace owt {
 namespace base {
-static const uint8_t frame_number_sei_guid[16] = {
-    0xef, 0xc8, 0xe7, 0xb0, 0x26, 0x26, 0x47, 0xfd,
-    0x9d, 0xa3, 0x49, 0x4f, 0x60, 0xb8, 0x5b, 0xf0};
+namespace {
+// Exposes bitstream stored in an EncodedFrameBuffer2 as encoded image data.
+// Holding |frame_buffer| keeps the underlying CustomizedEncoderBufferHandle2
+// alive for as long as the encoded image is referenced.
+class EncodedFrameBufferView : public webrtc::EncodedImageBufferInterface {
+ public:
+  EncodedFrameBufferView(
+      rtc::scoped_refptr<webrtc::VideoFrameBuffer> frame_buffer,
+      uint8_t* data,
+      size_t size)
+      : frame_buffer_(frame_buffer), data_(data), size_(size) {}
+  const uint8_t* data() const override { return data_; }
+  uint8_t* data() override { return data_; }
+  size_t size() const override { return size_; }
+
+ private:
+  rtc::scoped_refptr<webrtc::VideoFrameBuffer> frame_buffer_;
+  uint8_t* data_;
+  const size_t size_;
+};
+
+MetricHistogram* EncodedFrameSizes() {
+  static MetricHistogram* histogram = MetricsRegistry::Get()->Histogram(
+      "owt_encoder_proxy_frame_bytes",
+      "Size of encoded frames passed through customized encoders.",
+      MetricsRegistry::SizeBoundsBytes());
+  return histogram;
+}
 
-static const uint8_t cursor_data_sei_guid[16] = {
-    0x2f, 0x69, 0xe7, 0xb0, 0x16, 0x56, 0x87, 0xfd,
-    0x2d, 0x14, 0x26, 0x37, 0x14, 0x22, 0x23, 0x38};
+MetricCounter* EncodedFrameErrors() {
+  static MetricCounter* counter = MetricsRegistry::Get()->Counter(
+      "owt_encoder_proxy_errors_total",
+      "Encoded frames customized encoders failed to deliver.");
+  return counter;
+}
+}  // namespace
 
 CustomizedVideoEncoderProxy::CustomizedVideoEncoderProxy()
-    : callback_(nullptr) {
+    : callback_(nullptr), sei_composer_(webrtc::kVideoCodecGeneric) {
   picture_id_ = 0;
 }
 CustomizedVideoEncoderProxy::~CustomizedVideoEncoderProxy() {}
@@ -43,6 +77,7 @@ int CustomizedVideoEncoderProxy::InitEncode(
     size_t max_payload_size) {
   RTC_DCHECK(codec_settings);
   codec_type_ = codec_settings->codecType;
+  sei_composer_ = SeiComposer(codec_type_);
   width_ = codec_settings->width;
   height_ = codec_settings->height;
   bitrate_ = codec_settings->startBitrate * 1000;
@@ -65,12 +100,15 @@ int32_t CustomizedVideoEncoderProxy::Encode(
       encoder_buffer_handle->buffer_ == nullptr ||
       encoder_buffer_handle->buffer_length_ == 0) {
     RTC_LOG(LS_ERROR) << "Received invalid encoded frame.";
+    EncodedFrameErrors()->Increment();
     return WEBRTC_VIDEO_CODEC_ERROR;
   }
 
   // Set encoder event callback object if not done already.
   if (encoder_event_callback_ == nullptr) {
     encoder_event_callback_ = encoder_buffer_handle->encoder_event_callback_;
+    encoder_event_callback_owner_ =
+        encoder_buffer_handle->encoder_event_callback_owner_;
   }
 
   // Check codec type before proceeding.
@@ -118,134 +156,63 @@ int32_t CustomizedVideoEncoderProxy::Encode(
     return WEBRTC_VIDEO_CODEC_ERROR;
   }
 
-  // Construct the SEI. index 0-22/23 is the sei overhead, and last byte is
-  // RBSP. Allocate the buffer to accommadate both AVC and HEVC. Construct
-  // cursor data SEI and side-data SEI. Typically cursor data is larger than
-  // 1KB, so the payload size should expand multiple bytes with 0xFF.
-  int cursor_data_sei_payload__field_bytes = (cursor_data_size + 16 + 1) / 255;
-
-  // 42 = 8(7 for hevc) + 16(side-data-guid) + 1(cursor sei payload type)
-  // + 16(cursor_data-guid) + 1(rbsp trailing)
-  std::unique_ptr<uint8_t[]> data(
-      new uint8_t[encoder_buffer_handle->buffer_length_ + side_data_size +
-                  cursor_data_sei_payload__field_bytes + cursor_data_size + 42]);
-  uint8_t* data_ptr = data.get();
-  uint32_t data_size =
-      static_cast<uint32_t>(encoder_buffer_handle->buffer_length_);
-
-  if ((codec_type_ != webrtc::kVideoCodecH264 &&
-       codec_type_ != webrtc::kVideoCodecH265)) {
-    if (side_data_size > 0)
-      encoder_buffer_handle->meta_data_.encoded_image_sidedata_free();
-    if (cursor_data_size > 0)
-      encoder_buffer_handle->meta_data_.cursor_data_free();
-  }
-
-  int sei_idx = 0;
-
-  if (codec_type_ == webrtc::kVideoCodecH264 &&
-      ((side_data_ptr && side_data_size) ||
-       (cursor_data_ptr && cursor_data_size))) {
-    data_ptr[0] = data_ptr[1] = data_ptr[2] = 0;
-    data_ptr[3] = 0x01;                 // start code: byte 0-3
-    data_ptr[4] = 0x06;                 // NAL-type: SEI
-    data_ptr[5] = 0x05;                 // userdata unregistered
-    data_ptr[6] = 16 + side_data_size;  // payload size
-    for (int i = 0; i < 16; i++) {
-      data_ptr[i + 7] = frame_number_sei_guid[i];
-    }
-    if (side_data_size > 0 && side_data_ptr) {
-      memcpy(data_ptr + 23, side_data_ptr, side_data_size);
-      encoder_buffer_handle->meta_data_.encoded_image_sidedata_free();
-    }
-    sei_idx += 23 + side_data_size;
-
-    // Done with side-data sei-message. Proceed with cursor-data sei-message.
-    if (cursor_data_ptr && cursor_data_size) {
-      data_ptr[sei_idx] = 0x05;  // userdata unregistered
-      sei_idx++;
-      if (cursor_data_sei_payload__field_bytes > 1) {
-        for (int j = 0; j < cursor_data_sei_payload__field_bytes - 1; j++) {
-          data_ptr[sei_idx] = 0xFF;
-          sei_idx++;
-        }
-        data_ptr[sei_idx] = (cursor_data_size + 16) % 255;
-        sei_idx++;
-      } else {
-        data_ptr[sei_idx] = cursor_data_size + 16;
-        sei_idx++;
-      }
-      for (int i = 0; i < 16; i++) {
-        data_ptr[sei_idx] = cursor_data_sei_guid[i];
-        sei_idx++;
-      }
-      memcpy(data_ptr + sei_idx, cursor_data_ptr, cursor_data_size);
-      sei_idx += cursor_data_size;
-      encoder_buffer_handle->meta_data_.cursor_data_free();
-    }
-
-    data_ptr[sei_idx] = 0x80;
-    sei_idx++;
-
-    memcpy(data_ptr + sei_idx, encoder_buffer_handle->buffer_,
-           encoder_buffer_handle->buffer_length_);
-    data_size += sei_idx;
-  } else if (codec_type_ == webrtc::kVideoCodecH265 &&
-             ((side_data_ptr && side_data_size) ||
-              (cursor_data_ptr && cursor_data_size))) {
-    data_ptr[0] = data_ptr[1] = data_ptr[2] = 0;
-    data_ptr[3] = 0x01;                 // start code: byte 0-3
-    data_ptr[4] = 0x4e;                 // F: 0, nal_unit_type: prefix-SEI
-    data_ptr[5] = 0x1;                  // layerID: 0; TID: 1
-    data_ptr[6] = 0x05;                 // userdata unregistered
-    data_ptr[7] = 16 + side_data_size;  // payload size
-    for (int i = 0; i < 16; i++) {
-      data_ptr[i + 8] = frame_number_sei_guid[i];
+  // H.264/H.265 side data and cursor data are sent in an SEI NAL in front of
+  // the access unit. Other codecs drop them. The frame buffer is shared by
+  // every encoder proxy the frame is delivered to, so the SEI is composed
+  // into its headroom once and never rewritten while others read it.
+  const bool has_sei = sei_composer_.IsSupported() &&
+                       ((side_data_ptr && side_data_size) ||
+                        (cursor_data_ptr && cursor_data_size));
+  rtc::scoped_refptr<webrtc::EncodedImageBufferInterface> encoded_data;
+  if (has_sei) {
+    std::lock_guard<std::mutex> lock(encoder_buffer_handle->sei_mutex_);
+    uint8_t* bitstream = encoder_buffer_handle->buffer_;
+    const size_t max_sei_size =
+        SeiComposer::MaxSize(side_data_size, cursor_data_size);
+    if (encoder_buffer_handle->sei_size_ == 0 &&
+        encoder_buffer_handle->buffer_headroom_ >= max_sei_size) {
+      // Compose at the start of the headroom, then move the SEI next to the
+      // bitstream so the access unit is contiguous without copying it.
+      uint8_t* headroom = bitstream - encoder_buffer_handle->buffer_headroom_;
+      size_t sei_size =
+          sei_composer_.Compose(side_data_ptr, side_data_size, cursor_data_ptr,
+                                cursor_data_size, headroom);
+      memmove(bitstream - sei_size, headroom, sei_size);
+      encoder_buffer_handle->sei_size_ = sei_size;
+      encoder_buffer_handle->sei_codec_ = codec_type_;
     }
-
-    if (side_data_size > 0 && side_data_ptr) {
-      memcpy(data_ptr + 24, side_data_ptr, side_data_size);
-      encoder_buffer_handle->meta_data_.encoded_image_sidedata_free();
-    }
-    sei_idx += 24 + side_data_size;
-
-    // Done with side-data sei-message. Proceed with cursor-data sei-message.
-    if (cursor_data_ptr && cursor_data_size) {
-      data_ptr[sei_idx] = 0x05;  // userdata unregistered
-      sei_idx++;
-      if (cursor_data_sei_payload__field_bytes > 1) {
-        for (int j = 0; j < cursor_data_sei_payload__field_bytes - 1; j++) {
-          data_ptr[sei_idx] = 0xFF;
-          sei_idx++;
-        }
-        data_ptr[sei_idx] = (cursor_data_size + 16) % 255;
-        sei_idx++;
-      } else {
-        data_ptr[sei_idx] = cursor_data_size + 16;
-        sei_idx++;
-      }
-      for (int i = 0; i < 16; i++) {
-        data_ptr[sei_idx] = cursor_data_sei_guid[i];
-        sei_idx++;
-      }
-      memcpy(data_ptr + sei_idx, cursor_data_ptr, cursor_data_size);
-      sei_idx += cursor_data_size;
-      encoder_buffer_handle->meta_data_.cursor_data_free();
+    if (encoder_buffer_handle->sei_size_ > 0 &&
+        encoder_buffer_handle->sei_codec_ == codec_type_) {
+      encoded_data = rtc::make_ref_counted<EncodedFrameBufferView>(
+          input_image.video_frame_buffer(),
+          bitstream - encoder_buffer_handle->sei_size_,
+          encoder_buffer_handle->sei_size_ +
+              encoder_buffer_handle->buffer_length_);
+    } else {
+      // No headroom, or the SEI in it is for another codec.
+      rtc::scoped_refptr<webrtc::EncodedImageBuffer> buffer =
+          webrtc::EncodedImageBuffer::Create(
+              max_sei_size + encoder_buffer_handle->buffer_length_);
+      size_t sei_size =
+          sei_composer_.Compose(side_data_ptr, side_data_size, cursor_data_ptr,
+                                cursor_data_size, buffer->data());
+      memcpy(buffer->data() + sei_size, bitstream,
+             encoder_buffer_handle->buffer_length_);
+      buffer->Realloc(sei_size + encoder_buffer_handle->buffer_length_);
+      encoded_data = buffer;
     }
-
-    data_ptr[sei_idx] = 0x80;
-    sei_idx++;
-
-    memcpy(data_ptr + sei_idx, encoder_buffer_handle->buffer_,
-           encoder_buffer_handle->buffer_length_);
-    data_size += sei_idx;
   } else {
-    memcpy(data_ptr, encoder_buffer_handle->buffer_,
-           encoder_buffer_handle->buffer_length_);
+    encoded_data = rtc::make_ref_counted<EncodedFrameBufferView>(
+        input_image.video_frame_buffer(), encoder_buffer_handle->buffer_,
+        encoder_buffer_handle->buffer_length_);
   }
+  // Side data and cursor data stay with the frame for other encoder proxies,
+  // and are freed with it.
+  uint8_t* data_ptr = encoded_data->data();
+  uint32_t data_size = static_cast<uint32_t>(encoded_data->size());
 
   webrtc::EncodedImage encoded_frame;
-  encoded_frame.SetEncodedData(EncodedImageBuffer::Create(data_ptr, data_size));
+  encoded_frame.SetEncodedData(encoded_data);
 
   encoded_frame._encodedWidth = input_image.width();
   encoded_frame._encodedHeight = input_image.height();
@@ -273,6 +240,12 @@ int32_t CustomizedVideoEncoderProxy::Encode(
   else
     update_ts_ = false;
 
+  // VP8 key frames have the inverse key frame flag cleared in the frame tag.
+  if (codec_type_ == webrtc::kVideoCodecVP8 && data_size > 0) {
+    encoded_frame._frameType = (data_ptr[0] & 0x01) == 0
+                                   ? webrtc::VideoFrameType::kVideoFrameKey
+                                   : webrtc::VideoFrameType::kVideoFrameDelta;
+  }
   // VP9 requires setting the frame type according to actual frame type.
   if (codec_type_ == webrtc::kVideoCodecVP9 && data_size > 2) {
     uint8_t au_key = 1;
@@ -369,10 +342,12 @@ int32_t CustomizedVideoEncoderProxy::Encode(
     }
   }
 #endif
+  EncodedFrameSizes()->Observe(data_size);
   const auto result = callback_->OnEncodedImage(encoded_frame, &info);
   if (result.error != webrtc::EncodedImageCallback::Result::Error::OK) {
     RTC_LOG(LS_ERROR) << "Deliver encoded frame callback failed: "
                       << result.error;
+    EncodedFrameErrors()->Increment();
     return WEBRTC_VIDEO_CODEC_ERROR;
   }
   return WEBRTC_VIDEO_CODEC_OK;
@@ -3,9 +3,11 @@
 // SPDX-License-Identifier: Apache-2.0
 #ifndef OWT_BASE_ENCODEDVIDEOENCODER_H_
 #define OWT_BASE_ENCODEDVIDEOENCODER_H_
+#include <memory>
 #include <vector>
 #include "webrtc/api/video_codecs/video_encoder.h"
 #include "webrtc/media/base/codec.h"
+#include "talk/owt/sdk/base/seicomposer.h"
 #include "talk/owt/sdk/include/cpp/owt/base/videoencoderinterface.h"
 
 namespace owt {
@@ -39,11 +41,13 @@ class CustomizedVideoEncoderProxy : public webrtc::VideoEncoder {
   webrtc::VideoCodecType codec_type_;
   uint16_t picture_id_;
   EncoderEventCallback* encoder_event_callback_ = nullptr;
+  std::shared_ptr<EncoderEventCallback> encoder_event_callback_owner_;
   uint32_t last_timestamp_;
   uint64_t last_capture_timestamp_;
   bool update_ts_ = true;
   uint8_t gof_idx_;
   webrtc::GofInfoVP9 gof_;
+  SeiComposer sei_composer_;
 };
 }
 }
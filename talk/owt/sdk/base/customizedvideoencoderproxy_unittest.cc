@@ -0,0 +1,146 @@
+// Copyright (C) <2026> Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+#include <algorithm>
+#include <vector>
+#include "talk/owt/sdk/base/customizedencoderbufferhandle.h"
+#include "talk/owt/sdk/base/customizedvideoencoderproxy.h"
+#include "talk/owt/sdk/base/memoryaccount.h"
+#include "talk/owt/sdk/base/seicomposer.h"
+#include "testing/gtest/include/gtest/gtest.h"
+#include "webrtc/api/make_ref_counted.h"
+#include "webrtc/modules/video_coding/include/video_codec_interface.h"
+#include "webrtc/modules/video_coding/include/video_error_codes.h"
+
+namespace owt {
+namespace base {
+namespace {
+constexpr int kWidth = 320;
+constexpr int kHeight = 240;
+
+// Keeps the encoded images it receives.
+class EncodedImageRecorder : public webrtc::EncodedImageCallback {
+ public:
+  Result OnEncodedImage(
+      const webrtc::EncodedImage& image,
+      const webrtc::CodecSpecificInfo* codec_specific_info) override {
+    images.push_back(image);
+    return Result(Result::OK);
+  }
+  std::vector<webrtc::EncodedImage> images;
+};
+
+// Builds an encoded frame the way CustomizedFramesCapturer does, with
+// |headroom| writable bytes in front of the bitstream.
+webrtc::VideoFrame EncodedFrame(const std::vector<uint8_t>& bitstream,
+                                const std::vector<uint8_t>& side_data,
+                                size_t headroom) {
+  CustomizedEncoderBufferHandle2* handle = new CustomizedEncoderBufferHandle2;
+  handle->width_ = kWidth;
+  handle->height_ = kHeight;
+  if (!side_data.empty()) {
+    std::copy(side_data.begin(), side_data.end(),
+              handle->meta_data_.encoded_image_sidedata_new(side_data.size()));
+  }
+  uint8_t* frame_buffer = new uint8_t[headroom + bitstream.size()];
+  MemoryAccount::Process()->Add(MemoryCategory::kEncodedFrames,
+                                headroom + bitstream.size());
+  std::copy(bitstream.begin(), bitstream.end(), frame_buffer + headroom);
+  handle->buffer_ = frame_buffer + headroom;
+  handle->buffer_length_ = bitstream.size();
+  handle->buffer_headroom_ = headroom;
+  return webrtc::VideoFrame::Builder()
+      .set_video_frame_buffer(
+          rtc::make_ref_counted<EncodedFrameBuffer2>(handle))
+      .set_timestamp_rtp(3000)
+      .build();
+}
+
+CustomizedEncoderBufferHandle2* HandleOf(const webrtc::VideoFrame& frame) {
+  return static_cast<CustomizedEncoderBufferHandle2*>(
+      static_cast<EncodedFrameBuffer2*>(frame.video_frame_buffer().get())
+          ->native_handle());
+}
+
+class CustomizedVideoEncoderProxyTest : public ::testing::Test {
+ protected:
+  CustomizedVideoEncoderProxyTest()
+      : bitstream_({0, 0, 0, 1, 0x65, 0x88, 0x84, 0x21}),
+        side_data_({0x11, 0x22, 0x33, 0x44}) {}
+  std::unique_ptr<CustomizedVideoEncoderProxy> CreateProxy(
+      webrtc::VideoCodecType codec_type,
+      EncodedImageRecorder* recorder) {
+    webrtc::VideoCodec codec;
+    codec.codecType = codec_type;
+    codec.width = kWidth;
+    codec.height = kHeight;
+    codec.startBitrate = 500;
+    std::unique_ptr<CustomizedVideoEncoderProxy> proxy =
+        CustomizedVideoEncoderProxy::Create();
+    EXPECT_EQ(WEBRTC_VIDEO_CODEC_OK, proxy->InitEncode(&codec, 1, 1200));
+    proxy->RegisterEncodeCompleteCallback(recorder);
+    return proxy;
+  }
+  // SEI the proxies are expected to send in front of |bitstream_|.
+  std::vector<uint8_t> ExpectedSei(webrtc::VideoCodecType codec_type) {
+    std::vector<uint8_t> sei(SeiComposer::MaxSize(side_data_.size(), 0));
+    sei.resize(SeiComposer(codec_type).Compose(
+        side_data_.data(), side_data_.size(), nullptr, 0, sei.data()));
+    return sei;
+  }
+
+  const std::vector<uint8_t> bitstream_;
+  const std::vector<uint8_t> side_data_;
+};
+}  // namespace
+
+TEST_F(CustomizedVideoEncoderProxyTest, ComposesSeiOnceIntoHeadroom) {
+  EncodedImageRecorder first_recorder;
+  EncodedImageRecorder second_recorder;
+  auto first = CreateProxy(webrtc::kVideoCodecH264, &first_recorder);
+  auto second = CreateProxy(webrtc::kVideoCodecH264, &second_recorder);
+  webrtc::VideoFrame frame =
+      EncodedFrame(bitstream_, side_data_,
+                   SeiComposer::MaxSize(side_data_.size(), 0));
+  const uint8_t* payload = HandleOf(frame)->buffer_;
+  ASSERT_EQ(WEBRTC_VIDEO_CODEC_OK, first->Encode(frame, nullptr));
+  ASSERT_EQ(WEBRTC_VIDEO_CODEC_OK, second->Encode(frame, nullptr));
+  ASSERT_EQ(1u, first_recorder.images.size());
+  ASSERT_EQ(1u, second_recorder.images.size());
+
+  std::vector<uint8_t> expected = ExpectedSei(webrtc::kVideoCodecH264);
+  expected.insert(expected.end(), bitstream_.begin(), bitstream_.end());
+  for (const auto* recorder : {&first_recorder, &second_recorder}) {
+    const webrtc::EncodedImage& image = recorder->images[0];
+    EXPECT_EQ(expected, std::vector<uint8_t>(image.data(),
+                                             image.data() + image.size()));
+    // Both refer to the frame buffer instead of a copy.
+    EXPECT_EQ(payload + bitstream_.size(), image.data() + image.size());
+  }
+}
+
+TEST_F(CustomizedVideoEncoderProxyTest, CopiesWithoutHeadroom) {
+  EncodedImageRecorder recorder;
+  auto proxy = CreateProxy(webrtc::kVideoCodecH264, &recorder);
+  webrtc::VideoFrame frame = EncodedFrame(bitstream_, side_data_, 0);
+  ASSERT_EQ(WEBRTC_VIDEO_CODEC_OK, proxy->Encode(frame, nullptr));
+  ASSERT_EQ(1u, recorder.images.size());
+  std::vector<uint8_t> expected = ExpectedSei(webrtc::kVideoCodecH264);
+  expected.insert(expected.end(), bitstream_.begin(), bitstream_.end());
+  const webrtc::EncodedImage& image = recorder.images[0];
+  EXPECT_EQ(expected,
+            std::vector<uint8_t>(image.data(), image.data() + image.size()));
+  EXPECT_EQ(bitstream_.size(), HandleOf(frame)->buffer_length_);
+}
+
+TEST_F(CustomizedVideoEncoderProxyTest, FramesWithoutSideDataAreNotCopied) {
+  EncodedImageRecorder recorder;
+  auto proxy = CreateProxy(webrtc::kVideoCodecH264, &recorder);
+  webrtc::VideoFrame frame = EncodedFrame(bitstream_, {}, 0);
+  ASSERT_EQ(WEBRTC_VIDEO_CODEC_OK, proxy->Encode(frame, nullptr));
+  ASSERT_EQ(1u, recorder.images.size());
+  EXPECT_EQ(HandleOf(frame)->buffer_, recorder.images[0].data());
+  EXPECT_EQ(bitstream_.size(), recorder.images[0].size());
+}
+}  // namespace base
+}  // namespace owt
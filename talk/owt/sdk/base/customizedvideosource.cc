@@ -5,9 +5,15 @@
 #include "talk/owt/sdk/base/customizedframescapturer.h"
 #include "talk/owt/sdk/base/desktopcapturer.h"
 #include "talk/owt/sdk/base/customizedvideosource.h"
+#include "api/video/i420_buffer.h"
+#include "api/video/nv12_buffer.h"
 
 namespace owt {
 namespace base {
+namespace {
+// Scaled frames the encoder pipeline may hold at a time.
+const size_t kMaxScaledBuffers = 8;
+}  // namespace
 
 rtc::scoped_refptr<webrtc::VideoCaptureModule>
 CustomizedVideoCapturerFactory::Create(
@@ -43,13 +49,75 @@ CustomizedVideoCapturerFactory::Create(
 }
 #endif
 
-  CustomizedVideoSource::CustomizedVideoSource() = default;
+  CustomizedVideoSource::CustomizedVideoSource()
+      : scaled_buffer_pool_(/*zero_initialize=*/false, kMaxScaledBuffers) {}
   CustomizedVideoSource::~CustomizedVideoSource() = default;
 
   void CustomizedVideoSource::OnFrame(const webrtc::VideoFrame& frame) {
-    // TODO(johny): We need to adapt frame for yuv input here, but not for
-    // encoded input.
-    broadcaster_.OnFrame(frame);
+    // Encoded frames cannot be adapted.
+    if (frame.video_frame_buffer()->type() ==
+        webrtc::VideoFrameBuffer::Type::kNative) {
+      broadcaster_.OnFrame(frame);
+      return;
+    }
+    int cropped_width = 0;
+    int cropped_height = 0;
+    int out_width = 0;
+    int out_height = 0;
+    if (!video_adapter_.AdaptFrameResolution(
+            frame.width(), frame.height(), frame.timestamp_us() * 1000,
+            &cropped_width, &cropped_height, &out_width, &out_height)) {
+      // Drop frame in order to respect frame rate constraint.
+      broadcaster_.OnDiscardedFrame();
+      return;
+    }
+    if (out_width == frame.width() && out_height == frame.height()) {
+      broadcaster_.OnFrame(frame);
+      return;
+    }
+    rtc::scoped_refptr<webrtc::VideoFrameBuffer> scaled_buffer =
+        ScaleBuffer(frame.video_frame_buffer(), cropped_width, cropped_height,
+                    out_width, out_height);
+    if (!scaled_buffer) {
+      // No pooled buffer is free, or the frame cannot be converted.
+      broadcaster_.OnDiscardedFrame();
+      return;
+    }
+    webrtc::VideoFrame scaled_frame(frame);
+    scaled_frame.set_video_frame_buffer(scaled_buffer);
+    broadcaster_.OnFrame(scaled_frame);
+  }
+
+  rtc::scoped_refptr<webrtc::VideoFrameBuffer>
+  CustomizedVideoSource::ScaleBuffer(
+      rtc::scoped_refptr<webrtc::VideoFrameBuffer> buffer,
+      int cropped_width,
+      int cropped_height,
+      int out_width,
+      int out_height) {
+    // Crops the center of the frame to the adapted aspect ratio and scales it
+    // with libyuv. NV12 stays NV12 so encoders taking it are not given a
+    // converted frame. Other layouts are scaled as I420.
+    int offset_x = (buffer->width() - cropped_width) / 2;
+    int offset_y = (buffer->height() - cropped_height) / 2;
+    if (buffer->type() == webrtc::VideoFrameBuffer::Type::kNV12) {
+      rtc::scoped_refptr<webrtc::NV12Buffer> scaled_buffer =
+          scaled_buffer_pool_.CreateNV12Buffer(out_width, out_height);
+      if (scaled_buffer) {
+        scaled_buffer->CropAndScaleFrom(*buffer->GetNV12(), offset_x,
+                                        offset_y, cropped_width,
+                                        cropped_height);
+      }
+      return scaled_buffer;
+    }
+    rtc::scoped_refptr<webrtc::I420BufferInterface> source = buffer->ToI420();
+    rtc::scoped_refptr<webrtc::I420Buffer> scaled_buffer =
+        scaled_buffer_pool_.CreateI420Buffer(out_width, out_height);
+    if (!source || !scaled_buffer)
+      return nullptr;
+    scaled_buffer->CropAndScaleFrom(*source, offset_x, offset_y,
+                                    cropped_width, cropped_height);
+    return scaled_buffer;
   }
 
   void CustomizedVideoSource::AddOrUpdateSink(
@@ -69,7 +137,7 @@ CustomizedVideoCapturerFactory::Create(
   }
 
   void CustomizedVideoSource::UpdateVideoAdapter() {
-    // NOT Implemented.
+    video_adapter_.OnSinkWants(broadcaster_.wants());
   }
 
   CustomizedCapturer* CustomizedCapturer::Create(
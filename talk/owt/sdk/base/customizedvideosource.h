@@ -8,6 +8,7 @@
 #include "api/video/video_frame.h"
 #include "api/video/video_rotation.h"
 #include "api/video/video_sink_interface.h"
+#include "common_video/include/video_frame_buffer_pool.h"
 #include "media/base/video_adapter.h"
 #include "media/base/video_broadcaster.h"
 #include "modules/video_capture/video_capture.h"
@@ -40,6 +41,10 @@ class CustomizedVideoCapturerFactory {
 #endif
 };
 
+// Video source of raw or encoded frames fed by the application. Raw frames
+// are adapted to the sink wants, so CPU and bandwidth adaptation can lower
+// the resolution and frame rate the encoder works on. Encoded frames are
+// passed through as is.
 class CustomizedVideoSource
     : public rtc::VideoSourceInterface<webrtc::VideoFrame> {
  public:
@@ -56,9 +61,18 @@ class CustomizedVideoSource
 
  private:
   void UpdateVideoAdapter();
+  // Returns null if no pooled buffer is free.
+  rtc::scoped_refptr<webrtc::VideoFrameBuffer> ScaleBuffer(
+      rtc::scoped_refptr<webrtc::VideoFrameBuffer> buffer,
+      int cropped_width,
+      int cropped_height,
+      int out_width,
+      int out_height);
 
   rtc::VideoBroadcaster broadcaster_;
   cricket::VideoAdapter video_adapter_;
+  // Scaled frames. Only used on the thread delivering frames.
+  webrtc::VideoFrameBufferPool scaled_buffer_pool_;
 };
 
 // The proxy capturer to actual VideoCaptureModule implementation.
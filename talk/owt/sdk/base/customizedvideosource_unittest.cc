@@ -0,0 +1,117 @@
+// Copyright (C) <2026> Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+#include "talk/owt/sdk/base/customizedvideosource.h"
+#include "testing/gtest/include/gtest/gtest.h"
+#include "webrtc/api/video/i420_buffer.h"
+#include "webrtc/api/video/nv12_buffer.h"
+#include "webrtc/rtc_base/time_utils.h"
+
+namespace owt {
+namespace base {
+namespace {
+constexpr int kWidth = 1280;
+constexpr int kHeight = 720;
+constexpr int kFps = 30;
+
+class TestVideoSource : public CustomizedVideoSource {
+ public:
+  using CustomizedVideoSource::OnFrame;
+};
+
+// Counts what reaches the encoder. Encode CPU grows with the pixels encoded
+// per second.
+class CountingSink : public rtc::VideoSinkInterface<webrtc::VideoFrame> {
+ public:
+  void OnFrame(const webrtc::VideoFrame& frame) override {
+    frames++;
+    pixels += frame.width() * frame.height();
+    width = frame.width();
+    height = frame.height();
+    type = frame.video_frame_buffer()->type();
+  }
+  void OnDiscardedFrame() override { discarded++; }
+  int frames = 0;
+  int discarded = 0;
+  int64_t pixels = 0;
+  int width = 0;
+  int height = 0;
+  webrtc::VideoFrameBuffer::Type type = webrtc::VideoFrameBuffer::Type::kI420;
+};
+
+// Feeds one second of 720p30 to |source|.
+void FeedOneSecond(TestVideoSource* source, int64_t* timestamp_us) {
+  rtc::scoped_refptr<webrtc::I420Buffer> buffer =
+      webrtc::I420Buffer::Create(kWidth, kHeight);
+  webrtc::I420Buffer::SetBlack(buffer.get());
+  for (int i = 0; i < kFps; i++) {
+    source->OnFrame(webrtc::VideoFrame::Builder()
+                        .set_video_frame_buffer(buffer)
+                        .set_timestamp_us(*timestamp_us)
+                        .build());
+    *timestamp_us += rtc::kNumMicrosecsPerSec / kFps;
+  }
+}
+}  // namespace
+
+TEST(CustomizedVideoSourceTest, PassesFramesThroughWithoutConstraints) {
+  TestVideoSource source;
+  CountingSink sink;
+  source.AddOrUpdateSink(&sink, rtc::VideoSinkWants());
+  int64_t timestamp_us = 0;
+  FeedOneSecond(&source, &timestamp_us);
+  EXPECT_EQ(kFps, sink.frames);
+  EXPECT_EQ(0, sink.discarded);
+  EXPECT_EQ(kWidth, sink.width);
+  EXPECT_EQ(kHeight, sink.height);
+  source.RemoveSink(&sink);
+}
+
+TEST(CustomizedVideoSourceTest, ShrinkingWantsLowerEncodedPixelRate) {
+  TestVideoSource source;
+  CountingSink sink;
+  source.AddOrUpdateSink(&sink, rtc::VideoSinkWants());
+  int64_t timestamp_us = 0;
+  FeedOneSecond(&source, &timestamp_us);
+  const int64_t full_pixel_rate = sink.pixels;
+
+  // What CPU overuse detection asks for on an overloaded encoder.
+  rtc::VideoSinkWants wants;
+  wants.max_pixel_count = kWidth * kHeight / 4;
+  wants.max_framerate_fps = kFps / 2;
+  source.AddOrUpdateSink(&sink, wants);
+  sink = CountingSink();
+  FeedOneSecond(&source, &timestamp_us);
+  EXPECT_LE(sink.width * sink.height, wants.max_pixel_count);
+  EXPECT_EQ(kWidth * sink.height, kHeight * sink.width);
+  EXPECT_NEAR(kFps / 2, sink.frames, 1);
+  EXPECT_EQ(kFps, sink.frames + sink.discarded);
+  EXPECT_LE(sink.pixels * 7, full_pixel_rate);
+
+  // Lifting the constraints restores full resolution and frame rate.
+  source.AddOrUpdateSink(&sink, rtc::VideoSinkWants());
+  sink = CountingSink();
+  FeedOneSecond(&source, &timestamp_us);
+  EXPECT_EQ(full_pixel_rate, sink.pixels);
+  source.RemoveSink(&sink);
+}
+
+TEST(CustomizedVideoSourceTest, ScalesNv12WithoutConversion) {
+  TestVideoSource source;
+  CountingSink sink;
+  rtc::VideoSinkWants wants;
+  wants.max_pixel_count = kWidth * kHeight / 4;
+  source.AddOrUpdateSink(&sink, wants);
+  rtc::scoped_refptr<webrtc::NV12Buffer> buffer =
+      webrtc::NV12Buffer::Create(kWidth, kHeight);
+  source.OnFrame(webrtc::VideoFrame::Builder()
+                     .set_video_frame_buffer(buffer)
+                     .set_timestamp_us(0)
+                     .build());
+  EXPECT_EQ(1, sink.frames);
+  EXPECT_EQ(webrtc::VideoFrameBuffer::Type::kNV12, sink.type);
+  EXPECT_LE(sink.width * sink.height, wants.max_pixel_count);
+  source.RemoveSink(&sink);
+}
+}  // namespace base
+}  // namespace owt
@@ -0,0 +1,71 @@
+// Copyright (C) <2026> Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "talk/owt/sdk/base/dumpingvideodecoderfactory.h"
+#include "talk/owt/sdk/base/bitstreamdumpwriter.h"
+
+namespace owt {
+namespace base {
+namespace {
+class DumpingVideoDecoder : public webrtc::VideoDecoder {
+ public:
+  explicit DumpingVideoDecoder(std::unique_ptr<webrtc::VideoDecoder> decoder)
+      : decoder_(std::move(decoder)) {}
+  ~DumpingVideoDecoder() override {}
+
+  bool Configure(const Settings& settings) override {
+    dump_ = BitstreamDumpWriter::Get()->CreateStream("recv",
+                                                     settings.codec_type());
+    return decoder_->Configure(settings);
+  }
+  int32_t Decode(const webrtc::EncodedImage& input_image,
+                 bool missing_frames,
+                 int64_t render_time_ms) override {
+    if (dump_)
+      dump_->Write(input_image);
+    return decoder_->Decode(input_image, missing_frames, render_time_ms);
+  }
+  int32_t RegisterDecodeCompleteCallback(
+      webrtc::DecodedImageCallback* callback) override {
+    return decoder_->RegisterDecodeCompleteCallback(callback);
+  }
+  int32_t Release() override {
+    dump_.reset();
+    return decoder_->Release();
+  }
+  DecoderInfo GetDecoderInfo() const override {
+    return decoder_->GetDecoderInfo();
+  }
+  const char* ImplementationName() const override {
+    return decoder_->ImplementationName();
+  }
+
+ private:
+  std::unique_ptr<webrtc::VideoDecoder> decoder_;
+  std::unique_ptr<BitstreamDumpStream> dump_;
+};
+}  // namespace
+
+DumpingVideoDecoderFactory::DumpingVideoDecoderFactory(
+    std::unique_ptr<webrtc::VideoDecoderFactory> factory)
+    : factory_(std::move(factory)) {}
+
+DumpingVideoDecoderFactory::~DumpingVideoDecoderFactory() {}
+
+std::vector<webrtc::SdpVideoFormat>
+DumpingVideoDecoderFactory::GetSupportedFormats() const {
+  return factory_->GetSupportedFormats();
+}
+
+std::unique_ptr<webrtc::VideoDecoder>
+DumpingVideoDecoderFactory::CreateVideoDecoder(
+    const webrtc::SdpVideoFormat& format) {
+  std::unique_ptr<webrtc::VideoDecoder> decoder =
+      factory_->CreateVideoDecoder(format);
+  if (!decoder)
+    return nullptr;
+  return std::make_unique<DumpingVideoDecoder>(std::move(decoder));
+}
+}  // namespace base
+}  // namespace owt
@@ -0,0 +1,32 @@
+// Copyright (C) <2026> Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef OWT_BASE_DUMPINGVIDEODECODERFACTORY_H_
+#define OWT_BASE_DUMPINGVIDEODECODERFACTORY_H_
+
+#include <memory>
+#include <vector>
+#include "webrtc/api/video_codecs/sdp_video_format.h"
+#include "webrtc/api/video_codecs/video_decoder.h"
+#include "webrtc/api/video_codecs/video_decoder_factory.h"
+
+namespace owt {
+namespace base {
+// Wraps decoders of another factory so their input bitstream is dumped by
+// BitstreamDumpWriter before decoding.
+class DumpingVideoDecoderFactory : public webrtc::VideoDecoderFactory {
+ public:
+  explicit DumpingVideoDecoderFactory(
+      std::unique_ptr<webrtc::VideoDecoderFactory> factory);
+  ~DumpingVideoDecoderFactory() override;
+  std::vector<webrtc::SdpVideoFormat> GetSupportedFormats() const override;
+  std::unique_ptr<webrtc::VideoDecoder> CreateVideoDecoder(
+      const webrtc::SdpVideoFormat& format) override;
+
+ private:
+  std::unique_ptr<webrtc::VideoDecoderFactory> factory_;
+};
+}  // namespace base
+}  // namespace owt
+#endif  // OWT_BASE_DUMPINGVIDEODECODERFACTORY_H_
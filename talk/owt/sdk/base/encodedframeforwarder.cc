@@ -0,0 +1,247 @@
+// Copyright (C) <2026> Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "talk/owt/sdk/base/encodedframeforwarder.h"
+#include "absl/types/optional.h"
+#include "absl/types/variant.h"
+#include "webrtc/api/make_ref_counted.h"
+#include "webrtc/modules/rtp_rtcp/source/rtp_video_header.h"
+#include "webrtc/modules/video_coding/include/video_error_codes.h"
+#include "webrtc/rtc_base/logging.h"
+
+namespace owt {
+namespace base {
+namespace {
+VideoCodec ToOwtCodec(webrtc::VideoCodecType type) {
+  switch (type) {
+    case webrtc::kVideoCodecVP8:
+      return VideoCodec::kVp8;
+    case webrtc::kVideoCodecVP9:
+      return VideoCodec::kVp9;
+    case webrtc::kVideoCodecH264:
+      return VideoCodec::kH264;
+#ifdef WEBRTC_USE_H265
+    case webrtc::kVideoCodecH265:
+      return VideoCodec::kH265;
+#endif
+    case webrtc::kVideoCodecAV1:
+      return VideoCodec::kAv1;
+    default:
+      return VideoCodec::kUnknown;
+  }
+}
+}  // namespace
+
+// Owns the transformable frame handed out by WebRTC, so Data() points into
+// WebRTC's own encoded buffer. The frame goes back to WebRTC, without its
+// payload, when application releases the last reference.
+class EncodedFrameForwarder::ReceivedEncodedFrameImpl
+    : public VideoReceivedEncodedFrame {
+ public:
+  ReceivedEncodedFrameImpl(
+      rtc::scoped_refptr<EncodedFrameForwarder> forwarder,
+      std::unique_ptr<webrtc::TransformableVideoFrameInterface> frame)
+      : forwarder_(forwarder), frame_(std::move(frame)) {
+    const webrtc::VideoFrameMetadata metadata = frame_->Metadata();
+    info_.codec = ToOwtCodec(metadata.GetCodec());
+    info_.rtp_timestamp = frame_->GetTimestamp();
+    info_.ssrc = frame_->GetSsrc();
+    info_.is_key_frame = frame_->IsKeyFrame();
+    info_.width = metadata.GetWidth();
+    info_.height = metadata.GetHeight();
+    if (metadata.GetFrameId())
+      info_.frame_id = *metadata.GetFrameId();
+    info_.spatial_index = metadata.GetSpatialIndex();
+    info_.temporal_index = metadata.GetTemporalIndex();
+    auto dependencies = metadata.GetFrameDependencies();
+    info_.dependencies.assign(dependencies.begin(), dependencies.end());
+    const auto& codec_specifics = metadata.GetRTPVideoHeaderCodecSpecifics();
+    if (auto* vp8 = absl::get_if<webrtc::RTPVideoHeaderVP8>(&codec_specifics)) {
+      info_.picture_id = vp8->pictureId;
+      info_.tl0_pic_idx = vp8->tl0PicIdx;
+    } else if (auto* vp9 =
+                   absl::get_if<webrtc::RTPVideoHeaderVP9>(&codec_specifics)) {
+      info_.picture_id = vp9->picture_id;
+      info_.tl0_pic_idx = vp9->tl0_pic_idx;
+    }
+  }
+  ~ReceivedEncodedFrameImpl() override {
+    forwarder_->ReturnFrame(std::move(frame_), true);
+  }
+  const uint8_t* Data() const override { return frame_->GetData().data(); }
+  size_t Size() const override { return frame_->GetData().size(); }
+  const VideoReceivedEncodedFrameInfo& Info() const override { return info_; }
+
+ private:
+  rtc::scoped_refptr<EncodedFrameForwarder> forwarder_;
+  std::unique_ptr<webrtc::TransformableVideoFrameInterface> frame_;
+  VideoReceivedEncodedFrameInfo info_;
+};
+
+rtc::scoped_refptr<EncodedFrameForwarder> EncodedFrameForwarder::Create(
+    std::shared_ptr<VideoEncodedFrameObserver> observer) {
+  return rtc::make_ref_counted<EncodedFrameForwarder>(observer);
+}
+
+EncodedFrameForwarder::EncodedFrameForwarder(
+    std::shared_ptr<VideoEncodedFrameObserver> observer)
+    : observer_(observer) {}
+
+EncodedFrameForwarder::~EncodedFrameForwarder() {}
+
+void EncodedFrameForwarder::Detach() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  observer_.reset();
+}
+
+void EncodedFrameForwarder::Transform(
+    std::unique_ptr<webrtc::TransformableFrameInterface> transformable_frame) {
+  if (!transformable_frame)
+    return;
+  std::shared_ptr<VideoEncodedFrameObserver> observer;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    observer = observer_;
+  }
+  // Frames of other directions, and all frames after Detach(), are left to
+  // WebRTC as they are.
+  if (!observer ||
+      transformable_frame->GetDirection() !=
+          webrtc::TransformableFrameInterface::Direction::kReceiver) {
+    ReturnFrame(std::move(transformable_frame), false);
+    return;
+  }
+  std::unique_ptr<webrtc::TransformableVideoFrameInterface> video_frame(
+      static_cast<webrtc::TransformableVideoFrameInterface*>(
+          transformable_frame.release()));
+  observer->OnEncodedFrame(std::make_shared<ReceivedEncodedFrameImpl>(
+      rtc::scoped_refptr<EncodedFrameForwarder>(this), std::move(video_frame)));
+}
+
+void EncodedFrameForwarder::ReturnFrame(
+    std::unique_ptr<webrtc::TransformableFrameInterface> frame,
+    bool strip_payload) {
+  rtc::scoped_refptr<webrtc::TransformedFrameCallback> callback;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = sink_callbacks_.find(frame->GetSsrc());
+    callback = it != sink_callbacks_.end() ? it->second : callback_;
+  }
+  if (!callback)
+    return;
+  if (strip_payload)
+    frame->SetData(rtc::ArrayView<const uint8_t>());
+  callback->OnTransformedFrame(std::move(frame));
+}
+
+void EncodedFrameForwarder::RegisterTransformedFrameCallback(
+    rtc::scoped_refptr<webrtc::TransformedFrameCallback> callback) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  callback_ = callback;
+}
+
+void EncodedFrameForwarder::RegisterTransformedFrameSinkCallback(
+    rtc::scoped_refptr<webrtc::TransformedFrameCallback> callback,
+    uint32_t ssrc) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  sink_callbacks_[ssrc] = callback;
+}
+
+void EncodedFrameForwarder::UnregisterTransformedFrameCallback() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  callback_ = nullptr;
+}
+
+void EncodedFrameForwarder::UnregisterTransformedFrameSinkCallback(
+    uint32_t ssrc) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  sink_callbacks_.erase(ssrc);
+}
+
+namespace {
+// Decodes frames with the wrapped decoder, and accepts empty frames from
+// pass-through receivers without output. The wrapped decoder is created on
+// the first non-empty frame, and released again on the next empty one.
+class PassThroughVideoDecoder : public webrtc::VideoDecoder {
+ public:
+  PassThroughVideoDecoder(webrtc::VideoDecoderFactory* factory,
+                          const webrtc::SdpVideoFormat& format)
+      : factory_(factory), format_(format) {}
+  ~PassThroughVideoDecoder() override {}
+
+  bool Configure(const Settings& settings) override {
+    settings_ = settings;
+    return !decoder_ || decoder_->Configure(settings);
+  }
+  int32_t Decode(const webrtc::EncodedImage& input_image,
+                 bool missing_frames,
+                 int64_t render_time_ms) override {
+    if (input_image.size() == 0) {
+      if (decoder_) {
+        RTC_LOG(LS_INFO) << "Releasing decoder of pass-through receiver.";
+        decoder_->Release();
+        decoder_.reset();
+      }
+      return WEBRTC_VIDEO_CODEC_OK;
+    }
+    if (!decoder_) {
+      decoder_ = factory_->CreateVideoDecoder(format_);
+      if (!decoder_ || (settings_ && !decoder_->Configure(*settings_))) {
+        decoder_.reset();
+        return WEBRTC_VIDEO_CODEC_ERROR;
+      }
+      if (callback_)
+        decoder_->RegisterDecodeCompleteCallback(callback_);
+    }
+    return decoder_->Decode(input_image, missing_frames, render_time_ms);
+  }
+  int32_t RegisterDecodeCompleteCallback(
+      webrtc::DecodedImageCallback* callback) override {
+    callback_ = callback;
+    return decoder_ ? decoder_->RegisterDecodeCompleteCallback(callback)
+                    : WEBRTC_VIDEO_CODEC_OK;
+  }
+  int32_t Release() override {
+    return decoder_ ? decoder_->Release() : WEBRTC_VIDEO_CODEC_OK;
+  }
+  DecoderInfo GetDecoderInfo() const override {
+    if (decoder_)
+      return decoder_->GetDecoderInfo();
+    DecoderInfo info;
+    info.implementation_name = "PassThrough";
+    return info;
+  }
+  const char* ImplementationName() const override {
+    return decoder_ ? decoder_->ImplementationName() : "PassThrough";
+  }
+
+ private:
+  webrtc::VideoDecoderFactory* const factory_;
+  const webrtc::SdpVideoFormat format_;
+  std::unique_ptr<webrtc::VideoDecoder> decoder_;
+  absl::optional<Settings> settings_;
+  webrtc::DecodedImageCallback* callback_ = nullptr;
+};
+}  // namespace
+
+PassThroughVideoDecoderFactory::PassThroughVideoDecoderFactory(
+    std::unique_ptr<webrtc::VideoDecoderFactory> factory)
+    : factory_(std::move(factory)) {}
+
+PassThroughVideoDecoderFactory::~PassThroughVideoDecoderFactory() {}
+
+std::vector<webrtc::SdpVideoFormat>
+PassThroughVideoDecoderFactory::GetSupportedFormats() const {
+  return factory_->GetSupportedFormats();
+}
+
+std::unique_ptr<webrtc::VideoDecoder>
+PassThroughVideoDecoderFactory::CreateVideoDecoder(
+    const webrtc::SdpVideoFormat& format) {
+  if (!format.IsCodecInList(factory_->GetSupportedFormats()))
+    return nullptr;
+  return std::make_unique<PassThroughVideoDecoder>(factory_.get(), format);
+}
+}  // namespace base
+}  // namespace owt
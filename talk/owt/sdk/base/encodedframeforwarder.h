@@ -0,0 +1,83 @@
+// Copyright (C) <2026> Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef OWT_BASE_ENCODEDFRAMEFORWARDER_H_
+#define OWT_BASE_ENCODEDFRAMEFORWARDER_H_
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include "webrtc/api/frame_transformer_interface.h"
+#include "webrtc/api/scoped_refptr.h"
+#include "webrtc/api/video_codecs/sdp_video_format.h"
+#include "webrtc/api/video_codecs/video_decoder.h"
+#include "webrtc/api/video_codecs/video_decoder_factory.h"
+#include "talk/owt/sdk/include/cpp/owt/base/videodecoderinterface.h"
+
+namespace owt {
+namespace base {
+// Installed as the depacketizer-to-decoder frame transformer of a video
+// receiver. Complete encoded frames assembled by the RTP receiver are handed
+// to a VideoEncodedFrameObserver instead of the decoder. Once the observer
+// releases a frame, it is returned to WebRTC with an empty payload, which
+// PassThroughVideoDecoderFactory's decoders accept without decoding. This
+// keeps the receive stream from treating itself as stalled and sending key
+// frame requests to the publisher.
+class EncodedFrameForwarder : public webrtc::FrameTransformerInterface {
+ public:
+  static rtc::scoped_refptr<EncodedFrameForwarder> Create(
+      std::shared_ptr<VideoEncodedFrameObserver> observer);
+  explicit EncodedFrameForwarder(
+      std::shared_ptr<VideoEncodedFrameObserver> observer);
+  ~EncodedFrameForwarder() override;
+  // Stop delivering frames. Frames already handed to observer stay valid.
+  // Later frames are returned to WebRTC unchanged.
+  void Detach();
+  // Implements webrtc::FrameTransformerInterface.
+  void Transform(std::unique_ptr<webrtc::TransformableFrameInterface>
+                     transformable_frame) override;
+  void RegisterTransformedFrameCallback(
+      rtc::scoped_refptr<webrtc::TransformedFrameCallback> callback) override;
+  void RegisterTransformedFrameSinkCallback(
+      rtc::scoped_refptr<webrtc::TransformedFrameCallback> callback,
+      uint32_t ssrc) override;
+  void UnregisterTransformedFrameCallback() override;
+  void UnregisterTransformedFrameSinkCallback(uint32_t ssrc) override;
+
+ private:
+  class ReceivedEncodedFrameImpl;
+  // Hands |frame| back to the receiver it came from. Drops it if the
+  // receiver has unregistered. If |strip_payload| is true, the payload is
+  // replaced by an empty one first.
+  void ReturnFrame(std::unique_ptr<webrtc::TransformableFrameInterface> frame,
+                   bool strip_payload);
+
+  std::mutex mutex_;
+  std::shared_ptr<VideoEncodedFrameObserver> observer_;
+  rtc::scoped_refptr<webrtc::TransformedFrameCallback> callback_;
+  std::map<uint32_t, rtc::scoped_refptr<webrtc::TransformedFrameCallback>>
+      sink_callbacks_;
+};
+
+// Wraps decoders of another factory so they accept the empty frames that
+// EncodedFrameForwarder returns for pass-through receivers. A wrapped
+// decoder is only created when the first non-empty frame arrives, so
+// pass-through receivers never create one. It is released again on the next
+// empty frame.
+class PassThroughVideoDecoderFactory : public webrtc::VideoDecoderFactory {
+ public:
+  explicit PassThroughVideoDecoderFactory(
+      std::unique_ptr<webrtc::VideoDecoderFactory> factory);
+  ~PassThroughVideoDecoderFactory() override;
+  std::vector<webrtc::SdpVideoFormat> GetSupportedFormats() const override;
+  std::unique_ptr<webrtc::VideoDecoder> CreateVideoDecoder(
+      const webrtc::SdpVideoFormat& format) override;
+
+ private:
+  std::unique_ptr<webrtc::VideoDecoderFactory> factory_;
+};
+}  // namespace base
+}  // namespace owt
+#endif  // OWT_BASE_ENCODEDFRAMEFORWARDER_H_
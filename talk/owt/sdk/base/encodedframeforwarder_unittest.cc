@@ -0,0 +1,212 @@
+// Copyright (C) <2026> Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+#include <vector>
+#include "talk/owt/sdk/base/encodedframeforwarder.h"
+#include "testing/gtest/include/gtest/gtest.h"
+#include "webrtc/api/make_ref_counted.h"
+#include "webrtc/api/video/encoded_image.h"
+#include "webrtc/modules/video_coding/include/video_error_codes.h"
+
+namespace owt {
+namespace base {
+namespace {
+using Direction = webrtc::TransformableFrameInterface::Direction;
+
+class FakeVideoFrame : public webrtc::TransformableVideoFrameInterface {
+ public:
+  FakeVideoFrame(Direction direction, uint32_t ssrc)
+      : direction_(direction), ssrc_(ssrc), data_({1, 2, 3, 4}) {}
+  rtc::ArrayView<const uint8_t> GetData() const override { return data_; }
+  void SetData(rtc::ArrayView<const uint8_t> data) override {
+    data_.assign(data.begin(), data.end());
+  }
+  uint32_t GetSsrc() const override { return ssrc_; }
+  uint32_t GetTimestamp() const override { return 3000; }
+  Direction GetDirection() const override { return direction_; }
+  bool IsKeyFrame() const override { return true; }
+  std::vector<uint8_t> GetAdditionalData() const override { return {}; }
+  webrtc::VideoFrameMetadata Metadata() const override { return metadata_; }
+
+ private:
+  const Direction direction_;
+  const uint32_t ssrc_;
+  std::vector<uint8_t> data_;
+  webrtc::VideoFrameMetadata metadata_;
+};
+
+class RecordingCallback : public webrtc::TransformedFrameCallback {
+ public:
+  void OnTransformedFrame(
+      std::unique_ptr<webrtc::TransformableFrameInterface> frame) override {
+    frames.push_back(std::move(frame));
+  }
+  std::vector<std::unique_ptr<webrtc::TransformableFrameInterface>> frames;
+};
+
+class RecordingObserver : public VideoEncodedFrameObserver {
+ public:
+  void OnEncodedFrame(
+      std::shared_ptr<VideoReceivedEncodedFrame> frame) override {
+    frames.push_back(frame);
+  }
+  std::vector<std::shared_ptr<VideoReceivedEncodedFrame>> frames;
+};
+
+class EncodedFrameForwarderTest : public testing::Test {
+ protected:
+  EncodedFrameForwarderTest()
+      : observer_(std::make_shared<RecordingObserver>()),
+        forwarder_(EncodedFrameForwarder::Create(observer_)),
+        callback_(rtc::make_ref_counted<RecordingCallback>()) {
+    forwarder_->RegisterTransformedFrameSinkCallback(callback_, kSsrc);
+  }
+  static constexpr uint32_t kSsrc = 1234;
+  std::shared_ptr<RecordingObserver> observer_;
+  rtc::scoped_refptr<EncodedFrameForwarder> forwarder_;
+  rtc::scoped_refptr<RecordingCallback> callback_;
+};
+}  // namespace
+
+TEST_F(EncodedFrameForwarderTest, ReturnsReceivedFrameWithoutPayload) {
+  forwarder_->Transform(std::make_unique<FakeVideoFrame>(Direction::kReceiver,
+                                                         kSsrc));
+  ASSERT_EQ(1u, observer_->frames.size());
+  EXPECT_EQ(4u, observer_->frames[0]->Size());
+  EXPECT_EQ(1, observer_->frames[0]->Data()[0]);
+  EXPECT_EQ(kSsrc, observer_->frames[0]->Info().ssrc);
+  EXPECT_TRUE(observer_->frames[0]->Info().is_key_frame);
+  // Frame stays with application until it is released.
+  EXPECT_TRUE(callback_->frames.empty());
+  observer_->frames.clear();
+  ASSERT_EQ(1u, callback_->frames.size());
+  EXPECT_EQ(0u, callback_->frames[0]->GetData().size());
+}
+
+TEST_F(EncodedFrameForwarderTest, DetachReturnsFramesUnchanged) {
+  forwarder_->Detach();
+  forwarder_->Transform(std::make_unique<FakeVideoFrame>(Direction::kReceiver,
+                                                         kSsrc));
+  EXPECT_TRUE(observer_->frames.empty());
+  ASSERT_EQ(1u, callback_->frames.size());
+  EXPECT_EQ(4u, callback_->frames[0]->GetData().size());
+}
+
+TEST_F(EncodedFrameForwarderTest, SenderFramesAreNotForwarded) {
+  forwarder_->Transform(std::make_unique<FakeVideoFrame>(Direction::kSender,
+                                                         kSsrc));
+  forwarder_->Transform(std::make_unique<FakeVideoFrame>(Direction::kUnknown,
+                                                         kSsrc));
+  EXPECT_TRUE(observer_->frames.empty());
+  ASSERT_EQ(2u, callback_->frames.size());
+  EXPECT_EQ(4u, callback_->frames[0]->GetData().size());
+  EXPECT_EQ(4u, callback_->frames[1]->GetData().size());
+}
+
+TEST_F(EncodedFrameForwarderTest, FramesGoToCallbackOfTheirSsrc) {
+  auto other_callback = rtc::make_ref_counted<RecordingCallback>();
+  forwarder_->RegisterTransformedFrameCallback(other_callback);
+  forwarder_->Transform(std::make_unique<FakeVideoFrame>(Direction::kSender,
+                                                         kSsrc));
+  forwarder_->Transform(std::make_unique<FakeVideoFrame>(Direction::kSender,
+                                                         kSsrc + 1));
+  EXPECT_EQ(1u, callback_->frames.size());
+  EXPECT_EQ(1u, other_callback->frames.size());
+}
+
+TEST_F(EncodedFrameForwarderTest, FramesReleasedAfterUnregisterAreDropped) {
+  forwarder_->Transform(std::make_unique<FakeVideoFrame>(Direction::kReceiver,
+                                                         kSsrc));
+  ASSERT_EQ(1u, observer_->frames.size());
+  forwarder_->UnregisterTransformedFrameSinkCallback(kSsrc);
+  std::shared_ptr<VideoReceivedEncodedFrame> frame = observer_->frames[0];
+  observer_->frames.clear();
+  // Forwarder is kept alive by the frame.
+  forwarder_ = nullptr;
+  frame.reset();
+  EXPECT_TRUE(callback_->frames.empty());
+}
+
+namespace {
+class CountingDecoder : public webrtc::VideoDecoder {
+ public:
+  explicit CountingDecoder(int* decoded) : decoded_(decoded) {}
+  bool Configure(const Settings& settings) override { return true; }
+  int32_t Decode(const webrtc::EncodedImage& input_image,
+                 bool missing_frames,
+                 int64_t render_time_ms) override {
+    (*decoded_)++;
+    return WEBRTC_VIDEO_CODEC_OK;
+  }
+  int32_t RegisterDecodeCompleteCallback(
+      webrtc::DecodedImageCallback* callback) override {
+    return WEBRTC_VIDEO_CODEC_OK;
+  }
+  int32_t Release() override { return WEBRTC_VIDEO_CODEC_OK; }
+
+ private:
+  int* decoded_;
+};
+
+class CountingDecoderFactory : public webrtc::VideoDecoderFactory {
+ public:
+  std::vector<webrtc::SdpVideoFormat> GetSupportedFormats() const override {
+    return {webrtc::SdpVideoFormat("VP8")};
+  }
+  std::unique_ptr<webrtc::VideoDecoder> CreateVideoDecoder(
+      const webrtc::SdpVideoFormat& format) override {
+    created++;
+    return std::make_unique<CountingDecoder>(&decoded);
+  }
+  int created = 0;
+  int decoded = 0;
+};
+
+webrtc::EncodedImage ImageOfSize(size_t size) {
+  webrtc::EncodedImage image;
+  image.SetEncodedData(webrtc::EncodedImageBuffer::Create(size));
+  return image;
+}
+}  // namespace
+
+TEST(PassThroughVideoDecoderFactoryTest, EmptyFramesCreateNoDecoder) {
+  auto counting_factory = std::make_unique<CountingDecoderFactory>();
+  CountingDecoderFactory* counting = counting_factory.get();
+  PassThroughVideoDecoderFactory factory(std::move(counting_factory));
+  std::unique_ptr<webrtc::VideoDecoder> decoder =
+      factory.CreateVideoDecoder(webrtc::SdpVideoFormat("VP8"));
+  ASSERT_TRUE(decoder);
+  EXPECT_TRUE(decoder->Configure(webrtc::VideoDecoder::Settings()));
+  EXPECT_EQ(WEBRTC_VIDEO_CODEC_OK, decoder->Decode(ImageOfSize(0), false, 0));
+  EXPECT_EQ(WEBRTC_VIDEO_CODEC_OK, decoder->Decode(ImageOfSize(0), false, 0));
+  EXPECT_EQ(0, counting->created);
+  EXPECT_EQ(0, counting->decoded);
+}
+
+TEST(PassThroughVideoDecoderFactoryTest, NonEmptyFramesCreateDecoder) {
+  auto counting_factory = std::make_unique<CountingDecoderFactory>();
+  CountingDecoderFactory* counting = counting_factory.get();
+  PassThroughVideoDecoderFactory factory(std::move(counting_factory));
+  std::unique_ptr<webrtc::VideoDecoder> decoder =
+      factory.CreateVideoDecoder(webrtc::SdpVideoFormat("VP8"));
+  ASSERT_TRUE(decoder);
+  EXPECT_TRUE(decoder->Configure(webrtc::VideoDecoder::Settings()));
+  EXPECT_EQ(0, counting->created);
+  EXPECT_EQ(WEBRTC_VIDEO_CODEC_OK, decoder->Decode(ImageOfSize(10), false, 0));
+  EXPECT_EQ(1, counting->created);
+  EXPECT_EQ(1, counting->decoded);
+  EXPECT_EQ(WEBRTC_VIDEO_CODEC_OK, decoder->Decode(ImageOfSize(0), false, 0));
+  EXPECT_EQ(1, counting->decoded);
+  // A non-empty frame after pass-through gets a new decoder.
+  EXPECT_EQ(WEBRTC_VIDEO_CODEC_OK, decoder->Decode(ImageOfSize(10), false, 0));
+  EXPECT_EQ(2, counting->decoded);
+  EXPECT_EQ(2, counting->created);
+}
+
+TEST(PassThroughVideoDecoderFactoryTest, UnsupportedFormatHasNoDecoder) {
+  PassThroughVideoDecoderFactory factory(
+      std::make_unique<CountingDecoderFactory>());
+  EXPECT_FALSE(factory.CreateVideoDecoder(webrtc::SdpVideoFormat("VP9")));
+}
+}  // namespace base
+}  // namespace owt
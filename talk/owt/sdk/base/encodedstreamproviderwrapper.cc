@@ -3,10 +3,36 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include <algorithm>
+#include <cstring>
+#include "talk/owt/sdk/base/bitrateladder.h"
 #include "talk/owt/sdk/base/encodedstreamproviderwrapper.h"
+#include "talk/owt/sdk/base/keyframerequestlimiter.h"
+#include "webrtc/rtc_base/time_utils.h"
 
 namespace owt {
 namespace base {
+namespace {
+// EncodedImageMetaData owns its side data and cursor data, so it is copied
+// member by member.
+void CopyMetaData(const EncodedImageMetaData& from, EncodedImageMetaData* to) {
+  to->picture_id = from.picture_id;
+  to->last_fragment = from.last_fragment;
+  to->capture_timestamp = from.capture_timestamp;
+  to->encoding_start = from.encoding_start;
+  to->encoding_end = from.encoding_end;
+  to->frame_descriptor = from.frame_descriptor;
+  to->is_keyframe = from.is_keyframe;
+  if (from.encoded_image_sidedata_size() > 0) {
+    memcpy(to->encoded_image_sidedata_new(from.encoded_image_sidedata_size()),
+           from.encoded_image_sidedata_get(),
+           from.encoded_image_sidedata_size());
+  }
+  if (from.cursor_data_size() > 0) {
+    memcpy(to->cursor_data_new(from.cursor_data_size()),
+           from.cursor_data_get(), from.cursor_data_size());
+  }
+}
+}  // namespace
 
 EncodedStreamProviderWrapper::EncodedStreamProviderWrapper(
     std::shared_ptr<EncodedStreamProvider> encoded_stream_provider)
@@ -74,14 +100,89 @@ std::shared_ptr<EncodedStreamProvider> EncodedStreamProvider::Create() {
   return std::shared_ptr<EncodedStreamProvider>(new EncodedStreamProvider);
 }
 
+EncodedStreamProvider::EncodedStreamProvider()
+    : key_frame_limiter_(new KeyFrameRequestLimiter(0)) {}
+
+EncodedStreamProvider::~EncodedStreamProvider() {}
+
 void EncodedStreamProvider::SendOneFrame(const std::vector<uint8_t>& buffer,
   const EncodedImageMetaData& meta_data) {
+  OnFrameSent(meta_data.is_keyframe);
   if (sink_ != nullptr) {
     sink_->OnStreamProviderFrame(buffer, meta_data);
   }
 }
 
+int EncodedStreamProvider::AddRendition(uint32_t bitrate_kbps) {
+  const std::lock_guard<std::mutex> lock(ladder_mutex_);
+  if (!ladder_)
+    ladder_.reset(new BitrateLadder());
+  return ladder_->AddRendition(bitrate_kbps);
+}
+
+void EncodedStreamProvider::SendOneFrame(int rendition,
+                                         const std::vector<uint8_t>& buffer,
+                                         const EncodedImageMetaData& meta_data) {
+  uint16_t picture_id;
+  {
+    const std::lock_guard<std::mutex> lock(ladder_mutex_);
+    if (!ladder_ || !ladder_->OnFrame(rendition, meta_data.is_keyframe,
+                                      meta_data.last_fragment, &picture_id)) {
+      return;
+    }
+  }
+  OnFrameSent(meta_data.is_keyframe);
+  if (sink_ == nullptr)
+    return;
+  EncodedImageMetaData forwarded;
+  CopyMetaData(meta_data, &forwarded);
+  forwarded.picture_id = picture_id;
+  sink_->OnStreamProviderFrame(buffer, forwarded);
+}
+
+int EncodedStreamProvider::CurrentRendition() const {
+  const std::lock_guard<std::mutex> lock(ladder_mutex_);
+  return ladder_ ? ladder_->current() : -1;
+}
+
+void EncodedStreamProvider::SetKeyFrameRequestMinInterval(int interval_ms) {
+  const std::lock_guard<std::mutex> lock(key_frame_mutex_);
+  key_frame_limiter_->SetMinInterval(interval_ms);
+}
+
+KeyFrameRequestStatistics EncodedStreamProvider::GetKeyFrameRequestStatistics()
+    const {
+  const std::lock_guard<std::mutex> lock(key_frame_mutex_);
+  return key_frame_limiter_->statistics();
+}
+
 void EncodedStreamProvider::RequestKeyFrame() {
+  {
+    const std::lock_guard<std::mutex> lock(ladder_mutex_);
+    if (ladder_)
+      ladder_->OnKeyFrameRequest();
+  }
+  bool forward;
+  {
+    const std::lock_guard<std::mutex> lock(key_frame_mutex_);
+    forward = key_frame_limiter_->OnRequest(rtc::TimeMillis());
+  }
+  if (forward)
+    NotifyKeyFrameRequest();
+}
+
+void EncodedStreamProvider::OnFrameSent(bool key_frame) {
+  bool forward;
+  {
+    const std::lock_guard<std::mutex> lock(key_frame_mutex_);
+    forward = key_frame_limiter_->OnFrame(key_frame, rtc::TimeMillis());
+  }
+  // A request held back by the limiter is due.
+  if (forward)
+    NotifyKeyFrameRequest();
+}
+
+void EncodedStreamProvider::NotifyKeyFrameRequest() {
   for (auto its = stream_provider_observers_.begin();
        its != stream_provider_observers_.end(); ++its) {
     (*its).get().OnKeyFrameRequest();
@@ -90,6 +191,11 @@ void EncodedStreamProvider::RequestKeyFrame() {
 
 void EncodedStreamProvider::RequestRateUpdate(uint64_t bitrate_bps,
   uint32_t frame_rate) {
+  {
+    const std::lock_guard<std::mutex> lock(ladder_mutex_);
+    if (ladder_)
+      ladder_->OnRateUpdate(bitrate_bps, rtc::TimeMillis());
+  }
   for (auto its = stream_provider_observers_.begin();
        its != stream_provider_observers_.end(); ++its) {
     (*its).get().OnRateUpdate(bitrate_bps, frame_rate);
@@ -0,0 +1,123 @@
+// Copyright (C) <2026> Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "talk/owt/sdk/base/encoderpolicyvideotracksource.h"
+#include "webrtc/api/make_ref_counted.h"
+
+namespace owt {
+namespace base {
+EncoderPolicyBuffer::EncoderPolicyBuffer(
+    rtc::scoped_refptr<webrtc::VideoFrameBuffer> buffer,
+    VideoEncoderPolicy policy)
+    : buffer_(buffer), policy_(policy) {}
+
+EncoderPolicyBuffer::~EncoderPolicyBuffer() {}
+
+EncoderPolicyBuffer* EncoderPolicyBuffer::From(
+    webrtc::VideoFrameBuffer* buffer) {
+  if (!buffer || buffer->type() != webrtc::VideoFrameBuffer::Type::kNative)
+    return nullptr;
+  EncoderInputBuffer* input = static_cast<EncoderInputBuffer*>(buffer);
+  if (input->kind() != EncoderInputBuffer::Kind::kEncoderPolicy)
+    return nullptr;
+  return static_cast<EncoderPolicyBuffer*>(input);
+}
+
+rtc::scoped_refptr<webrtc::I420BufferInterface> EncoderPolicyBuffer::ToI420() {
+  return buffer_->ToI420();
+}
+
+rtc::scoped_refptr<webrtc::VideoFrameBuffer>
+EncoderPolicyBuffer::GetMappedFrameBuffer(rtc::ArrayView<Type> types) {
+  for (Type type : types) {
+    if (type == buffer_->type())
+      return buffer_;
+  }
+  return buffer_->GetMappedFrameBuffer(types);
+}
+
+// Simulcast layers and adapted resolutions keep the policy.
+rtc::scoped_refptr<webrtc::VideoFrameBuffer> EncoderPolicyBuffer::CropAndScale(
+    int offset_x,
+    int offset_y,
+    int crop_width,
+    int crop_height,
+    int scaled_width,
+    int scaled_height) {
+  return rtc::make_ref_counted<EncoderPolicyBuffer>(
+      buffer_->CropAndScale(offset_x, offset_y, crop_width, crop_height,
+                            scaled_width, scaled_height),
+      policy_);
+}
+
+EncoderPolicyVideoTrackSource::EncoderPolicyVideoTrackSource(
+    rtc::scoped_refptr<webrtc::VideoTrackInterface> track,
+    VideoEncoderPolicy policy)
+    : webrtc::VideoTrackSource(/*remote=*/false),
+      track_(track),
+      tagger_(track, policy) {
+  SetState(kLive);
+}
+
+EncoderPolicyVideoTrackSource::~EncoderPolicyVideoTrackSource() {}
+
+bool EncoderPolicyVideoTrackSource::is_screencast() const {
+  return track_->GetSource() && track_->GetSource()->is_screencast();
+}
+
+absl::optional<bool> EncoderPolicyVideoTrackSource::needs_denoising() const {
+  return track_->GetSource() ? track_->GetSource()->needs_denoising()
+                             : absl::nullopt;
+}
+
+EncoderPolicyVideoTrackSource::Tagger::Tagger(
+    rtc::scoped_refptr<webrtc::VideoTrackInterface> track,
+    VideoEncoderPolicy policy)
+    : track_(track), policy_(policy) {}
+
+EncoderPolicyVideoTrackSource::Tagger::~Tagger() {
+  track_->RemoveSink(this);
+}
+
+void EncoderPolicyVideoTrackSource::Tagger::AddOrUpdateSink(
+    rtc::VideoSinkInterface<webrtc::VideoFrame>* sink,
+    const rtc::VideoSinkWants& wants) {
+  broadcaster_.AddOrUpdateSink(sink, wants);
+  UpdateUpstream();
+}
+
+void EncoderPolicyVideoTrackSource::Tagger::RemoveSink(
+    rtc::VideoSinkInterface<webrtc::VideoFrame>* sink) {
+  broadcaster_.RemoveSink(sink);
+  UpdateUpstream();
+}
+
+void EncoderPolicyVideoTrackSource::Tagger::UpdateUpstream() {
+  if (broadcaster_.frame_wanted()) {
+    track_->AddOrUpdateSink(this, broadcaster_.wants());
+  } else {
+    track_->RemoveSink(this);
+  }
+}
+
+void EncoderPolicyVideoTrackSource::Tagger::OnFrame(
+    const webrtc::VideoFrame& frame) {
+  // Encoded frames already select the pass-through encoder.
+  if (frame.video_frame_buffer()->type() ==
+      webrtc::VideoFrameBuffer::Type::kNative) {
+    broadcaster_.OnFrame(frame);
+    return;
+  }
+  webrtc::VideoFrame tagged_frame(frame);
+  tagged_frame.set_video_frame_buffer(
+      rtc::make_ref_counted<EncoderPolicyBuffer>(frame.video_frame_buffer(),
+                                                 policy_));
+  broadcaster_.OnFrame(tagged_frame);
+}
+
+void EncoderPolicyVideoTrackSource::Tagger::OnDiscardedFrame() {
+  broadcaster_.OnDiscardedFrame();
+}
+}  // namespace base
+}  // namespace owt
@@ -0,0 +1,99 @@
+// Copyright (C) <2026> Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef OWT_BASE_ENCODERPOLICYVIDEOTRACKSOURCE_H_
+#define OWT_BASE_ENCODERPOLICYVIDEOTRACKSOURCE_H_
+
+#include "absl/types/optional.h"
+#include "webrtc/api/array_view.h"
+#include "webrtc/api/media_stream_interface.h"
+#include "webrtc/api/video/video_frame.h"
+#include "webrtc/api/video/video_frame_buffer.h"
+#include "webrtc/media/base/video_broadcaster.h"
+#include "webrtc/pc/video_track_source.h"
+#include "talk/owt/sdk/base/customizedencoderbufferhandle.h"
+#include "talk/owt/sdk/include/cpp/owt/base/commontypes.h"
+
+namespace owt {
+namespace base {
+// Raw buffer of a publication with an explicit VideoEncoderPolicy, wrapped
+// as a native buffer so the policy travels with the frame to the encoder,
+// which is created by a factory that only sees the SDP format.
+// SelectingVideoEncoder unwraps it before encoding. Any pixel format can be
+// wrapped, and crop and scale keep the policy.
+class EncoderPolicyBuffer : public EncoderInputBuffer {
+ public:
+  EncoderPolicyBuffer(rtc::scoped_refptr<webrtc::VideoFrameBuffer> buffer,
+                      VideoEncoderPolicy policy);
+  ~EncoderPolicyBuffer() override;
+  // Returns |buffer| as an EncoderPolicyBuffer, or null for other buffers.
+  static EncoderPolicyBuffer* From(webrtc::VideoFrameBuffer* buffer);
+
+  VideoEncoderPolicy policy() const { return policy_; }
+  // The wrapped raw buffer.
+  rtc::scoped_refptr<webrtc::VideoFrameBuffer> buffer() const {
+    return buffer_;
+  }
+  Kind kind() const override { return Kind::kEncoderPolicy; }
+  int width() const override { return buffer_->width(); }
+  int height() const override { return buffer_->height(); }
+  rtc::scoped_refptr<webrtc::I420BufferInterface> ToI420() override;
+  rtc::scoped_refptr<webrtc::VideoFrameBuffer> GetMappedFrameBuffer(
+      rtc::ArrayView<Type> types) override;
+  rtc::scoped_refptr<webrtc::VideoFrameBuffer> CropAndScale(
+      int offset_x,
+      int offset_y,
+      int crop_width,
+      int crop_height,
+      int scaled_width,
+      int scaled_height) override;
+
+ private:
+  rtc::scoped_refptr<webrtc::VideoFrameBuffer> buffer_;
+  const VideoEncoderPolicy policy_;
+};
+
+// Video source of a published copy of a local track. Raw frames of the
+// original track are wrapped in EncoderPolicyBuffer, so local rendering of
+// the original track is not affected.
+class EncoderPolicyVideoTrackSource : public webrtc::VideoTrackSource {
+ public:
+  EncoderPolicyVideoTrackSource(
+      rtc::scoped_refptr<webrtc::VideoTrackInterface> track,
+      VideoEncoderPolicy policy);
+  ~EncoderPolicyVideoTrackSource() override;
+  bool is_screencast() const override;
+  absl::optional<bool> needs_denoising() const override;
+
+ protected:
+  rtc::VideoSourceInterface<webrtc::VideoFrame>* source() override {
+    return &tagger_;
+  }
+
+ private:
+  class Tagger : public rtc::VideoSourceInterface<webrtc::VideoFrame>,
+                 public rtc::VideoSinkInterface<webrtc::VideoFrame> {
+   public:
+    Tagger(rtc::scoped_refptr<webrtc::VideoTrackInterface> track,
+           VideoEncoderPolicy policy);
+    ~Tagger() override;
+    void AddOrUpdateSink(rtc::VideoSinkInterface<webrtc::VideoFrame>* sink,
+                         const rtc::VideoSinkWants& wants) override;
+    void RemoveSink(rtc::VideoSinkInterface<webrtc::VideoFrame>* sink) override;
+    void OnFrame(const webrtc::VideoFrame& frame) override;
+    void OnDiscardedFrame() override;
+
+   private:
+    // Forwards combined wants of publication sinks to the original track.
+    void UpdateUpstream();
+    rtc::scoped_refptr<webrtc::VideoTrackInterface> track_;
+    const VideoEncoderPolicy policy_;
+    rtc::VideoBroadcaster broadcaster_;
+  };
+  rtc::scoped_refptr<webrtc::VideoTrackInterface> track_;
+  Tagger tagger_;
+};
+}  // namespace base
+}  // namespace owt
+#endif  // OWT_BASE_ENCODERPOLICYVIDEOTRACKSOURCE_H_
@@ -0,0 +1,159 @@
+// Copyright (C) <2026> Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "talk/owt/sdk/base/framelatencytracer.h"
+#include <algorithm>
+#include "owt/base/globalconfiguration.h"
+#include "webrtc/modules/rtp_rtcp/source/time_util.h"
+#include "webrtc/rtc_base/time_utils.h"
+#include "webrtc/system_wrappers/include/clock.h"
+
+namespace owt {
+namespace base {
+// Frames an encoder may hold before output. Hardware encoders with lookahead
+// stay well below this.
+static const size_t kMaxPendingEncodes = 16;
+// Latencies above this are treated as clock mismatch rather than measured,
+// e.g. pass-through frames with capture time from another clock.
+static const int64_t kMaxPlausibleLatencyUs = 10 * rtc::kNumMicrosecsPerSec;
+
+LatencyHistogram::LatencyHistogram() {
+  Reset();
+}
+
+void LatencyHistogram::Add(int64_t latency_us) {
+  latency_us = std::max<int64_t>(latency_us, 0);
+  size_t bucket = std::min<int64_t>(latency_us / rtc::kNumMicrosecsPerMillisec,
+                                    kMaxMs);
+  buckets_[bucket].fetch_add(1, std::memory_order_relaxed);
+  count_.fetch_add(1, std::memory_order_relaxed);
+  int64_t max_us = max_us_.load(std::memory_order_relaxed);
+  while (latency_us > max_us &&
+         !max_us_.compare_exchange_weak(max_us, latency_us,
+                                        std::memory_order_relaxed)) {
+  }
+}
+
+double LatencyHistogram::Percentile(double quantile) const {
+  uint64_t total = 0;
+  std::array<uint32_t, kMaxMs + 1> snapshot;
+  for (size_t i = 0; i < snapshot.size(); i++) {
+    snapshot[i] = buckets_[i].load(std::memory_order_relaxed);
+    total += snapshot[i];
+  }
+  if (total == 0)
+    return 0;
+  uint64_t rank = std::max<uint64_t>(
+      1, static_cast<uint64_t>(quantile * static_cast<double>(total) + 0.5));
+  uint64_t seen = 0;
+  for (size_t i = 0; i < snapshot.size(); i++) {
+    seen += snapshot[i];
+    if (seen >= rank && i < kMaxMs)
+      return std::min(static_cast<double>(i + 1), MaxMs());
+  }
+  return MaxMs();
+}
+
+double LatencyHistogram::MaxMs() const {
+  return max_us_.load(std::memory_order_relaxed) /
+         static_cast<double>(rtc::kNumMicrosecsPerMillisec);
+}
+
+void LatencyHistogram::Reset() {
+  for (auto& bucket : buckets_)
+    bucket.store(0, std::memory_order_relaxed);
+  count_.store(0, std::memory_order_relaxed);
+  max_us_.store(0, std::memory_order_relaxed);
+}
+
+bool FrameLatencyTracer::Enabled() {
+  return GlobalConfiguration::GetLatencyTracingEnabled();
+}
+
+FrameLatencyTracer* FrameLatencyTracer::Get() {
+  static FrameLatencyTracer* tracer = new FrameLatencyTracer();
+  return tracer;
+}
+
+void FrameLatencyTracer::Record(LatencyStage stage, int64_t latency_us) {
+  if (latency_us > kMaxPlausibleLatencyUs ||
+      latency_us < -kMaxPlausibleLatencyUs) {
+    return;
+  }
+  Histogram(stage).Add(latency_us);
+}
+
+void FrameLatencyTracer::OnFrameRendered(const webrtc::VideoFrame& frame) {
+  // Sender's capture time on the local NTP clock. The absolute capture time
+  // offset is already adjusted to this receiver's clock by the RTP receiver.
+  int64_t capture_ntp_ms = -1;
+  int64_t last_receive_us = -1;
+  for (const webrtc::RtpPacketInfo& packet : frame.packet_infos()) {
+    last_receive_us = std::max(last_receive_us, packet.receive_time().us());
+    const auto& capture_time = packet.absolute_capture_time();
+    if (capture_time && capture_time->estimated_capture_clock_offset) {
+      capture_ntp_ms =
+          webrtc::UQ32x32ToInt64Ms(capture_time->absolute_capture_timestamp) +
+          webrtc::Q32x32ToInt64Ms(*capture_time->estimated_capture_clock_offset);
+    }
+  }
+  // Without the extension, fall back to the RTCP sender report estimate.
+  if (capture_ntp_ms < 0 && frame.ntp_time_ms() > 0)
+    capture_ntp_ms = frame.ntp_time_ms();
+  if (capture_ntp_ms < 0)
+    return;
+  webrtc::Clock* clock = webrtc::Clock::GetRealTimeClock();
+  int64_t now_us = rtc::TimeMicros();
+  int64_t ntp_to_local_ms =
+      clock->CurrentNtpInMilliseconds() - now_us / rtc::kNumMicrosecsPerMillisec;
+  int64_t capture_us =
+      (capture_ntp_ms - ntp_to_local_ms) * rtc::kNumMicrosecsPerMillisec;
+  if (last_receive_us >= 0)
+    Record(LatencyStage::kReceived, last_receive_us - capture_us);
+  if (frame.processing_time()) {
+    Record(LatencyStage::kDecodeStart,
+           frame.processing_time()->start.us() - capture_us);
+    Record(LatencyStage::kDecodeEnd,
+           frame.processing_time()->finish.us() - capture_us);
+  }
+  Record(LatencyStage::kRendered, now_us - capture_us);
+}
+
+void EncodeLatencyProbe::OnEncodeStart(const webrtc::VideoFrame& frame) {
+  // timestamp_us() is the capture time on the rtc::TimeMicros() clock.
+  int64_t now_us = rtc::TimeMicros();
+  FrameLatencyTracer::Get()->Record(LatencyStage::kEncodeStart,
+                                    now_us - frame.timestamp_us());
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (pending_.size() >= kMaxPendingEncodes)
+    pending_.pop_front();
+  pending_.push_back({frame.timestamp(), frame.timestamp_us()});
+}
+
+void EncodeLatencyProbe::OnEncoded(uint32_t rtp_timestamp) {
+  int64_t capture_time_us = CaptureTimeUs(rtp_timestamp);
+  if (capture_time_us >= 0) {
+    FrameLatencyTracer::Get()->Record(LatencyStage::kEncodeEnd,
+                                      rtc::TimeMicros() - capture_time_us);
+  }
+}
+
+void EncodeLatencyProbe::OnPacketized(uint32_t rtp_timestamp) {
+  int64_t capture_time_us = CaptureTimeUs(rtp_timestamp);
+  if (capture_time_us >= 0) {
+    FrameLatencyTracer::Get()->Record(LatencyStage::kPacketized,
+                                      rtc::TimeMicros() - capture_time_us);
+  }
+}
+
+int64_t EncodeLatencyProbe::CaptureTimeUs(uint32_t rtp_timestamp) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (auto it = pending_.rbegin(); it != pending_.rend(); ++it) {
+    if (it->rtp_timestamp == rtp_timestamp)
+      return it->capture_time_us;
+  }
+  return -1;
+}
+}  // namespace base
+}  // namespace owt
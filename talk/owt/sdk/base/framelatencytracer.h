@@ -0,0 +1,81 @@
+// Copyright (C) <2026> Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef OWT_BASE_FRAMELATENCYTRACER_H_
+#define OWT_BASE_FRAMELATENCYTRACER_H_
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include "webrtc/api/video/video_frame.h"
+#include "talk/owt/sdk/include/cpp/owt/base/latencytracer.h"
+
+namespace owt {
+namespace base {
+// Lock-free latency histogram with 1 ms buckets up to kMaxMs. Samples above
+// kMaxMs land in the last bucket but still update the maximum.
+class LatencyHistogram {
+ public:
+  static constexpr int kMaxMs = 4096;
+  LatencyHistogram();
+  void Add(int64_t latency_us);
+  uint64_t Count() const { return count_.load(std::memory_order_relaxed); }
+  // Upper bound of the bucket holding the |quantile| sample, in ms.
+  double Percentile(double quantile) const;
+  double MaxMs() const;
+  void Reset();
+
+ private:
+  std::array<std::atomic<uint32_t>, kMaxMs + 1> buckets_;
+  std::atomic<uint64_t> count_{0};
+  std::atomic<int64_t> max_us_{0};
+};
+
+// Collects per-stage latency of video frames. Sender stages are fed by the
+// video encoder wrapper, receiver stages are derived from the frame reaching
+// the renderer, which carries receive and decode times.
+class FrameLatencyTracer {
+ public:
+  static constexpr int kNumStages = static_cast<int>(LatencyStage::kRendered) + 1;
+  static bool Enabled();
+  static FrameLatencyTracer* Get();
+  void Record(LatencyStage stage, int64_t latency_us);
+  // Records receiver stages of a remote frame about to be rendered.
+  void OnFrameRendered(const webrtc::VideoFrame& frame);
+  LatencyHistogram& Histogram(LatencyStage stage) {
+    return histograms_[static_cast<int>(stage)];
+  }
+
+ private:
+  FrameLatencyTracer() = default;
+  std::array<LatencyHistogram, kNumStages> histograms_;
+};
+
+// Tracks frames of one encoder between Encode() and OnEncodedImage(), which
+// may run on different threads.
+class EncodeLatencyProbe {
+ public:
+  // Call right before the frame is passed to the encoder.
+  void OnEncodeStart(const webrtc::VideoFrame& frame);
+  // Call before and after the encoded image is passed on for packetization.
+  void OnEncoded(uint32_t rtp_timestamp);
+  void OnPacketized(uint32_t rtp_timestamp);
+
+ private:
+  struct PendingFrame {
+    uint32_t rtp_timestamp;
+    int64_t capture_time_us;
+  };
+  // Capture time of |rtp_timestamp|, or -1 when unknown.
+  int64_t CaptureTimeUs(uint32_t rtp_timestamp);
+  std::mutex mutex_;
+  // Most recent frames, in encode order. Simulcast layers of one frame share
+  // an entry, so entries are only evicted by age.
+  std::deque<PendingFrame> pending_;
+};
+}  // namespace base
+}  // namespace owt
+#endif  // OWT_BASE_FRAMELATENCYTRACER_H_
@@ -0,0 +1,75 @@
+// Copyright (C) <2026> Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+#include <thread>
+#include <vector>
+#include "talk/owt/sdk/base/framelatencytracer.h"
+#include "testing/gtest/include/gtest/gtest.h"
+#include "testing/gmock/include/gmock/gmock.h"
+#include "webrtc/api/video/i420_buffer.h"
+#include "webrtc/rtc_base/time_utils.h"
+namespace owt {
+namespace base {
+TEST(LatencyHistogramTest, Percentiles) {
+  LatencyHistogram histogram;
+  // 1..100 ms.
+  for (int i = 1; i <= 100; i++)
+    histogram.Add(i * rtc::kNumMicrosecsPerMillisec - 1);
+  EXPECT_EQ(100u, histogram.Count());
+  EXPECT_DOUBLE_EQ(50, histogram.Percentile(0.5));
+  EXPECT_DOUBLE_EQ(90, histogram.Percentile(0.9));
+  EXPECT_DOUBLE_EQ(99, histogram.Percentile(0.99));
+  EXPECT_NEAR(100, histogram.MaxMs(), 0.01);
+  histogram.Reset();
+  EXPECT_EQ(0u, histogram.Count());
+  EXPECT_DOUBLE_EQ(0, histogram.Percentile(0.5));
+}
+
+TEST(LatencyHistogramTest, ClampsOutOfRangeSamples) {
+  LatencyHistogram histogram;
+  histogram.Add(-5);
+  histogram.Add(int64_t{60} * rtc::kNumMicrosecsPerSec);
+  EXPECT_EQ(2u, histogram.Count());
+  EXPECT_DOUBLE_EQ(1, histogram.Percentile(0.5));
+  EXPECT_DOUBLE_EQ(60000, histogram.Percentile(1));
+}
+
+TEST(LatencyHistogramTest, ConcurrentAdds) {
+  LatencyHistogram histogram;
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 4; t++) {
+    threads.emplace_back([&histogram, t]() {
+      for (int i = 0; i < 10000; i++)
+        histogram.Add((t + 1) * rtc::kNumMicrosecsPerMillisec);
+    });
+  }
+  for (auto& thread : threads)
+    thread.join();
+  EXPECT_EQ(40000u, histogram.Count());
+  EXPECT_NEAR(4, histogram.MaxMs(), 0.01);
+}
+
+TEST(EncodeLatencyProbeTest, RecordsSenderStages) {
+  FrameLatencyTracer* tracer = FrameLatencyTracer::Get();
+  tracer->Histogram(LatencyStage::kEncodeStart).Reset();
+  tracer->Histogram(LatencyStage::kEncodeEnd).Reset();
+  tracer->Histogram(LatencyStage::kPacketized).Reset();
+  EncodeLatencyProbe probe;
+  webrtc::VideoFrame frame =
+      webrtc::VideoFrame::Builder()
+          .set_video_frame_buffer(webrtc::I420Buffer::Create(16, 16))
+          .set_timestamp_rtp(90000)
+          .set_timestamp_us(rtc::TimeMicros() - 20 * rtc::kNumMicrosecsPerMillisec)
+          .build();
+  probe.OnEncodeStart(frame);
+  probe.OnEncoded(90000);
+  probe.OnPacketized(90000);
+  // Unknown frames are ignored.
+  probe.OnEncoded(12345);
+  EXPECT_EQ(1u, tracer->Histogram(LatencyStage::kEncodeStart).Count());
+  EXPECT_EQ(1u, tracer->Histogram(LatencyStage::kEncodeEnd).Count());
+  EXPECT_EQ(1u, tracer->Histogram(LatencyStage::kPacketized).Count());
+  EXPECT_GE(tracer->Histogram(LatencyStage::kPacketized).MaxMs(), 20);
+}
+}  // namespace base
+}  // namespace owt
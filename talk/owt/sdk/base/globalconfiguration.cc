@@ -18,6 +18,7 @@ int GlobalConfiguration::min_port_ = 0; // not set;
 int GlobalConfiguration::max_port_ = 0; // not set;
 bool GlobalConfiguration::low_latency_streaming_enabled_ = false;
 bool GlobalConfiguration::log_latency_to_file_enabled_ = false;
+bool GlobalConfiguration::latency_tracing_enabled_ = false;
 bool GlobalConfiguration::encoded_frame_ = false;
 int GlobalConfiguration::start_bitrate_kbps_ = 0; // not set
 int GlobalConfiguration::min_bitrate_kbps_ = 0; // not set
@@ -29,6 +30,9 @@ std::unique_ptr<AudioFrameGeneratorInterface>
 #if defined(WEBRTC_WIN) || defined(WEBRTC_LINUX)
 std::unique_ptr<VideoDecoderInterface>
     GlobalConfiguration::video_decoder_ = nullptr;
+std::unique_ptr<AsyncVideoDecoderInterface>
+    GlobalConfiguration::async_video_decoder_ = nullptr;
+size_t GlobalConfiguration::software_encoder_pool_size_ = 0;
 #endif
 int GlobalConfiguration::h264_temporal_layers_ = 1;
 #if defined(WEBRTC_IOS)
@@ -40,6 +44,8 @@ AudioProcessingSettings GlobalConfiguration::audio_processing_settings_ = {
 #endif
 bool GlobalConfiguration::pre_decode_dump_enabled_ = false;
 bool GlobalConfiguration::post_encode_dump_enabled_ = false;
+std::string GlobalConfiguration::bitstream_dump_directory_;
+size_t GlobalConfiguration::bitstream_dump_max_queued_bytes_ = 0;
 bool GlobalConfiguration::video_super_resolution_enabled_ = false;
 }  // namespace base
 }
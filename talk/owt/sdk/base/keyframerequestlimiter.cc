@@ -0,0 +1,48 @@
+// Copyright (C) <2026> Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "talk/owt/sdk/base/keyframerequestlimiter.h"
+
+namespace owt {
+namespace base {
+KeyFrameRequestLimiter::KeyFrameRequestLimiter(int64_t min_interval_ms)
+    : min_interval_ms_(min_interval_ms) {}
+
+void KeyFrameRequestLimiter::SetMinInterval(int64_t min_interval_ms) {
+  min_interval_ms_ = min_interval_ms;
+}
+
+bool KeyFrameRequestLimiter::OnRequest(int64_t now_ms) {
+  statistics_.requested++;
+  if (!Elapsed(now_ms)) {
+    pending_ = true;
+    return false;
+  }
+  pending_ = false;
+  last_key_frame_ms_ = now_ms;
+  statistics_.forwarded++;
+  return true;
+}
+
+bool KeyFrameRequestLimiter::OnFrame(bool key_frame, int64_t now_ms) {
+  if (key_frame) {
+    statistics_.key_frames++;
+    last_key_frame_ms_ = now_ms;
+    pending_ = false;
+    return false;
+  }
+  if (!pending_ || !Elapsed(now_ms))
+    return false;
+  pending_ = false;
+  last_key_frame_ms_ = now_ms;
+  statistics_.forwarded++;
+  return true;
+}
+
+bool KeyFrameRequestLimiter::Elapsed(int64_t now_ms) const {
+  return min_interval_ms_ <= 0 || last_key_frame_ms_ < 0 ||
+         now_ms - last_key_frame_ms_ >= min_interval_ms_;
+}
+}  // namespace base
+}  // namespace owt
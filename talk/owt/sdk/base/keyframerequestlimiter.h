@@ -0,0 +1,41 @@
+// Copyright (C) <2026> Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef OWT_BASE_KEYFRAMEREQUESTLIMITER_H_
+#define OWT_BASE_KEYFRAMEREQUESTLIMITER_H_
+
+#include <cstdint>
+#include "talk/owt/sdk/include/cpp/owt/base/videoencoderinterface.h"
+
+namespace owt {
+namespace base {
+// Coalesces key frame requests to an application encoder so that key frames
+// are at least |min_interval_ms| apart. A request inside the interval after
+// the last key frame, or after the last forwarded request, is kept pending
+// and forwarded once the interval ends, unless a key frame satisfies it
+// first. Any number of requests in between are merged into one.
+class KeyFrameRequestLimiter {
+ public:
+  // A |min_interval_ms| of 0 forwards every request.
+  explicit KeyFrameRequestLimiter(int64_t min_interval_ms);
+  void SetMinInterval(int64_t min_interval_ms);
+  // Returns true if the request should be forwarded now.
+  bool OnRequest(int64_t now_ms);
+  // Called for every frame sent. Returns true if a pending request should be
+  // forwarded now.
+  bool OnFrame(bool key_frame, int64_t now_ms);
+  const KeyFrameRequestStatistics& statistics() const { return statistics_; }
+
+ private:
+  bool Elapsed(int64_t now_ms) const;
+
+  int64_t min_interval_ms_;
+  // Time of the last key frame or forwarded request, -1 if none.
+  int64_t last_key_frame_ms_ = -1;
+  bool pending_ = false;
+  KeyFrameRequestStatistics statistics_;
+};
+}  // namespace base
+}  // namespace owt
+#endif  // OWT_BASE_KEYFRAMEREQUESTLIMITER_H_
@@ -0,0 +1,47 @@
+// Copyright (C) <2026> Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+#include "talk/owt/sdk/base/keyframerequestlimiter.h"
+#include "testing/gtest/include/gtest/gtest.h"
+namespace owt {
+namespace base {
+TEST(KeyFrameRequestLimiterTest, ForwardsEveryRequestWithoutInterval) {
+  KeyFrameRequestLimiter limiter(0);
+  for (int i = 0; i < 3; i++) {
+    EXPECT_TRUE(limiter.OnRequest(0));
+    EXPECT_FALSE(limiter.OnFrame(true, 0));
+  }
+  EXPECT_EQ(3u, limiter.statistics().requested);
+  EXPECT_EQ(3u, limiter.statistics().forwarded);
+  EXPECT_EQ(3u, limiter.statistics().key_frames);
+}
+
+TEST(KeyFrameRequestLimiterTest, MergesRequestsInsideInterval) {
+  KeyFrameRequestLimiter limiter(1000);
+  EXPECT_TRUE(limiter.OnRequest(0));
+  EXPECT_FALSE(limiter.OnFrame(true, 30));
+  // A storm of requests right after the key frame.
+  for (int64_t t = 40; t < 500; t += 10)
+    EXPECT_FALSE(limiter.OnRequest(t));
+  for (int64_t t = 500; t < 1030; t += 33)
+    EXPECT_FALSE(limiter.OnFrame(false, t));
+  // One request is forwarded for all of them once the interval ends.
+  EXPECT_TRUE(limiter.OnFrame(false, 1030));
+  EXPECT_FALSE(limiter.OnFrame(false, 1063));
+  EXPECT_EQ(2u, limiter.statistics().forwarded);
+}
+
+TEST(KeyFrameRequestLimiterTest, KeyFrameSatisfiesPendingRequest) {
+  KeyFrameRequestLimiter limiter(1000);
+  EXPECT_FALSE(limiter.OnFrame(true, 0));
+  EXPECT_FALSE(limiter.OnRequest(100));
+  // A periodic key frame arrives before the interval ends.
+  EXPECT_FALSE(limiter.OnFrame(true, 900));
+  EXPECT_FALSE(limiter.OnFrame(false, 2000));
+  EXPECT_EQ(1u, limiter.statistics().requested);
+  EXPECT_EQ(0u, limiter.statistics().forwarded);
+  EXPECT_EQ(2u, limiter.statistics().key_frames);
+  EXPECT_TRUE(limiter.OnRequest(2000));
+}
+}  // namespace base
+}  // namespace owt
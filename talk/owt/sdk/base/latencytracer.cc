@@ -0,0 +1,31 @@
+// Copyright (C) <2026> Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "owt/base/latencytracer.h"
+#include "talk/owt/sdk/base/framelatencytracer.h"
+
+namespace owt {
+namespace base {
+std::vector<LatencyStageStatistics> LatencyTracer::GetStatistics() {
+  std::vector<LatencyStageStatistics> statistics;
+  FrameLatencyTracer* tracer = FrameLatencyTracer::Get();
+  for (int i = 0; i < FrameLatencyTracer::kNumStages; i++) {
+    LatencyStage stage = static_cast<LatencyStage>(i);
+    const LatencyHistogram& histogram = tracer->Histogram(stage);
+    if (histogram.Count() == 0)
+      continue;
+    statistics.push_back({stage, histogram.Count(), histogram.Percentile(0.5),
+                          histogram.Percentile(0.9), histogram.Percentile(0.99),
+                          histogram.MaxMs()});
+  }
+  return statistics;
+}
+
+void LatencyTracer::Reset() {
+  FrameLatencyTracer* tracer = FrameLatencyTracer::Get();
+  for (int i = 0; i < FrameLatencyTracer::kNumStages; i++)
+    tracer->Histogram(static_cast<LatencyStage>(i)).Reset();
+}
+}  // namespace base
+}  // namespace owt
@@ -3,6 +3,7 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "libyuv/convert_from.h"
+#include "libyuv/planar_functions.h"
 #include "webrtc/rtc_base/logging.h"
 
 #include "msdkvideoencoder.h"
@@ -131,7 +132,17 @@ int32_t MsdkVideoEncoder::Encode(const webrtc::VideoFrame& frame,
   }
 
   pitch = pData.Pitch;
-  if (MFX_FOURCC_NV12 == pInfo.FourCC) {
+  if (MFX_FOURCC_NV12 == pInfo.FourCC &&
+      frame.video_frame_buffer()->type() ==
+          webrtc::VideoFrameBuffer::Type::kNV12) {
+      // NV12 input is copied as is.
+      const webrtc::NV12BufferInterface* buffer =
+          frame.video_frame_buffer()->GetNV12();
+      libyuv::CopyPlane(buffer->DataY(), buffer->StrideY(), pData.Y, pitch, w,
+                        h);
+      libyuv::CopyPlane(buffer->DataUV(), buffer->StrideUV(), pData.UV, pitch,
+                        buffer->ChromaWidth() * 2, buffer->ChromaHeight());
+  } else if (MFX_FOURCC_NV12 == pInfo.FourCC) {
       //Todo: As an optimization target, later we will use VPP for CSC conversion. For now
       //I420 to NV12 CSC is AVX2 instruction optimized.
       rtc::scoped_refptr<webrtc::I420BufferInterface> buffer(frame.video_frame_buffer()->ToI420());
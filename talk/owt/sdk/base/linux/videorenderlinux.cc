@@ -5,6 +5,7 @@
 #if defined(OWT_USE_MSDK)
 #include "talk/owt/sdk/base/linux/xwindownativeframe.h"
 #endif
+#include "talk/owt/sdk/base/framelatencytracer.h"
 #include "talk/owt/sdk/base/nativehandlebuffer.h"
 #include "talk/owt/sdk/base/webrtcvideorendererimpl.h"
 #include "webrtc/common_video/libyuv/include/webrtc_libyuv.h"
@@ -14,6 +15,8 @@ namespace base {
 
 #if defined(OWT_USE_MSDK)
 void WebrtcVideoRendererVaImpl::OnFrame(const webrtc::VideoFrame& frame) {
+  if (FrameLatencyTracer::Enabled())
+    FrameLatencyTracer::Get()->OnFrameRendered(frame);
   if (frame.video_frame_buffer()->type() !=
       webrtc::VideoFrameBuffer::Type::kNative)
     return;
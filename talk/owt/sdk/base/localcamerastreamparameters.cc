@@ -10,6 +10,7 @@ LocalCameraStreamParameters::LocalCameraStreamParameters(bool audio_enabled,
     : resolution_width_(320),
       resolution_height_(240),
       fps_(30),
+      crop_to_aspect_ratio_(false),
       video_enabled_(video_enabled),
       audio_enabled_(audio_enabled) {
   std::random_device rd;
@@ -19,6 +20,9 @@ LocalCameraStreamParameters::LocalCameraStreamParameters(bool audio_enabled,
 void LocalCameraStreamParameters::Fps(int fps) {
   fps_ = fps;
 }
+void LocalCameraStreamParameters::CropToAspectRatio(bool crop) {
+  crop_to_aspect_ratio_ = crop;
+}
 void LocalCameraStreamParameters::CameraId(const std::string& camera_id) {
   camera_id_ = camera_id;
 }
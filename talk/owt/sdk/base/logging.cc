@@ -1,8 +1,10 @@
 // Copyright (C) <2018> Intel Corporation
 //
 // SPDX-License-Identifier: Apache-2.0
+#include <memory>
 #include <unordered_map>
 #include <string>
+#include "talk/owt/sdk/base/asynclogsink.h"
 #include "talk/owt/sdk/include/cpp/owt/base/logging.h"
 #include "webrtc/rtc_base/log_sinks.h"
 #include "webrtc/rtc_base/logging.h"
@@ -36,12 +38,30 @@ void Logging::LogToConsole(LoggingSeverity severity) {
   rtc::LogMessage::ConfigureLogging(logging_param_map[static_cast<int>(severity)].c_str());
 }
 
+// Writes to file happen on the async sink's writer thread, never on the
+// thread calling RTC_LOG.
+static const size_t kFileLogQueueCapacity = 8192;
+static std::unique_ptr<AsyncLogSink> file_log_sink;
+
+static void AddFileLogSink(
+    LoggingSeverity severity,
+    std::unique_ptr<rtc::CallSessionFileRotatingLogSink> file_sink) {
+  if (!file_sink->Init()) {
+    RTC_LOG(LS_ERROR) << "Failed to create log file.";
+    return;
+  }
+  if (file_log_sink)
+    rtc::LogMessage::RemoveLogToStream(file_log_sink.get());
+  file_log_sink = std::make_unique<AsyncLogSink>(std::move(file_sink),
+                                                 kFileLogQueueCapacity);
+  rtc::LogMessage::AddLogToStream(
+      file_log_sink.get(), logging_severity_map[static_cast<int>(severity)]);
+}
+
 void Logging::LogToFileRotate(LoggingSeverity severity, std::string& dir, size_t max_log_size) {
   min_severity_ = severity;
-  static std::shared_ptr<rtc::CallSessionFileRotatingLogSink> log_sink =
-      std::make_shared<rtc::CallSessionFileRotatingLogSink>(dir, max_log_size);
-  log_sink->Init();
-  rtc::LogMessage::AddLogToStream(log_sink.get(), logging_severity_map[static_cast<int>(severity)]);
+  AddFileLogSink(severity, std::make_unique<rtc::CallSessionFileRotatingLogSink>(
+                               dir, max_log_size));
 }
 
 void Logging::LogToFileRotate(LoggingSeverity severity,
@@ -49,12 +69,12 @@ void Logging::LogToFileRotate(LoggingSeverity severity,
                               const std::string& prefix,
                               size_t max_log_size) {
   min_severity_ = severity;
-  static std::shared_ptr<rtc::CallSessionFileRotatingLogSink> log_sink =
-      std::make_shared<rtc::CallSessionFileRotatingLogSink>(dir, prefix,
-                                                            max_log_size);
-  log_sink->Init();
-  rtc::LogMessage::AddLogToStream(
-      log_sink.get(), logging_severity_map[static_cast<int>(severity)]);
+  AddFileLogSink(severity, std::make_unique<rtc::CallSessionFileRotatingLogSink>(
+                               dir, prefix, max_log_size));
+}
+
+uint64_t Logging::DroppedFileLogMessages() {
+  return file_log_sink ? file_log_sink->DroppedMessages() : 0;
 }
 
 LoggingSeverity Logging::Severity() {
@@ -0,0 +1,89 @@
+// Copyright (C) <2026> Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "talk/owt/sdk/base/memoryaccount.h"
+
+namespace owt {
+namespace base {
+std::shared_ptr<MemoryAccount> MemoryAccount::Process() {
+  static auto* account = new std::shared_ptr<MemoryAccount>(
+      new MemoryAccount(ProcessTag()));
+  return *account;
+}
+
+MemoryAccount::MemoryAccount(std::shared_ptr<MemoryAccount> parent)
+    : parent_(parent ? parent : Process()) {}
+
+MemoryAccount::MemoryAccount(ProcessTag) {}
+
+MemoryAccount::~MemoryAccount() {
+  if (!parent_)
+    return;
+  for (int i = 0; i < kNumCategories; i++) {
+    size_t bytes = counters_[i].bytes.load(std::memory_order_relaxed);
+    if (bytes > 0)
+      parent_->Release(static_cast<MemoryCategory>(i), bytes);
+  }
+}
+
+void MemoryAccount::Add(MemoryCategory category, size_t bytes) {
+  if (bytes == 0)
+    return;
+  counters_[static_cast<int>(category)].Add(bytes);
+  total_.Add(bytes);
+  if (parent_)
+    parent_->Add(category, bytes);
+}
+
+void MemoryAccount::Release(MemoryCategory category, size_t bytes) {
+  if (bytes == 0)
+    return;
+  counters_[static_cast<int>(category)].Release(bytes);
+  total_.Release(bytes);
+  if (parent_)
+    parent_->Release(category, bytes);
+}
+
+MemoryReport MemoryAccount::Report() const {
+  MemoryReport report;
+  report.total = total_.Usage();
+  report.pending_messages =
+      counters_[static_cast<int>(MemoryCategory::kPendingMessages)].Usage();
+  report.pending_candidates =
+      counters_[static_cast<int>(MemoryCategory::kPendingCandidates)].Usage();
+  report.capturer_frame_buffers =
+      counters_[static_cast<int>(MemoryCategory::kCapturerFrameBuffers)]
+          .Usage();
+  report.renderer_buffers =
+      counters_[static_cast<int>(MemoryCategory::kRendererBuffers)].Usage();
+  report.encoded_frames =
+      counters_[static_cast<int>(MemoryCategory::kEncodedFrames)].Usage();
+  return report;
+}
+
+void MemoryAccount::Counter::Add(size_t delta) {
+  size_t now = bytes.fetch_add(delta, std::memory_order_relaxed) + delta;
+  size_t peak = peak_bytes.load(std::memory_order_relaxed);
+  while (now > peak &&
+         !peak_bytes.compare_exchange_weak(peak, now,
+                                           std::memory_order_relaxed)) {
+  }
+}
+
+void MemoryAccount::Counter::Release(size_t delta) {
+  bytes.fetch_sub(delta, std::memory_order_relaxed);
+}
+
+MemoryUsage MemoryAccount::Counter::Usage() const {
+  MemoryUsage usage;
+  usage.bytes = bytes.load(std::memory_order_relaxed);
+  usage.peak_bytes = peak_bytes.load(std::memory_order_relaxed);
+  return usage;
+}
+
+MemoryReport MemoryAccounting::GetProcessReport() {
+  return MemoryAccount::Process()->Report();
+}
+}  // namespace base
+}  // namespace owt
@@ -0,0 +1,61 @@
+// Copyright (C) <2026> Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef OWT_BASE_MEMORYACCOUNT_H_
+#define OWT_BASE_MEMORYACCOUNT_H_
+
+#include <array>
+#include <atomic>
+#include <memory>
+#include "talk/owt/sdk/include/cpp/owt/base/memoryaccounting.h"
+
+namespace owt {
+namespace base {
+enum class MemoryCategory : int {
+  kPendingMessages = 0,
+  kPendingCandidates,
+  kCapturerFrameBuffers,
+  kRendererBuffers,
+  kEncodedFrames,
+};
+
+// Lock-free byte counters by category. Changes propagate to the parent
+// account, so a channel's account feeds its client's, and every client's
+// feeds the process account.
+class MemoryAccount {
+ public:
+  static constexpr int kNumCategories =
+      static_cast<int>(MemoryCategory::kEncodedFrames) + 1;
+  // Account of the process. Never destroyed.
+  static std::shared_ptr<MemoryAccount> Process();
+  // A null |parent| means the process account.
+  explicit MemoryAccount(std::shared_ptr<MemoryAccount> parent = nullptr);
+  // Returns bytes still held to the parent.
+  ~MemoryAccount();
+  MemoryAccount(const MemoryAccount&) = delete;
+  MemoryAccount& operator=(const MemoryAccount&) = delete;
+
+  void Add(MemoryCategory category, size_t bytes);
+  void Release(MemoryCategory category, size_t bytes);
+  MemoryReport Report() const;
+
+ private:
+  struct Counter {
+    std::atomic<size_t> bytes{0};
+    std::atomic<size_t> peak_bytes{0};
+    void Add(size_t delta);
+    void Release(size_t delta);
+    MemoryUsage Usage() const;
+  };
+  struct ProcessTag {};
+  explicit MemoryAccount(ProcessTag);
+
+  // Null for the process account.
+  const std::shared_ptr<MemoryAccount> parent_;
+  std::array<Counter, kNumCategories> counters_;
+  Counter total_;
+};
+}  // namespace base
+}  // namespace owt
+#endif  // OWT_BASE_MEMORYACCOUNT_H_
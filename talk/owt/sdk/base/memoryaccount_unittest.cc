@@ -0,0 +1,99 @@
+// Copyright (C) <2026> Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+#include <thread>
+#include <vector>
+#include "talk/owt/sdk/base/memoryaccount.h"
+#include "talk/owt/sdk/base/webrtcvideorendererimpl.h"
+#include "testing/gtest/include/gtest/gtest.h"
+#include "webrtc/api/video/i420_buffer.h"
+namespace owt {
+namespace base {
+namespace {
+// Keeps the last buffer it was given.
+class HoldingRenderer : public VideoRendererInterface {
+ public:
+  void RenderFrame(std::unique_ptr<VideoBuffer> buffer) override {
+    last_buffer = std::move(buffer);
+  }
+  VideoRendererType Type() override { return VideoRendererType::kI420; }
+  std::unique_ptr<VideoBuffer> last_buffer;
+};
+}  // namespace
+
+TEST(MemoryAccountTest, TracksBytesAndPeaks) {
+  MemoryAccount account;
+  account.Add(MemoryCategory::kPendingMessages, 100);
+  account.Add(MemoryCategory::kPendingCandidates, 50);
+  account.Release(MemoryCategory::kPendingMessages, 100);
+  account.Add(MemoryCategory::kPendingMessages, 30);
+  MemoryReport report = account.Report();
+  EXPECT_EQ(30u, report.pending_messages.bytes);
+  EXPECT_EQ(100u, report.pending_messages.peak_bytes);
+  EXPECT_EQ(50u, report.pending_candidates.bytes);
+  EXPECT_EQ(50u, report.pending_candidates.peak_bytes);
+  EXPECT_EQ(80u, report.total.bytes);
+  // Peak of the sum, not the sum of peaks.
+  EXPECT_EQ(150u, report.total.peak_bytes);
+  EXPECT_EQ(0u, report.encoded_frames.peak_bytes);
+}
+
+TEST(MemoryAccountTest, PropagatesToParents) {
+  auto client = std::make_shared<MemoryAccount>();
+  size_t process_bytes =
+      MemoryAccount::Process()->Report().pending_candidates.bytes;
+  {
+    MemoryAccount channel(client);
+    channel.Add(MemoryCategory::kPendingCandidates, 40);
+    EXPECT_EQ(40u, client->Report().pending_candidates.bytes);
+    EXPECT_EQ(process_bytes + 40,
+              MemoryAccount::Process()->Report().pending_candidates.bytes);
+  }
+  // Bytes of a destroyed channel are returned.
+  EXPECT_EQ(0u, client->Report().pending_candidates.bytes);
+  EXPECT_EQ(40u, client->Report().pending_candidates.peak_bytes);
+  EXPECT_EQ(process_bytes,
+            MemoryAccount::Process()->Report().pending_candidates.bytes);
+}
+
+TEST(MemoryAccountTest, ConcurrentUpdates) {
+  MemoryAccount account;
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 4; t++) {
+    threads.emplace_back([&account]() {
+      for (int i = 0; i < 10000; i++) {
+        account.Add(MemoryCategory::kRendererBuffers, 10);
+        account.Release(MemoryCategory::kRendererBuffers, 10);
+      }
+    });
+  }
+  for (auto& thread : threads)
+    thread.join();
+  MemoryReport report = account.Report();
+  EXPECT_EQ(0u, report.renderer_buffers.bytes);
+  EXPECT_GE(report.renderer_buffers.peak_bytes, 10u);
+  EXPECT_LE(report.renderer_buffers.peak_bytes, 40u);
+}
+
+TEST(MemoryAccountTest, RendererBuffersCountUntilFreed) {
+  size_t renderer_bytes =
+      MemoryAccount::Process()->Report().renderer_buffers.bytes;
+  HoldingRenderer renderer;
+  WebrtcVideoRendererImpl sink(renderer);
+  rtc::scoped_refptr<webrtc::I420Buffer> buffer =
+      webrtc::I420Buffer::Create(64, 48);
+  webrtc::I420Buffer::SetBlack(buffer.get());
+  sink.OnFrame(webrtc::VideoFrame::Builder()
+                   .set_video_frame_buffer(buffer)
+                   .set_timestamp_us(1000)
+                   .build());
+  ASSERT_TRUE(renderer.last_buffer);
+  // Held by the renderer after RenderFrame returned.
+  EXPECT_EQ(renderer_bytes + 64 * 48 * 3 / 2,
+            MemoryAccount::Process()->Report().renderer_buffers.bytes);
+  renderer.last_buffer.reset();
+  EXPECT_EQ(renderer_bytes,
+            MemoryAccount::Process()->Report().renderer_buffers.bytes);
+}
+}  // namespace base
+}  // namespace owt
@@ -0,0 +1,33 @@
+// Copyright (C) <2026> Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "owt/base/metrics.h"
+#include "talk/owt/sdk/base/metricsexporter.h"
+#include "talk/owt/sdk/base/metricsregistry.h"
+
+namespace owt {
+namespace base {
+std::string Metrics::GetPrometheusText() {
+  return MetricsRegistry::Get()->RenderPrometheusText();
+}
+
+void Metrics::StartExporter(
+    std::function<void(const std::string& text)> exporter,
+    int interval_ms) {
+  MetricsExporter::Get()->StartCallback(exporter, interval_ms);
+}
+
+void Metrics::StopExporter() {
+  MetricsExporter::Get()->StopCallback();
+}
+
+int Metrics::StartHttpExporter(int port) {
+  return MetricsExporter::Get()->StartHttp(port);
+}
+
+void Metrics::StopHttpExporter() {
+  MetricsExporter::Get()->StopHttp();
+}
+}  // namespace base
+}  // namespace owt
@@ -0,0 +1,171 @@
+// Copyright (C) <2026> Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "talk/owt/sdk/base/metricsexporter.h"
+#include "talk/owt/sdk/base/metricsregistry.h"
+#include "webrtc/api/units/time_delta.h"
+#include "webrtc/rtc_base/logging.h"
+#include "webrtc/rtc_base/socket_address.h"
+
+namespace owt {
+namespace base {
+namespace {
+// Requests are a single line and a few headers. Larger ones are rejected.
+const size_t kMaxRequestSize = 8192;
+const char kContentType[] = "text/plain; version=0.0.4; charset=utf-8";
+
+std::string HttpResponse(const std::string& status,
+                         const std::string& content_type,
+                         const std::string& body) {
+  return "HTTP/1.1 " + status + "\r\nContent-Type: " + content_type +
+         "\r\nContent-Length: " + std::to_string(body.size()) +
+         "\r\nConnection: close\r\n\r\n" + body;
+}
+}  // namespace
+
+// Answers one request and closes.
+class MetricsExporter::HttpConnection : public sigslot::has_slots<> {
+ public:
+  HttpConnection(MetricsExporter* exporter,
+                 std::unique_ptr<rtc::Socket> socket)
+      : exporter_(exporter), socket_(std::move(socket)) {
+    socket_->SignalReadEvent.connect(this, &HttpConnection::OnRead);
+    socket_->SignalWriteEvent.connect(this, &HttpConnection::OnWrite);
+    socket_->SignalCloseEvent.connect(this, &HttpConnection::OnClose);
+  }
+  bool closed() const { return closed_; }
+
+ private:
+  void OnRead(rtc::Socket* socket) {
+    char buffer[4096];
+    int read;
+    while ((read = socket_->Recv(buffer, sizeof(buffer), nullptr)) > 0)
+      input_.append(buffer, read);
+    if (responded_ || closed_)
+      return;
+    size_t end = input_.find("\r\n\r\n");
+    if (end == std::string::npos) {
+      if (input_.size() > kMaxRequestSize)
+        Close();
+      return;
+    }
+    responded_ = true;
+    std::string request_line = input_.substr(0, input_.find("\r\n"));
+    if (request_line.compare(0, 13, "GET /metrics ") == 0) {
+      output_ = HttpResponse("200 OK", kContentType,
+                             MetricsRegistry::Get()->RenderPrometheusText());
+    } else {
+      output_ = HttpResponse("404 Not Found", "text/plain", "Not found.\n");
+    }
+    OnWrite(socket_.get());
+  }
+
+  void OnWrite(rtc::Socket* socket) {
+    while (!output_.empty() && !closed_) {
+      int sent = socket_->Send(output_.data(), output_.size());
+      if (sent <= 0) {
+        if (!socket_->IsBlocking())
+          Close();
+        return;
+      }
+      output_.erase(0, sent);
+    }
+    if (responded_ && output_.empty())
+      Close();
+  }
+
+  void OnClose(rtc::Socket* socket, int error) { Close(); }
+
+  void Close() {
+    if (closed_)
+      return;
+    closed_ = true;
+    socket_->Close();
+    exporter_->Remove(this);
+  }
+
+  MetricsExporter* const exporter_;
+  std::unique_ptr<rtc::Socket> socket_;
+  std::string input_;
+  std::string output_;
+  bool responded_ = false;
+  bool closed_ = false;
+};
+
+MetricsExporter* MetricsExporter::Get() {
+  static MetricsExporter* exporter = new MetricsExporter();
+  return exporter;
+}
+
+MetricsExporter::MetricsExporter()
+    : thread_(rtc::Thread::CreateWithSocketServer()) {
+  thread_->SetName("MetricsExporterThread", nullptr);
+  thread_->Start();
+}
+
+void MetricsExporter::StartCallback(
+    std::function<void(const std::string& text)> callback,
+    int interval_ms) {
+  thread_->BlockingCall([this, callback, interval_ms] {
+    callback_task_.Stop();
+    if (!callback || interval_ms <= 0)
+      return;
+    callback_task_ = webrtc::RepeatingTaskHandle::DelayedStart(
+        thread_.get(), webrtc::TimeDelta::Millis(interval_ms),
+        [callback, interval_ms] {
+          callback(MetricsRegistry::Get()->RenderPrometheusText());
+          return webrtc::TimeDelta::Millis(interval_ms);
+        });
+  });
+}
+
+void MetricsExporter::StopCallback() {
+  thread_->BlockingCall([this] { callback_task_.Stop(); });
+}
+
+int MetricsExporter::StartHttp(int port) {
+  return thread_->BlockingCall([this, port] {
+    listen_socket_.reset(
+        thread_->socketserver()->CreateSocket(AF_INET, SOCK_STREAM));
+    if (!listen_socket_ ||
+        listen_socket_->Bind(rtc::SocketAddress("127.0.0.1", port)) != 0 ||
+        listen_socket_->Listen(16) != 0) {
+      RTC_LOG(LS_ERROR) << "Failed to serve metrics on port " << port;
+      listen_socket_.reset();
+      return 0;
+    }
+    listen_socket_->SignalReadEvent.connect(this, &MetricsExporter::OnAccept);
+    int bound_port = listen_socket_->GetLocalAddress().port();
+    RTC_LOG(LS_INFO) << "Serving metrics on 127.0.0.1:" << bound_port;
+    return bound_port;
+  });
+}
+
+void MetricsExporter::StopHttp() {
+  thread_->BlockingCall([this] {
+    listen_socket_.reset();
+    connections_.clear();
+  });
+}
+
+void MetricsExporter::OnAccept(rtc::Socket* socket) {
+  std::unique_ptr<rtc::Socket> accepted(listen_socket_->Accept(nullptr));
+  if (!accepted)
+    return;
+  auto connection =
+      std::make_unique<HttpConnection>(this, std::move(accepted));
+  connections_[connection.get()] = std::move(connection);
+}
+
+void MetricsExporter::Remove(HttpConnection* connection) {
+  // The exporter is never destroyed. StopHttp may have destroyed
+  // |connection| already, and a new one may live at its address.
+  thread_->PostTask([this, connection] {
+    auto it = connections_.find(connection);
+    if (it != connections_.end() && it->second->closed())
+      connections_.erase(it);
+  });
+}
+}  // namespace base
+}  // namespace owt
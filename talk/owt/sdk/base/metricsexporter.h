@@ -0,0 +1,47 @@
+// Copyright (C) <2026> Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef OWT_BASE_METRICSEXPORTER_H_
+#define OWT_BASE_METRICSEXPORTER_H_
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include "webrtc/rtc_base/socket.h"
+#include "webrtc/rtc_base/task_utils/repeating_task.h"
+#include "webrtc/rtc_base/third_party/sigslot/sigslot.h"
+#include "webrtc/rtc_base/thread.h"
+
+namespace owt {
+namespace base {
+// Exports MetricsRegistry in the Prometheus text format, by calling a
+// callback periodically and by serving HTTP GET /metrics on a loopback port.
+// Both run on a thread of the exporter, created on first use.
+class MetricsExporter : public sigslot::has_slots<> {
+ public:
+  static MetricsExporter* Get();
+  // Replaces the current callback.
+  void StartCallback(std::function<void(const std::string& text)> callback,
+                     int interval_ms);
+  void StopCallback();
+  // Returns the port listened on, or 0 on failure. Stops a previous server.
+  int StartHttp(int port);
+  void StopHttp();
+
+ private:
+  class HttpConnection;
+  MetricsExporter();
+  void OnAccept(rtc::Socket* socket);
+  // Destroys |connection| once the current task is done with it.
+  void Remove(HttpConnection* connection);
+
+  std::unique_ptr<rtc::Thread> thread_;
+  webrtc::RepeatingTaskHandle callback_task_;
+  std::unique_ptr<rtc::Socket> listen_socket_;
+  std::map<HttpConnection*, std::unique_ptr<HttpConnection>> connections_;
+};
+}  // namespace base
+}  // namespace owt
+#endif  // OWT_BASE_METRICSEXPORTER_H_
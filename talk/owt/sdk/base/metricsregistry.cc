@@ -0,0 +1,204 @@
+// Copyright (C) <2026> Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "talk/owt/sdk/base/metricsregistry.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include "webrtc/rtc_base/checks.h"
+
+namespace owt {
+namespace base {
+namespace {
+std::string FormatDouble(double value) {
+  if (std::isinf(value))
+    return value > 0 ? "+Inf" : "-Inf";
+  if (std::isnan(value))
+    return "NaN";
+  char buffer[32];
+  snprintf(buffer, sizeof(buffer), "%.15g", value);
+  return buffer;
+}
+
+// Escapes backslashes and line feeds, and double quotes if |quotes| is true.
+std::string Escape(const std::string& text, bool quotes) {
+  std::string escaped;
+  escaped.reserve(text.size());
+  for (char c : text) {
+    if (c == '\\') {
+      escaped += "\\\\";
+    } else if (c == '\n') {
+      escaped += "\\n";
+    } else if (c == '"' && quotes) {
+      escaped += "\\\"";
+    } else {
+      escaped += c;
+    }
+  }
+  return escaped;
+}
+
+// Renders |labels| and |extra|, if not empty, as {name="value",...}.
+std::string FormatLabels(const MetricLabels& labels,
+                         const std::pair<std::string, std::string>* extra) {
+  if (labels.empty() && !extra)
+    return "";
+  std::string text = "{";
+  bool first = true;
+  auto append = [&](const std::pair<std::string, std::string>& label) {
+    if (!first)
+      text += ",";
+    first = false;
+    text += label.first + "=\"" + Escape(label.second, true) + "\"";
+  };
+  for (const auto& label : labels)
+    append(label);
+  if (extra)
+    append(*extra);
+  return text + "}";
+}
+}  // namespace
+
+MetricHistogram::MetricHistogram(const std::vector<double>& bounds)
+    : bounds_(bounds),
+      buckets_(new std::atomic<uint64_t>[bounds.size() + 1]) {
+  RTC_DCHECK(std::is_sorted(bounds_.begin(), bounds_.end()));
+  for (size_t i = 0; i <= bounds_.size(); i++)
+    buckets_[i].store(0, std::memory_order_relaxed);
+}
+
+void MetricHistogram::Observe(double value) {
+  size_t index = std::lower_bound(bounds_.begin(), bounds_.end(), value) -
+                 bounds_.begin();
+  buckets_[index].fetch_add(1, std::memory_order_relaxed);
+  double sum = sum_.load(std::memory_order_relaxed);
+  while (!sum_.compare_exchange_weak(sum, sum + value,
+                                     std::memory_order_relaxed)) {
+  }
+}
+
+MetricHistogram::Snapshot MetricHistogram::GetSnapshot() const {
+  Snapshot snapshot;
+  snapshot.buckets.reserve(bounds_.size() + 1);
+  uint64_t count = 0;
+  for (size_t i = 0; i <= bounds_.size(); i++) {
+    count += buckets_[i].load(std::memory_order_relaxed);
+    snapshot.buckets.push_back(count);
+  }
+  snapshot.sum = sum_.load(std::memory_order_relaxed);
+  return snapshot;
+}
+
+MetricsRegistry* MetricsRegistry::Get() {
+  static MetricsRegistry* registry = new MetricsRegistry();
+  return registry;
+}
+
+MetricCounter* MetricsRegistry::Counter(const std::string& name,
+                                        const std::string& help,
+                                        const MetricLabels& labels) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  Series* series = FindOrCreateSeries(name, help, Type::kCounter, labels);
+  if (!series->counter)
+    series->counter.reset(new MetricCounter());
+  return series->counter.get();
+}
+
+MetricGauge* MetricsRegistry::Gauge(const std::string& name,
+                                    const std::string& help,
+                                    const MetricLabels& labels) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  Series* series = FindOrCreateSeries(name, help, Type::kGauge, labels);
+  if (!series->gauge)
+    series->gauge.reset(new MetricGauge());
+  return series->gauge.get();
+}
+
+MetricHistogram* MetricsRegistry::Histogram(const std::string& name,
+                                            const std::string& help,
+                                            const std::vector<double>& bounds,
+                                            const MetricLabels& labels) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  Series* series = FindOrCreateSeries(name, help, Type::kHistogram, labels);
+  if (!series->histogram)
+    series->histogram.reset(new MetricHistogram(bounds));
+  RTC_DCHECK(series->histogram->Bounds() == bounds);
+  return series->histogram.get();
+}
+
+MetricsRegistry::Series* MetricsRegistry::FindOrCreateSeries(
+    const std::string& name,
+    const std::string& help,
+    Type type,
+    const MetricLabels& labels) {
+  auto it = families_.find(name);
+  if (it == families_.end()) {
+    Family family;
+    family.type = type;
+    family.help = help;
+    it = families_.emplace(name, std::move(family)).first;
+  }
+  RTC_CHECK(it->second.type == type) << name << " has another type.";
+  return &it->second.series[labels];
+}
+
+std::string MetricsRegistry::RenderPrometheusText() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  std::string text;
+  for (const auto& family_pair : families_) {
+    const std::string& name = family_pair.first;
+    const Family& family = family_pair.second;
+    text += "# HELP " + name + " " + Escape(family.help, false) + "\n";
+    switch (family.type) {
+      case Type::kCounter:
+        text += "# TYPE " + name + " counter\n";
+        break;
+      case Type::kGauge:
+        text += "# TYPE " + name + " gauge\n";
+        break;
+      case Type::kHistogram:
+        text += "# TYPE " + name + " histogram\n";
+        break;
+    }
+    for (const auto& series_pair : family.series) {
+      const MetricLabels& labels = series_pair.first;
+      const Series& series = series_pair.second;
+      if (series.counter) {
+        text += name + FormatLabels(labels, nullptr) + " " +
+                std::to_string(series.counter->Value()) + "\n";
+      } else if (series.gauge) {
+        text += name + FormatLabels(labels, nullptr) + " " +
+                std::to_string(series.gauge->Value()) + "\n";
+      } else if (series.histogram) {
+        MetricHistogram::Snapshot snapshot = series.histogram->GetSnapshot();
+        const std::vector<double>& bounds = series.histogram->Bounds();
+        for (size_t i = 0; i < snapshot.buckets.size(); i++) {
+          std::pair<std::string, std::string> le(
+              "le", i < bounds.size() ? FormatDouble(bounds[i]) : "+Inf");
+          text += name + "_bucket" + FormatLabels(labels, &le) + " " +
+                  std::to_string(snapshot.buckets[i]) + "\n";
+        }
+        text += name + "_sum" + FormatLabels(labels, nullptr) + " " +
+                FormatDouble(snapshot.sum) + "\n";
+        text += name + "_count" + FormatLabels(labels, nullptr) + " " +
+                std::to_string(snapshot.buckets.back()) + "\n";
+      }
+    }
+  }
+  return text;
+}
+
+const std::vector<double>& MetricsRegistry::DurationBoundsMs() {
+  static const std::vector<double>* bounds = new std::vector<double>{
+      1, 2, 5, 10, 20, 50, 100, 200, 500, 1000, 2000, 5000, 10000};
+  return *bounds;
+}
+
+const std::vector<double>& MetricsRegistry::SizeBoundsBytes() {
+  static const std::vector<double>* bounds = new std::vector<double>{
+      256, 1024, 4096, 16384, 65536, 262144, 1048576, 4194304};
+  return *bounds;
+}
+}  // namespace base
+}  // namespace owt
@@ -0,0 +1,119 @@
+// Copyright (C) <2026> Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef OWT_BASE_METRICSREGISTRY_H_
+#define OWT_BASE_METRICSREGISTRY_H_
+
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace owt {
+namespace base {
+// Label names and values of a metric, in the order they are rendered.
+using MetricLabels = std::vector<std::pair<std::string, std::string>>;
+
+class MetricCounter {
+ public:
+  void Increment(uint64_t value = 1) {
+    value_.fetch_add(value, std::memory_order_relaxed);
+  }
+  uint64_t Value() const { return value_.load(std::memory_order_relaxed); }
+
+ private:
+  std::atomic<uint64_t> value_{0};
+};
+
+class MetricGauge {
+ public:
+  void Set(int64_t value) { value_.store(value, std::memory_order_relaxed); }
+  void Add(int64_t value) {
+    value_.fetch_add(value, std::memory_order_relaxed);
+  }
+  int64_t Value() const { return value_.load(std::memory_order_relaxed); }
+
+ private:
+  std::atomic<int64_t> value_{0};
+};
+
+// Histogram with fixed bucket upper bounds. Observations are lock-free.
+class MetricHistogram {
+ public:
+  struct Snapshot {
+    // Cumulative count of each bound, followed by the count of all
+    // observations for +Inf.
+    std::vector<uint64_t> buckets;
+    double sum = 0;
+  };
+  // |bounds| must be sorted in ascending order.
+  explicit MetricHistogram(const std::vector<double>& bounds);
+  void Observe(double value);
+  const std::vector<double>& Bounds() const { return bounds_; }
+  Snapshot GetSnapshot() const;
+
+ private:
+  const std::vector<double> bounds_;
+  // Non-cumulative. The last one counts values above all bounds.
+  std::unique_ptr<std::atomic<uint64_t>[]> buckets_;
+  std::atomic<double> sum_{0};
+};
+
+// Process-wide registry of counters, gauges and histograms, rendered in the
+// Prometheus text exposition format on demand. Looking a metric up takes a
+// lock, so hot paths look their metrics up once and keep the pointers, which
+// stay valid for the lifetime of the process. Updates are lock-free.
+class MetricsRegistry {
+ public:
+  static MetricsRegistry* Get();
+  // Return the metric of |name| with |labels|, registering it on first use.
+  // A name must always be used with the same type and help text.
+  MetricCounter* Counter(const std::string& name,
+                         const std::string& help,
+                         const MetricLabels& labels = {});
+  MetricGauge* Gauge(const std::string& name,
+                     const std::string& help,
+                     const MetricLabels& labels = {});
+  MetricHistogram* Histogram(const std::string& name,
+                             const std::string& help,
+                             const std::vector<double>& bounds,
+                             const MetricLabels& labels = {});
+  // Text exposition format, version 0.0.4.
+  std::string RenderPrometheusText() const;
+
+  // Bucket bounds for durations in milliseconds.
+  static const std::vector<double>& DurationBoundsMs();
+  // Bucket bounds for sizes in bytes.
+  static const std::vector<double>& SizeBoundsBytes();
+
+ private:
+  enum class Type { kCounter, kGauge, kHistogram };
+  struct Series {
+    std::unique_ptr<MetricCounter> counter;
+    std::unique_ptr<MetricGauge> gauge;
+    std::unique_ptr<MetricHistogram> histogram;
+  };
+  struct Family {
+    Type type;
+    std::string help;
+    std::map<MetricLabels, Series> series;
+  };
+  // Returns the series of |name| with |labels|, creating an empty one if it
+  // does not exist. |mutex_| must be held.
+  Series* FindOrCreateSeries(const std::string& name,
+                             const std::string& help,
+                             Type type,
+                             const MetricLabels& labels);
+
+  mutable std::mutex mutex_;
+  // Ordered by name so output is stable.
+  std::map<std::string, Family> families_;
+};
+}  // namespace base
+}  // namespace owt
+#endif  // OWT_BASE_METRICSREGISTRY_H_
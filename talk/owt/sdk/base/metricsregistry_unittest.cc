@@ -0,0 +1,86 @@
+// Copyright (C) <2026> Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+#include <thread>
+#include <vector>
+#include "talk/owt/sdk/base/metricsregistry.h"
+#include "testing/gmock/include/gmock/gmock.h"
+#include "testing/gtest/include/gtest/gtest.h"
+namespace owt {
+namespace base {
+using ::testing::HasSubstr;
+
+TEST(MetricsRegistryTest, RendersCountersAndGauges) {
+  MetricsRegistry* registry = MetricsRegistry::Get();
+  MetricCounter* counter = registry->Counter(
+      "test_requests_total", "Requests.", {{"method", "get"}});
+  counter->Increment();
+  counter->Increment(2);
+  // The same name and labels return the same counter.
+  EXPECT_EQ(counter, registry->Counter("test_requests_total", "Requests.",
+                                       {{"method", "get"}}));
+  registry->Counter("test_requests_total", "Requests.", {{"method", "put"}});
+  MetricGauge* gauge = registry->Gauge("test_queue_length", "Queued items.");
+  gauge->Set(10);
+  gauge->Add(-3);
+  std::string text = registry->RenderPrometheusText();
+  EXPECT_THAT(text, HasSubstr("# HELP test_requests_total Requests.\n"
+                              "# TYPE test_requests_total counter\n"
+                              "test_requests_total{method=\"get\"} 3\n"
+                              "test_requests_total{method=\"put\"} 0\n"));
+  EXPECT_THAT(text, HasSubstr("# TYPE test_queue_length gauge\n"
+                              "test_queue_length 7\n"));
+}
+
+TEST(MetricsRegistryTest, RendersHistograms) {
+  MetricHistogram* histogram = MetricsRegistry::Get()->Histogram(
+      "test_latency_ms", "Latency.", {1, 10}, {{"path", "a"}});
+  histogram->Observe(0.5);
+  histogram->Observe(1);
+  histogram->Observe(5);
+  histogram->Observe(50);
+  std::string text = MetricsRegistry::Get()->RenderPrometheusText();
+  EXPECT_THAT(text,
+              HasSubstr("# TYPE test_latency_ms histogram\n"
+                        "test_latency_ms_bucket{path=\"a\",le=\"1\"} 2\n"
+                        "test_latency_ms_bucket{path=\"a\",le=\"10\"} 3\n"
+                        "test_latency_ms_bucket{path=\"a\",le=\"+Inf\"} 4\n"
+                        "test_latency_ms_sum{path=\"a\"} 56.5\n"
+                        "test_latency_ms_count{path=\"a\"} 4\n"));
+}
+
+TEST(MetricsRegistryTest, EscapesLabelValuesAndHelp) {
+  MetricsRegistry::Get()
+      ->Counter("test_escaped_total", "Line\\one\ntwo.",
+                {{"name", "a\"b\\c\nd"}})
+      ->Increment();
+  std::string text = MetricsRegistry::Get()->RenderPrometheusText();
+  EXPECT_THAT(text,
+              HasSubstr("# HELP test_escaped_total Line\\\\one\\ntwo.\n"));
+  EXPECT_THAT(text,
+              HasSubstr("test_escaped_total{name=\"a\\\"b\\\\c\\nd\"} 1\n"));
+}
+
+TEST(MetricsRegistryTest, ConcurrentUpdates) {
+  MetricCounter* counter =
+      MetricsRegistry::Get()->Counter("test_concurrent_total", "Updates.");
+  MetricHistogram* histogram = MetricsRegistry::Get()->Histogram(
+      "test_concurrent_ms", "Updates.", MetricsRegistry::DurationBoundsMs());
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 4; t++) {
+    threads.emplace_back([counter, histogram]() {
+      for (int i = 0; i < 10000; i++) {
+        counter->Increment();
+        histogram->Observe(1);
+      }
+    });
+  }
+  for (auto& thread : threads)
+    thread.join();
+  EXPECT_EQ(40000u, counter->Value());
+  MetricHistogram::Snapshot snapshot = histogram->GetSnapshot();
+  EXPECT_EQ(40000u, snapshot.buckets.back());
+  EXPECT_DOUBLE_EQ(40000, snapshot.sum);
+}
+}  // namespace base
+}  // namespace owt
@@ -2,9 +2,14 @@
 //
 // SPDX-License-Identifier: Apache-2.0
 #include "talk/owt/sdk/base/peerconnectionchannel.h"
+#include <algorithm>
 #include <vector>
+#include "talk/owt/sdk/base/encoderpolicyvideotracksource.h"
+#include "talk/owt/sdk/base/rtpencodingsettings.h"
 #include "talk/owt/sdk/base/sdputils.h"
+#include "webrtc/api/make_ref_counted.h"
 #include "webrtc/api/peer_connection_interface.h"
+#include "webrtc/api/rtp_transceiver_interface.h"
 #include "webrtc/rtc_base/logging.h"
 #include "webrtc/rtc_base/thread.h"
 #include "webrtc/system_wrappers/include/field_trial.h"
@@ -43,56 +48,148 @@ bool PeerConnectionChannel::InitializePeerConnection() {
   RTC_CHECK(peer_connection_);
   return true;
 }
-void PeerConnectionChannel::ApplyBitrateSettings() {
+bool PeerConnectionChannel::ApplyBitrateSettings() {
   RTC_CHECK(peer_connection_);
   std::vector<rtc::scoped_refptr<webrtc::RtpSenderInterface>> senders =
       peer_connection_->GetSenders();
   if (senders.size() == 0) {
     RTC_LOG(LS_WARNING) << "Cannot set max bitrate without stream added.";
-    return;
+    return true;
   }
+  std::vector<VideoEncodingParameters> video_settings;
+  std::vector<AudioEncodingParameters> audio_settings;
+  {
+    std::lock_guard<std::mutex> lock(encoding_settings_mutex_);
+    video_settings = configuration_.video;
+    audio_settings = configuration_.audio;
+  }
+  bool result = true;
   for (auto sender : senders) {
     auto sender_track = sender->track();
-    if (sender_track != nullptr) {
-      webrtc::RtpParameters rtp_parameters = sender->GetParameters();
+    if (sender_track == nullptr)
+      continue;
+    webrtc::RtpParameters rtp_parameters = sender->GetParameters();
+    bool changed = false;
+    if (sender_track->kind() == webrtc::MediaStreamTrackInterface::kAudioKind) {
+      if (audio_settings.size() > 0 && audio_settings[0].max_bitrate > 0) {
+        for (auto& encoding : rtp_parameters.encodings) {
+          encoding.max_bitrate_bps =
+              absl::optional<int>(audio_settings[0].max_bitrate * 1024);
+          changed = true;
+        }
+      }
+    } else if (sender_track->kind() ==
+                   webrtc::MediaStreamTrackInterface::kVideoKind &&
+               video_settings.size() > 0) {
+      const VideoEncodingParameters& video = video_settings[0];
       for (size_t idx = 0; idx < rtp_parameters.encodings.size(); idx++) {
-        // TODO(jianlin): It may not be appropriate to set the same settings
-        // on all encodings. Update the logic when upstream implement the
-        // the per codec settings, and many other encoding specific setttings
-        // should move here instead of modifying SDP.
-        if (sender_track->kind() ==
-            webrtc::MediaStreamTrackInterface::kAudioKind) {
-          if (configuration_.audio.size() > 0 &&
-              configuration_.audio[0].max_bitrate > 0) {
-            rtp_parameters.encodings[idx].max_bitrate_bps =
-                absl::optional<int>(configuration_.audio[0].max_bitrate * 1024);
-            sender->SetParameters(rtp_parameters);
-          }
-        } else if (sender_track->kind() ==
-                   webrtc::MediaStreamTrackInterface::kVideoKind) {
-          if (configuration_.video.size() > 0 &&
-              configuration_.video[0].max_bitrate > 0) {
-            rtp_parameters.encodings[idx].max_bitrate_bps =
-                absl::optional<int>(configuration_.video[0].max_bitrate * 1024);
-            sender->SetParameters(rtp_parameters);
-          }
+        webrtc::RtpEncodingParameters& encoding = rtp_parameters.encodings[idx];
+        if (video.max_bitrate > 0) {
+          encoding.max_bitrate_bps =
+              absl::optional<int>(video.max_bitrate * 1024);
+          changed = true;
+        }
+        const RtpEncodingParameters* settings = FindEncodingSettings(
+            video.rtp_encoding_parameters, encoding, idx);
+        if (settings) {
+          ApplyEncodingSettings(*settings, &encoding);
+          changed = true;
         }
       }
     }
+    if (!changed)
+      continue;
+    webrtc::RTCError error = sender->SetParameters(rtp_parameters);
+    if (!error.ok()) {
+      RTC_LOG(LS_WARNING) << "Failed to apply bitrate settings: "
+                          << error.message();
+      result = false;
+    }
+  }
+  if (!start_bitrate_applied_ && video_settings.size() > 0 &&
+      video_settings[0].start_bitrate > 0) {
+    // Replaces x-google-start-bitrate in SDP.
+    webrtc::BitrateSettings bitrate_settings;
+    bitrate_settings.start_bitrate_bps =
+        static_cast<int>(video_settings[0].start_bitrate * 1024);
+    webrtc::RTCError error = peer_connection_->SetBitrate(bitrate_settings);
+    if (!error.ok()) {
+      RTC_LOG(LS_WARNING) << "Failed to set start bitrate: "
+                          << error.message();
+      result = false;
+    }
+    start_bitrate_applied_ = true;
+  }
+  return result;
+}
+
+void PeerConnectionChannel::OfferVideoHeaderExtension(const std::string& uri) {
+  for (const auto& transceiver : peer_connection_->GetTransceivers()) {
+    if (transceiver->media_type() != cricket::MediaType::MEDIA_TYPE_VIDEO ||
+        transceiver->stopped()) {
+      continue;
+    }
+    std::vector<webrtc::RtpHeaderExtensionCapability> extensions =
+        transceiver->HeaderExtensionsToOffer();
+    auto extension = std::find_if(
+        extensions.begin(), extensions.end(),
+        [&uri](const webrtc::RtpHeaderExtensionCapability& capability) {
+          return capability.uri == uri;
+        });
+    if (extension == extensions.end()) {
+      RTC_LOG(LS_WARNING) << "Header extension " << uri << " not supported.";
+      continue;
+    }
+    if (extension->direction != webrtc::RtpTransceiverDirection::kStopped)
+      continue;
+    extension->direction = webrtc::RtpTransceiverDirection::kSendRecv;
+    webrtc::RTCError error =
+        transceiver->SetOfferedRtpHeaderExtensions(extensions);
+    if (!error.ok()) {
+      RTC_LOG(LS_WARNING) << "Failed to offer header extension " << uri << ": "
+                          << error.message();
+    }
   }
-  return;
 }
 
-void PeerConnectionChannel::AddTransceiver(
+rtc::scoped_refptr<webrtc::RtpTransceiverInterface>
+PeerConnectionChannel::AddTransceiver(
     rtc::scoped_refptr<webrtc::MediaStreamTrackInterface> track,
     const webrtc::RtpTransceiverInit& init) {
-  peer_connection_->AddTransceiver(track, init);
+  // Publications with an explicit encoder policy send a copy of the track
+  // whose frames carry the policy to the encoder factory.
+  if (track && track->kind() == webrtc::MediaStreamTrackInterface::kVideoKind &&
+      !configuration_.video.empty() &&
+      configuration_.video[0].encoder_policy != VideoEncoderPolicy::kAuto) {
+    rtc::scoped_refptr<webrtc::VideoTrackInterface> video_track(
+        static_cast<webrtc::VideoTrackInterface*>(track.get()));
+    auto source = rtc::make_ref_counted<EncoderPolicyVideoTrackSource>(
+        video_track, configuration_.video[0].encoder_policy);
+    rtc::scoped_refptr<webrtc::VideoTrackInterface> tagged_track =
+        factory_->CreateLocalVideoTrack(video_track->id(), source.get());
+    tagged_track->set_content_hint(video_track->content_hint());
+    track = tagged_track;
+  }
+  auto result = peer_connection_->AddTransceiver(track, init);
+  if (!result.ok()) {
+    RTC_LOG(LS_ERROR) << "Failed to add transceiver: "
+                      << result.error().message();
+    return nullptr;
+  }
+  return result.MoveValue();
 }
 
-void PeerConnectionChannel::AddTransceiver(
+rtc::scoped_refptr<webrtc::RtpTransceiverInterface>
+PeerConnectionChannel::AddTransceiver(
     cricket::MediaType media_type,
     const webrtc::RtpTransceiverInit& init) {
-  peer_connection_->AddTransceiver(media_type, init);
+  auto result = peer_connection_->AddTransceiver(media_type, init);
+  if (!result.ok()) {
+    RTC_LOG(LS_ERROR) << "Failed to add transceiver: "
+                      << result.error().message();
+    return nullptr;
+  }
+  return result.MoveValue();
 }
 
 const webrtc::SessionDescriptionInterface*
@@ -165,6 +262,8 @@ void PeerConnectionChannel::OnNetworksChanged() {
   RTC_LOG(LS_INFO) << "PeerConnectionChannel::OnNetworksChanged.";
 }
 PeerConnectionChannelConfiguration::PeerConnectionChannelConfiguration()
-    : RTCConfiguration() {}
+    : RTCConfiguration(),
+      shared_video_encoding(false),
+      compact_signaling(false) {}
 }  // namespace base
 }  // namespace owt
@@ -3,6 +3,8 @@
 // SPDX-License-Identifier: Apache-2.0
 #ifndef WOOGEEN_BASE_PEERCONNECTIONCHANNEL_H_
 #define WOOGEEN_BASE_PEERCONNECTIONCHANNEL_H_
+#include <mutex>
+#include <string>
 #include <vector>
 #include "webrtc/rtc_base/third_party/sigslot/sigslot.h"
 #include "webrtc/sdk/media_constraints.h"
@@ -22,6 +24,12 @@ struct PeerConnectionChannelConfiguration
   std::vector<AudioEncodingParameters> audio;
   /// Indicate whether this PeerConnection is used for sending encoded frame.
   bool encoded_video_frame_;
+  /// Indicate whether video tracks are encoded once for all PeerConnections.
+  bool shared_video_encoding;
+  /// Remote endpoint driving the rate of shared encoders, empty for weakest.
+  std::string shared_video_encoding_rate_peer;
+  /// Indicate whether signaling messages may be sent in compact encoding.
+  bool compact_signaling;
 };
 class PeerConnectionChannel : public webrtc::PeerConnectionObserver,
                               public webrtc::DataChannelObserver,
@@ -35,17 +43,24 @@ class PeerConnectionChannel : public webrtc::PeerConnectionObserver,
   webrtc::PeerConnectionInterface::SignalingState SignalingState() const;
   // Apply the bitrate settings on all tracks available. Failing to set any of them
   // will result in a false return, with remaining settings applicable still applied.
-  // Subclasses can override this to implementation specific bitrate allocation policies.
-  void ApplyBitrateSettings();
+  // Settings are matched to encodings by rid, or by index for encodings
+  // without one, and applied with one SetParameters per sender, so this can
+  // be called again at any time to update them without renegotiation.
+  bool ApplyBitrateSettings();
+  // Adds RTP header extension |uri| to the extensions offered by all video
+  // transceivers. Call it before creating an offer.
+  void OfferVideoHeaderExtension(const std::string& uri);
   // Subclasses should prepare observers for these functions and post
   // message to PeerConnectionChannel.
   virtual void CreateOffer() = 0;
   virtual void CreateAnswer() = 0;
-  virtual void AddTransceiver(
+  // Returns the transceiver added, or nullptr on failure.
+  virtual rtc::scoped_refptr<webrtc::RtpTransceiverInterface> AddTransceiver(
       rtc::scoped_refptr<webrtc::MediaStreamTrackInterface> track,
       const webrtc::RtpTransceiverInit& init);
-  virtual void AddTransceiver(cricket::MediaType media_type,
-                              const webrtc::RtpTransceiverInit& init);
+  virtual rtc::scoped_refptr<webrtc::RtpTransceiverInterface> AddTransceiver(
+      cricket::MediaType media_type,
+      const webrtc::RtpTransceiverInit& init);
   // PeerConnectionObserver
   virtual void OnStateChange(webrtc::StatsReport::StatsType state_changed) {}
   virtual void OnSignalingChange(
@@ -91,6 +106,9 @@ class PeerConnectionChannel : public webrtc::PeerConnectionObserver,
   // most 1 audio transceiver and 1 video transceiver.
   webrtc::RtpTransceiverDirection audio_transceiver_direction_;
   webrtc::RtpTransceiverDirection video_transceiver_direction_;
+  // Guards the encoding settings in |configuration_|, which may be updated
+  // while a publication is live. Never held while calling into webrtc.
+  std::mutex encoding_settings_mutex_;
  private:
   // DataChannelObserver
   virtual void OnStateChange() override { OnDataChannelStateChange(); }
@@ -100,6 +118,9 @@ class PeerConnectionChannel : public webrtc::PeerConnectionObserver,
   // |factory_| is got from PeerConnectionDependencyFactory::Get() which is
   // shared among all PeerConnectionChannels.
   rtc::scoped_refptr<PeerConnectionDependencyFactory> factory_;
+  // The start bitrate is only applied once, as it resets the bandwidth
+  // estimation.
+  bool start_bitrate_applied_ = false;
 };
 }
 }
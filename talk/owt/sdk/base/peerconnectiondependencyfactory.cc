@@ -3,7 +3,7 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 #include "talk/owt/sdk/base/customizedaudiodevicemodule.h"
-#include "talk/owt/sdk/base/encodedvideoencoderfactory.h"
+#include "talk/owt/sdk/base/encodedframeforwarder.h"
 #include "talk/owt/sdk/base/peerconnectiondependencyfactory.h"
 #include "webrtc/api/audio_codecs/builtin_audio_decoder_factory.h"
 #include "webrtc/api/audio_codecs/builtin_audio_encoder_factory.h"
@@ -30,7 +30,10 @@
 #include "talk/owt/sdk/base/objc/ObjcVideoCodecFactory.h"
 #endif
 #if defined(WEBRTC_LINUX) || defined(WEBRTC_WIN)
+#include "talk/owt/sdk/base/bitstreamdumpwriter.h"
 #include "talk/owt/sdk/base/customizedvideodecoderfactory.h"
+#include "talk/owt/sdk/base/dumpingvideodecoderfactory.h"
+#include "talk/owt/sdk/base/selectingvideoencoderfactory.h"
 #endif
 #include "owt/base/clientconfiguration.h"
 #include "owt/base/globalconfiguration.h"
@@ -127,6 +130,9 @@ void PeerConnectionDependencyFactory::
       GlobalConfiguration::GetAEC3Enabled()) {
     field_trial_ += "OWT-EchoCanceller3/Enabled/";
   }
+#if !defined(WEBRTC_WIN) && !defined(WEBRTC_LINUX)
+  // Windows and Linux dump through BitstreamDumpWriter, off the encoding and
+  // decoding threads.
   bool pre_decode_dump = GlobalConfiguration::GetPreDecodeDumpEnabled();
   if (pre_decode_dump) {
     field_trial_ += "WebRTC-DecoderDataDumpDirectory/./";
@@ -136,6 +142,7 @@ void PeerConnectionDependencyFactory::
   if (post_encode_dump) {
     field_trial_ += "WebRTC-EncoderDataDumpDirectory/./";
   }
+#endif
 
   // Set H.264 temporal layers. Ideally it should be set via RtpSenderParam
   int h264_temporal_layers = GlobalConfiguration::GetH264TemporalLayers();
@@ -190,24 +197,27 @@ void PeerConnectionDependencyFactory::
   // Configure codec factories. MSDK factory will internally use built-in codecs
   // if hardware acceleration is not in place. For H.265/H.264, if hardware
   // acceleration is turned off at application level, negotiation will fail.
-  if (encoded_frame_) {
-    encoder_factory.reset(new EncodedVideoEncoderFactory());
-  } else if (render_hardware_acceleration_enabled_) {
+  // Each encoder picks pass-through, hardware or pooled software on its first
+  // frame, so publications with different encoder policies can coexist.
+  std::unique_ptr<webrtc::VideoEncoderFactory> hardware_encoder_factory;
+  if (render_hardware_acceleration_enabled_) {
 #if defined(OWT_CG_CLIENT)
     // CG client app takes care of external encoder. If it's expected to receive
     // video streams, an encoder must be provided.
-    encoder_factory.reset(new ExternalVideoEncoderFactory());
+    hardware_encoder_factory.reset(new ExternalVideoEncoderFactory());
 #elif defined(WEBRTC_WIN) && defined(OWT_USE_MSDK)
-    encoder_factory.reset(new ExternalVideoEncoderFactory());
-#else
-    // For Linux HW encoder pending verification.
-    encoder_factory = webrtc::CreateBuiltinVideoEncoderFactory();
+    hardware_encoder_factory.reset(new ExternalVideoEncoderFactory());
 #endif
-  } else {
-    encoder_factory = webrtc::CreateBuiltinVideoEncoderFactory();
+    // For Linux HW encoder pending verification.
   }
+  encoder_factory.reset(new SelectingVideoEncoderFactory(
+      std::move(hardware_encoder_factory), encoded_frame_));
+  video_encoder_factory_ = encoder_factory.get();
 
-  if (GlobalConfiguration::GetCustomizedVideoDecoderEnabled()) {
+  if (GlobalConfiguration::GetAsyncVideoDecoderEnabled()) {
+    decoder_factory.reset(new CustomizedVideoDecoderFactory(
+        GlobalConfiguration::GetAsyncVideoDecoder()));
+  } else if (GlobalConfiguration::GetCustomizedVideoDecoderEnabled()) {
     decoder_factory.reset(new CustomizedVideoDecoderFactory(
         GlobalConfiguration::GetCustomizedVideoDecoder()));
   } else if (render_hardware_acceleration_enabled_) {
@@ -225,6 +235,10 @@ void PeerConnectionDependencyFactory::
   } else {
     decoder_factory = webrtc::CreateBuiltinVideoDecoderFactory();
   }
+  if (decoder_factory && BitstreamDumpWriter::PreDecodeDumpEnabled()) {
+    decoder_factory.reset(
+        new DumpingVideoDecoderFactory(std::move(decoder_factory)));
+  }
 #endif
   // If still video factory is not in place, use internal factory.
   if (!encoder_factory.get()) {
@@ -233,6 +247,11 @@ void PeerConnectionDependencyFactory::
   if (!decoder_factory.get()) {
     decoder_factory = webrtc::CreateBuiltinVideoDecoderFactory();
   }
+  // Subscriptions in encoded frame pass-through mode return frames without
+  // payload to WebRTC. Their decoders skip such frames and never create the
+  // wrapped decoder, while other subscriptions decode as before.
+  decoder_factory.reset(
+      new PassThroughVideoDecoderFactory(std::move(decoder_factory)));
 
   // Raw audio frame
   // if adm is nullptr, voe_base will initilize it with the default internal
@@ -321,6 +340,15 @@ PeerConnectionDependencyFactory::CreateLocalVideoTrack(
   });
 }
 
+#if defined(WEBRTC_WIN) || defined(WEBRTC_LINUX)
+std::unique_ptr<webrtc::VideoEncoder>
+PeerConnectionDependencyFactory::CreateVideoEncoder(
+    const webrtc::SdpVideoFormat& format) {
+  RTC_CHECK(video_encoder_factory_);
+  return video_encoder_factory_->CreateVideoEncoder(format);
+}
+#endif
+
 scoped_refptr<AudioTrackInterface>
 PeerConnectionDependencyFactory::CreateLocalAudioTrack(const std::string& id) {
   bool aec_enabled, agc_enabled, ns_enabled;
@@ -3,9 +3,11 @@
 // SPDX-License-Identifier: Apache-2.0
 #ifndef OWT_BASE_PEERCONNECTIONDEPENDENCYFACTORY_H_
 #define OWT_BASE_PEERCONNECTIONDEPENDENCYFACTORY_H_
+#include <memory>
 #include <mutex>
 #include "webrtc/api/peer_connection_interface.h"
 #include "webrtc/api/media_stream_interface.h"
+#include "webrtc/api/video_codecs/video_encoder_factory.h"
 #if defined(WEBRTC_WIN)
 #include "webrtc/api/task_queue/task_queue_factory.h"
 #include "webrtc/modules/audio_device/win/audio_device_core_win.h"
@@ -54,6 +56,12 @@ class PeerConnectionDependencyFactory : public rtc::RefCountInterface {
       webrtc::VideoTrackSourceInterface* video_source);
   rtc::scoped_refptr<AudioSourceInterface> CreateAudioSource(
       const cricket::AudioOptions& options);
+#if defined(WEBRTC_WIN) || defined(WEBRTC_LINUX)
+  // Creates an encoder from the factory PeerConnections use, for encoding
+  // outside of a PeerConnection.
+  std::unique_ptr<webrtc::VideoEncoder> CreateVideoEncoder(
+      const webrtc::SdpVideoFormat& format);
+#endif
   // Returns current |pc_factory_|.
   rtc::scoped_refptr<PeerConnectionFactoryInterface> PeerConnectionFactory()
       const;
@@ -89,6 +97,8 @@ class PeerConnectionDependencyFactory : public rtc::RefCountInterface {
 #if defined(WEBRTC_WIN) || defined(WEBRTC_LINUX)
   bool render_hardware_acceleration_enabled_;  // Enabling HW acceleration for
                                                // VP8, H.264 & HEVC enc/dec
+  // Owned by |pc_factory_|.
+  webrtc::VideoEncoderFactory* video_encoder_factory_ = nullptr;
 #endif
   bool encoded_frame_;
   std::string field_trial_;
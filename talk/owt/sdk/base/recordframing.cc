@@ -0,0 +1,171 @@
+// Copyright (C) <2026> Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "talk/owt/sdk/base/recordframing.h"
+#include <algorithm>
+#include <cstring>
+#include "webrtc/rtc_base/checks.h"
+#include "webrtc/rtc_base/logging.h"
+
+namespace owt {
+namespace base {
+// Read-ahead size used when the next header is not yet complete.
+static constexpr size_t kHeaderReadAhead = RecordFraming::kMaxHeaderSize;
+// Initial reassembly buffer size. Grows on demand for larger records.
+static constexpr size_t kInitialBufferSize = 64 * 1024;
+
+size_t RecordFraming::VarIntSize(uint64_t value) {
+  RTC_DCHECK_LE(value, kMaxVarInt);
+  if (value < (1ull << 6))
+    return 1;
+  if (value < (1ull << 14))
+    return 2;
+  if (value < (1ull << 30))
+    return 4;
+  return 8;
+}
+
+size_t RecordFraming::WriteVarInt(uint64_t value, uint8_t* out) {
+  size_t size = VarIntSize(value);
+  // Two most significant bits of the first byte carry log2(size).
+  uint8_t prefix = size == 1 ? 0x00 : size == 2 ? 0x40 : size == 4 ? 0x80 : 0xc0;
+  for (size_t i = 0; i < size; i++) {
+    out[size - 1 - i] = static_cast<uint8_t>(value >> (8 * i));
+  }
+  out[0] = (out[0] & 0x3f) | prefix;
+  return size;
+}
+
+size_t RecordFraming::ReadVarInt(const uint8_t* data,
+                                 size_t length,
+                                 uint64_t& value) {
+  if (length == 0)
+    return 0;
+  size_t size = static_cast<size_t>(1) << (data[0] >> 6);
+  if (length < size)
+    return 0;
+  value = data[0] & 0x3f;
+  for (size_t i = 1; i < size; i++) {
+    value = (value << 8) | data[i];
+  }
+  return size;
+}
+
+size_t RecordFraming::WriteHeader(uint64_t payload_length,
+                                  bool with_timestamp,
+                                  int64_t timestamp_us,
+                                  uint8_t* out) {
+  size_t size = WriteVarInt(payload_length, out);
+  if (with_timestamp) {
+    uint64_t timestamp =
+        timestamp_us < 0 ? 0
+                         : std::min(static_cast<uint64_t>(timestamp_us),
+                                    kMaxVarInt);
+    size += WriteVarInt(timestamp, out + size);
+  }
+  return size;
+}
+
+RecordReassembler::RecordReassembler(bool with_timestamp,
+                                     size_t max_record_size)
+    : with_timestamp_(with_timestamp), max_record_size_(max_record_size) {}
+
+void RecordReassembler::Compact(size_t min_free) {
+  if (read_pos_ == 0)
+    return;
+  // Only move data when the free tail is too small; a fully consumed buffer
+  // is reset for free.
+  if (read_pos_ == write_pos_) {
+    read_pos_ = write_pos_ = 0;
+    return;
+  }
+  if (buffer_.size() - write_pos_ >= min_free)
+    return;
+  size_t unread = write_pos_ - read_pos_;
+  memmove(buffer_.data(), buffer_.data() + read_pos_, unread);
+  read_pos_ = 0;
+  write_pos_ = unread;
+}
+
+uint8_t* RecordReassembler::GetWriteBuffer(size_t min_size) {
+  Compact(min_size);
+  size_t required = write_pos_ + min_size;
+  if (buffer_.size() < required) {
+    size_t new_size = std::max(
+        required, std::max(buffer_.size() * 2, kInitialBufferSize));
+    buffer_.EnsureCapacity(new_size);
+    buffer_.SetSize(new_size);
+  }
+  return buffer_.data() + write_pos_;
+}
+
+void RecordReassembler::CommitWrite(size_t bytes_written) {
+  RTC_DCHECK_LE(write_pos_ + bytes_written, buffer_.size());
+  write_pos_ += bytes_written;
+}
+
+void RecordReassembler::Append(const uint8_t* data, size_t length) {
+  if (!data || length == 0)
+    return;
+  memcpy(GetWriteBuffer(length), data, length);
+  CommitWrite(length);
+}
+
+bool RecordReassembler::Next(FramedRecord& record) {
+  if (error_)
+    return false;
+  const uint8_t* head = buffer_.data() + read_pos_;
+  size_t available = write_pos_ - read_pos_;
+  uint64_t timestamp = 0;
+  if (pending_header_ == 0) {
+    uint64_t payload_length = 0;
+    size_t header = RecordFraming::ReadVarInt(head, available, payload_length);
+    if (header == 0)
+      return false;
+    if (with_timestamp_) {
+      size_t ts_size = RecordFraming::ReadVarInt(head + header,
+                                                 available - header, timestamp);
+      if (ts_size == 0)
+        return false;
+      header += ts_size;
+    }
+    if (payload_length > max_record_size_) {
+      RTC_LOG(LS_ERROR) << "Record of " << payload_length
+                        << " bytes exceeds limit of " << max_record_size_;
+      error_ = true;
+      return false;
+    }
+    pending_header_ = header;
+    pending_payload_ = static_cast<size_t>(payload_length);
+    pending_timestamp_ = static_cast<int64_t>(timestamp);
+  }
+  if (available < pending_header_ + pending_payload_)
+    return false;
+  record.data = head + pending_header_;
+  record.size = pending_payload_;
+  record.timestamp_us = pending_timestamp_;
+  read_pos_ += pending_header_ + pending_payload_;
+  pending_header_ = 0;
+  pending_payload_ = 0;
+  pending_timestamp_ = 0;
+  return true;
+}
+
+size_t RecordReassembler::BytesWanted() const {
+  if (pending_header_ == 0)
+    return kHeaderReadAhead;
+  size_t needed = pending_header_ + pending_payload_;
+  size_t available = write_pos_ - read_pos_;
+  return needed > available ? needed - available : 0;
+}
+
+void RecordReassembler::Reset() {
+  read_pos_ = write_pos_ = 0;
+  pending_header_ = pending_payload_ = 0;
+  pending_timestamp_ = 0;
+  error_ = false;
+}
+
+}  // namespace base
+}  // namespace owt
@@ -0,0 +1,99 @@
+// Copyright (C) <2026> Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef OWT_BASE_RECORDFRAMING_H_
+#define OWT_BASE_RECORDFRAMING_H_
+
+#include <cstddef>
+#include <cstdint>
+#include "webrtc/rtc_base/buffer.h"
+
+namespace owt {
+namespace base {
+
+// Record framing used on WebTransport data streams. Each record is
+//   varint(payload_length) [varint(timestamp_us)] payload
+// where varint is the QUIC variable-length integer encoding (RFC 9000,
+// section 16). Whether the timestamp is present is a property of the stream,
+// not of individual records, so both ends must agree on it out of band.
+class RecordFraming {
+ public:
+  // Largest value representable by a QUIC varint.
+  static constexpr uint64_t kMaxVarInt = (1ull << 62) - 1;
+  // Largest header: two 8-byte varints.
+  static constexpr size_t kMaxHeaderSize = 16;
+
+  // Number of bytes needed to encode |value|. |value| must not exceed
+  // kMaxVarInt.
+  static size_t VarIntSize(uint64_t value);
+  // Writes |value| to |out| and returns bytes written. |out| must have room
+  // for VarIntSize(value) bytes.
+  static size_t WriteVarInt(uint64_t value, uint8_t* out);
+  // Reads a varint from |data|. Returns bytes consumed, or 0 if |length| is
+  // not enough to hold the complete varint.
+  static size_t ReadVarInt(const uint8_t* data, size_t length, uint64_t& value);
+  // Writes a record header into |out|, which must be at least kMaxHeaderSize
+  // bytes. Returns header size.
+  static size_t WriteHeader(uint64_t payload_length,
+                            bool with_timestamp,
+                            int64_t timestamp_us,
+                            uint8_t* out);
+};
+
+// A complete record handed out by RecordReassembler. |data| points into the
+// reassembler's buffer and stays valid until the next call to
+// RecordReassembler::Next(), GetWriteBuffer() or Reset().
+struct FramedRecord {
+  const uint8_t* data = nullptr;
+  size_t size = 0;
+  int64_t timestamp_us = 0;
+};
+
+// Collects bytes read from a stream and splits them into records. Callers
+// read from the stream directly into the buffer returned by GetWriteBuffer()
+// so payload bytes are copied exactly once, from the transport into this
+// buffer, and records are returned as views into it.
+class RecordReassembler {
+ public:
+  // |max_record_size| bounds the payload size accepted from the peer.
+  // Records above this size put the reassembler into error state.
+  RecordReassembler(bool with_timestamp, size_t max_record_size);
+  ~RecordReassembler() = default;
+
+  // Returns a writable region of at least |min_size| bytes at the tail of
+  // the buffer. Call CommitWrite() with the number of bytes actually filled.
+  uint8_t* GetWriteBuffer(size_t min_size);
+  void CommitWrite(size_t bytes_written);
+  // Copying variant of GetWriteBuffer()/CommitWrite() for callers that
+  // already hold the bytes in memory.
+  void Append(const uint8_t* data, size_t length);
+  // Extracts the next complete record. Returns false if more data is needed
+  // or the stream is malformed.
+  bool Next(FramedRecord& record);
+  // Bytes still needed to complete the record at the head of the buffer, or
+  // a small read-ahead size if the header itself is incomplete.
+  size_t BytesWanted() const;
+  bool HasError() const { return error_; }
+  size_t BufferedBytes() const { return write_pos_ - read_pos_; }
+  void Reset();
+
+ private:
+  // Moves unread bytes to the front of the buffer if it makes room.
+  void Compact(size_t min_free);
+
+  const bool with_timestamp_;
+  const size_t max_record_size_;
+  rtc::Buffer buffer_;
+  size_t read_pos_ = 0;
+  size_t write_pos_ = 0;
+  // Payload size of the record at |read_pos_|, once its header is parsed.
+  size_t pending_payload_ = 0;
+  size_t pending_header_ = 0;
+  int64_t pending_timestamp_ = 0;
+  bool error_ = false;
+};
+
+}  // namespace base
+}  // namespace owt
+#endif  // OWT_BASE_RECORDFRAMING_H_
@@ -0,0 +1,85 @@
+// Copyright (C) <2026> Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+#include <cstring>
+#include <vector>
+#include "talk/owt/sdk/base/recordframing.h"
+#include "testing/gtest/include/gtest/gtest.h"
+#include "testing/gmock/include/gmock/gmock.h"
+namespace owt {
+namespace base {
+namespace {
+std::vector<uint8_t> Frame(const std::vector<uint8_t>& payload,
+                           bool with_timestamp,
+                           int64_t timestamp_us) {
+  uint8_t header[RecordFraming::kMaxHeaderSize];
+  size_t header_size = RecordFraming::WriteHeader(
+      payload.size(), with_timestamp, timestamp_us, header);
+  std::vector<uint8_t> framed(header, header + header_size);
+  framed.insert(framed.end(), payload.begin(), payload.end());
+  return framed;
+}
+}  // namespace
+
+TEST(RecordFramingTest, VarIntRoundTrip) {
+  const uint64_t values[] = {0, 63, 64, 16383, 16384, (1ull << 30) - 1,
+                             1ull << 30, RecordFraming::kMaxVarInt};
+  const size_t sizes[] = {1, 1, 2, 2, 4, 4, 8, 8};
+  for (size_t i = 0; i < sizeof(values) / sizeof(values[0]); i++) {
+    uint8_t buffer[8];
+    EXPECT_EQ(sizes[i], RecordFraming::WriteVarInt(values[i], buffer));
+    uint64_t value = 0;
+    EXPECT_EQ(sizes[i], RecordFraming::ReadVarInt(buffer, sizes[i], value));
+    EXPECT_EQ(values[i], value);
+    EXPECT_EQ(0u, RecordFraming::ReadVarInt(buffer, sizes[i] - 1, value));
+  }
+}
+
+TEST(RecordFramingTest, ReassemblesRecordsSplitAcrossReads) {
+  std::vector<uint8_t> wire;
+  for (int i = 0; i < 3; i++) {
+    std::vector<uint8_t> framed =
+        Frame(std::vector<uint8_t>(100 * (i + 1), i), true, 1000 * i);
+    wire.insert(wire.end(), framed.begin(), framed.end());
+  }
+  RecordReassembler reassembler(true, 1024);
+  std::vector<FramedRecord> records;
+  for (size_t i = 0; i < wire.size(); i++) {
+    reassembler.Append(&wire[i], 1);
+    FramedRecord record;
+    while (reassembler.Next(record)) {
+      EXPECT_EQ(record.data[0], record.data[record.size - 1]);
+      records.push_back(record);
+    }
+  }
+  ASSERT_EQ(3u, records.size());
+  for (int i = 0; i < 3; i++) {
+    EXPECT_EQ(100u * (i + 1), records[i].size);
+    EXPECT_EQ(1000 * i, records[i].timestamp_us);
+  }
+  EXPECT_EQ(0u, reassembler.BufferedBytes());
+}
+
+TEST(RecordFramingTest, ReturnsRecordsWithoutCopy) {
+  std::vector<uint8_t> wire = Frame(std::vector<uint8_t>(32, 1), false, 0);
+  RecordReassembler reassembler(false, 64);
+  uint8_t* write_buffer = reassembler.GetWriteBuffer(wire.size());
+  memcpy(write_buffer, wire.data(), wire.size());
+  reassembler.CommitWrite(wire.size());
+  FramedRecord record;
+  ASSERT_TRUE(reassembler.Next(record));
+  // One byte varint header precedes the payload.
+  EXPECT_EQ(write_buffer + 1, record.data);
+  EXPECT_EQ(32u, record.size);
+}
+
+TEST(RecordFramingTest, RejectsOversizedRecord) {
+  std::vector<uint8_t> wire = Frame(std::vector<uint8_t>(65, 1), false, 0);
+  RecordReassembler reassembler(false, 64);
+  reassembler.Append(wire.data(), wire.size());
+  FramedRecord record;
+  EXPECT_FALSE(reassembler.Next(record));
+  EXPECT_TRUE(reassembler.HasError());
+}
+}  // namespace base
+}  // namespace owt
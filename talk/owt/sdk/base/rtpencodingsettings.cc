@@ -0,0 +1,146 @@
+// Copyright (C) <2026> Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "talk/owt/sdk/base/rtpencodingsettings.h"
+#include <algorithm>
+#include <set>
+
+namespace owt {
+namespace base {
+namespace {
+// Index of the encoding |update| targets in |parameters|, -1 if none.
+int TargetIndex(const RtpEncodingParameters& update,
+                const webrtc::RtpParameters& parameters) {
+  if (update.rid.empty())
+    return parameters.encodings.size() == 1 &&
+                   parameters.encodings[0].rid.empty()
+               ? 0
+               : -1;
+  for (size_t i = 0; i < parameters.encodings.size(); i++) {
+    if (parameters.encodings[i].rid == update.rid)
+      return static_cast<int>(i);
+  }
+  return -1;
+}
+
+bool CheckValues(const RtpEncodingParameters& update, std::string* error) {
+  if (update.max_bitrate_bps < 0 || update.min_bitrate_bps < 0 ||
+      update.max_framerate < 0) {
+    *error = "Bitrate and framerate must not be negative.";
+    return false;
+  }
+  if (update.max_bitrate_bps > 0 &&
+      update.min_bitrate_bps > update.max_bitrate_bps) {
+    *error = "Minimum bitrate is above maximum bitrate.";
+    return false;
+  }
+  if (update.scale_resolution_down_by > 0 &&
+      update.scale_resolution_down_by < 1.0) {
+    *error = "Resolution can only be scaled down.";
+    return false;
+  }
+  return true;
+}
+}  // namespace
+
+const RtpEncodingParameters* FindEncodingSettings(
+    const std::vector<RtpEncodingParameters>& settings,
+    const webrtc::RtpEncodingParameters& encoding,
+    size_t index) {
+  if (!encoding.rid.empty()) {
+    for (const auto& setting : settings) {
+      if (setting.rid == encoding.rid)
+        return &setting;
+    }
+    return nullptr;
+  }
+  if (index < settings.size() && settings[index].rid.empty())
+    return &settings[index];
+  return nullptr;
+}
+
+void ApplyEncodingSettings(const RtpEncodingParameters& settings,
+                           webrtc::RtpEncodingParameters* encoding) {
+  if (settings.max_bitrate_bps != 0)
+    encoding->max_bitrate_bps = settings.max_bitrate_bps;
+  if (settings.min_bitrate_bps != 0)
+    encoding->min_bitrate_bps = settings.min_bitrate_bps;
+  if (settings.max_framerate != 0)
+    encoding->max_framerate = settings.max_framerate;
+  if (settings.scale_resolution_down_by > 0)
+    encoding->scale_resolution_down_by = settings.scale_resolution_down_by;
+  switch (settings.priority) {
+    case NetworkPriority::kVeryLow:
+      encoding->network_priority = webrtc::Priority::kVeryLow;
+      break;
+    case NetworkPriority::kLow:
+      encoding->network_priority = webrtc::Priority::kLow;
+      break;
+    case NetworkPriority::kMedium:
+      encoding->network_priority = webrtc::Priority::kMedium;
+      break;
+    case NetworkPriority::kHigh:
+      encoding->network_priority = webrtc::Priority::kHigh;
+      break;
+    default:
+      break;
+  }
+  encoding->active = settings.active;
+}
+
+bool UpdateEncodingSettings(const std::vector<RtpEncodingParameters>& updates,
+                            webrtc::RtpParameters* parameters,
+                            std::vector<RtpEncodingParameters>* settings,
+                            std::string* error) {
+  if (updates.empty()) {
+    *error = "No encoding to update.";
+    return false;
+  }
+  std::set<int> targets;
+  for (const auto& update : updates) {
+    int index = TargetIndex(update, *parameters);
+    if (index < 0) {
+      *error = update.rid.empty()
+                   ? "Encodings of a simulcast sender must have a rid."
+                   : "Unknown rid " + update.rid + ".";
+      return false;
+    }
+    if (!targets.insert(index).second) {
+      *error = "Encoding " + update.rid + " is updated twice.";
+      return false;
+    }
+    if (!CheckValues(update, error))
+      return false;
+  }
+  for (const auto& update : updates) {
+    int index = TargetIndex(update, *parameters);
+    ApplyEncodingSettings(update, &parameters->encodings[index]);
+    auto setting = std::find_if(
+        settings->begin(), settings->end(),
+        [&update](const RtpEncodingParameters& setting) {
+          return setting.rid == update.rid;
+        });
+    if (setting == settings->end()) {
+      settings->insert(update.rid.empty() ? settings->begin() : settings->end(),
+                       update);
+      continue;
+    }
+    // Same rules as ApplyEncodingSettings(). Temporal layers are fixed when
+    // the encoder is set up.
+    if (update.max_bitrate_bps != 0)
+      setting->max_bitrate_bps = update.max_bitrate_bps;
+    if (update.min_bitrate_bps != 0)
+      setting->min_bitrate_bps = update.min_bitrate_bps;
+    if (update.max_framerate != 0)
+      setting->max_framerate = update.max_framerate;
+    if (update.scale_resolution_down_by > 0)
+      setting->scale_resolution_down_by = update.scale_resolution_down_by;
+    if (update.priority != NetworkPriority::kDefault)
+      setting->priority = update.priority;
+    setting->active = update.active;
+  }
+  return true;
+}
+}  // namespace base
+}  // namespace owt
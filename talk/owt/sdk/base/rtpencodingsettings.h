@@ -0,0 +1,40 @@
+// Copyright (C) <2026> Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef OWT_BASE_RTPENCODINGSETTINGS_H_
+#define OWT_BASE_RTPENCODINGSETTINGS_H_
+
+#include <string>
+#include <vector>
+#include "talk/owt/sdk/include/cpp/owt/base/commontypes.h"
+#include "webrtc/api/rtp_parameters.h"
+
+namespace owt {
+namespace base {
+// Settings in |settings| for |encoding|, the |index|th encoding of a sender.
+// Matched by rid, or by index for encodings without one. Null if none.
+const RtpEncodingParameters* FindEncodingSettings(
+    const std::vector<RtpEncodingParameters>& settings,
+    const webrtc::RtpEncodingParameters& encoding,
+    size_t index);
+
+// Copies the fields of |settings| that can change without renegotiation to
+// |encoding|. Fields left at 0 or at the default priority are not copied;
+// |active| always is.
+void ApplyEncodingSettings(const RtpEncodingParameters& settings,
+                           webrtc::RtpEncodingParameters* encoding);
+
+// Applies |updates| to the encodings of a live sender in |parameters|, and
+// merges them into |settings| so renegotiation keeps them. Every update must
+// name the rid of an existing encoding, or leave it empty for a sender
+// without simulcast. The rid and number of temporal layers of an encoding
+// cannot change. Returns false with |error| set, changing nothing, if an
+// update is invalid.
+bool UpdateEncodingSettings(const std::vector<RtpEncodingParameters>& updates,
+                            webrtc::RtpParameters* parameters,
+                            std::vector<RtpEncodingParameters>* settings,
+                            std::string* error);
+}  // namespace base
+}  // namespace owt
+#endif  // OWT_BASE_RTPENCODINGSETTINGS_H_
@@ -0,0 +1,106 @@
+// Copyright (C) <2026> Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+#include "talk/owt/sdk/base/rtpencodingsettings.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace owt {
+namespace base {
+namespace {
+webrtc::RtpParameters SimulcastParameters() {
+  webrtc::RtpParameters parameters;
+  for (const char* rid : {"q", "h", "f"}) {
+    webrtc::RtpEncodingParameters encoding;
+    encoding.rid = rid;
+    parameters.encodings.push_back(encoding);
+  }
+  return parameters;
+}
+
+RtpEncodingParameters Update(const std::string& rid) {
+  RtpEncodingParameters update;
+  update.rid = rid;
+  return update;
+}
+}  // namespace
+
+TEST(RtpEncodingSettingsTest, UpdatesEncodingsByRid) {
+  webrtc::RtpParameters parameters = SimulcastParameters();
+  std::vector<RtpEncodingParameters> settings = {Update("q"), Update("h")};
+  settings[1].max_bitrate_bps = 500000;
+  settings[1].num_temporal_layers = 3;
+
+  RtpEncodingParameters high = Update("h");
+  high.max_framerate = 15;
+  high.scale_resolution_down_by = 2;
+  high.priority = NetworkPriority::kHigh;
+  RtpEncodingParameters full = Update("f");
+  full.active = false;
+  std::string error;
+  ASSERT_TRUE(
+      UpdateEncodingSettings({high, full}, &parameters, &settings, &error));
+
+  EXPECT_EQ(15, parameters.encodings[1].max_framerate);
+  EXPECT_EQ(2, parameters.encodings[1].scale_resolution_down_by);
+  EXPECT_EQ(webrtc::Priority::kHigh, parameters.encodings[1].network_priority);
+  EXPECT_TRUE(parameters.encodings[1].active);
+  EXPECT_FALSE(parameters.encodings[2].active);
+  EXPECT_TRUE(parameters.encodings[0].active);
+  EXPECT_FALSE(parameters.encodings[0].max_framerate);
+
+  // Stored settings keep what the update leaves out.
+  ASSERT_EQ(3u, settings.size());
+  EXPECT_EQ(500000, settings[1].max_bitrate_bps);
+  EXPECT_EQ(15, settings[1].max_framerate);
+  EXPECT_EQ(3, settings[1].num_temporal_layers);
+  EXPECT_EQ("f", settings[2].rid);
+  EXPECT_FALSE(settings[2].active);
+}
+
+TEST(RtpEncodingSettingsTest, RejectsInvalidUpdatesWithoutChanges) {
+  webrtc::RtpParameters parameters = SimulcastParameters();
+  std::vector<RtpEncodingParameters> settings;
+  std::string error;
+  RtpEncodingParameters low = Update("q");
+  low.active = false;
+  EXPECT_FALSE(UpdateEncodingSettings({low, Update("x")}, &parameters,
+                                      &settings, &error));
+  EXPECT_EQ("Unknown rid x.", error);
+  EXPECT_FALSE(UpdateEncodingSettings({low, low}, &parameters, &settings,
+                                      &error));
+  EXPECT_FALSE(
+      UpdateEncodingSettings({Update("")}, &parameters, &settings, &error));
+  RtpEncodingParameters upscale = Update("h");
+  upscale.scale_resolution_down_by = 0.5;
+  EXPECT_FALSE(
+      UpdateEncodingSettings({upscale}, &parameters, &settings, &error));
+  RtpEncodingParameters inverted = Update("h");
+  inverted.min_bitrate_bps = 2000000;
+  inverted.max_bitrate_bps = 1000000;
+  EXPECT_FALSE(
+      UpdateEncodingSettings({inverted}, &parameters, &settings, &error));
+  EXPECT_FALSE(
+      UpdateEncodingSettings({}, &parameters, &settings, &error));
+
+  EXPECT_TRUE(parameters.encodings[0].active);
+  EXPECT_TRUE(settings.empty());
+}
+
+TEST(RtpEncodingSettingsTest, UpdatesSenderWithoutSimulcast) {
+  webrtc::RtpParameters parameters;
+  parameters.encodings.resize(1);
+  std::vector<RtpEncodingParameters> settings;
+  RtpEncodingParameters update;
+  update.max_bitrate_bps = 800000;
+  update.min_bitrate_bps = 100000;
+  std::string error;
+  ASSERT_TRUE(
+      UpdateEncodingSettings({update}, &parameters, &settings, &error));
+  EXPECT_EQ(800000, parameters.encodings[0].max_bitrate_bps);
+  EXPECT_EQ(100000, parameters.encodings[0].min_bitrate_bps);
+  ASSERT_EQ(1u, settings.size());
+  EXPECT_EQ(&settings[0],
+            FindEncodingSettings(settings, parameters.encodings[0], 0));
+}
+}  // namespace base
+}  // namespace owt
@@ -15,8 +15,6 @@ class SdpUtils {
                                          std::vector<AudioCodec>& codec);
   static std::string SetPreferVideoCodecs(const std::string& sdp,
                                          std::vector<VideoCodec>& codec, bool qos_mode = false);
-  static std::string SetStartVideoBandwidth(const std::string& sdp,
-                                            int bandwidth);
  private:
   /**
    @brief Replace SDP for preferred codec.
@@ -0,0 +1,235 @@
+// Copyright (C) <2026> Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+#include "talk/owt/sdk/base/seicomposer.h"
+#include <cstring>
+
+namespace owt {
+namespace base {
+namespace {
+const uint8_t kFrameNumberSeiGuid[16] = {0xef, 0xc8, 0xe7, 0xb0, 0x26, 0x26,
+                                         0x47, 0xfd, 0x9d, 0xa3, 0x49, 0x4f,
+                                         0x60, 0xb8, 0x5b, 0xf0};
+const uint8_t kCursorDataSeiGuid[16] = {0x2f, 0x69, 0xe7, 0xb0, 0x16, 0x56,
+                                        0x87, 0xfd, 0x2d, 0x14, 0x26, 0x37,
+                                        0x14, 0x22, 0x23, 0x38};
+const uint8_t kUserDataUnregistered = 0x05;
+const uint8_t kRbspTrailingBits = 0x80;
+const size_t kGuidSize = 16;
+
+// Number of bytes used by a payload type or payload size field.
+size_t SeiValueSize(size_t value) {
+  return value / 255 + 1;
+}
+
+// Writes RBSP bytes as NAL payload, inserting emulation prevention bytes.
+class EscapingWriter {
+ public:
+  explicit EscapingWriter(uint8_t* out) : out_(out) {}
+  void WriteByte(uint8_t value) { Write(&value, 1); }
+  void WriteSeiValue(size_t value) {
+    for (; value >= 255; value -= 255)
+      WriteByte(0xff);
+    WriteByte(static_cast<uint8_t>(value));
+  }
+  void Write(const uint8_t* data, size_t size) {
+    while (size > 0) {
+      if (zeros_ >= 2 && *data <= 0x03) {
+        out_[pos_++] = 0x03;
+        zeros_ = 0;
+      }
+      if (*data == 0) {
+        out_[pos_++] = 0;
+        zeros_++;
+        data++;
+        size--;
+        continue;
+      }
+      // Copy the run of non-zero bytes at once.
+      const uint8_t* zero =
+          static_cast<const uint8_t*>(memchr(data, 0, size));
+      size_t run = zero ? zero - data : size;
+      memcpy(out_ + pos_, data, run);
+      pos_ += run;
+      data += run;
+      size -= run;
+      zeros_ = 0;
+    }
+  }
+  size_t position() const { return pos_; }
+
+ private:
+  uint8_t* out_;
+  size_t pos_ = 0;
+  int zeros_ = 0;
+};
+
+// Reads RBSP bytes from NAL payload, dropping emulation prevention bytes.
+// Reading stops at the next start code or end of buffer.
+class UnescapingReader {
+ public:
+  UnescapingReader(const uint8_t* data, size_t size)
+      : data_(data), size_(size) {}
+  bool ReadByte(uint8_t& value) {
+    if (pos_ >= size_)
+      return false;
+    if (zeros_ >= 2) {
+      if (data_[pos_] == 0x03) {
+        pos_++;
+        zeros_ = 0;
+        if (pos_ >= size_)
+          return false;
+      } else if (data_[pos_] <= 0x02) {
+        // Start code of the next NAL.
+        return false;
+      }
+    }
+    value = data_[pos_++];
+    zeros_ = value == 0 ? zeros_ + 1 : 0;
+    return true;
+  }
+  bool ReadSeiValue(size_t& value) {
+    value = 0;
+    uint8_t byte = 0;
+    do {
+      if (!ReadByte(byte))
+        return false;
+      value += byte;
+    } while (byte == 0xff);
+    return true;
+  }
+  bool Read(size_t size, std::vector<uint8_t>& out) {
+    out.clear();
+    out.reserve(size);
+    uint8_t byte = 0;
+    for (size_t i = 0; i < size; i++) {
+      if (!ReadByte(byte))
+        return false;
+      out.push_back(byte);
+    }
+    return true;
+  }
+  bool ExpectGuid(const uint8_t* guid) {
+    uint8_t byte = 0;
+    for (size_t i = 0; i < kGuidSize; i++) {
+      if (!ReadByte(byte) || byte != guid[i])
+        return false;
+    }
+    return true;
+  }
+
+ private:
+  const uint8_t* data_;
+  const size_t size_;
+  size_t pos_ = 0;
+  int zeros_ = 0;
+};
+}  // namespace
+
+SeiComposer::SeiComposer(webrtc::VideoCodecType codec_type) : prefix_size_(0) {
+  const uint8_t start_code[] = {0x00, 0x00, 0x00, 0x01};
+  memcpy(prefix_, start_code, sizeof(start_code));
+  if (codec_type == webrtc::kVideoCodecH264) {
+    prefix_[4] = 0x06;  // NAL-type: SEI
+    prefix_size_ = 5;
+  }
+#ifdef WEBRTC_USE_H265
+  else if (codec_type == webrtc::kVideoCodecH265) {
+    prefix_[4] = 0x4e;  // F: 0, nal_unit_type: prefix-SEI
+    prefix_[5] = 0x01;  // layerID: 0; TID: 1
+    prefix_size_ = 6;
+  }
+#endif
+}
+
+size_t SeiComposer::MaxSize(size_t side_data_size, size_t cursor_data_size) {
+  size_t rbsp_size = 1 + SeiValueSize(kGuidSize + side_data_size) +
+                     kGuidSize + side_data_size;
+  if (cursor_data_size > 0) {
+    rbsp_size += 1 + SeiValueSize(kGuidSize + cursor_data_size) + kGuidSize +
+                 cursor_data_size;
+  }
+  rbsp_size++;  // rbsp_trailing_bits
+  // At most one emulation prevention byte per two RBSP bytes.
+  return kMaxPrefixSize + rbsp_size + rbsp_size / 2 + 1;
+}
+
+size_t SeiComposer::Compose(const uint8_t* side_data,
+                            size_t side_data_size,
+                            const uint8_t* cursor_data,
+                            size_t cursor_data_size,
+                            uint8_t* out) const {
+  if (!IsSupported() || !out)
+    return 0;
+  if (!side_data)
+    side_data_size = 0;
+  if (!cursor_data)
+    cursor_data_size = 0;
+  memcpy(out, prefix_, prefix_size_);
+  EscapingWriter writer(out + prefix_size_);
+  // Side data message is always present. Receivers use it to locate cursor
+  // data.
+  writer.WriteSeiValue(kUserDataUnregistered);
+  writer.WriteSeiValue(kGuidSize + side_data_size);
+  writer.Write(kFrameNumberSeiGuid, kGuidSize);
+  if (side_data_size > 0)
+    writer.Write(side_data, side_data_size);
+  if (cursor_data_size > 0) {
+    writer.WriteSeiValue(kUserDataUnregistered);
+    writer.WriteSeiValue(kGuidSize + cursor_data_size);
+    writer.Write(kCursorDataSeiGuid, kGuidSize);
+    writer.Write(cursor_data, cursor_data_size);
+  }
+  writer.WriteByte(kRbspTrailingBits);
+  return prefix_size_ + writer.position();
+}
+
+bool SeiComposer::Parse(webrtc::VideoCodecType codec_type,
+                        const uint8_t* frame_data,
+                        size_t frame_size,
+                        std::vector<uint8_t>& side_data,
+                        std::vector<uint8_t>& cursor_data) {
+  side_data.clear();
+  if (!frame_data || frame_size < 6 || frame_data[0] != 0 ||
+      frame_data[1] != 0 || frame_data[2] != 0 || frame_data[3] != 1) {
+    return false;
+  }
+  size_t header_size = 0;
+  if (codec_type == webrtc::kVideoCodecH264 && (frame_data[4] & 0x1f) == 0x06) {
+    header_size = 5;
+  }
+#ifdef WEBRTC_USE_H265
+  else if (codec_type == webrtc::kVideoCodecH265 &&
+           ((frame_data[4] & 0x7e) >> 1) == 0x27) {
+    header_size = 6;
+  }
+#endif
+  if (header_size == 0)
+    return false;
+  UnescapingReader reader(frame_data + header_size, frame_size - header_size);
+  size_t payload_type = 0;
+  size_t payload_size = 0;
+  if (!reader.ReadSeiValue(payload_type) ||
+      payload_type != kUserDataUnregistered ||
+      !reader.ReadSeiValue(payload_size) || payload_size < kGuidSize ||
+      !reader.ExpectGuid(kFrameNumberSeiGuid) ||
+      !reader.Read(payload_size - kGuidSize, side_data)) {
+    side_data.clear();
+    return false;
+  }
+  if (!reader.ReadSeiValue(payload_type) ||
+      payload_type != kUserDataUnregistered) {
+    return true;
+  }
+  std::vector<uint8_t> cursor;
+  if (!reader.ReadSeiValue(payload_size) || payload_size < kGuidSize ||
+      !reader.ExpectGuid(kCursorDataSeiGuid) ||
+      !reader.Read(payload_size - kGuidSize, cursor)) {
+    return true;
+  }
+  if (!cursor.empty())
+    cursor_data.swap(cursor);
+  return true;
+}
+}  // namespace base
+}  // namespace owt
@@ -0,0 +1,55 @@
+// Copyright (C) <2026> Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef OWT_BASE_SEICOMPOSER_H_
+#define OWT_BASE_SEICOMPOSER_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "webrtc/api/video/video_codec_type.h"
+
+namespace owt {
+namespace base {
+// Builds and parses the user data unregistered SEI NAL that carries encoded
+// image side data and cursor data in front of an H.264 or H.265 access unit.
+// The NAL holds a side data message (frame number GUID followed by side data)
+// and, if cursor data is present, a cursor data message (cursor GUID followed
+// by cursor data). Emulation prevention bytes are inserted on composing and
+// removed on parsing.
+class SeiComposer {
+ public:
+  // Size of start code plus NAL unit header.
+  static constexpr size_t kMaxPrefixSize = 6;
+
+  explicit SeiComposer(webrtc::VideoCodecType codec_type);
+  // True for H.264 and H.265.
+  bool IsSupported() const { return prefix_size_ > 0; }
+  // Upper bound of Compose() output for the given payloads, including
+  // worst-case emulation prevention.
+  static size_t MaxSize(size_t side_data_size, size_t cursor_data_size);
+  // Writes the SEI NAL, start code included, to |out| which must have room
+  // for MaxSize() bytes. Returns number of bytes written, or 0 if codec is not
+  // supported.
+  size_t Compose(const uint8_t* side_data,
+                 size_t side_data_size,
+                 const uint8_t* cursor_data,
+                 size_t cursor_data_size,
+                 uint8_t* out) const;
+  // Parses side data and cursor data from the SEI NAL at the start of
+  // |frame_data|. |cursor_data| is left untouched if no cursor message is
+  // present. Returns false if |frame_data| does not start with such a NAL.
+  static bool Parse(webrtc::VideoCodecType codec_type,
+                    const uint8_t* frame_data,
+                    size_t frame_size,
+                    std::vector<uint8_t>& side_data,
+                    std::vector<uint8_t>& cursor_data);
+
+ private:
+  // Start code and NAL unit header, built once per codec.
+  uint8_t prefix_[kMaxPrefixSize];
+  size_t prefix_size_;
+};
+}  // namespace base
+}  // namespace owt
+#endif  // OWT_BASE_SEICOMPOSER_H_
@@ -0,0 +1,119 @@
+// Copyright (C) <2026> Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+#include <cstring>
+#include <memory>
+#include <random>
+#include <vector>
+#include "talk/owt/sdk/base/seicomposer.h"
+#include "testing/gtest/include/gtest/gtest.h"
+#include "testing/gmock/include/gmock/gmock.h"
+namespace owt {
+namespace base {
+namespace {
+// True if |data| contains 00 00 00, 00 00 01 or 00 00 02 after the leading
+// start code.
+bool HasStartCodeEmulation(const std::vector<uint8_t>& data) {
+  for (size_t i = 4; i + 2 < data.size(); i++) {
+    if (data[i] == 0 && data[i + 1] == 0 && data[i + 2] <= 0x02)
+      return true;
+  }
+  return false;
+}
+
+std::vector<uint8_t> Compose(const SeiComposer& composer,
+                             const std::vector<uint8_t>& side_data,
+                             const std::vector<uint8_t>& cursor_data) {
+  std::vector<uint8_t> sei(
+      SeiComposer::MaxSize(side_data.size(), cursor_data.size()));
+  size_t size = composer.Compose(side_data.data(), side_data.size(),
+                                 cursor_data.data(), cursor_data.size(),
+                                 sei.data());
+  sei.resize(size);
+  return sei;
+}
+}  // namespace
+
+TEST(SeiComposerTest, MatchesLegacyLayoutWithoutEscaping) {
+  SeiComposer composer(webrtc::kVideoCodecH264);
+  std::vector<uint8_t> side_data = {0x11, 0x22, 0x33};
+  std::vector<uint8_t> sei = Compose(composer, side_data, {});
+  ASSERT_EQ(4u + 1 + 1 + 1 + 16 + 3 + 1, sei.size());
+  EXPECT_EQ(0x06, sei[4]);
+  EXPECT_EQ(0x05, sei[5]);
+  EXPECT_EQ(16 + 3, sei[6]);
+  EXPECT_EQ(0xef, sei[7]);
+  EXPECT_EQ(0x11, sei[23]);
+  EXPECT_EQ(0x80, sei.back());
+}
+
+TEST(SeiComposerTest, InsertsEmulationPreventionBytes) {
+  SeiComposer composer(webrtc::kVideoCodecH264);
+  std::vector<uint8_t> side_data = {0x00, 0x00, 0x01, 0x00, 0x00, 0x00};
+  std::vector<uint8_t> sei = Compose(composer, side_data, {});
+  EXPECT_FALSE(HasStartCodeEmulation(sei));
+  const uint8_t escaped[] = {0x00, 0x00, 0x03, 0x01, 0x00, 0x00, 0x03, 0x00};
+  EXPECT_EQ(0, memcmp(sei.data() + 23, escaped, sizeof(escaped)));
+  std::vector<uint8_t> parsed_side, parsed_cursor;
+  ASSERT_TRUE(SeiComposer::Parse(webrtc::kVideoCodecH264, sei.data(),
+                                 sei.size(), parsed_side, parsed_cursor));
+  EXPECT_EQ(side_data, parsed_side);
+  EXPECT_TRUE(parsed_cursor.empty());
+}
+
+TEST(SeiComposerTest, RandomPayloadsRoundTrip) {
+  std::mt19937 rng(20260101);
+  SeiComposer composer(webrtc::kVideoCodecH264);
+  for (int iteration = 0; iteration < 2000; iteration++) {
+    // Zero-heavy payloads exercise emulation prevention.
+    std::uniform_int_distribution<int> byte(0, 7);
+    std::vector<uint8_t> side_data(rng() % 241);
+    for (auto& b : side_data)
+      b = byte(rng) < 5 ? 0 : static_cast<uint8_t>(rng());
+    std::vector<uint8_t> cursor_data(rng() % 3 ? rng() % 4096 : 0);
+    for (auto& b : cursor_data)
+      b = byte(rng) < 5 ? static_cast<uint8_t>(rng() % 4) : rng();
+    std::vector<uint8_t> sei = Compose(composer, side_data, cursor_data);
+    ASSERT_LE(sei.size(),
+              SeiComposer::MaxSize(side_data.size(), cursor_data.size()));
+    EXPECT_FALSE(HasStartCodeEmulation(sei));
+    // Parser must stop at the start code of the following NAL.
+    const uint8_t next_nal[] = {0x00, 0x00, 0x00, 0x01, 0x65, 0x00, 0x00};
+    sei.insert(sei.end(), next_nal, next_nal + sizeof(next_nal));
+    std::vector<uint8_t> parsed_side, parsed_cursor;
+    ASSERT_TRUE(SeiComposer::Parse(webrtc::kVideoCodecH264, sei.data(),
+                                   sei.size(), parsed_side, parsed_cursor));
+    EXPECT_EQ(side_data, parsed_side);
+    EXPECT_EQ(cursor_data, parsed_cursor);
+  }
+}
+
+TEST(SeiComposerTest, ParseRejectsTruncatedAndCorruptInput) {
+  std::mt19937 rng(7);
+  SeiComposer composer(webrtc::kVideoCodecH264);
+  std::vector<uint8_t> side_data(100, 0x5a);
+  std::vector<uint8_t> sei = Compose(composer, side_data, {});
+  std::vector<uint8_t> parsed_side, parsed_cursor;
+  for (size_t size = 0; size < sei.size() - 1; size++) {
+    EXPECT_FALSE(SeiComposer::Parse(webrtc::kVideoCodecH264, sei.data(), size,
+                                    parsed_side, parsed_cursor));
+  }
+  // Random corruption must never read out of bounds.
+  for (int iteration = 0; iteration < 2000; iteration++) {
+    std::vector<uint8_t> corrupt = sei;
+    corrupt[4 + rng() % (corrupt.size() - 4)] = static_cast<uint8_t>(rng());
+    SeiComposer::Parse(webrtc::kVideoCodecH264, corrupt.data(),
+                       rng() % (corrupt.size() + 1), parsed_side,
+                       parsed_cursor);
+  }
+}
+
+TEST(SeiComposerTest, UnsupportedCodecWritesNothing) {
+  SeiComposer composer(webrtc::kVideoCodecVP9);
+  EXPECT_FALSE(composer.IsSupported());
+  uint8_t out[64];
+  uint8_t side_data[4] = {1, 2, 3, 4};
+  EXPECT_EQ(0u, composer.Compose(side_data, 4, nullptr, 0, out));
+}
+}  // namespace base
+}  // namespace owt
@@ -0,0 +1,387 @@
+// Copyright (C) <2026> Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "talk/owt/sdk/base/selectingvideoencoderfactory.h"
+#include <atomic>
+#include <map>
+#include <mutex>
+#include "absl/types/optional.h"
+#include "webrtc/api/video_codecs/builtin_video_encoder_factory.h"
+#include "webrtc/modules/video_coding/include/video_error_codes.h"
+#include "webrtc/rtc_base/event.h"
+#include "webrtc/rtc_base/logging.h"
+#include "webrtc/rtc_base/task_queue.h"
+#include "talk/owt/sdk/base/bitstreamdumpwriter.h"
+#include "talk/owt/sdk/base/customizedvideoencoderproxy.h"
+#include "talk/owt/sdk/base/encodedvideoencoderfactory.h"
+#include "talk/owt/sdk/base/encoderpolicyvideotracksource.h"
+#include "talk/owt/sdk/base/framelatencytracer.h"
+#include "talk/owt/sdk/base/softwareencoderpool.h"
+#include "talk/owt/sdk/include/cpp/owt/base/commontypes.h"
+
+namespace owt {
+namespace base {
+namespace {
+// Frames queued on a pool thread per software encoder. Further frames are
+// dropped so a slow encoder does not build up latency for its publication
+// or starve other publications sharing the thread.
+static const int kMaxPendingSoftwareFrames = 2;
+// Software encoders at or below this resolution use a single thread, leaving
+// the other pool threads to other publications.
+static const int kSingleThreadMaxPixels = 640 * 480;
+
+class SelectingVideoEncoder : public webrtc::VideoEncoder,
+                              public webrtc::EncodedImageCallback {
+ public:
+  SelectingVideoEncoder(const webrtc::SdpVideoFormat& format,
+                        webrtc::VideoEncoderFactory* hardware_factory,
+                        webrtc::VideoEncoderFactory* software_factory)
+      : format_(format),
+        hardware_factory_(hardware_factory),
+        software_factory_(software_factory),
+        trace_latency_(FrameLatencyTracer::Enabled()),
+        dump_(BitstreamDumpWriter::PostEncodeDumpEnabled()) {
+    info_.supports_native_handle = true;
+    info_.implementation_name = "OWTSelectingEncoder";
+  }
+  ~SelectingVideoEncoder() override { Release(); }
+
+  int InitEncode(const webrtc::VideoCodec* codec_settings,
+                 const Settings& settings) override {
+    Release();
+    codec_ = *codec_settings;
+    settings_.emplace(settings);
+    // The implementation is only known once the first frame tells whether
+    // it is encoded or raw, and which policy it carries.
+    return WEBRTC_VIDEO_CODEC_OK;
+  }
+
+  int32_t RegisterEncodeCompleteCallback(
+      webrtc::EncodedImageCallback* callback) override {
+    callback_ = callback;
+    if (encoder_)
+      return encoder_->RegisterEncodeCompleteCallback(InnerCallback());
+    return WEBRTC_VIDEO_CODEC_OK;
+  }
+
+  // Implements webrtc::EncodedImageCallback. Only registered with the
+  // selected encoder while latency tracing or post-encode dump is enabled.
+  Result OnEncodedImage(
+      const webrtc::EncodedImage& encoded_image,
+      const webrtc::CodecSpecificInfo* codec_specific_info) override {
+    if (dump_)
+      Dump(encoded_image);
+    if (!trace_latency_)
+      return callback_->OnEncodedImage(encoded_image, codec_specific_info);
+    latency_probe_.OnEncoded(encoded_image.Timestamp());
+    // Packetization completes before the sender's callback returns.
+    Result result =
+        callback_->OnEncodedImage(encoded_image, codec_specific_info);
+    latency_probe_.OnPacketized(encoded_image.Timestamp());
+    return result;
+  }
+
+  void OnDroppedFrame(DropReason reason) override {
+    callback_->OnDroppedFrame(reason);
+  }
+
+  int32_t Encode(
+      const webrtc::VideoFrame& input_frame,
+      const std::vector<webrtc::VideoFrameType>* frame_types) override {
+    if (!encoder_) {
+      if (!settings_)
+        return WEBRTC_VIDEO_CODEC_UNINITIALIZED;
+      int32_t result = Select(input_frame);
+      if (result != WEBRTC_VIDEO_CODEC_OK)
+        return result;
+    }
+    webrtc::VideoFrame frame(input_frame);
+    if (EncoderPolicyBuffer* policy_buffer =
+            EncoderPolicyBuffer::From(input_frame.video_frame_buffer().get())) {
+      frame.set_video_frame_buffer(policy_buffer->buffer());
+    }
+    if (!queue_) {
+      if (trace_latency_)
+        latency_probe_.OnEncodeStart(frame);
+      return encoder_->Encode(frame, frame_types);
+    }
+    if (pending_frames_.fetch_add(1) >= kMaxPendingSoftwareFrames) {
+      pending_frames_--;
+      // The next queued frame carries key frame requests of dropped frames,
+      // so the receiver does not wait for another request round trip.
+      if (frame_types)
+        LatchKeyFrameRequests(*frame_types);
+      if (callback_) {
+        callback_->OnDroppedFrame(
+            webrtc::EncodedImageCallback::DropReason::kDroppedByEncoder);
+      }
+      return WEBRTC_VIDEO_CODEC_OK;
+    }
+    absl::optional<std::vector<webrtc::VideoFrameType>> types;
+    if (frame_types)
+      types = *frame_types;
+    ApplyLatchedKeyFrameRequests(types);
+    queue_->PostTask([this, frame, types = std::move(types)]() {
+      if (trace_latency_)
+        latency_probe_.OnEncodeStart(frame);
+      int32_t result = encoder_->Encode(frame, types ? &*types : nullptr);
+      if (result != WEBRTC_VIDEO_CODEC_OK) {
+        RTC_LOG(LS_WARNING) << "Software encoder returned " << result;
+      }
+      UpdateEncoderInfo();
+      pending_frames_--;
+    });
+    return WEBRTC_VIDEO_CODEC_OK;
+  }
+
+  void SetRates(const RateControlParameters& parameters) override {
+    rates_ = parameters;
+    if (!encoder_)
+      return;
+    PostToEncoder([this, parameters]() { encoder_->SetRates(parameters); });
+  }
+
+  void OnPacketLossRateUpdate(float packet_loss_rate) override {
+    if (encoder_) {
+      PostToEncoder([this, packet_loss_rate]() {
+        encoder_->OnPacketLossRateUpdate(packet_loss_rate);
+      });
+    }
+  }
+
+  void OnRttUpdate(int64_t rtt_ms) override {
+    if (encoder_)
+      PostToEncoder([this, rtt_ms]() { encoder_->OnRttUpdate(rtt_ms); });
+  }
+
+  void OnLossNotification(const LossNotification& loss_notification) override {
+    if (encoder_) {
+      PostToEncoder([this, loss_notification]() {
+        encoder_->OnLossNotification(loss_notification);
+      });
+    }
+  }
+
+  EncoderInfo GetEncoderInfo() const override {
+    std::lock_guard<std::mutex> lock(info_mutex_);
+    return info_;
+  }
+
+  int32_t Release() override {
+    if (queue_) {
+      // Queued frames are encoded before the encoder goes away, so no task
+      // refers to it afterwards.
+      rtc::Event done;
+      queue_->PostTask([this, &done]() {
+        encoder_->Release();
+        done.Set();
+      });
+      done.Wait(rtc::Event::kForever);
+      SoftwareEncoderPool::Get()->Release(queue_);
+      queue_ = nullptr;
+    } else if (encoder_) {
+      encoder_->Release();
+    }
+    encoder_.reset();
+    pending_frames_ = 0;
+    latched_frame_types_.clear();
+    return WEBRTC_VIDEO_CODEC_OK;
+  }
+
+ private:
+  int32_t Select(const webrtc::VideoFrame& frame) {
+    EncoderPolicyBuffer* policy_buffer =
+        EncoderPolicyBuffer::From(frame.video_frame_buffer().get());
+    // Other native buffers reaching encoders here are encoded frames.
+    if (!policy_buffer && frame.video_frame_buffer()->type() ==
+                              webrtc::VideoFrameBuffer::Type::kNative) {
+      encoder_ = CustomizedVideoEncoderProxy::Create();
+      return InitSelected(*settings_);
+    }
+    VideoEncoderPolicy policy =
+        policy_buffer ? policy_buffer->policy() : VideoEncoderPolicy::kAuto;
+    if (policy == VideoEncoderPolicy::kPassThrough) {
+      RTC_LOG(LS_ERROR) << "Pass-through publication received raw frames.";
+      return WEBRTC_VIDEO_CODEC_ERROR;
+    }
+    if (policy != VideoEncoderPolicy::kSoftware && hardware_factory_ &&
+        format_.IsCodecInList(hardware_factory_->GetSupportedFormats())) {
+      encoder_ = hardware_factory_->CreateVideoEncoder(format_);
+      if (encoder_ && InitSelected(*settings_) == WEBRTC_VIDEO_CODEC_OK)
+        return WEBRTC_VIDEO_CODEC_OK;
+      RTC_LOG(LS_WARNING) << "Hardware " << format_.name
+                          << " encoder unavailable, using software encoder.";
+      encoder_.reset();
+    }
+    encoder_ = software_factory_->CreateVideoEncoder(format_);
+    if (!encoder_) {
+      RTC_LOG(LS_ERROR) << "No software encoder for " << format_.name;
+      return WEBRTC_VIDEO_CODEC_ERROR;
+    }
+    // Other software encoders run on WebRTC's encoder queue, as they did
+    // before the pool existed.
+    if (policy != VideoEncoderPolicy::kSoftware &&
+        !SoftwareEncoderPool::Enabled()) {
+      return InitSelected(*settings_);
+    }
+    queue_ = SoftwareEncoderPool::Get()->Acquire();
+    int cores = codec_.width * codec_.height <= kSingleThreadMaxPixels
+                    ? 1
+                    : settings_->number_of_cores;
+    Settings settings(settings_->capabilities, cores,
+                      settings_->max_payload_size);
+    int32_t result = InitSelected(settings);
+    if (result != WEBRTC_VIDEO_CODEC_OK)
+      Release();
+    return result;
+  }
+
+  // Initializes |encoder_| and applies state received before selection.
+  int32_t InitSelected(const Settings& settings) {
+    int32_t result = WEBRTC_VIDEO_CODEC_ERROR;
+    RunOnEncoder([this, &settings, &result]() {
+      result = encoder_->InitEncode(&codec_, settings);
+      if (result != WEBRTC_VIDEO_CODEC_OK)
+        return;
+      if (callback_)
+        encoder_->RegisterEncodeCompleteCallback(InnerCallback());
+      if (rates_)
+        encoder_->SetRates(*rates_);
+      UpdateEncoderInfo();
+    });
+    return result;
+  }
+
+  // Runs |task| in order with queued frames on the pool thread of a software
+  // encoder, or inline for other encoders.
+  template <typename Task>
+  void PostToEncoder(Task task) {
+    if (queue_)
+      queue_->PostTask(std::move(task));
+    else
+      task();
+  }
+
+  // Like PostToEncoder(), but returns after |task| has run.
+  template <typename Task>
+  void RunOnEncoder(Task task) {
+    if (!queue_) {
+      task();
+      return;
+    }
+    rtc::Event done;
+    queue_->PostTask([&task, &done]() {
+      task();
+      done.Set();
+    });
+    done.Wait(rtc::Event::kForever);
+  }
+
+  void LatchKeyFrameRequests(
+      const std::vector<webrtc::VideoFrameType>& frame_types) {
+    if (latched_frame_types_.size() < frame_types.size()) {
+      latched_frame_types_.resize(frame_types.size(),
+                                  webrtc::VideoFrameType::kVideoFrameDelta);
+    }
+    for (size_t i = 0; i < frame_types.size(); i++) {
+      if (frame_types[i] == webrtc::VideoFrameType::kVideoFrameKey)
+        latched_frame_types_[i] = webrtc::VideoFrameType::kVideoFrameKey;
+    }
+  }
+
+  void ApplyLatchedKeyFrameRequests(
+      absl::optional<std::vector<webrtc::VideoFrameType>>& frame_types) {
+    if (latched_frame_types_.empty())
+      return;
+    if (!frame_types) {
+      frame_types.emplace(latched_frame_types_.size(),
+                          webrtc::VideoFrameType::kVideoFrameDelta);
+    }
+    for (size_t i = 0;
+         i < latched_frame_types_.size() && i < frame_types->size(); i++) {
+      if (latched_frame_types_[i] == webrtc::VideoFrameType::kVideoFrameKey)
+        (*frame_types)[i] = webrtc::VideoFrameType::kVideoFrameKey;
+    }
+    latched_frame_types_.clear();
+  }
+
+  webrtc::EncodedImageCallback* InnerCallback() {
+    return (trace_latency_ || dump_) && callback_ ? this : callback_;
+  }
+
+  // One dump file per simulcast layer. Simulcast encoders report the layer
+  // as spatial index. Spatial layers of an SVC stream share one file, which
+  // merges the layers of each picture into one frame.
+  void Dump(const webrtc::EncodedImage& encoded_image) {
+    int index = codec_.numberOfSimulcastStreams > 1
+                    ? encoded_image.SpatialIndex().value_or(0)
+                    : 0;
+    std::lock_guard<std::mutex> lock(dump_mutex_);
+    std::unique_ptr<BitstreamDumpStream>& stream = dump_streams_[index];
+    if (!stream) {
+      stream = BitstreamDumpWriter::Get()->CreateStream(
+          "send_" + std::to_string(index), codec_.codecType);
+    }
+    stream->Write(encoded_image);
+  }
+
+  void UpdateEncoderInfo() {
+    EncoderInfo info = encoder_->GetEncoderInfo();
+    // Keeps encoded frames from being converted to I420 before they reach
+    // the pass-through encoder.
+    info.supports_native_handle = true;
+    std::lock_guard<std::mutex> lock(info_mutex_);
+    info_ = info;
+  }
+
+  const webrtc::SdpVideoFormat format_;
+  webrtc::VideoEncoderFactory* hardware_factory_;
+  webrtc::VideoEncoderFactory* software_factory_;
+  webrtc::VideoCodec codec_;
+  absl::optional<Settings> settings_;
+  absl::optional<RateControlParameters> rates_;
+  webrtc::EncodedImageCallback* callback_ = nullptr;
+  const bool trace_latency_;
+  const bool dump_;
+  std::mutex dump_mutex_;
+  std::map<int, std::unique_ptr<BitstreamDumpStream>> dump_streams_;
+  EncodeLatencyProbe latency_probe_;
+  std::unique_ptr<webrtc::VideoEncoder> encoder_;
+  // Pool thread of a software encoder, null for other encoders.
+  rtc::TaskQueue* queue_ = nullptr;
+  std::atomic<int> pending_frames_{0};
+  // Key frame requests of frames dropped while the queue was full. Only
+  // touched on WebRTC's encoder queue.
+  std::vector<webrtc::VideoFrameType> latched_frame_types_;
+  mutable std::mutex info_mutex_;
+  EncoderInfo info_;
+};
+}  // namespace
+
+SelectingVideoEncoderFactory::SelectingVideoEncoderFactory(
+    std::unique_ptr<webrtc::VideoEncoderFactory> hardware_factory,
+    bool pass_through_formats)
+    : hardware_factory_(std::move(hardware_factory)),
+      software_factory_(webrtc::CreateBuiltinVideoEncoderFactory()),
+      pass_through_formats_(pass_through_formats) {}
+
+SelectingVideoEncoderFactory::~SelectingVideoEncoderFactory() {}
+
+std::unique_ptr<webrtc::VideoEncoder>
+SelectingVideoEncoderFactory::CreateVideoEncoder(
+    const webrtc::SdpVideoFormat& format) {
+  return std::make_unique<SelectingVideoEncoder>(
+      format, hardware_factory_.get(), software_factory_.get());
+}
+
+std::vector<webrtc::SdpVideoFormat>
+SelectingVideoEncoderFactory::GetSupportedFormats() const {
+  if (pass_through_formats_)
+    return EncodedVideoEncoderFactory().GetSupportedFormats();
+  if (hardware_factory_)
+    return hardware_factory_->GetSupportedFormats();
+  return software_factory_->GetSupportedFormats();
+}
+}  // namespace base
+}  // namespace owt
@@ -0,0 +1,44 @@
+// Copyright (C) <2026> Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef OWT_BASE_SELECTINGVIDEOENCODERFACTORY_H_
+#define OWT_BASE_SELECTINGVIDEOENCODERFACTORY_H_
+
+#include <memory>
+#include <vector>
+#include "webrtc/api/video_codecs/sdp_video_format.h"
+#include "webrtc/api/video_codecs/video_encoder.h"
+#include "webrtc/api/video_codecs/video_encoder_factory.h"
+
+namespace owt {
+namespace base {
+// Creates encoders that pick their implementation on the first frame:
+// pass-through for encoded frames, otherwise hardware or software according
+// to the VideoEncoderPolicy carried by an EncoderPolicyBuffer. Publications
+// with different policies can therefore share one PeerConnectionFactory.
+// Software encoders run on SoftwareEncoderPool for kSoftware publications,
+// or for all publications once the pool size is configured.
+class SelectingVideoEncoderFactory : public webrtc::VideoEncoderFactory {
+ public:
+  // |hardware_factory| may be null when no hardware encoder is available.
+  // |pass_through_formats| advertises formats of EncodedVideoEncoderFactory
+  // instead of the encoder factories'.
+  SelectingVideoEncoderFactory(
+      std::unique_ptr<webrtc::VideoEncoderFactory> hardware_factory,
+      bool pass_through_formats);
+  ~SelectingVideoEncoderFactory() override;
+  using webrtc::VideoEncoderFactory::CreateVideoEncoder;
+
+  std::unique_ptr<webrtc::VideoEncoder> CreateVideoEncoder(
+      const webrtc::SdpVideoFormat& format) override;
+  std::vector<webrtc::SdpVideoFormat> GetSupportedFormats() const override;
+
+ private:
+  std::unique_ptr<webrtc::VideoEncoderFactory> hardware_factory_;
+  std::unique_ptr<webrtc::VideoEncoderFactory> software_factory_;
+  const bool pass_through_formats_;
+};
+}  // namespace base
+}  // namespace owt
+#endif  // OWT_BASE_SELECTINGVIDEOENCODERFACTORY_H_
@@ -0,0 +1,235 @@
+// Copyright (C) <2026> Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+#include <atomic>
+#include <mutex>
+#include <set>
+#include <vector>
+#include "talk/owt/sdk/base/encoderpolicyvideotracksource.h"
+#include "talk/owt/sdk/base/selectingvideoencoderfactory.h"
+#include "talk/owt/sdk/base/softwareencoderpool.h"
+#include "testing/gtest/include/gtest/gtest.h"
+#include "testing/gmock/include/gmock/gmock.h"
+#include "webrtc/api/video/i420_buffer.h"
+#include "webrtc/api/video/nv12_buffer.h"
+#include "webrtc/api/video/video_frame.h"
+#include "webrtc/api/video_codecs/sdp_video_format.h"
+#include "webrtc/media/base/media_constants.h"
+#include "webrtc/modules/video_coding/include/video_error_codes.h"
+#include "webrtc/rtc_base/event.h"
+
+namespace owt {
+namespace base {
+namespace {
+constexpr int kWidth = 320;
+constexpr int kHeight = 240;
+constexpr int kTimeoutMs = 5000;
+
+// Counts frames and signals |done| for every encoded or dropped frame.
+class CountingCallback : public webrtc::EncodedImageCallback {
+ public:
+  Result OnEncodedImage(
+      const webrtc::EncodedImage& encoded_image,
+      const webrtc::CodecSpecificInfo* codec_specific_info) override {
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      frame_types.push_back(encoded_image._frameType);
+    }
+    encoded++;
+    done.Set();
+    return Result(Result::OK);
+  }
+  void OnDroppedFrame(DropReason reason) override {
+    dropped++;
+    done.Set();
+  }
+  webrtc::VideoFrameType LastFrameType() {
+    std::lock_guard<std::mutex> lock(mutex);
+    return frame_types.back();
+  }
+  std::atomic<int> encoded{0};
+  std::atomic<int> dropped{0};
+  rtc::Event done;
+  std::mutex mutex;
+  std::vector<webrtc::VideoFrameType> frame_types;
+};
+
+webrtc::VideoFrame TaggedFrame(VideoEncoderPolicy policy, uint32_t timestamp) {
+  rtc::scoped_refptr<webrtc::I420Buffer> buffer =
+      webrtc::I420Buffer::Create(kWidth, kHeight);
+  webrtc::I420Buffer::SetBlack(buffer.get());
+  return webrtc::VideoFrame::Builder()
+      .set_video_frame_buffer(
+          rtc::make_ref_counted<EncoderPolicyBuffer>(buffer, policy))
+      .set_timestamp_rtp(timestamp)
+      .build();
+}
+
+std::unique_ptr<webrtc::VideoEncoder> CreateSoftwareVp8Encoder(
+    SelectingVideoEncoderFactory& factory,
+    CountingCallback& callback) {
+  std::unique_ptr<webrtc::VideoEncoder> encoder =
+      factory.CreateVideoEncoder(webrtc::SdpVideoFormat(cricket::kVp8CodecName));
+  webrtc::VideoCodec codec;
+  codec.codecType = webrtc::kVideoCodecVP8;
+  codec.width = kWidth;
+  codec.height = kHeight;
+  codec.maxFramerate = 30;
+  codec.startBitrate = 300;
+  codec.minBitrate = 30;
+  codec.maxBitrate = 500;
+  *codec.VP8() = webrtc::VideoEncoder::GetDefaultVp8Settings();
+  // Every frame produces output, so tests can wait for each one.
+  codec.VP8()->frameDroppingOn = false;
+  EXPECT_EQ(WEBRTC_VIDEO_CODEC_OK,
+            encoder->InitEncode(
+                &codec, webrtc::VideoEncoder::Settings(
+                            webrtc::VideoEncoder::Capabilities(false), 4, 0)));
+  encoder->RegisterEncodeCompleteCallback(&callback);
+  webrtc::VideoBitrateAllocation allocation;
+  allocation.SetBitrate(0, 0, 300000);
+  encoder->SetRates(
+      webrtc::VideoEncoder::RateControlParameters(allocation, 30.0));
+  return encoder;
+}
+}  // namespace
+
+TEST(EncoderPolicyBufferTest, PolicySurvivesScaling) {
+  rtc::scoped_refptr<webrtc::VideoFrameBuffer> tagged =
+      rtc::make_ref_counted<EncoderPolicyBuffer>(
+          webrtc::I420Buffer::Create(kWidth, kHeight),
+          VideoEncoderPolicy::kSoftware);
+  EXPECT_EQ(webrtc::VideoFrameBuffer::Type::kNative, tagged->type());
+  ASSERT_TRUE(EncoderPolicyBuffer::From(tagged.get()));
+  EXPECT_EQ(VideoEncoderPolicy::kSoftware,
+            EncoderPolicyBuffer::From(tagged.get())->policy());
+  rtc::scoped_refptr<webrtc::VideoFrameBuffer> scaled =
+      tagged->Scale(kWidth / 2, kHeight / 2);
+  ASSERT_TRUE(EncoderPolicyBuffer::From(scaled.get()));
+  EXPECT_EQ(kWidth / 2, scaled->width());
+  EXPECT_EQ(VideoEncoderPolicy::kSoftware,
+            EncoderPolicyBuffer::From(scaled.get())->policy());
+}
+
+TEST(EncoderPolicyBufferTest, WrapsAnyPixelFormat) {
+  rtc::scoped_refptr<webrtc::VideoFrameBuffer> nv12 =
+      webrtc::NV12Buffer::Create(kWidth, kHeight);
+  rtc::scoped_refptr<webrtc::VideoFrameBuffer> tagged =
+      rtc::make_ref_counted<EncoderPolicyBuffer>(nv12,
+                                                 VideoEncoderPolicy::kHardware);
+  ASSERT_TRUE(EncoderPolicyBuffer::From(tagged.get()));
+  EXPECT_EQ(VideoEncoderPolicy::kHardware,
+            EncoderPolicyBuffer::From(tagged.get())->policy());
+  EXPECT_EQ(nv12.get(), EncoderPolicyBuffer::From(tagged.get())->buffer());
+  webrtc::VideoFrameBuffer::Type nv12_type[] = {
+      webrtc::VideoFrameBuffer::Type::kNV12};
+  EXPECT_EQ(nv12.get(), tagged->GetMappedFrameBuffer(nv12_type));
+  EXPECT_TRUE(tagged->ToI420());
+  // Plain buffers are not policy buffers.
+  EXPECT_FALSE(EncoderPolicyBuffer::From(nv12.get()));
+}
+
+TEST(SoftwareEncoderPoolTest, SpreadsEncodersAcrossQueues) {
+  SoftwareEncoderPool* pool = SoftwareEncoderPool::Get();
+  ASSERT_GE(pool->Size(), 1u);
+  std::set<rtc::TaskQueue*> queues;
+  for (size_t i = 0; i < pool->Size(); i++)
+    queues.insert(pool->Acquire());
+  EXPECT_EQ(pool->Size(), queues.size());
+  for (rtc::TaskQueue* queue : queues)
+    pool->Release(queue);
+}
+
+TEST(SelectingVideoEncoderFactoryTest, SoftwarePolicyEncodesOnPool) {
+  SelectingVideoEncoderFactory factory(nullptr, false);
+  CountingCallback callback;
+  std::unique_ptr<webrtc::VideoEncoder> encoder =
+      CreateSoftwareVp8Encoder(factory, callback);
+  EXPECT_TRUE(encoder->GetEncoderInfo().supports_native_handle);
+  std::vector<webrtc::VideoFrameType> key_frame = {
+      webrtc::VideoFrameType::kVideoFrameKey};
+  const int frames = 30;
+  for (int i = 0; i < frames; i++) {
+    EXPECT_EQ(WEBRTC_VIDEO_CODEC_OK,
+              encoder->Encode(TaggedFrame(VideoEncoderPolicy::kSoftware,
+                                          i * 3000),
+                              i == 0 ? &key_frame : nullptr));
+    // One frame at a time, so none is dropped for a full queue.
+    ASSERT_TRUE(callback.done.Wait(kTimeoutMs));
+  }
+  encoder->Release();
+  EXPECT_EQ(frames, callback.encoded);
+  EXPECT_EQ(0, callback.dropped);
+  EXPECT_FALSE(encoder->GetEncoderInfo().is_hardware_accelerated);
+}
+
+TEST(SelectingVideoEncoderFactoryTest, KeyFrameRequestOfDroppedFrameIsKept) {
+  SelectingVideoEncoderFactory factory(nullptr, false);
+  CountingCallback callback;
+  std::unique_ptr<webrtc::VideoEncoder> encoder =
+      CreateSoftwareVp8Encoder(factory, callback);
+  std::vector<webrtc::VideoFrameType> key_frame = {
+      webrtc::VideoFrameType::kVideoFrameKey};
+  ASSERT_EQ(WEBRTC_VIDEO_CODEC_OK,
+            encoder->Encode(TaggedFrame(VideoEncoderPolicy::kSoftware, 0),
+                            &key_frame));
+  ASSERT_TRUE(callback.done.Wait(kTimeoutMs));
+
+  // Stall every pool thread, so the encoder's queue fills up.
+  SoftwareEncoderPool* pool = SoftwareEncoderPool::Get();
+  std::set<rtc::TaskQueue*> queues;
+  std::vector<rtc::TaskQueue*> acquired;
+  while (queues.size() < pool->Size()) {
+    acquired.push_back(pool->Acquire());
+    queues.insert(acquired.back());
+  }
+  rtc::Event resume;
+  for (rtc::TaskQueue* queue : queues)
+    queue->PostTask([&resume]() { resume.Wait(rtc::Event::kForever); });
+  EXPECT_EQ(WEBRTC_VIDEO_CODEC_OK,
+            encoder->Encode(TaggedFrame(VideoEncoderPolicy::kSoftware, 3000),
+                            nullptr));
+  EXPECT_EQ(WEBRTC_VIDEO_CODEC_OK,
+            encoder->Encode(TaggedFrame(VideoEncoderPolicy::kSoftware, 6000),
+                            nullptr));
+  // Dropped with its key frame request.
+  EXPECT_EQ(WEBRTC_VIDEO_CODEC_OK,
+            encoder->Encode(TaggedFrame(VideoEncoderPolicy::kSoftware, 9000),
+                            &key_frame));
+  EXPECT_EQ(1, callback.dropped);
+  resume.Set();
+  for (rtc::TaskQueue* queue : acquired)
+    pool->Release(queue);
+  while (callback.encoded < 3)
+    ASSERT_TRUE(callback.done.Wait(kTimeoutMs));
+  EXPECT_EQ(webrtc::VideoFrameType::kVideoFrameDelta, callback.LastFrameType());
+
+  // Next frame is a key frame without a new request.
+  EXPECT_EQ(WEBRTC_VIDEO_CODEC_OK,
+            encoder->Encode(TaggedFrame(VideoEncoderPolicy::kSoftware, 12000),
+                            nullptr));
+  while (callback.encoded < 4)
+    ASSERT_TRUE(callback.done.Wait(kTimeoutMs));
+  EXPECT_EQ(webrtc::VideoFrameType::kVideoFrameKey, callback.LastFrameType());
+  encoder->Release();
+}
+
+TEST(SelectingVideoEncoderFactoryTest, PassThroughPolicyRejectsRawFrames) {
+  SelectingVideoEncoderFactory factory(nullptr, false);
+  std::unique_ptr<webrtc::VideoEncoder> encoder =
+      factory.CreateVideoEncoder(webrtc::SdpVideoFormat(cricket::kVp8CodecName));
+  webrtc::VideoCodec codec;
+  codec.codecType = webrtc::kVideoCodecVP8;
+  codec.width = kWidth;
+  codec.height = kHeight;
+  *codec.VP8() = webrtc::VideoEncoder::GetDefaultVp8Settings();
+  ASSERT_EQ(WEBRTC_VIDEO_CODEC_OK,
+            encoder->InitEncode(
+                &codec, webrtc::VideoEncoder::Settings(
+                            webrtc::VideoEncoder::Capabilities(false), 1, 0)));
+  EXPECT_EQ(WEBRTC_VIDEO_CODEC_ERROR,
+            encoder->Encode(TaggedFrame(VideoEncoderPolicy::kPassThrough, 0),
+                            nullptr));
+}
+}  // namespace base
+}  // namespace owt
@@ -0,0 +1,413 @@
+// Copyright (C) <2026> Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "talk/owt/sdk/base/sharedvideoencoder.h"
+#include <algorithm>
+#include <unordered_map>
+#include "webrtc/api/make_ref_counted.h"
+#include "webrtc/api/video/video_bitrate_allocation.h"
+#include "webrtc/media/base/media_constants.h"
+#include "webrtc/modules/video_coding/include/video_error_codes.h"
+#include "webrtc/rtc_base/logging.h"
+#include "webrtc/rtc_base/time_utils.h"
+#include "talk/owt/sdk/base/codecutils.h"
+#include "talk/owt/sdk/base/customizedencoderbufferhandle.h"
+#include "talk/owt/sdk/base/peerconnectiondependencyfactory.h"
+
+namespace owt {
+namespace base {
+namespace {
+// Forced key frames are at least this far apart. Requests of several peers
+// within the interval share one key frame.
+static const int64_t kMinKeyFrameIntervalMs = 300;
+static const int kDefaultFrameRate = 30;
+// Start bitrate until peers report their estimates.
+static const int kDefaultStartBitrateKbps = 800;
+
+std::mutex encoders_mutex;
+std::unordered_map<webrtc::VideoTrackInterface*,
+                   std::weak_ptr<SharedVideoEncoder>>&
+Encoders() {
+  static auto* encoders =
+      new std::unordered_map<webrtc::VideoTrackInterface*,
+                             std::weak_ptr<SharedVideoEncoder>>();
+  return *encoders;
+}
+
+webrtc::SdpVideoFormat FormatOf(VideoCodec codec) {
+  switch (codec) {
+    case VideoCodec::kVp9:
+      return webrtc::SdpVideoFormat(cricket::kVp9CodecName);
+    case VideoCodec::kH264:
+      // Constrained baseline, packetization mode 1.
+      return CodecUtils::SupportedH264Codecs()[2];
+    case VideoCodec::kAv1:
+      return webrtc::SdpVideoFormat(cricket::kAv1CodecName);
+#ifdef WEBRTC_USE_H265
+    case VideoCodec::kH265:
+      return CodecUtils::GetSupportedH265Codecs()[0];
+#endif
+    default:
+      return webrtc::SdpVideoFormat(cricket::kVp8CodecName);
+  }
+}
+
+// Encoded frame buffer of one peer. Refers to the encoder's output instead of
+// owning a copy, so fanning out to peers does not copy bitstream.
+class SharedEncodedFrameHandle : public CustomizedEncoderBufferHandle2 {
+ public:
+  explicit SharedEncodedFrameHandle(
+      rtc::scoped_refptr<webrtc::EncodedImageBufferInterface> data)
+      : data_(data) {
+    buffer_ = data_->data();
+    buffer_length_ = data_->size();
+  }
+  ~SharedEncodedFrameHandle() override {
+    // |buffer_| belongs to |data_|.
+    buffer_ = nullptr;
+  }
+
+ private:
+  rtc::scoped_refptr<webrtc::EncodedImageBufferInterface> data_;
+};
+
+// Events from the pass-through encoder of one peer. Owned by the peer's
+// frames and the pass-through encoder, which may outlive the shared encoder.
+class PeerEncoderEvents : public EncoderEventCallback {
+ public:
+  PeerEncoderEvents(std::weak_ptr<SharedVideoEncoder> encoder,
+                    const std::string& peer_id)
+      : encoder_(encoder), peer_id_(peer_id) {}
+  void StartStreaming() override {}
+  void StopStreaming() override {}
+  void RequestKeyFrame() override {
+    if (auto encoder = encoder_.lock())
+      encoder->RequestKeyFrame();
+  }
+  void RequestRateUpdate(uint64_t bitrate_bps, uint32_t frame_rate) override {
+    if (auto encoder = encoder_.lock())
+      encoder->OnPeerRateUpdate(peer_id_, bitrate_bps, frame_rate);
+  }
+  // Loss notifications of one peer cannot steer references shared by all
+  // peers. Key frame requests cover unrecoverable loss.
+  void RequestLossNotification(DependencyNotification notification) override {}
+
+ private:
+  std::weak_ptr<SharedVideoEncoder> encoder_;
+  const std::string peer_id_;
+};
+}  // namespace
+
+// Frame delivery of one peer. Shared by the peer's source and the encoder,
+// so the encoder can deliver without holding its peer list lock. Once
+// detached, which the source does first thing in its destructor, no frame is
+// delivered any more.
+class SharedVideoEncoder::PeerSink {
+ public:
+  PeerSink(std::shared_ptr<SharedVideoEncoder> encoder,
+           const std::string& peer_id)
+      : events_(std::make_shared<PeerEncoderEvents>(encoder, peer_id)) {}
+  // Blocks until a delivery in progress returns.
+  void Detach() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    detached_ = true;
+  }
+  rtc::VideoBroadcaster* broadcaster() { return &broadcaster_; }
+
+  void Deliver(const webrtc::EncodedImage& encoded_image) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (detached_)
+      return;
+    auto* handle = new SharedEncodedFrameHandle(encoded_image.GetEncodedData());
+    handle->encoder_event_callback_ = events_.get();
+    handle->encoder_event_callback_owner_ = events_;
+    handle->width_ = encoded_image._encodedWidth;
+    handle->height_ = encoded_image._encodedHeight;
+    handle->meta_data_.capture_timestamp = encoded_image.capture_time_ms_;
+    handle->meta_data_.encoding_start = encoded_image.timing_.encode_start_ms;
+    handle->meta_data_.encoding_end = encoded_image.timing_.encode_finish_ms;
+    handle->meta_data_.is_keyframe =
+        encoded_image._frameType == webrtc::VideoFrameType::kVideoFrameKey;
+    handle->meta_data_.last_fragment = true;
+    webrtc::VideoFrame frame =
+        webrtc::VideoFrame::Builder()
+            .set_video_frame_buffer(
+                rtc::make_ref_counted<EncodedFrameBuffer2>(handle))
+            .set_timestamp_rtp(encoded_image.Timestamp())
+            .set_timestamp_us(encoded_image.capture_time_ms_ *
+                              rtc::kNumMicrosecsPerMillisec)
+            .build();
+    broadcaster_.OnFrame(frame);
+  }
+
+ private:
+  std::shared_ptr<PeerEncoderEvents> events_;
+  std::mutex mutex_;
+  bool detached_ = false;
+  rtc::VideoBroadcaster broadcaster_;
+};
+
+// Source of a peer track. Frames are encoded frames of the shared encoder.
+class SharedVideoEncoder::PeerSource : public webrtc::VideoTrackSource {
+ public:
+  PeerSource(std::shared_ptr<SharedVideoEncoder> encoder,
+             const std::string& peer_id)
+      : webrtc::VideoTrackSource(/*remote=*/false),
+        encoder_(encoder),
+        peer_id_(peer_id),
+        sink_(std::make_shared<PeerSink>(encoder, peer_id)) {
+    SetState(kLive);
+    encoder_->AddPeer(sink_);
+  }
+  ~PeerSource() override {
+    sink_->Detach();
+    encoder_->RemovePeer(sink_.get());
+    encoder_->OnPeerRateUpdate(peer_id_, 0, 0);
+  }
+  bool is_screencast() const override {
+    auto* source = encoder_->track_->GetSource();
+    return source && source->is_screencast();
+  }
+  absl::optional<bool> needs_denoising() const override { return false; }
+
+ protected:
+  rtc::VideoSourceInterface<webrtc::VideoFrame>* source() override {
+    return sink_->broadcaster();
+  }
+
+ private:
+  std::shared_ptr<SharedVideoEncoder> encoder_;
+  const std::string peer_id_;
+  std::shared_ptr<PeerSink> sink_;
+};
+
+std::shared_ptr<SharedVideoEncoder> SharedVideoEncoder::ForTrack(
+    rtc::scoped_refptr<webrtc::VideoTrackInterface> track,
+    const VideoEncodingParameters& parameters,
+    const std::string& rate_peer_id) {
+  std::lock_guard<std::mutex> lock(encoders_mutex);
+  auto& encoders = Encoders();
+  auto it = encoders.find(track.get());
+  if (it != encoders.end()) {
+    if (auto encoder = it->second.lock())
+      return encoder;
+  }
+  auto encoder =
+      std::make_shared<SharedVideoEncoder>(track, parameters, rate_peer_id);
+  encoders[track.get()] = encoder;
+  return encoder;
+}
+
+SharedVideoEncoder::SharedVideoEncoder(
+    rtc::scoped_refptr<webrtc::VideoTrackInterface> track,
+    const VideoEncodingParameters& parameters,
+    const std::string& rate_peer_id,
+    webrtc::VideoEncoderFactory* encoder_factory)
+    : track_(track),
+      format_(FormatOf(parameters.codec.name)),
+      max_bitrate_kbps_(static_cast<int>(parameters.max_bitrate)),
+      rate_peer_id_(rate_peer_id),
+      encoder_factory_(encoder_factory) {
+  track_->AddOrUpdateSink(this, rtc::VideoSinkWants());
+}
+
+SharedVideoEncoder::~SharedVideoEncoder() {
+  track_->RemoveSink(this);
+  {
+    std::lock_guard<std::mutex> lock(encoders_mutex);
+    auto it = Encoders().find(track_.get());
+    if (it != Encoders().end() && it->second.expired())
+      Encoders().erase(it);
+  }
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (encoder_)
+    encoder_->Release();
+}
+
+rtc::scoped_refptr<webrtc::VideoTrackInterface>
+SharedVideoEncoder::CreatePeerTrack(std::shared_ptr<SharedVideoEncoder> encoder,
+                                    const std::string& peer_id) {
+  rtc::scoped_refptr<webrtc::VideoTrackSourceInterface> source =
+      CreatePeerSource(encoder, peer_id);
+  rtc::scoped_refptr<webrtc::VideoTrackInterface> track =
+      PeerConnectionDependencyFactory::Get()->CreateLocalVideoTrack(
+          encoder->track_->id(), source.get());
+  track->set_content_hint(encoder->track_->content_hint());
+  return track;
+}
+
+rtc::scoped_refptr<webrtc::VideoTrackSourceInterface>
+SharedVideoEncoder::CreatePeerSource(
+    std::shared_ptr<SharedVideoEncoder> encoder,
+    const std::string& peer_id) {
+  return rtc::make_ref_counted<PeerSource>(encoder, peer_id);
+}
+
+void SharedVideoEncoder::AddPeer(std::shared_ptr<PeerSink> peer) {
+  {
+    std::lock_guard<std::mutex> lock(peers_mutex_);
+    peers_.push_back(std::move(peer));
+  }
+  // A new peer can only start decoding at a key frame.
+  RequestKeyFrame();
+}
+
+void SharedVideoEncoder::RemovePeer(PeerSink* peer) {
+  std::lock_guard<std::mutex> lock(peers_mutex_);
+  peers_.erase(std::remove_if(peers_.begin(), peers_.end(),
+                              [peer](const std::shared_ptr<PeerSink>& p) {
+                                return p.get() == peer;
+                              }),
+               peers_.end());
+}
+
+void SharedVideoEncoder::RequestKeyFrame() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  key_frame_requested_ = true;
+}
+
+void SharedVideoEncoder::OnPeerRateUpdate(const std::string& peer_id,
+                                          uint64_t bitrate_bps,
+                                          uint32_t frame_rate) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (bitrate_bps == 0)
+    peer_rates_.erase(peer_id);
+  else
+    peer_rates_[peer_id] = {bitrate_bps, frame_rate};
+  UpdateRates();
+}
+
+void SharedVideoEncoder::UpdateRates() {
+  if (!encoder_ || peer_rates_.empty())
+    return;
+  PeerRate rate;
+  auto configured = peer_rates_.find(rate_peer_id_);
+  if (!rate_peer_id_.empty() && configured != peer_rates_.end()) {
+    rate = configured->second;
+  } else {
+    rate = std::min_element(peer_rates_.begin(), peer_rates_.end(),
+                            [](const auto& a, const auto& b) {
+                              return a.second.bitrate_bps <
+                                     b.second.bitrate_bps;
+                            })
+               ->second;
+  }
+  if (max_bitrate_kbps_ > 0) {
+    rate.bitrate_bps = std::min<uint64_t>(
+        rate.bitrate_bps, static_cast<uint64_t>(max_bitrate_kbps_) * 1000);
+  }
+  if (rate.frame_rate == 0)
+    rate.frame_rate = kDefaultFrameRate;
+  if (applied_rate_ && applied_rate_->bitrate_bps == rate.bitrate_bps &&
+      applied_rate_->frame_rate == rate.frame_rate) {
+    return;
+  }
+  webrtc::VideoBitrateAllocation allocation;
+  allocation.SetBitrate(0, 0, static_cast<uint32_t>(rate.bitrate_bps));
+  encoder_->SetRates(webrtc::VideoEncoder::RateControlParameters(
+      allocation, static_cast<double>(rate.frame_rate)));
+  applied_rate_ = rate;
+}
+
+bool SharedVideoEncoder::InitEncoder(int width, int height) {
+  if (encoder_) {
+    encoder_->Release();
+    encoder_.reset();
+  }
+  encoder_ = encoder_factory_
+                 ? encoder_factory_->CreateVideoEncoder(format_)
+                 : PeerConnectionDependencyFactory::Get()->CreateVideoEncoder(
+                       format_);
+  if (!encoder_) {
+    RTC_LOG(LS_ERROR) << "No encoder for shared " << format_.name
+                      << " encoding.";
+    return false;
+  }
+  webrtc::VideoCodec codec;
+  codec.codecType = CodecUtils::ConvertSdpFormatToCodecType(format_);
+  codec.width = width;
+  codec.height = height;
+  codec.maxFramerate = kDefaultFrameRate;
+  codec.maxBitrate = max_bitrate_kbps_ > 0 ? max_bitrate_kbps_ : 0;
+  codec.startBitrate = kDefaultStartBitrateKbps;
+  if (max_bitrate_kbps_ > 0)
+    codec.startBitrate = std::min(max_bitrate_kbps_, kDefaultStartBitrateKbps);
+  codec.minBitrate = 30;
+  codec.numberOfSimulcastStreams = 1;
+  codec.mode = webrtc::VideoCodecMode::kRealtimeVideo;
+  if (codec.codecType == webrtc::kVideoCodecVP8) {
+    *codec.VP8() = webrtc::VideoEncoder::GetDefaultVp8Settings();
+  } else if (codec.codecType == webrtc::kVideoCodecVP9) {
+    *codec.VP9() = webrtc::VideoEncoder::GetDefaultVp9Settings();
+  } else if (codec.codecType == webrtc::kVideoCodecH264) {
+    *codec.H264() = webrtc::VideoEncoder::GetDefaultH264Settings();
+  }
+  webrtc::VideoEncoder::Settings settings(
+      webrtc::VideoEncoder::Capabilities(/*loss_notification=*/false),
+      /*number_of_cores=*/2, /*max_payload_size=*/1200);
+  if (encoder_->InitEncode(&codec, settings) != WEBRTC_VIDEO_CODEC_OK) {
+    RTC_LOG(LS_ERROR) << "Failed to initialize shared encoder.";
+    encoder_.reset();
+    return false;
+  }
+  encoder_->RegisterEncodeCompleteCallback(this);
+  width_ = width;
+  height_ = height;
+  applied_rate_.reset();
+  if (peer_rates_.empty()) {
+    webrtc::VideoBitrateAllocation allocation;
+    allocation.SetBitrate(0, 0, codec.startBitrate * 1000);
+    encoder_->SetRates(webrtc::VideoEncoder::RateControlParameters(
+        allocation, static_cast<double>(kDefaultFrameRate)));
+  } else {
+    UpdateRates();
+  }
+  return true;
+}
+
+void SharedVideoEncoder::OnFrame(const webrtc::VideoFrame& frame) {
+  {
+    std::lock_guard<std::mutex> lock(peers_mutex_);
+    if (peers_.empty())
+      return;
+  }
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (!encoder_ || frame.width() != width_ || frame.height() != height_) {
+    if (!InitEncoder(frame.width(), frame.height()))
+      return;
+  }
+  std::vector<webrtc::VideoFrameType> types{
+      webrtc::VideoFrameType::kVideoFrameDelta};
+  int64_t now_ms = rtc::TimeMillis();
+  if (key_frame_requested_ &&
+      (last_forced_key_frame_ms_ < 0 ||
+       now_ms - last_forced_key_frame_ms_ >= kMinKeyFrameIntervalMs)) {
+    types[0] = webrtc::VideoFrameType::kVideoFrameKey;
+    key_frame_requested_ = false;
+    last_forced_key_frame_ms_ = now_ms;
+  }
+  webrtc::VideoFrame input(frame);
+  // Capture time travels with the encoded image to the peers' senders.
+  if (input.timestamp_us() == 0)
+    input.set_timestamp_us(rtc::TimeMicros());
+  encoder_->Encode(input, &types);
+}
+
+webrtc::EncodedImageCallback::Result SharedVideoEncoder::OnEncodedImage(
+    const webrtc::EncodedImage& encoded_image,
+    const webrtc::CodecSpecificInfo* codec_specific_info) {
+  if (!encoded_image.GetEncodedData())
+    return Result(Result::ERROR_SEND_FAILED);
+  std::vector<std::shared_ptr<PeerSink>> peers;
+  {
+    std::lock_guard<std::mutex> lock(peers_mutex_);
+    peers = peers_;
+  }
+  // Peers removed meanwhile are detached and skip the frame.
+  for (const auto& peer : peers)
+    peer->Deliver(encoded_image);
+  return Result(Result::OK, encoded_image.Timestamp());
+}
+}  // namespace base
+}  // namespace owt
@@ -0,0 +1,109 @@
+// Copyright (C) <2026> Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef OWT_BASE_SHAREDVIDEOENCODER_H_
+#define OWT_BASE_SHAREDVIDEOENCODER_H_
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include "absl/types/optional.h"
+#include "webrtc/api/media_stream_interface.h"
+#include "webrtc/api/video/video_frame.h"
+#include "webrtc/api/video_codecs/sdp_video_format.h"
+#include "webrtc/api/video_codecs/video_encoder.h"
+#include "webrtc/api/video_codecs/video_encoder_factory.h"
+#include "webrtc/media/base/video_broadcaster.h"
+#include "webrtc/pc/video_track_source.h"
+#include "talk/owt/sdk/include/cpp/owt/base/commontypes.h"
+
+namespace owt {
+namespace base {
+// Encodes a local video track once for all PeerConnections publishing it.
+// Each PeerConnection sends a peer track whose frames are already encoded, so
+// its own encoder is the pass-through encoder proxy. Key frame requests of all
+// peers are coalesced, and bitrate follows the weakest peer, or a configured
+// one.
+class SharedVideoEncoder : public rtc::VideoSinkInterface<webrtc::VideoFrame>,
+                           public webrtc::EncodedImageCallback {
+ public:
+  // Returns the encoder of |track|, creating it if no publication shares one
+  // yet. |parameters| and |rate_peer_id| only apply to a new encoder.
+  // |rate_peer_id| names the peer whose rate drives the encoder, empty for
+  // the weakest peer.
+  static std::shared_ptr<SharedVideoEncoder> ForTrack(
+      rtc::scoped_refptr<webrtc::VideoTrackInterface> track,
+      const VideoEncodingParameters& parameters,
+      const std::string& rate_peer_id);
+  // Encoders are created by |encoder_factory|, or by
+  // PeerConnectionDependencyFactory if it is null.
+  SharedVideoEncoder(rtc::scoped_refptr<webrtc::VideoTrackInterface> track,
+                     const VideoEncodingParameters& parameters,
+                     const std::string& rate_peer_id,
+                     webrtc::VideoEncoderFactory* encoder_factory = nullptr);
+  ~SharedVideoEncoder() override;
+  // Creates the track to publish to |peer_id|. The encoder stays alive as
+  // long as any of its peer tracks.
+  static rtc::scoped_refptr<webrtc::VideoTrackInterface> CreatePeerTrack(
+      std::shared_ptr<SharedVideoEncoder> encoder,
+      const std::string& peer_id);
+  // Creates the source of a peer track. The peer receives encoded frames
+  // until the source is destroyed.
+  static rtc::scoped_refptr<webrtc::VideoTrackSourceInterface>
+  CreatePeerSource(std::shared_ptr<SharedVideoEncoder> encoder,
+                   const std::string& peer_id);
+  // Format produced by this encoder. Peers must negotiate it.
+  const webrtc::SdpVideoFormat& Format() const { return format_; }
+
+  // Implements rtc::VideoSinkInterface for frames of the local track.
+  void OnFrame(const webrtc::VideoFrame& frame) override;
+  // Implements webrtc::EncodedImageCallback.
+  Result OnEncodedImage(
+      const webrtc::EncodedImage& encoded_image,
+      const webrtc::CodecSpecificInfo* codec_specific_info) override;
+
+  // Called by peers' pass-through encoders.
+  void RequestKeyFrame();
+  void OnPeerRateUpdate(const std::string& peer_id,
+                        uint64_t bitrate_bps,
+                        uint32_t frame_rate);
+
+ private:
+  class PeerSource;
+  class PeerSink;
+  void AddPeer(std::shared_ptr<PeerSink> peer);
+  void RemovePeer(PeerSink* peer);
+  // Applies the rate of the driving peer. Requires |mutex_|.
+  void UpdateRates();
+  bool InitEncoder(int width, int height);
+
+  struct PeerRate {
+    uint64_t bitrate_bps;
+    uint32_t frame_rate;
+  };
+
+  rtc::scoped_refptr<webrtc::VideoTrackInterface> track_;
+  const webrtc::SdpVideoFormat format_;
+  const int max_bitrate_kbps_;
+  const std::string rate_peer_id_;
+  webrtc::VideoEncoderFactory* const encoder_factory_;
+  // Serializes calls to |encoder_|.
+  std::mutex mutex_;
+  std::unique_ptr<webrtc::VideoEncoder> encoder_;
+  int width_ = 0;
+  int height_ = 0;
+  std::map<std::string, PeerRate> peer_rates_;
+  absl::optional<PeerRate> applied_rate_;
+  bool key_frame_requested_ = false;
+  int64_t last_forced_key_frame_ms_ = -1;
+  // Peers receiving encoded frames. Frames are delivered outside
+  // |peers_mutex_|, to a copy of this list.
+  std::mutex peers_mutex_;
+  std::vector<std::shared_ptr<PeerSink>> peers_;
+};
+}  // namespace base
+}  // namespace owt
+#endif  // OWT_BASE_SHAREDVIDEOENCODER_H_
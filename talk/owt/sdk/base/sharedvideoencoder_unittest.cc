@@ -0,0 +1,251 @@
+// Copyright (C) <2026> Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "talk/owt/sdk/base/customizedencoderbufferhandle.h"
+#include "talk/owt/sdk/base/sharedvideoencoder.h"
+#include "testing/gtest/include/gtest/gtest.h"
+#include "webrtc/api/make_ref_counted.h"
+#include "webrtc/api/video/i420_buffer.h"
+#include "webrtc/media/base/media_constants.h"
+#include "webrtc/modules/video_coding/include/video_codec_interface.h"
+#include "webrtc/modules/video_coding/include/video_error_codes.h"
+#include "webrtc/pc/media_stream_track.h"
+#include "webrtc/rtc_base/fake_clock.h"
+
+namespace owt {
+namespace base {
+namespace {
+constexpr int kWidth = 320;
+constexpr int kHeight = 240;
+
+// State of the encoders created by FakeEncoderFactory.
+struct FakeEncoderState {
+  std::mutex mutex;
+  std::vector<webrtc::VideoFrameType> frame_types;
+  uint32_t bitrate_bps = 0;
+  double frame_rate = 0;
+};
+
+// Outputs one small image per frame, of the requested frame type.
+class FakeEncoder : public webrtc::VideoEncoder {
+ public:
+  explicit FakeEncoder(FakeEncoderState* state) : state_(state) {}
+  int InitEncode(const webrtc::VideoCodec* codec_settings,
+                 const Settings& settings) override {
+    return WEBRTC_VIDEO_CODEC_OK;
+  }
+  int32_t RegisterEncodeCompleteCallback(
+      webrtc::EncodedImageCallback* callback) override {
+    callback_ = callback;
+    return WEBRTC_VIDEO_CODEC_OK;
+  }
+  int32_t Release() override { return WEBRTC_VIDEO_CODEC_OK; }
+  int32_t Encode(const webrtc::VideoFrame& frame,
+                 const std::vector<webrtc::VideoFrameType>* types) override {
+    webrtc::EncodedImage image;
+    image.SetEncodedData(webrtc::EncodedImageBuffer::Create(16));
+    image._frameType = (*types)[0];
+    image._encodedWidth = frame.width();
+    image._encodedHeight = frame.height();
+    image.SetTimestamp(frame.timestamp());
+    {
+      std::lock_guard<std::mutex> lock(state_->mutex);
+      state_->frame_types.push_back(image._frameType);
+    }
+    webrtc::CodecSpecificInfo info;
+    callback_->OnEncodedImage(image, &info);
+    return WEBRTC_VIDEO_CODEC_OK;
+  }
+  void SetRates(const RateControlParameters& parameters) override {
+    std::lock_guard<std::mutex> lock(state_->mutex);
+    state_->bitrate_bps = parameters.bitrate.get_sum_bps();
+    state_->frame_rate = parameters.framerate_fps;
+  }
+
+ private:
+  FakeEncoderState* state_;
+  webrtc::EncodedImageCallback* callback_ = nullptr;
+};
+
+class FakeEncoderFactory : public webrtc::VideoEncoderFactory {
+ public:
+  std::vector<webrtc::SdpVideoFormat> GetSupportedFormats() const override {
+    return {webrtc::SdpVideoFormat(cricket::kVp8CodecName)};
+  }
+  std::unique_ptr<webrtc::VideoEncoder> CreateVideoEncoder(
+      const webrtc::SdpVideoFormat& format) override {
+    return std::make_unique<FakeEncoder>(&state);
+  }
+  FakeEncoderState state;
+};
+
+class FakeVideoTrack
+    : public webrtc::MediaStreamTrack<webrtc::VideoTrackInterface> {
+ public:
+  FakeVideoTrack() : MediaStreamTrack("video") {}
+  std::string kind() const override { return kVideoKind; }
+  webrtc::VideoTrackSourceInterface* GetSource() const override {
+    return nullptr;
+  }
+};
+
+// Records whether each frame delivered to a peer is a key frame.
+class PeerFrameSink : public rtc::VideoSinkInterface<webrtc::VideoFrame> {
+ public:
+  void OnFrame(const webrtc::VideoFrame& frame) override {
+    auto* buffer =
+        static_cast<EncodedFrameBuffer2*>(frame.video_frame_buffer().get());
+    auto* handle =
+        static_cast<CustomizedEncoderBufferHandle2*>(buffer->native_handle());
+    std::lock_guard<std::mutex> lock(mutex_);
+    key_frames_.push_back(handle->meta_data_.is_keyframe);
+  }
+  std::vector<bool> KeyFrames() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return key_frames_;
+  }
+
+ private:
+  std::mutex mutex_;
+  std::vector<bool> key_frames_;
+};
+
+webrtc::VideoFrame Frame(uint32_t timestamp) {
+  rtc::scoped_refptr<webrtc::I420Buffer> buffer =
+      webrtc::I420Buffer::Create(kWidth, kHeight);
+  webrtc::I420Buffer::SetBlack(buffer.get());
+  return webrtc::VideoFrame::Builder()
+      .set_video_frame_buffer(buffer)
+      .set_timestamp_rtp(timestamp)
+      .set_timestamp_us(1000)
+      .build();
+}
+
+class SharedVideoEncoderTest : public ::testing::Test {
+ protected:
+  std::shared_ptr<SharedVideoEncoder> CreateEncoder(
+      const std::string& rate_peer_id = "",
+      unsigned long max_bitrate_kbps = 0) {
+    VideoEncodingParameters parameters;
+    parameters.codec.name = VideoCodec::kVp8;
+    parameters.max_bitrate = max_bitrate_kbps;
+    return std::make_shared<SharedVideoEncoder>(
+        rtc::make_ref_counted<FakeVideoTrack>(), parameters, rate_peer_id,
+        &factory_);
+  }
+  rtc::scoped_refptr<webrtc::VideoTrackSourceInterface> AddPeer(
+      std::shared_ptr<SharedVideoEncoder> encoder,
+      const std::string& peer_id,
+      PeerFrameSink* sink) {
+    auto source = SharedVideoEncoder::CreatePeerSource(encoder, peer_id);
+    source->AddOrUpdateSink(sink, rtc::VideoSinkWants());
+    return source;
+  }
+  std::vector<webrtc::VideoFrameType> FrameTypes() {
+    std::lock_guard<std::mutex> lock(factory_.state.mutex);
+    return factory_.state.frame_types;
+  }
+  uint32_t Bitrate() {
+    std::lock_guard<std::mutex> lock(factory_.state.mutex);
+    return factory_.state.bitrate_bps;
+  }
+
+  rtc::ScopedFakeClock clock_;
+  FakeEncoderFactory factory_;
+};
+}  // namespace
+
+TEST_F(SharedVideoEncoderTest, KeyFrameRequestsAreCoalesced) {
+  const auto kKey = webrtc::VideoFrameType::kVideoFrameKey;
+  const auto kDelta = webrtc::VideoFrameType::kVideoFrameDelta;
+  clock_.SetTime(webrtc::Timestamp::Seconds(1));
+  auto encoder = CreateEncoder();
+  PeerFrameSink sink_a;
+  PeerFrameSink sink_b;
+  auto peer_a = AddPeer(encoder, "a", &sink_a);
+  auto peer_b = AddPeer(encoder, "b", &sink_b);
+  // Both peers joining share the first key frame.
+  encoder->OnFrame(Frame(0));
+  encoder->OnFrame(Frame(3000));
+  // Requests within 300 ms of the last forced key frame wait for it to pass,
+  // and are served by one key frame.
+  clock_.AdvanceTime(webrtc::TimeDelta::Millis(100));
+  encoder->RequestKeyFrame();
+  encoder->RequestKeyFrame();
+  encoder->OnFrame(Frame(6000));
+  clock_.AdvanceTime(webrtc::TimeDelta::Millis(200));
+  encoder->RequestKeyFrame();
+  encoder->OnFrame(Frame(9000));
+  encoder->OnFrame(Frame(12000));
+  EXPECT_EQ(std::vector<webrtc::VideoFrameType>(
+                {kKey, kDelta, kDelta, kKey, kDelta}),
+            FrameTypes());
+  EXPECT_EQ(std::vector<bool>({true, false, false, true, false}),
+            sink_a.KeyFrames());
+  EXPECT_EQ(sink_a.KeyFrames(), sink_b.KeyFrames());
+}
+
+TEST_F(SharedVideoEncoderTest, RateFollowsWeakestPeer) {
+  auto encoder = CreateEncoder();
+  PeerFrameSink sink;
+  auto peer_a = AddPeer(encoder, "a", &sink);
+  auto peer_b = AddPeer(encoder, "b", &sink);
+  encoder->OnFrame(Frame(0));
+  encoder->OnPeerRateUpdate("a", 1000000, 30);
+  encoder->OnPeerRateUpdate("b", 300000, 15);
+  EXPECT_EQ(300000u, Bitrate());
+  encoder->OnPeerRateUpdate("b", 2000000, 30);
+  EXPECT_EQ(1000000u, Bitrate());
+  // A removed peer no longer limits the rate.
+  encoder->OnPeerRateUpdate("b", 500000, 30);
+  EXPECT_EQ(500000u, Bitrate());
+  peer_b = nullptr;
+  EXPECT_EQ(1000000u, Bitrate());
+}
+
+TEST_F(SharedVideoEncoderTest, RateFollowsConfiguredPeerUpToMaxBitrate) {
+  auto encoder = CreateEncoder("b", 1500);
+  PeerFrameSink sink;
+  auto peer_a = AddPeer(encoder, "a", &sink);
+  auto peer_b = AddPeer(encoder, "b", &sink);
+  encoder->OnFrame(Frame(0));
+  encoder->OnPeerRateUpdate("a", 300000, 30);
+  encoder->OnPeerRateUpdate("b", 1000000, 30);
+  EXPECT_EQ(1000000u, Bitrate());
+  encoder->OnPeerRateUpdate("b", 4000000, 30);
+  EXPECT_EQ(1500000u, Bitrate());
+}
+
+TEST_F(SharedVideoEncoderTest, PeersAddedAndRemovedDuringDelivery) {
+  auto encoder = CreateEncoder();
+  PeerFrameSink steady_sink;
+  auto steady_peer = AddPeer(encoder, "steady", &steady_sink);
+  const int kFrames = 500;
+  std::atomic<bool> encoding{true};
+  std::thread encode_thread([&]() {
+    for (int i = 0; i < kFrames; i++)
+      encoder->OnFrame(Frame(i * 3000));
+    encoding = false;
+  });
+  // Peers come and go while frames are delivered. Once a peer's source is
+  // gone, its sink gets no frame.
+  std::vector<std::unique_ptr<PeerFrameSink>> sinks;
+  std::vector<size_t> frames_at_removal;
+  while (encoding) {
+    sinks.push_back(std::make_unique<PeerFrameSink>());
+    auto peer = AddPeer(encoder, "peer", sinks.back().get());
+    std::this_thread::yield();
+    peer = nullptr;
+    frames_at_removal.push_back(sinks.back()->KeyFrames().size());
+  }
+  encode_thread.join();
+  for (size_t i = 0; i < sinks.size(); i++)
+    EXPECT_EQ(frames_at_removal[i], sinks[i]->KeyFrames().size());
+  EXPECT_EQ(static_cast<size_t>(kFrames), steady_sink.KeyFrames().size());
+}
+}  // namespace base
+}  // namespace owt
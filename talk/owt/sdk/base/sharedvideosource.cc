@@ -0,0 +1,88 @@
+// Copyright (C) <2026> Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "talk/owt/sdk/base/sharedvideosource.h"
+#include "api/make_ref_counted.h"
+
+namespace owt {
+namespace base {
+SharedVideoSourceRegistry& SharedVideoSourceRegistry::Get() {
+  static SharedVideoSourceRegistry* registry = new SharedVideoSourceRegistry();
+  return *registry;
+}
+
+std::shared_ptr<SharedVideoSourceRegistry::Source>
+SharedVideoSourceRegistry::GetOrCreate(const std::string& key,
+                                       const SourceFactory& create) {
+  // Creation happens under the lock, so a device is never opened twice.
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (auto it = sources_.begin(); it != sources_.end();) {
+    if (it->second.expired())
+      it = sources_.erase(it);
+    else
+      ++it;
+  }
+  auto it = sources_.find(key);
+  if (it != sources_.end())
+    return it->second.lock();
+  std::shared_ptr<Source> source(create());
+  if (source)
+    sources_[key] = source;
+  return source;
+}
+
+size_t SharedVideoSourceRegistry::size() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  size_t live = 0;
+  for (const auto& source : sources_) {
+    if (!source.second.expired())
+      live++;
+  }
+  return live;
+}
+
+SharedVideoTrackSource::TrackAdapter::TrackAdapter(int width,
+                                                   int height,
+                                                   int fps,
+                                                   bool crop_to_aspect_ratio) {
+  SetCropToAspectRatio(crop_to_aspect_ratio);
+  RequestOutputFormat(width, height, fps);
+}
+
+void SharedVideoTrackSource::TrackAdapter::OnFrame(
+    const webrtc::VideoFrame& frame) {
+  CameraVideoCapturer::OnFrame(frame);
+}
+
+rtc::scoped_refptr<SharedVideoTrackSource> SharedVideoTrackSource::Create(
+    std::shared_ptr<SharedVideoSourceRegistry::Source> capture,
+    int width,
+    int height,
+    int fps,
+    bool crop_to_aspect_ratio) {
+  if (!capture)
+    return nullptr;
+  return rtc::make_ref_counted<SharedVideoTrackSource>(
+      std::move(capture), width, height, fps, crop_to_aspect_ratio);
+}
+
+SharedVideoTrackSource::SharedVideoTrackSource(
+    std::shared_ptr<SharedVideoSourceRegistry::Source> capture,
+    int width,
+    int height,
+    int fps,
+    bool crop_to_aspect_ratio)
+    : VideoTrackSource(/*remote=*/false),
+      capture_(std::move(capture)),
+      adapter_(width, height, fps, crop_to_aspect_ratio) {
+  // The capture's own adapter must not follow the wants of one track, so
+  // tracks attach without constraints and adapt on their own.
+  capture_->AddOrUpdateSink(&adapter_, rtc::VideoSinkWants());
+}
+
+SharedVideoTrackSource::~SharedVideoTrackSource() {
+  capture_->RemoveSink(&adapter_);
+}
+}  // namespace base
+}  // namespace owt
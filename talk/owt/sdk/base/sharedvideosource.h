@@ -0,0 +1,85 @@
+// Copyright (C) <2026> Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef OWT_BASE_SHAREDVIDEOSOURCE_H_
+#define OWT_BASE_SHAREDVIDEOSOURCE_H_
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include "api/video/video_frame.h"
+#include "api/video/video_source_interface.h"
+#include "pc/video_track_source.h"
+#include "talk/owt/sdk/base/cameravideocapturer.h"
+
+namespace owt {
+namespace base {
+// Process-wide registry of capture sources, keyed by camera or frame
+// generator, so that all local streams of one device share a single capture.
+// A source lives as long as a track uses it; the device is closed when the
+// last one is gone.
+class SharedVideoSourceRegistry {
+ public:
+  using Source = rtc::VideoSourceInterface<webrtc::VideoFrame>;
+  using SourceFactory = std::function<std::unique_ptr<Source>()>;
+
+  static SharedVideoSourceRegistry& Get();
+  // Returns the live source registered for |key|, or registers the one
+  // |create| returns. Returns null if |create| fails.
+  std::shared_ptr<Source> GetOrCreate(const std::string& key,
+                                      const SourceFactory& create);
+  // Number of live sources.
+  size_t size();
+
+ private:
+  std::mutex mutex_;
+  std::unordered_map<std::string, std::weak_ptr<Source>> sources_;
+};
+
+// Track source attached to a shared capture. Every track adapts the captured
+// frames to its own sinks and requested format, so one consumer lowering its
+// resolution or frame rate does not affect the others, and the capture runs
+// once however many tracks attach.
+class SharedVideoTrackSource : public webrtc::VideoTrackSource {
+ public:
+  // |width|, |height| and |fps| cap the format of this track. 0 takes it as
+  // captured. A shared capture keeps the format it was opened with, so a
+  // larger request gets the captured format. Frames of another aspect ratio
+  // are stretched, or center cropped if |crop_to_aspect_ratio| is true.
+  static rtc::scoped_refptr<SharedVideoTrackSource> Create(
+      std::shared_ptr<SharedVideoSourceRegistry::Source> capture,
+      int width,
+      int height,
+      int fps,
+      bool crop_to_aspect_ratio = false);
+
+ protected:
+  SharedVideoTrackSource(
+      std::shared_ptr<SharedVideoSourceRegistry::Source> capture,
+      int width,
+      int height,
+      int fps,
+      bool crop_to_aspect_ratio);
+  ~SharedVideoTrackSource() override;
+
+ private:
+  class TrackAdapter : public CameraVideoCapturer,
+                       public rtc::VideoSinkInterface<webrtc::VideoFrame> {
+   public:
+    TrackAdapter(int width, int height, int fps, bool crop_to_aspect_ratio);
+    void OnFrame(const webrtc::VideoFrame& frame) override;
+  };
+
+  rtc::VideoSourceInterface<webrtc::VideoFrame>* source() override {
+    return &adapter_;
+  }
+
+  std::shared_ptr<SharedVideoSourceRegistry::Source> capture_;
+  TrackAdapter adapter_;
+};
+}  // namespace base
+}  // namespace owt
+#endif  // OWT_BASE_SHAREDVIDEOSOURCE_H_
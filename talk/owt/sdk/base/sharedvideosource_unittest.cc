@@ -0,0 +1,153 @@
+// Copyright (C) <2026> Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+#include <algorithm>
+#include <limits>
+#include "talk/owt/sdk/base/sharedvideosource.h"
+#include "media/base/video_broadcaster.h"
+#include "testing/gtest/include/gtest/gtest.h"
+#include "webrtc/api/video/i420_buffer.h"
+
+namespace owt {
+namespace base {
+namespace {
+constexpr int kWidth = 1280;
+constexpr int kHeight = 720;
+
+class FakeCapture : public SharedVideoSourceRegistry::Source {
+ public:
+  void AddOrUpdateSink(rtc::VideoSinkInterface<webrtc::VideoFrame>* sink,
+                       const rtc::VideoSinkWants& wants) override {
+    broadcaster_.AddOrUpdateSink(sink, wants);
+  }
+  void RemoveSink(rtc::VideoSinkInterface<webrtc::VideoFrame>* sink) override {
+    broadcaster_.RemoveSink(sink);
+  }
+  // Captures a black frame with white bars of |bar_width| at both sides.
+  void Capture(int64_t timestamp_us, int bar_width = 0) {
+    rtc::scoped_refptr<webrtc::I420Buffer> buffer =
+        webrtc::I420Buffer::Create(kWidth, kHeight);
+    webrtc::I420Buffer::SetBlack(buffer.get());
+    for (int y = 0; y < kHeight; y++) {
+      uint8_t* row = buffer->MutableDataY() + y * buffer->StrideY();
+      std::fill(row, row + bar_width, 255);
+      std::fill(row + kWidth - bar_width, row + kWidth, 255);
+    }
+    broadcaster_.OnFrame(webrtc::VideoFrame::Builder()
+                             .set_video_frame_buffer(buffer)
+                             .set_timestamp_us(timestamp_us)
+                             .build());
+  }
+  rtc::VideoSinkWants wants() const { return broadcaster_.wants(); }
+
+ private:
+  rtc::VideoBroadcaster broadcaster_;
+};
+
+class LastFrameSink : public rtc::VideoSinkInterface<webrtc::VideoFrame> {
+ public:
+  void OnFrame(const webrtc::VideoFrame& frame) override {
+    frames++;
+    width = frame.width();
+    height = frame.height();
+    left_luma = frame.video_frame_buffer()->ToI420()->DataY()[0];
+  }
+  int frames = 0;
+  int width = 0;
+  int height = 0;
+  // Luma of the top left pixel.
+  int left_luma = 0;
+};
+}  // namespace
+
+TEST(SharedVideoSourceRegistryTest, SharesSourceWhileInUse) {
+  SharedVideoSourceRegistry registry;
+  int created = 0;
+  auto create = [&created]() {
+    created++;
+    return std::make_unique<FakeCapture>();
+  };
+  auto first = registry.GetOrCreate("camera:0", create);
+  auto second = registry.GetOrCreate("camera:0", create);
+  auto other = registry.GetOrCreate("camera:1", create);
+  EXPECT_EQ(first, second);
+  EXPECT_NE(first, other);
+  EXPECT_EQ(2, created);
+  EXPECT_EQ(2u, registry.size());
+
+  first.reset();
+  second.reset();
+  EXPECT_EQ(1u, registry.size());
+  // The device is opened again once every user is gone.
+  EXPECT_TRUE(registry.GetOrCreate("camera:0", create));
+  EXPECT_EQ(3, created);
+}
+
+TEST(SharedVideoSourceRegistryTest, FailedCreationIsNotRegistered) {
+  SharedVideoSourceRegistry registry;
+  EXPECT_FALSE(registry.GetOrCreate("camera:0", [] {
+    return std::unique_ptr<SharedVideoSourceRegistry::Source>();
+  }));
+  EXPECT_EQ(0u, registry.size());
+}
+
+TEST(SharedVideoTrackSourceTest, TracksAdaptIndependently) {
+  auto capture = std::make_shared<FakeCapture>();
+  rtc::scoped_refptr<SharedVideoTrackSource> full =
+      SharedVideoTrackSource::Create(capture, 0, 0, 0);
+  rtc::scoped_refptr<SharedVideoTrackSource> small =
+      SharedVideoTrackSource::Create(capture, kWidth / 2, kHeight / 2, 0);
+  LastFrameSink full_sink;
+  LastFrameSink small_sink;
+  LastFrameSink constrained_sink;
+  full->AddOrUpdateSink(&full_sink, rtc::VideoSinkWants());
+  small->AddOrUpdateSink(&small_sink, rtc::VideoSinkWants());
+  rtc::VideoSinkWants wants;
+  wants.max_pixel_count = kWidth * kHeight / 4;
+  full->AddOrUpdateSink(&constrained_sink, wants);
+  // The capture itself is not constrained by any track.
+  EXPECT_EQ(std::numeric_limits<int>::max(), capture->wants().max_pixel_count);
+
+  capture->Capture(0);
+  EXPECT_EQ(1, small_sink.frames);
+  EXPECT_EQ(kWidth / 2, small_sink.width);
+  EXPECT_EQ(kHeight / 2, small_sink.height);
+  // Sinks of one track get the frame at the lowest resolution they want.
+  EXPECT_EQ(1, full_sink.frames);
+  EXPECT_EQ(1, constrained_sink.frames);
+  EXPECT_LE(full_sink.width * full_sink.height, wants.max_pixel_count);
+
+  full->RemoveSink(&full_sink);
+  full->RemoveSink(&constrained_sink);
+  small->RemoveSink(&small_sink);
+  full = nullptr;
+  small = nullptr;
+  EXPECT_EQ(1, capture.use_count());
+}
+
+TEST(SharedVideoTrackSourceTest, StretchesUnlessCropRequested) {
+  auto capture = std::make_shared<FakeCapture>();
+  // A square track of a 16:9 capture. The bars lie outside the center crop.
+  rtc::scoped_refptr<SharedVideoTrackSource> stretched =
+      SharedVideoTrackSource::Create(capture, kHeight / 2, kHeight / 2, 0);
+  rtc::scoped_refptr<SharedVideoTrackSource> cropped =
+      SharedVideoTrackSource::Create(capture, kHeight / 2, kHeight / 2, 0,
+                                     /*crop_to_aspect_ratio=*/true);
+  LastFrameSink stretched_sink;
+  LastFrameSink cropped_sink;
+  stretched->AddOrUpdateSink(&stretched_sink, rtc::VideoSinkWants());
+  cropped->AddOrUpdateSink(&cropped_sink, rtc::VideoSinkWants());
+
+  capture->Capture(0, (kWidth - kHeight) / 4);
+  ASSERT_EQ(1, stretched_sink.frames);
+  ASSERT_EQ(1, cropped_sink.frames);
+  EXPECT_EQ(stretched_sink.width, cropped_sink.width);
+  EXPECT_EQ(stretched_sink.height, cropped_sink.height);
+  EXPECT_GT(stretched_sink.left_luma, 128);
+  EXPECT_LT(cropped_sink.left_luma, 128);
+
+  stretched->RemoveSink(&stretched_sink);
+  cropped->RemoveSink(&cropped_sink);
+}
+}  // namespace base
+}  // namespace owt
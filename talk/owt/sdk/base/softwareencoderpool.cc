@@ -0,0 +1,65 @@
+// Copyright (C) <2026> Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+#include "talk/owt/sdk/base/softwareencoderpool.h"
+#include <algorithm>
+#include <string>
+#include "owt/base/globalconfiguration.h"
+#include "webrtc/api/task_queue/default_task_queue_factory.h"
+#include "webrtc/rtc_base/checks.h"
+#include "webrtc/rtc_base/logging.h"
+#include "webrtc/system_wrappers/include/cpu_info.h"
+
+namespace owt {
+namespace base {
+static const size_t kDefaultMaxPoolSize = 4;
+
+SoftwareEncoderPool* SoftwareEncoderPool::Get() {
+  static SoftwareEncoderPool* pool = [] {
+    size_t size = GlobalConfiguration::GetSoftwareEncoderPoolSize();
+    if (size == 0) {
+      size = std::min(
+          static_cast<size_t>(webrtc::CpuInfo::DetectNumberOfCores()),
+          kDefaultMaxPoolSize);
+    }
+    return new SoftwareEncoderPool(std::max<size_t>(size, 1));
+  }();
+  return pool;
+}
+
+bool SoftwareEncoderPool::Enabled() {
+  return GlobalConfiguration::GetSoftwareEncoderPoolSize() > 0;
+}
+
+SoftwareEncoderPool::SoftwareEncoderPool(size_t size) : encoders_(size, 0) {
+  auto task_queue_factory = webrtc::CreateDefaultTaskQueueFactory();
+  for (size_t i = 0; i < size; i++) {
+    queues_.push_back(
+        std::make_unique<rtc::TaskQueue>(task_queue_factory->CreateTaskQueue(
+            "SoftwareEncoderQueue" + std::to_string(i),
+            webrtc::TaskQueueFactory::Priority::NORMAL)));
+  }
+  RTC_LOG(LS_INFO) << "Software encoder pool of " << size << " threads.";
+}
+
+rtc::TaskQueue* SoftwareEncoderPool::Acquire() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  size_t index =
+      std::min_element(encoders_.begin(), encoders_.end()) - encoders_.begin();
+  encoders_[index]++;
+  return queues_[index].get();
+}
+
+void SoftwareEncoderPool::Release(rtc::TaskQueue* queue) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (size_t i = 0; i < queues_.size(); i++) {
+    if (queues_[i].get() == queue) {
+      RTC_DCHECK_GT(encoders_[i], 0);
+      encoders_[i]--;
+      return;
+    }
+  }
+  RTC_DCHECK_NOTREACHED();
+}
+}  // namespace base
+}  // namespace owt
@@ -0,0 +1,40 @@
+// Copyright (C) <2026> Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef OWT_BASE_SOFTWAREENCODERPOOL_H_
+#define OWT_BASE_SOFTWAREENCODERPOOL_H_
+
+#include <memory>
+#include <mutex>
+#include <vector>
+#include "webrtc/rtc_base/task_queue.h"
+
+namespace owt {
+namespace base {
+// Fixed set of encoder threads shared by all software video encoders of the
+// process, so the number of encoding threads does not grow with the number of
+// publications. Each encoder is pinned to one queue, keeping its calls
+// serialized.
+class SoftwareEncoderPool {
+ public:
+  static SoftwareEncoderPool* Get();
+  // True if application set a pool size, which moves software encoders of
+  // all publications to the pool. Otherwise only publications with
+  // VideoEncoderPolicy::kSoftware use it.
+  static bool Enabled();
+  // Returns the queue with fewest encoders. Pass it to Release() once the
+  // encoder no longer posts to it.
+  rtc::TaskQueue* Acquire();
+  void Release(rtc::TaskQueue* queue);
+  size_t Size() const { return queues_.size(); }
+
+ private:
+  explicit SoftwareEncoderPool(size_t size);
+  std::mutex mutex_;
+  std::vector<std::unique_ptr<rtc::TaskQueue>> queues_;
+  // Number of encoders pinned to each queue.
+  std::vector<int> encoders_;
+};
+}  // namespace base
+}  // namespace owt
+#endif  // OWT_BASE_SOFTWAREENCODERPOOL_H_
@@ -2,6 +2,8 @@
 //
 // SPDX-License-Identifier: Apache-2.0
 //
+#include <cstring>
+#include <sstream>
 #include "modules/video_capture/video_capture.h"
 #include "pc/video_track_source.h"
 #include "talk/owt/sdk/base/vcmcapturer.h"
@@ -25,6 +27,10 @@
 #endif
 #include "talk/owt/sdk/base/customizedvideosource.h"
 #include "talk/owt/sdk/base/peerconnectiondependencyfactory.h"
+#include "talk/owt/sdk/base/sharedvideosource.h"
+#ifdef OWT_ENABLE_QUIC
+#include "talk/owt/sdk/base/recordframing.h"
+#endif
 #include "talk/owt/sdk/base/webrtcvideorendererimpl.h"
 #if defined(WEBRTC_WIN)
 #include "talk/owt/sdk/base/win/videorendererwin.h"
@@ -39,41 +45,57 @@ using namespace rtc;
 namespace owt {
 namespace base {
 
-class CapturerTrackSource : public webrtc::VideoTrackSource {
- public:
-  static rtc::scoped_refptr<CapturerTrackSource> Create(
-      const size_t width,
-      const size_t height,
-      const size_t fps,
-      int capture_device_idx) {
-    std::unique_ptr<owt::base::VcmCapturer> capturer;
-    std::unique_ptr<webrtc::VideoCaptureModule::DeviceInfo> info(
-        webrtc::VideoCaptureFactory::CreateDeviceInfo());
-    if (!info) {
-      return nullptr;
-    }
-    int num_devices = info->NumberOfDevices();
-    for (int i = 0; i < num_devices; ++i) {
-      capturer = absl::WrapUnique(owt::base::VcmCapturer::Create(
-          width, height, fps, capture_device_idx));
-      if (capturer) {
-        return rtc::make_ref_counted<CapturerTrackSource>(std::move(capturer));
-      }
-    }
-
+namespace {
+#if !defined(WEBRTC_IOS)
+std::unique_ptr<SharedVideoSourceRegistry::Source> CreateVcmCapturer(
+    const size_t width,
+    const size_t height,
+    const size_t fps,
+    int capture_device_idx) {
+  std::unique_ptr<webrtc::VideoCaptureModule::DeviceInfo> info(
+      webrtc::VideoCaptureFactory::CreateDeviceInfo());
+  if (!info) {
     return nullptr;
   }
+  int num_devices = info->NumberOfDevices();
+  for (int i = 0; i < num_devices; ++i) {
+    std::unique_ptr<owt::base::VcmCapturer> capturer = absl::WrapUnique(
+        owt::base::VcmCapturer::Create(width, height, fps,
+                                       capture_device_idx));
+    if (capturer) {
+      return capturer;
+    }
+  }
+  return nullptr;
+}
+#endif
 
- protected:
-  explicit CapturerTrackSource(std::unique_ptr<owt::base::VcmCapturer> capturer)
-      : VideoTrackSource(/*remote=*/false), capturer_(std::move(capturer)) {}
+#if defined(WEBRTC_WIN) || defined(WEBRTC_LINUX)
+// Lets one frame generator feed a shared capture while the application keeps
+// its reference.
+class SharedFrameGenerator : public VideoFrameGeneratorInterface {
+ public:
+  explicit SharedFrameGenerator(
+      std::shared_ptr<VideoFrameGeneratorInterface> generator)
+      : generator_(std::move(generator)) {}
+  uint32_t GenerateNextFrame(uint8_t* buffer,
+                             const uint32_t capacity) override {
+    return generator_->GenerateNextFrame(buffer, capacity);
+  }
+  uint32_t GetNextFrameSize() override {
+    return generator_->GetNextFrameSize();
+  }
+  int GetHeight() override { return generator_->GetHeight(); }
+  int GetWidth() override { return generator_->GetWidth(); }
+  int GetFps() override { return generator_->GetFps(); }
+  VideoFrameCodec GetType() override { return generator_->GetType(); }
+  void Cleanup() override { generator_->Cleanup(); }
 
  private:
-  rtc::VideoSourceInterface<webrtc::VideoFrame>* source() override {
-    return capturer_.get();
-  }
-  std::unique_ptr<owt::base::VcmCapturer> capturer_;
+  std::shared_ptr<VideoFrameGeneratorInterface> generator_;
 };
+#endif
+}  // namespace
 
 #if defined(WEBRTC_WIN)
 Stream::Stream()
@@ -461,6 +483,12 @@ std::shared_ptr<LocalStream> LocalStream::Create(
       new LocalStream(parameters, std::move(framer)));
   return stream;
 }
+std::shared_ptr<LocalStream> LocalStream::CreateWithSharedGenerator(
+    std::shared_ptr<LocalCustomizedStreamParameters> parameters,
+    std::shared_ptr<VideoFrameGeneratorInterface> framer) {
+  std::shared_ptr<LocalStream> stream(new LocalStream(parameters, framer));
+  return stream;
+}
 std::shared_ptr<LocalStream> LocalStream::Create(
     std::shared_ptr<LocalCustomizedStreamParameters> parameters,
     std::shared_ptr<EncodedStreamProvider> encoder) {
@@ -526,11 +554,21 @@ LocalStream::LocalStream(const LocalCameraStreamParameters& parameters,
       error_code = static_cast<int>(ExceptionType::kLocalNotSupported);
       return;
     }
-    rtc::scoped_refptr<CapturerTrackSource> source =
-        CapturerTrackSource::Create(
-            parameters.ResolutionWidth(), parameters.ResolutionHeight(),
-            parameters.Fps(),
-            DeviceUtils::GetVideoCaptureDeviceIndex(parameters.CameraId()));
+    // Streams of the same camera share one capture.
+    std::shared_ptr<SharedVideoSourceRegistry::Source> capture =
+        SharedVideoSourceRegistry::Get().GetOrCreate(
+            "camera:" + parameters.CameraId(), [&parameters] {
+              return CreateVcmCapturer(
+                  parameters.ResolutionWidth(), parameters.ResolutionHeight(),
+                  parameters.Fps(),
+                  DeviceUtils::GetVideoCaptureDeviceIndex(
+                      parameters.CameraId()));
+            });
+    rtc::scoped_refptr<SharedVideoTrackSource> source =
+        SharedVideoTrackSource::Create(
+            capture, parameters.ResolutionWidth(),
+            parameters.ResolutionHeight(), parameters.Fps(),
+            parameters.CropToAspectRatio());
 #else
     capturer_ = ObjcVideoCapturerFactory::Create(parameters);
     if (!capturer_) {
@@ -667,6 +705,53 @@ LocalStream::LocalStream(
   media_stream_ = stream.get();
   media_stream_->AddRef();
 }
+LocalStream::LocalStream(
+    std::shared_ptr<LocalCustomizedStreamParameters> parameters,
+    std::shared_ptr<VideoFrameGeneratorInterface> framer) {
+  if (!parameters->VideoEnabled() && !parameters->AudioEnabled()) {
+    RTC_LOG(LS_WARNING)
+        << "Create Local Camera Stream without video and audio.";
+  }
+  PeerConnectionDependencyFactory* pcd_factory =
+      PeerConnectionDependencyFactory::Get();
+  std::string media_stream_id("MediaStream-" + rtc::CreateRandomUuid());
+  Id(media_stream_id);
+  scoped_refptr<MediaStreamInterface> stream =
+      pcd_factory->CreateLocalMediaStream(media_stream_id);
+  if (parameters->VideoEnabled() && framer) {
+    // Streams of the same generator share one capture thread.
+    std::ostringstream key;
+    key << "generator:" << framer.get();
+    std::shared_ptr<SharedVideoSourceRegistry::Source> capture =
+        SharedVideoSourceRegistry::Get().GetOrCreate(
+            key.str(),
+            [&parameters, &framer]()
+                -> std::unique_ptr<SharedVideoSourceRegistry::Source> {
+              return absl::WrapUnique(CustomizedCapturer::Create(
+                  parameters,
+                  std::make_unique<SharedFrameGenerator>(framer)));
+            });
+    rtc::scoped_refptr<SharedVideoTrackSource> video_device =
+        SharedVideoTrackSource::Create(
+            capture, parameters->ResolutionWidth(),
+            parameters->ResolutionHeight(), parameters->Fps());
+    if (video_device) {
+      std::string video_track_id("VideoTrack-" + rtc::CreateRandomUuid());
+      rtc::scoped_refptr<webrtc::VideoTrackInterface> video_track =
+          pcd_factory->CreateLocalVideoTrack(video_track_id,
+                                             video_device.get());
+      stream->AddTrack(video_track);
+    }
+  }
+  if (parameters->AudioEnabled()) {
+    std::string audio_track_id("AudioTrack-" + rtc::CreateRandomUuid());
+    scoped_refptr<AudioTrackInterface> audio_track =
+        pcd_factory->CreateLocalAudioTrack(audio_track_id);
+    stream->AddTrack(audio_track);
+  }
+  media_stream_ = stream.get();
+  media_stream_->AddRef();
+}
 LocalStream::LocalStream(
     std::shared_ptr<LocalCustomizedStreamParameters> parameters,
     std::shared_ptr<EncodedStreamProvider> encoder) {
@@ -779,6 +864,72 @@ uint64_t QuicStream::BufferedDataBytes() const {
   }
 }
 
+void QuicStream::SetFramingMode(QuicStreamFramingMode mode,
+                                size_t max_record_size) {
+  framing_mode_ = mode;
+  if (mode == QuicStreamFramingMode::kRaw) {
+    reassembler_.reset();
+    return;
+  }
+  reassembler_ = std::make_unique<RecordReassembler>(
+      mode == QuicStreamFramingMode::kRecordWithTimestamp, max_record_size);
+}
+
+bool QuicStream::WriteRecord(const uint8_t* data,
+                             size_t length,
+                             int64_t timestamp_us) {
+  if (!quic_stream_ || framing_mode_ == QuicStreamFramingMode::kRaw) {
+    RTC_LOG(LS_ERROR) << "WriteRecord requires record framing mode.";
+    return false;
+  }
+  if (write_failed_) {
+    RTC_LOG(LS_ERROR) << "Stream failed after a partial record write.";
+    return false;
+  }
+  if (length > 0 && data == nullptr)
+    return false;
+  // Header and payload go to the transport in a single write, so a short
+  // write cannot leave a header without its payload on the wire.
+  write_buffer_.resize(RecordFraming::kMaxHeaderSize + length);
+  size_t header_size = RecordFraming::WriteHeader(
+      length, framing_mode_ == QuicStreamFramingMode::kRecordWithTimestamp,
+      timestamp_us, write_buffer_.data());
+  if (length > 0)
+    memcpy(write_buffer_.data() + header_size, data, length);
+  size_t record_size = header_size + length;
+  size_t written = quic_stream_->Write(write_buffer_.data(), record_size);
+  if (written == record_size)
+    return true;
+  if (written > 0) {
+    // The peer can no longer find record boundaries on this stream.
+    RTC_LOG(LS_ERROR) << "Partial record write, " << written << " of "
+                      << record_size << " bytes.";
+    write_failed_ = true;
+  }
+  return false;
+}
+
+bool QuicStream::ReadRecord(QuicStreamRecord& record) {
+  if (!reassembler_) {
+    RTC_LOG(LS_ERROR) << "ReadRecord requires record framing mode.";
+    return false;
+  }
+  if (reassembler_->HasError())
+    return false;
+  size_t readable = ReadableBytes();
+  if (readable > 0) {
+    uint8_t* buffer = reassembler_->GetWriteBuffer(readable);
+    reassembler_->CommitWrite(quic_stream_->Read(buffer, readable));
+  }
+  FramedRecord framed;
+  if (!reassembler_->Next(framed))
+    return false;
+  record.data = framed.data;
+  record.size = framed.size;
+  record.timestamp_us = framed.timestamp_us;
+  return true;
+}
+
 std::shared_ptr<owt::base::QuicStream> LocalStream::Stream() {
   return quic_stream_;
 }
@@ -0,0 +1,94 @@
+// Copyright (C) <2026> Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+
+// Measures what an RTC_LOG call costs the logging thread when messages go to
+// a file, written by the logging thread itself or handed to AsyncLogSink.
+// Several threads log at the same time, as media and network threads do.
+
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include "absl/flags/flag.h"
+#include "absl/flags/parse.h"
+#include "talk/owt/sdk/base/asynclogsink.h"
+#include "third_party/webrtc/rtc_base/logging.h"
+#include "third_party/webrtc/rtc_base/time_utils.h"
+
+ABSL_FLAG(int, threads, 4, "Number of threads logging at the same time.");
+ABSL_FLAG(int, calls, 20000, "RTC_LOG calls per thread.");
+ABSL_FLAG(int, queue_size, 8192, "Messages AsyncLogSink may queue.");
+
+namespace owt {
+namespace base {
+namespace test {
+namespace {
+void PrintResult(const std::string& name, double value, const char* unit) {
+  printf("RESULT %s: asynclogsink_benchmark= %.2f %s\n", name.c_str(), value,
+         unit);
+}
+
+// Appends every message to a file and flushes it, like the rotating file sink.
+class FileSink : public rtc::LogSink {
+ public:
+  FileSink() : file_(std::tmpfile()) {}
+  ~FileSink() override {
+    if (file_)
+      fclose(file_);
+  }
+  void OnLogMessage(const std::string& message) override {
+    fwrite(message.data(), 1, message.size(), file_);
+    fflush(file_);
+  }
+
+ private:
+  FILE* file_;
+};
+
+// Average cost in ns of one RTC_LOG call on each of |threads| threads while
+// |sink| is attached.
+double MeasureLogCallNs(rtc::LogSink* sink, int threads, int calls) {
+  rtc::LogMessage::AddLogToStream(sink, rtc::LS_INFO);
+  int64_t start = rtc::TimeNanos();
+  std::vector<std::thread> workers;
+  for (int t = 0; t < threads; t++) {
+    workers.emplace_back([t, calls]() {
+      for (int i = 0; i < calls; i++)
+        RTC_LOG(LS_INFO) << "Benchmark thread " << t << " message " << i;
+    });
+  }
+  for (auto& worker : workers)
+    worker.join();
+  int64_t elapsed = rtc::TimeNanos() - start;
+  rtc::LogMessage::RemoveLogToStream(sink);
+  return calls > 0 ? static_cast<double>(elapsed) / calls : 0;
+}
+
+int RunBenchmark() {
+  const int threads = absl::GetFlag(FLAGS_threads);
+  const int calls = absl::GetFlag(FLAGS_calls);
+  // Only the sinks under test see the messages.
+  rtc::LogMessage::LogToDebug(rtc::LS_NONE);
+  FileSink sync_sink;
+  double sync_ns = MeasureLogCallNs(&sync_sink, threads, calls);
+  AsyncLogSink async_sink(std::make_unique<FileSink>(),
+                          absl::GetFlag(FLAGS_queue_size));
+  double async_ns = MeasureLogCallNs(&async_sink, threads, calls);
+  async_sink.Flush();
+  PrintResult("synchronous_file_log_call", sync_ns, "ns");
+  PrintResult("async_log_call", async_ns, "ns");
+  PrintResult("async_dropped_messages",
+              static_cast<double>(async_sink.DroppedMessages()), "messages");
+  return 0;
+}
+}  // namespace
+}  // namespace test
+}  // namespace base
+}  // namespace owt
+
+int main(int argc, char* argv[]) {
+  absl::ParseCommandLine(argc, argv);
+  return owt::base::test::RunBenchmark();
+}
@@ -0,0 +1,207 @@
+// Copyright (C) <2026> Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+
+// Measures decode throughput of the built-in VP8 decoder called directly and
+// through AsyncVideoDecoderProxy, which decodes on its own threads and lets
+// the caller queue the next frame while the previous one is decoded.
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "absl/flags/flag.h"
+#include "absl/flags/parse.h"
+#include "talk/owt/sdk/base/asyncvideodecoderproxy.h"
+#include "talk/owt/sdk/include/cpp/owt/base/videodecoderinterface.h"
+#include "third_party/webrtc/api/video/i420_buffer.h"
+#include "third_party/webrtc/api/video/video_frame.h"
+#include "third_party/webrtc/api/video_codecs/builtin_video_decoder_factory.h"
+#include "third_party/webrtc/api/video_codecs/builtin_video_encoder_factory.h"
+#include "third_party/webrtc/api/video_codecs/sdp_video_format.h"
+#include "third_party/webrtc/api/video_codecs/video_encoder.h"
+#include "third_party/webrtc/media/base/media_constants.h"
+#include "third_party/webrtc/rtc_base/time_utils.h"
+
+ABSL_FLAG(int, width, 1280, "Width of the encoded stream.");
+ABSL_FLAG(int, height, 720, "Height of the encoded stream.");
+ABSL_FLAG(int, frames, 150, "Number of frames to decode.");
+ABSL_FLAG(int, cores, 4, "Number of cores each decoder may use.");
+ABSL_FLAG(int, queue_size, 8, "Frames the asynchronous decoder may queue.");
+
+namespace owt {
+namespace base {
+namespace test {
+namespace {
+// Frames decode within this time unless the decoder is stuck.
+const int kDecodeTimeoutS = 30;
+
+void PrintResult(const std::string& name, double value, const char* unit) {
+  printf("RESULT %s: asyncvideodecoder_benchmark= %.2f %s\n", name.c_str(),
+         value, unit);
+}
+
+class FrameCollector : public webrtc::EncodedImageCallback {
+ public:
+  Result OnEncodedImage(
+      const webrtc::EncodedImage& encoded_image,
+      const webrtc::CodecSpecificInfo* codec_specific_info) override {
+    // Encoder reuses its output buffer, so keep a copy.
+    webrtc::EncodedImage image(encoded_image);
+    image.SetEncodedData(webrtc::EncodedImageBuffer::Create(
+        encoded_image.data(), encoded_image.size()));
+    images.push_back(image);
+    return Result(Result::OK);
+  }
+  std::vector<webrtc::EncodedImage> images;
+};
+
+// Encodes |frames| moving gradient frames with the built-in VP8 encoder.
+std::vector<webrtc::EncodedImage> EncodeTestStream(int width,
+                                                   int height,
+                                                   int frames) {
+  FrameCollector collector;
+  std::unique_ptr<webrtc::VideoEncoder> encoder =
+      webrtc::CreateBuiltinVideoEncoderFactory()->CreateVideoEncoder(
+          webrtc::SdpVideoFormat(cricket::kVp8CodecName));
+  webrtc::VideoCodec codec;
+  codec.codecType = webrtc::kVideoCodecVP8;
+  codec.width = width;
+  codec.height = height;
+  codec.maxFramerate = 30;
+  codec.startBitrate = 2000;
+  codec.minBitrate = 100;
+  codec.maxBitrate = 4000;
+  *codec.VP8() = webrtc::VideoEncoder::GetDefaultVp8Settings();
+  encoder->InitEncode(&codec,
+                      webrtc::VideoEncoder::Settings(
+                          webrtc::VideoEncoder::Capabilities(false), 4, 0));
+  encoder->RegisterEncodeCompleteCallback(&collector);
+  webrtc::VideoBitrateAllocation allocation;
+  allocation.SetBitrate(0, 0, 2000000);
+  encoder->SetRates(
+      webrtc::VideoEncoder::RateControlParameters(allocation, 30.0));
+  for (int i = 0; i < frames; i++) {
+    rtc::scoped_refptr<webrtc::I420Buffer> buffer =
+        webrtc::I420Buffer::Create(width, height);
+    for (int y = 0; y < height; y++) {
+      for (int x = 0; x < width; x++) {
+        buffer->MutableDataY()[y * buffer->StrideY() + x] =
+            static_cast<uint8_t>(x + y + i * 4);
+      }
+    }
+    memset(buffer->MutableDataU(), 128,
+           buffer->StrideU() * buffer->ChromaHeight());
+    memset(buffer->MutableDataV(), 128,
+           buffer->StrideV() * buffer->ChromaHeight());
+    webrtc::VideoFrame frame = webrtc::VideoFrame::Builder()
+                                   .set_video_frame_buffer(buffer)
+                                   .set_timestamp_rtp(i * 3000)
+                                   .build();
+    std::vector<webrtc::VideoFrameType> types{
+        i == 0 ? webrtc::VideoFrameType::kVideoFrameKey
+               : webrtc::VideoFrameType::kVideoFrameDelta};
+    encoder->Encode(frame, &types);
+  }
+  encoder->Release();
+  return collector.images;
+}
+
+class CountingDecodedCallback : public webrtc::DecodedImageCallback {
+ public:
+  int32_t Decoded(webrtc::VideoFrame& decoded_image) override {
+    std::lock_guard<std::mutex> lock(mutex_);
+    decoded_++;
+    cv_.notify_all();
+    return 0;
+  }
+  bool WaitFor(size_t count) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    return cv_.wait_for(lock, std::chrono::seconds(kDecodeTimeoutS),
+                        [&] { return decoded_ >= count; });
+  }
+
+ private:
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  size_t decoded_ = 0;
+};
+
+webrtc::VideoDecoder::Settings Vp8Settings(int number_of_cores) {
+  webrtc::VideoDecoder::Settings settings;
+  settings.set_codec_type(webrtc::kVideoCodecVP8);
+  settings.set_number_of_cores(number_of_cores);
+  return settings;
+}
+
+// Returns decoded frames per second of |decoder| for |images|, or 0 if not
+// all of them were decoded.
+double MeasureDecodeFps(webrtc::VideoDecoder* decoder,
+                        const std::vector<webrtc::EncodedImage>& images) {
+  CountingDecodedCallback callback;
+  decoder->RegisterDecodeCompleteCallback(&callback);
+  int64_t start = rtc::TimeNanos();
+  for (const auto& image : images) {
+    // A full queue is back pressure here, not loss.
+    while (decoder->Decode(image, false, 0) != WEBRTC_VIDEO_CODEC_OK)
+      std::this_thread::yield();
+  }
+  bool decoded = callback.WaitFor(images.size());
+  int64_t elapsed = rtc::TimeNanos() - start;
+  decoder->Release();
+  if (!decoded) {
+    fprintf(stderr, "Not all frames were decoded.\n");
+    return 0;
+  }
+  return elapsed > 0 ? images.size() * 1e9 / elapsed : 0;
+}
+
+int RunBenchmark() {
+  const int cores = absl::GetFlag(FLAGS_cores);
+  std::vector<webrtc::EncodedImage> images =
+      EncodeTestStream(absl::GetFlag(FLAGS_width),
+                       absl::GetFlag(FLAGS_height),
+                       absl::GetFlag(FLAGS_frames));
+  if (images.empty()) {
+    fprintf(stderr, "Failed to encode the test stream.\n");
+    return 1;
+  }
+  std::unique_ptr<webrtc::VideoDecoder> sync_decoder =
+      webrtc::CreateBuiltinVideoDecoderFactory()->CreateVideoDecoder(
+          webrtc::SdpVideoFormat(cricket::kVp8CodecName));
+  if (!sync_decoder || !sync_decoder->Configure(Vp8Settings(cores))) {
+    fprintf(stderr, "Failed to create the VP8 decoder.\n");
+    return 1;
+  }
+  double sync_fps = MeasureDecodeFps(sync_decoder.get(), images);
+  AsyncVideoDecoderProxy async_decoder(
+      webrtc::kVideoCodecVP8,
+      AsyncVideoDecoderInterface::CreateBuiltin(
+          absl::GetFlag(FLAGS_queue_size))
+          .release());
+  if (!async_decoder.Configure(Vp8Settings(cores))) {
+    fprintf(stderr, "Failed to configure the asynchronous decoder.\n");
+    return 1;
+  }
+  double async_fps = MeasureDecodeFps(&async_decoder, images);
+  if (sync_fps <= 0 || async_fps <= 0)
+    return 1;
+  PrintResult("synchronous_decode", sync_fps, "fps");
+  PrintResult("asynchronous_decode", async_fps, "fps");
+  PrintResult("speedup", async_fps / sync_fps, "x");
+  return 0;
+}
+}  // namespace
+}  // namespace test
+}  // namespace base
+}  // namespace owt
+
+int main(int argc, char* argv[]) {
+  absl::ParseCommandLine(argc, argv);
+  return owt::base::test::RunBenchmark();
+}
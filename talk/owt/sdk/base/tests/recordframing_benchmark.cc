@@ -0,0 +1,85 @@
+// Copyright (C) <2026> Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+
+// Measures how fast RecordReassembler gets records out of a byte stream, for
+// small records arriving in packet sized chunks and large records arriving in
+// large reads.
+
+#include <algorithm>
+#include <cstdio>
+#include <string>
+#include <vector>
+#include "absl/flags/flag.h"
+#include "absl/flags/parse.h"
+#include "talk/owt/sdk/base/recordframing.h"
+#include "third_party/webrtc/rtc_base/time_utils.h"
+
+ABSL_FLAG(int, small_records, 200000, "Number of 64 B records.");
+ABSL_FLAG(int, large_records, 200, "Number of 1 MB records.");
+
+namespace owt {
+namespace base {
+namespace test {
+namespace {
+void PrintResult(const std::string& name, double value, const char* unit) {
+  printf("RESULT %s: recordframing_benchmark= %.2f %s\n", name.c_str(), value,
+         unit);
+}
+
+// Frames and reassembles |count| records of |record_size| bytes, feeding
+// the reassembler in |chunk_size| pieces. Returns records per second, or 0
+// if not all records came out.
+double MeasureRecordsPerSecond(size_t record_size,
+                               size_t count,
+                               size_t chunk_size) {
+  std::vector<uint8_t> payload(record_size, 0x5a);
+  uint8_t header[RecordFraming::kMaxHeaderSize];
+  size_t header_size =
+      RecordFraming::WriteHeader(payload.size(), true, 1, header);
+  std::vector<uint8_t> wire(header, header + header_size);
+  wire.insert(wire.end(), payload.begin(), payload.end());
+  RecordReassembler reassembler(true, record_size);
+  size_t received = 0;
+  int64_t start = rtc::TimeNanos();
+  for (size_t i = 0; i < count; i++) {
+    for (size_t offset = 0; offset < wire.size(); offset += chunk_size) {
+      size_t length = std::min(chunk_size, wire.size() - offset);
+      reassembler.Append(wire.data() + offset, length);
+      FramedRecord record;
+      while (reassembler.Next(record))
+        received++;
+    }
+  }
+  int64_t elapsed = rtc::TimeNanos() - start;
+  if (received != count) {
+    fprintf(stderr, "%zu of %zu records of %zu bytes reassembled.\n",
+            received, count, record_size);
+    return 0;
+  }
+  return elapsed > 0 ? count * 1e9 / elapsed : 0;
+}
+
+int RunBenchmark() {
+  // 64 B records delivered in 1200 B packets, 1 MB records in 64 KB reads.
+  double small_rate = MeasureRecordsPerSecond(
+      64, absl::GetFlag(FLAGS_small_records), 1200);
+  double large_rate = MeasureRecordsPerSecond(
+      1024 * 1024, absl::GetFlag(FLAGS_large_records), 64 * 1024);
+  if (small_rate <= 0 || large_rate <= 0)
+    return 1;
+  PrintResult("small_records", small_rate, "records/s");
+  PrintResult("small_record_time", 1e6 / small_rate, "us");
+  PrintResult("large_records", large_rate, "records/s");
+  PrintResult("large_record_time", 1e6 / large_rate, "us");
+  return 0;
+}
+}  // namespace
+}  // namespace test
+}  // namespace base
+}  // namespace owt
+
+int main(int argc, char* argv[]) {
+  absl::ParseCommandLine(argc, argv);
+  return owt::base::test::RunBenchmark();
+}
@@ -0,0 +1,102 @@
+// Copyright (C) <2026> Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "talk/owt/sdk/base/videolayerselector.h"
+#include <algorithm>
+#include <numeric>
+#include "webrtc/rtc_base/checks.h"
+
+namespace owt {
+namespace base {
+namespace {
+uint64_t Pixels(const Resolution& resolution) {
+  return static_cast<uint64_t>(resolution.width) * resolution.height;
+}
+}  // namespace
+
+VideoLayerSelector::VideoLayerSelector(const std::vector<VideoLayer>& layers,
+                                       size_t initial,
+                                       const Config& config)
+    : config_(config), upswitch_hold_ms_(config.upswitch_hold_ms) {
+  RTC_DCHECK(!layers.empty());
+  RTC_DCHECK_LT(initial, layers.size());
+  std::vector<size_t> order(layers.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(order.begin(), order.end(), [&layers](size_t a, size_t b) {
+    return Pixels(layers[a].resolution) < Pixels(layers[b].resolution);
+  });
+  for (size_t i = 0; i < order.size(); i++) {
+    layers_.push_back(layers[order[i]]);
+    if (order[i] == initial)
+      current_ = i;
+  }
+  cap_ = layers_.size() - 1;
+}
+
+bool VideoLayerSelector::SetTargetResolution(const Resolution& target) {
+  cap_ = layers_.size() - 1;
+  if (target.width != 0 || target.height != 0) {
+    for (size_t i = 0; i < layers_.size(); i++) {
+      if (layers_[i].resolution.width >= target.width &&
+          layers_[i].resolution.height >= target.height) {
+        cap_ = i;
+        break;
+      }
+    }
+  }
+  if (current_ <= cap_)
+    return false;
+  SwitchTo(cap_);
+  return true;
+}
+
+bool VideoLayerSelector::OnSample(const VideoLayerSample& sample) {
+  const int64_t now = sample.time_ms;
+  // An upswitch that survived its hold resets the backoff.
+  if (last_upswitch_ms_ >= 0 && now - last_upswitch_ms_ >= upswitch_hold_ms_) {
+    upswitch_hold_ms_ = config_.upswitch_hold_ms;
+    last_upswitch_ms_ = -1;
+  }
+  if (Congested(sample)) {
+    clean_since_ms_ = -1;
+    if (congested_since_ms_ < 0)
+      congested_since_ms_ = now;
+    if (current_ == 0 || now - congested_since_ms_ < config_.downswitch_hold_ms)
+      return false;
+    if (last_upswitch_ms_ >= 0) {
+      upswitch_hold_ms_ =
+          std::min(upswitch_hold_ms_ * 2, config_.max_upswitch_hold_ms);
+      last_upswitch_ms_ = -1;
+    }
+    SwitchTo(current_ - 1);
+    return true;
+  }
+  congested_since_ms_ = -1;
+  if (clean_since_ms_ < 0)
+    clean_since_ms_ = now;
+  if (current_ >= cap_ || now - clean_since_ms_ < upswitch_hold_ms_)
+    return false;
+  SwitchTo(current_ + 1);
+  last_upswitch_ms_ = now;
+  return true;
+}
+
+bool VideoLayerSelector::Congested(const VideoLayerSample& sample) const {
+  if (sample.loss_fraction > config_.max_loss_fraction ||
+      sample.frame_drop_fraction > config_.max_frame_drop_fraction) {
+    return true;
+  }
+  return sample.frames_per_second > 0 &&
+         sample.decode_ms_per_frame * sample.frames_per_second / 1000 >
+             config_.max_decode_utilization;
+}
+
+void VideoLayerSelector::SwitchTo(size_t layer) {
+  current_ = layer;
+  // Measurements so far describe the previous layer.
+  congested_since_ms_ = -1;
+  clean_since_ms_ = -1;
+}
+}  // namespace base
+}  // namespace owt
@@ -0,0 +1,81 @@
+// Copyright (C) <2026> Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef OWT_BASE_VIDEOLAYERSELECTOR_H_
+#define OWT_BASE_VIDEOLAYERSELECTOR_H_
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "talk/owt/sdk/include/cpp/owt/base/commontypes.h"
+
+namespace owt {
+namespace base {
+// One simulcast layer of a remote video track.
+struct VideoLayer {
+  Resolution resolution;
+  std::string rid;
+};
+
+// Receiver side measurements over the last sampling interval.
+struct VideoLayerSample {
+  int64_t time_ms = 0;
+  double loss_fraction = 0;
+  double frames_per_second = 0;
+  double decode_ms_per_frame = 0;
+  double frame_drop_fraction = 0;
+};
+
+// Picks the simulcast layer a subscriber should receive from its link and
+// decoder statistics and the size the video is rendered at.
+//
+// The layer never exceeds the smallest one covering the render target, and
+// drops to it immediately when the target shrinks. Congestion or decoder
+// overload that persists for |downswitch_hold_ms| steps one layer down. A
+// clean link that persists for the upswitch hold steps one layer up. The
+// receiver has no estimate of spare bandwidth, so an upswitch is a probe: one
+// that is followed by a downswitch within the hold doubles the hold, so a
+// layer the link cannot sustain is probed less and less often.
+class VideoLayerSelector {
+ public:
+  struct Config {
+    double max_loss_fraction = 0.05;
+    double max_frame_drop_fraction = 0.1;
+    // Share of the frame interval decoding may take.
+    double max_decode_utilization = 0.75;
+    int64_t downswitch_hold_ms = 2000;
+    int64_t upswitch_hold_ms = 8000;
+    int64_t max_upswitch_hold_ms = 64000;
+  };
+  // |initial| is the index in |layers| of the layer received at start.
+  VideoLayerSelector(const std::vector<VideoLayer>& layers,
+                     size_t initial,
+                     const Config& config);
+  // Layers sorted from the smallest to the largest.
+  const std::vector<VideoLayer>& layers() const { return layers_; }
+  size_t current() const { return current_; }
+  const VideoLayer& CurrentLayer() const { return layers_[current_]; }
+  // Sets the size the video is rendered at. 0x0 means unlimited. Returns true
+  // if the current layer changed.
+  bool SetTargetResolution(const Resolution& target);
+  // Returns true if the current layer changed.
+  bool OnSample(const VideoLayerSample& sample);
+
+ private:
+  bool Congested(const VideoLayerSample& sample) const;
+  void SwitchTo(size_t layer);
+
+  const Config config_;
+  std::vector<VideoLayer> layers_;
+  size_t current_;
+  size_t cap_;
+  // Start of the current congested or clean period, -1 if none.
+  int64_t congested_since_ms_ = -1;
+  int64_t clean_since_ms_ = -1;
+  int64_t last_upswitch_ms_ = -1;
+  int64_t upswitch_hold_ms_;
+};
+}  // namespace base
+}  // namespace owt
+#endif  // OWT_BASE_VIDEOLAYERSELECTOR_H_
@@ -0,0 +1,88 @@
+// Copyright (C) <2026> Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+#include "talk/owt/sdk/base/videolayerselector.h"
+#include "testing/gtest/include/gtest/gtest.h"
+namespace owt {
+namespace base {
+namespace {
+// Listed out of order on purpose, the selector sorts them.
+std::vector<VideoLayer> Layers() {
+  return {{Resolution(1280, 720), "h"},
+          {Resolution(320, 180), "l"},
+          {Resolution(640, 360), "m"}};
+}
+
+VideoLayerSample Clean(int64_t time_ms) {
+  VideoLayerSample sample;
+  sample.time_ms = time_ms;
+  sample.frames_per_second = 30;
+  sample.decode_ms_per_frame = 5;
+  return sample;
+}
+
+VideoLayerSample Lossy(int64_t time_ms) {
+  VideoLayerSample sample = Clean(time_ms);
+  sample.loss_fraction = 0.2;
+  return sample;
+}
+}  // namespace
+
+TEST(VideoLayerSelectorTest, SortsLayersAndKeepsInitialLayer) {
+  VideoLayerSelector selector(Layers(), 2, VideoLayerSelector::Config());
+  EXPECT_EQ("l", selector.layers()[0].rid);
+  EXPECT_EQ("h", selector.layers()[2].rid);
+  EXPECT_EQ("m", selector.CurrentLayer().rid);
+}
+
+TEST(VideoLayerSelectorTest, TargetResolutionCapsLayerImmediately) {
+  VideoLayerSelector selector(Layers(), 0, VideoLayerSelector::Config());
+  EXPECT_TRUE(selector.SetTargetResolution(Resolution(400, 200)));
+  EXPECT_EQ("m", selector.CurrentLayer().rid);
+  // A clean link never exceeds the cap.
+  for (int64_t t = 0; t < 60000; t += 1000)
+    EXPECT_FALSE(selector.OnSample(Clean(t)));
+  EXPECT_EQ("m", selector.CurrentLayer().rid);
+  EXPECT_FALSE(selector.SetTargetResolution(Resolution()));
+}
+
+TEST(VideoLayerSelectorTest, StepsDownOnlyAfterPersistentCongestion) {
+  VideoLayerSelector selector(Layers(), 0, VideoLayerSelector::Config());
+  EXPECT_FALSE(selector.OnSample(Lossy(0)));
+  EXPECT_FALSE(selector.OnSample(Lossy(1000)));
+  // A single clean sample restarts the hold.
+  EXPECT_FALSE(selector.OnSample(Clean(2000)));
+  EXPECT_FALSE(selector.OnSample(Lossy(3000)));
+  EXPECT_FALSE(selector.OnSample(Lossy(4000)));
+  EXPECT_TRUE(selector.OnSample(Lossy(5000)));
+  EXPECT_EQ("m", selector.CurrentLayer().rid);
+
+  VideoLayerSample overloaded = Clean(6000);
+  overloaded.decode_ms_per_frame = 30;
+  EXPECT_FALSE(selector.OnSample(overloaded));
+  overloaded.time_ms = 8000;
+  EXPECT_TRUE(selector.OnSample(overloaded));
+  EXPECT_EQ("l", selector.CurrentLayer().rid);
+  overloaded.time_ms = 20000;
+  EXPECT_FALSE(selector.OnSample(overloaded));
+}
+
+TEST(VideoLayerSelectorTest, FailedUpswitchBacksOff) {
+  VideoLayerSelector selector(Layers(), 1, VideoLayerSelector::Config());
+  int64_t t = 0;
+  for (; !selector.OnSample(Clean(t)); t += 1000) {
+  }
+  EXPECT_EQ(8000, t);
+  EXPECT_EQ("m", selector.CurrentLayer().rid);
+  // The new layer does not fit, so the selector returns to the old one.
+  for (t += 1000; !selector.OnSample(Lossy(t)); t += 1000) {
+  }
+  EXPECT_EQ("l", selector.CurrentLayer().rid);
+  // The next probe waits twice as long.
+  const int64_t down = t;
+  for (t += 1000; !selector.OnSample(Clean(t)); t += 1000) {
+  }
+  EXPECT_EQ(16000, t - down - 1000);
+}
+}  // namespace base
+}  // namespace owt
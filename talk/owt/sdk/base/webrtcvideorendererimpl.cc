@@ -9,6 +9,9 @@
 #include <d3d9.h>
 #include <dxva2api.h>
 #endif
+#include "talk/owt/sdk/base/framelatencytracer.h"
+#include "talk/owt/sdk/base/memoryaccount.h"
+#include "talk/owt/sdk/base/metricsregistry.h"
 #include "talk/owt/sdk/base/nativehandlebuffer.h"
 #include "talk/owt/sdk/base/webrtcvideorendererimpl.h"
 #if defined(WEBRTC_WIN)
@@ -16,10 +19,47 @@
 #include "talk/owt/sdk/include/cpp/owt/base/videorendererinterface.h"
 #endif
 #include "webrtc/common_video/libyuv/include/webrtc_libyuv.h"
+#include "webrtc/rtc_base/time_utils.h"
 
 namespace owt {
 namespace base {
+namespace {
+// Records a conversion of a frame for the renderer, which took |duration_us|.
+void RecordConversion(bool argb, int64_t duration_us) {
+  static MetricCounter* argb_conversions = MetricsRegistry::Get()->Counter(
+      "owt_renderer_conversions_total",
+      "Frames converted for video renderers.", {{"format", "argb"}});
+  static MetricCounter* i420_conversions = MetricsRegistry::Get()->Counter(
+      "owt_renderer_conversions_total",
+      "Frames converted for video renderers.", {{"format", "i420"}});
+  static MetricHistogram* durations = MetricsRegistry::Get()->Histogram(
+      "owt_renderer_conversion_duration_ms",
+      "Time to convert a frame for a video renderer.",
+      MetricsRegistry::DurationBoundsMs());
+  (argb ? argb_conversions : i420_conversions)->Increment();
+  durations->Observe(static_cast<double>(duration_us) /
+                     rtc::kNumMicrosecsPerMillisec);
+}
+
+// Wraps |size| bytes at |buffer| for the renderer. They count as renderer
+// buffers until the renderer frees the VideoBuffer.
+std::unique_ptr<VideoBuffer> AccountedVideoBuffer(uint8_t* buffer,
+                                                  size_t size,
+                                                  const Resolution& resolution,
+                                                  VideoBufferType type) {
+  MemoryAccount::Process()->Add(MemoryCategory::kRendererBuffers, size);
+  std::unique_ptr<VideoBuffer> video_buffer(
+      new VideoBuffer{buffer, resolution, type});
+  video_buffer->on_release = [size] {
+    MemoryAccount::Process()->Release(MemoryCategory::kRendererBuffers, size);
+  };
+  return video_buffer;
+}
+}  // namespace
+
 void WebrtcVideoRendererImpl::OnFrame(const webrtc::VideoFrame& frame) {
+  if (FrameLatencyTracer::Enabled())
+    FrameLatencyTracer::Get()->OnFrameRendered(frame);
   if (frame.video_frame_buffer()->type() ==
           webrtc::VideoFrameBuffer::Type::kNative) {
 #if defined(WEBRTC_WIN)
@@ -81,19 +121,23 @@ void WebrtcVideoRendererImpl::OnFrame(const webrtc::VideoFrame& frame) {
     return;
   Resolution resolution(frame.width(), frame.height());
   if (renderer_type == VideoRendererType::kARGB) {
-    uint8_t* buffer = new uint8_t[resolution.width * resolution.height * 4];
+    size_t size = resolution.width * resolution.height * 4;
+    uint8_t* buffer = new uint8_t[size];
+    int64_t start_us = rtc::TimeMicros();
     webrtc::ConvertFromI420(frame, webrtc::VideoType::kARGB, 0,
                             static_cast<uint8_t*>(buffer));
-    std::unique_ptr<VideoBuffer> video_buffer(
-        new VideoBuffer{buffer, resolution, VideoBufferType::kARGB});
-    renderer_.RenderFrame(std::move(video_buffer));
+    RecordConversion(true, rtc::TimeMicros() - start_us);
+    renderer_.RenderFrame(
+        AccountedVideoBuffer(buffer, size, resolution, VideoBufferType::kARGB));
   } else {
-    uint8_t* buffer = new uint8_t[resolution.width * resolution.height * 3 / 2];
+    size_t size = resolution.width * resolution.height * 3 / 2;
+    uint8_t* buffer = new uint8_t[size];
+    int64_t start_us = rtc::TimeMicros();
     webrtc::ConvertFromI420(frame, webrtc::VideoType::kI420, 0,
                             static_cast<uint8_t*>(buffer));
-    std::unique_ptr<VideoBuffer> video_buffer(
-        new VideoBuffer{buffer, resolution, VideoBufferType::kI420});
-    renderer_.RenderFrame(std::move(video_buffer));
+    RecordConversion(false, rtc::TimeMicros() - start_us);
+    renderer_.RenderFrame(
+        AccountedVideoBuffer(buffer, size, resolution, VideoBufferType::kI420));
   }
 }
 }  // namespace base
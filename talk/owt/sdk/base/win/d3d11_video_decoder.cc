@@ -9,6 +9,7 @@
 #include "system_wrappers/include/metrics.h"
 #include "talk/owt/sdk/base/mediautils.h"
 #include "talk/owt/sdk/base/nativehandlebuffer.h"
+#include "talk/owt/sdk/base/seicomposer.h"
 #include "webrtc/api/video/color_space.h"
 #include "webrtc/api/video/i420_buffer.h"
 #include "webrtc/common_video/include/video_frame_buffer.h"
@@ -38,14 +39,6 @@ enum D3D11VideoDecoderEvent {
 
 }  // namespace
 
-static const uint8_t frame_number_sei_guid[16] = {
-    0xef, 0xc8, 0xe7, 0xb0, 0x26, 0x26, 0x47, 0xfd,
-    0x9d, 0xa3, 0x49, 0x4f, 0x60, 0xb8, 0x5b, 0xf0};
-
-static const uint8_t cursor_data_sei_guid[16] = {
-    0x2f, 0x69, 0xe7, 0xb0, 0x16, 0x56, 0x87, 0xfd,
-    0x2d, 0x14, 0x26, 0x37, 0x14, 0x22, 0x23, 0x38};
-
 static enum AVPixelFormat hw_pix_fmt;
 static enum AVPixelFormat get_hw_format(AVCodecContext* ctx,
                                         const enum AVPixelFormat* pix_fmts) {
@@ -394,119 +387,11 @@ int64_t D3D11VideoDecoder::GetSideData(const uint8_t* frame_data,
                                          size_t frame_size,
                                          std::vector<uint8_t>& side_data,
                                          std::vector<uint8_t>& cursor_data) {
-  side_data.clear();
-  if (frame_size < 24)  // with prefix-frame-num sei, frame size needs to be at
-                        // least 24 bytes.
-    return -1;
-
-  const uint8_t* head = frame_data;
-  unsigned int payload_size = 0;
-
-  if (head[0] != 0 || head[1] != 0 || head[2] != 0 || head[3] != 1) {
+  if (!SeiComposer::Parse(settings_.codec_type(), frame_data, frame_size,
+                          side_data, cursor_data)) {
     return -1;
   }
-
-  if (settings_.codec_type() == webrtc::kVideoCodecH264 &&
-      (head[4] & 0x1f) == 0x06) {
-    if (head[5] == 0x05) { // user data unregistered.
-      payload_size = head[6];
-      if (payload_size > frame_size - 4 - 4 || payload_size < 17) //. 4-byte start code + 4 byte NAL HDR/Payload Type/Size/RBSP
-        return -1;
-      for (int i = 7; i < 23; i++) {
-        if (head[i] != frame_number_sei_guid[i - 7]) {
-          return -1;
-        }
-      }
-      // Read the entire side-data payload
-      for (unsigned int i = 0; i < payload_size - 16; i++)
-        side_data.push_back(head[i + 23]);
-
-      // Proceed with cursor data SEI, if any.
-      unsigned int sei_idx = 23 + payload_size - 16;
-      if (head[sei_idx] != 0x05) {
-        return payload_size;
-      } else {
-        sei_idx++;
-        unsigned int cursor_data_size = 0;
-        while (head[sei_idx] == 0xFF) {
-          cursor_data_size += head[sei_idx];
-          sei_idx++;
-        }
-        cursor_data_size += head[sei_idx];
-        cursor_data_size -= 16;
-        sei_idx++;
-
-        for (int i = 0; i < 16; i++) {
-          if (head[sei_idx] != cursor_data_sei_guid[i]) {
-            return -1;
-          }
-          sei_idx++;
-        }
-
-        if (cursor_data_size > 0) {
-          if (!cursor_data.empty()) {
-            cursor_data.clear();
-          }
-          cursor_data.insert(cursor_data.end(), head + sei_idx,
-                             head + sei_idx + cursor_data_size);
-        }
-      }
-      return payload_size;
-    }
-  } else if (settings_.codec_type() == webrtc::kVideoCodecH265 &&
-             (head[4] & 0x7E) >> 1 == 0x27 && frame_size >= 25) {
-    // skip byte #5 and check byte #6
-    if (head[6] == 0x05) {
-      payload_size = head[7];
-      if (payload_size > frame_size - 4 - 5 ||
-          payload_size < 17) {  // 4-byte start code + 5 byte NAL HDR/Payload
-                                // Type/Size/RBSP
-        RTC_LOG(LS_INFO) << "Invalid payload size.";
-        return -1;
-      }
-      for (int i = 8; i < 24; i++) {
-        if (head[i] != frame_number_sei_guid[i - 8]) {
-          return -1;
-        }
-      }
-      // Read the entire side-data payload
-      for (unsigned int i = 0; i < payload_size - 16; i++)
-        side_data.push_back(head[i + 24]);
-
-      // Proceed with cursor data SEI, if any.
-      unsigned int sei_idx = 24 + payload_size - 16;
-      if (head[sei_idx] != 0x05) {
-        return payload_size;
-      } else {
-        sei_idx++;
-        unsigned int cursor_data_size = 0;
-        while (head[sei_idx] == 0xFF) {
-          cursor_data_size += head[sei_idx];
-          sei_idx++;
-        }
-        cursor_data_size += head[sei_idx];
-        cursor_data_size -= 16;
-        sei_idx++;
-
-        for (int i = 0; i < 16; i++) {
-          if (head[sei_idx] != cursor_data_sei_guid[i]) {
-            return -1;
-          }
-          sei_idx++;
-        }
-
-        if (cursor_data_size > 0) {
-          if (!cursor_data.empty()) {
-            cursor_data.clear();
-          }
-          cursor_data.insert(cursor_data.end(), head + sei_idx,
-                             head + sei_idx + cursor_data_size);
-        }
-      }
-      return payload_size;
-    }
-  }
-  return payload_size;
+  return side_data.size();
 }
 
 const char* D3D11VideoDecoder::ImplementationName() const {
@@ -5,6 +5,7 @@
 #include "msdkvideobase.h"
 #include "mfxadapter.h"
 #include "talk/owt/sdk/base/nativehandlebuffer.h"
+#include "talk/owt/sdk/base/seicomposer.h"
 #include "talk/owt/sdk/base/win/d3d11_allocator.h"
 #include "talk/owt/sdk/base/win/d3dnativeframe.h"
 #include "talk/owt/sdk/base/win/msdkvideodecoder.h"
@@ -20,138 +21,25 @@ static constexpr int kMaxSideDataListSize = 20;
 
 namespace {
 
-static const uint8_t frame_number_sei_guid[16] = {
-    0xef, 0xc8, 0xe7, 0xb0, 0x26, 0x26, 0x47, 0xfd,
-    0x9d, 0xa3, 0x49, 0x4f, 0x60, 0xb8, 0x5b, 0xf0};
-
-static const uint8_t cursor_data_sei_guid[16] = {
-    0x2f, 0x69, 0xe7, 0xb0, 0x16, 0x56, 0x87, 0xfd,
-    0x2d, 0x14, 0x26, 0x37, 0x14, 0x22, 0x23, 0x38};
-
 int64_t GetSideData(const uint8_t* frame_data,
                     size_t frame_size,
                     std::vector<uint8_t>& side_data,
                     std::vector<uint8_t>& cursor_data,
                     bool is_h264) {
-  side_data.clear();
-
-  const uint8_t* head = frame_data;
-  unsigned int payload_size = 0;
-
-  if (frame_size < 24)  // with prefix-frame-num sei, frame size needs to be at
-                        // least 24 bytes.
-    goto failed;
-
-  if (head[0] != 0 || head[1] != 0 || head[2] != 0 || head[3] != 1) {
-    goto failed;
-  }
-  if (is_h264) {
-    if ((head[4] & 0x1f) == 0x06) {
-      if (head[5] == 0x05) {  // user data unregistered.
-        payload_size = head[6];
-        if (payload_size > frame_size - 4 - 4 ||
-            payload_size < 17)  //. 4-byte start code + 4 byte NAL HDR/Payload
-                                //Type/Size/RBSP
-          goto failed;
-        for (int i = 7; i < 23; i++) {
-          if (head[i] != frame_number_sei_guid[i - 7]) {
-            goto failed;
-          }
-        }
-        // Read the entire side-data payload
-        for (unsigned int i = 0; i < payload_size - 16; i++)
-          side_data.push_back(head[i + 23]);
-
-        // Proceed with cursor data SEI, if any.
-        unsigned int sei_idx = 23 + payload_size - 16;
-        if (head[sei_idx] != 0x05) {
-          return payload_size;
-        } else {
-          sei_idx++;
-          unsigned int cursor_data_size = 0;
-          while (head[sei_idx] == 0xFF) {
-            cursor_data_size += head[sei_idx];
-            sei_idx++;
-          }
-          cursor_data_size += head[sei_idx];
-          cursor_data_size -= 16;
-          sei_idx++;
-
-          for (int i = 0; i < 16; i++) {
-            if (head[sei_idx] != cursor_data_sei_guid[i]) {
-              goto failed;
-            }
-            sei_idx++;
-          }
-
-          if (cursor_data_size > 0) {
-            if (!cursor_data.empty()) {
-              cursor_data.clear();
-            }
-            cursor_data.insert(cursor_data.end(), head + sei_idx,
-                               head + sei_idx + cursor_data_size);
-          }
-        }
-
-        return payload_size;
-      }
-    }
-  } else {
-    // HEVC side data -prefix-sei
-    if ((head[4] & 0x7E) >> 1 == 0x27 && frame_size >= 25) {
-      // skip byte #5 and check byte #6
-      if (head[6] == 0x05) {
-        payload_size = head[7];
-        if (payload_size > frame_size - 4 - 5 ||
-            payload_size < 17) {  // 4-byte start code + 5 byte NAL HDR/Payload
-                                  // Type/Size/RBSP
-          goto failed;
-        }
-        for (int i = 8; i < 24; i++) {
-          if (head[i] != frame_number_sei_guid[i - 8]) {
-            goto failed;
-          }
-        }
-        // Read the entire side-data payload
-        for (unsigned int i = 0; i < payload_size - 16; i++)
-          side_data.push_back(head[i + 24]);
-
-        // Proceed with cursor data SEI, if any.
-        unsigned int sei_idx = 24 + payload_size - 16;
-        if (head[sei_idx] != 0x05) {
-          return payload_size;
-        } else {
-          sei_idx++;
-          unsigned int cursor_data_size = 0;
-          while (head[sei_idx] == 0xFF) {
-            cursor_data_size += head[sei_idx];
-            sei_idx++;
-          }
-          cursor_data_size += head[sei_idx];
-          cursor_data_size -= 16;
-          sei_idx++;
-
-          for (int i = 0; i < 16; i++) {
-            if (head[sei_idx] != cursor_data_sei_guid[i]) {
-              goto failed;
-            }
-            sei_idx++;
-          }
-
-          if (cursor_data_size > 0) {
-            if (!cursor_data.empty()) {
-              cursor_data.clear();
-            }
-            cursor_data.insert(cursor_data.end(), head + sei_idx,
-                               head + sei_idx + cursor_data_size);
-          }
-        }
-        return payload_size;
-      }
-    }
+#ifdef WEBRTC_USE_H265
+  webrtc::VideoCodecType codec_type =
+      is_h264 ? webrtc::kVideoCodecH264 : webrtc::kVideoCodecH265;
+#else
+  // HEVC side data cannot be parsed without H.265 support.
+  if (!is_h264)
+    return -1;
+  webrtc::VideoCodecType codec_type = webrtc::kVideoCodecH264;
+#endif
+  if (!owt::base::SeiComposer::Parse(codec_type, frame_data, frame_size,
+                                     side_data, cursor_data)) {
+    return -1;
   }
-failed:
-  return -1;
+  return side_data.size();
 }
 }  // namespace
 
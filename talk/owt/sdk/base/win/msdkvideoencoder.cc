@@ -5,6 +5,7 @@
 #include <string>
 #include <vector>
 #include "libyuv/convert_from.h"
+#include "libyuv/planar_functions.h"
 #include "mfxcommon.h"
 #include "absl/algorithm/container.h"
 #include "talk/owt/sdk/base/mediautils.h"
@@ -637,7 +638,17 @@ int MSDKVideoEncoder::Encode(
   pitch = pData.Pitch;
   ptr = pData.Y + pInfo.CropX + pInfo.CropY * pData.Pitch;
 
-  if (MFX_FOURCC_NV12 == pInfo.FourCC) {
+  if (MFX_FOURCC_NV12 == pInfo.FourCC &&
+      input_image.video_frame_buffer()->type() ==
+          webrtc::VideoFrameBuffer::Type::kNV12) {
+    // NV12 input is copied as is.
+    const webrtc::NV12BufferInterface* buffer =
+        input_image.video_frame_buffer()->GetNV12();
+    libyuv::CopyPlane(buffer->DataY(), buffer->StrideY(), pData.Y, pitch, w,
+                      h);
+    libyuv::CopyPlane(buffer->DataUV(), buffer->StrideUV(), pData.UV, pitch,
+                      buffer->ChromaWidth() * 2, buffer->ChromaHeight());
+  } else if (MFX_FOURCC_NV12 == pInfo.FourCC) {
     rtc::scoped_refptr<webrtc::I420BufferInterface> buffer(
         input_image.video_frame_buffer()->ToI420());
 
@@ -647,8 +658,21 @@ int MSDKVideoEncoder::Encode(
   } else if (MFX_FOURCC_YV12 == pInfo.FourCC) {
     // Do not support it.
     return WEBRTC_VIDEO_CODEC_ERROR;
+  } else if (MFX_FOURCC_P010 == pInfo.FourCC &&
+             input_image.video_frame_buffer()->type() ==
+                 webrtc::VideoFrameBuffer::Type::kI010) {
+    // 10 bit input keeps its precision. P010 holds the samples in the high
+    // bits, with U and V interleaved.
+    const webrtc::I010BufferInterface* buffer =
+        input_image.video_frame_buffer()->GetI010();
+    libyuv::ConvertToMSBPlane_16(buffer->DataY(), buffer->StrideY(),
+                                 pData.Y16, pitch / 2, w, h, 10);
+    libyuv::MergeUVPlane_16(buffer->DataU(), buffer->StrideU(),
+                            buffer->DataV(), buffer->StrideV(), pData.U16,
+                            pitch / 2, buffer->ChromaWidth(),
+                            buffer->ChromaHeight(), 10);
   } else if (MFX_FOURCC_P010 == pInfo.FourCC) {
-    // Source is always I420.
+    // Source is I420, or converted to it.
     rtc::scoped_refptr<webrtc::I420BufferInterface> buffer(
         input_image.video_frame_buffer()->ToI420());
     libyuv::I420ToI010(buffer->DataY(), buffer->StrideY(), buffer->DataU(),
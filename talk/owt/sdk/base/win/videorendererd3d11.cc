@@ -7,6 +7,7 @@
 #include <cstdio>
 #include "rtc_base/logging.h"
 #include <system_error>
+#include "talk/owt/sdk/base/framelatencytracer.h"
 #include "talk/owt/sdk/base/nativehandlebuffer.h"
 #include "talk/owt/sdk/base/win/d3dnativeframe.h"
 #include "talk/owt/sdk/include/cpp/owt/base/globalconfiguration.h"
@@ -61,6 +62,8 @@ bool WebrtcVideoRendererD3D11Impl::GetWindowSizeForSwapChain(int& width, int& he
 
 void WebrtcVideoRendererD3D11Impl::OnFrame(
     const webrtc::VideoFrame& video_frame) {
+  if (FrameLatencyTracer::Enabled())
+    FrameLatencyTracer::Get()->OnFrameRendered(video_frame);
   uint16_t width = video_frame.video_frame_buffer()->width();
   uint16_t height = video_frame.video_frame_buffer()->height();
   if (width == 0 || height == 0) {
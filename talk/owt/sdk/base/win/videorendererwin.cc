@@ -2,6 +2,7 @@
 //
 // SPDX-License-Identifier: Apache-2.0
 
+#include "talk/owt/sdk/base/framelatencytracer.h"
 #include "talk/owt/sdk/base/nativehandlebuffer.h"
 #include "talk/owt/sdk/base/win/videorendererwin.h"
 #include "talk/owt/sdk/base/win/d3dnativeframe.h"
@@ -57,6 +58,8 @@ void WebrtcVideoRendererD3D9Impl::Resize(size_t width, size_t height) {
 
 void WebrtcVideoRendererD3D9Impl::OnFrame(
     const webrtc::VideoFrame& video_frame) {
+  if (FrameLatencyTracer::Enabled())
+    FrameLatencyTracer::Get()->OnFrameRendered(video_frame);
   // Do we need to Lock the renderframe call? since we have the device lock here
   // it seems no neccessary.
   if (video_frame.video_frame_buffer()->type() ==
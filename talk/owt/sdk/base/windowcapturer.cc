@@ -289,7 +289,7 @@ void BasicWindowCapturer::OnCaptureResult(
       webrtc::VideoFrame::Builder()
           .set_video_frame_buffer(frame_buffer_)
           .set_timestamp_rtp(0)
-          .set_timestamp_ms(rtc::TimeMillis())
+          .set_timestamp_us(rtc::TimeMicros())
           .set_rotation(webrtc::kVideoRotation_0)
           .build();
 
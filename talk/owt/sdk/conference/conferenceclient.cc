@@ -4,7 +4,9 @@
 #include "talk/owt/sdk/include/cpp/owt/conference/conferenceclient.h"
 #include <algorithm>
 #include <string>
+#include <utility>
 #include "talk/owt/sdk/base/mediautils.h"
+#include "talk/owt/sdk/base/memoryaccount.h"
 #include "talk/owt/sdk/base/stringutils.h"
 #include "talk/owt/sdk/conference/conferencepeerconnectionchannel.h"
 #ifdef OWT_ENABLE_QUIC
@@ -19,6 +21,7 @@
 #include "webrtc/rtc_base/strings/json.h"
 #include "webrtc/rtc_base/task_queue.h"
 #include "webrtc/rtc_base/third_party/base64/base64.h"
+#include "webrtc/rtc_base/time_utils.h"
 
 using namespace rtc;
 namespace owt {
@@ -35,6 +38,188 @@ static const std::unordered_map<std::string, VideoSourceInfo>
                           {"raw-file", VideoSourceInfo::kFile},
                           {"encoded-file", VideoSourceInfo::kFile},
                           {"mcu", VideoSourceInfo::kMixed}};
+namespace {
+// Completion of requests sent together. Invokes |on_success| or |on_failure|
+// once after every request completed.
+class BatchCompletion : public std::enable_shared_from_this<BatchCompletion> {
+ public:
+  BatchCompletion(size_t count,
+                  std::function<void()> on_success,
+                  std::function<void(std::unique_ptr<Exception>)> on_failure)
+      : remaining_(count),
+        count_(count),
+        on_success_(on_success),
+        on_failure_(on_failure) {}
+  std::function<void()> Success() {
+    auto that = shared_from_this();
+    return [that]() { that->Complete(nullptr); };
+  }
+  std::function<void(std::unique_ptr<Exception>)> Failure() {
+    auto that = shared_from_this();
+    return [that](std::unique_ptr<Exception> exception) {
+      that->Complete(std::move(exception));
+    };
+  }
+
+ private:
+  void Complete(std::unique_ptr<Exception> exception) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (exception) {
+        failed_++;
+        if (!first_failure_)
+          first_failure_ = std::move(exception);
+      }
+      if (remaining_ == 0 || --remaining_ > 0)
+        return;
+    }
+    if (!first_failure_) {
+      if (on_success_)
+        on_success_();
+    } else if (on_failure_) {
+      on_failure_(std::unique_ptr<Exception>(new Exception(
+          first_failure_->Type(),
+          std::to_string(failed_) + " of " + std::to_string(count_) +
+              " requests failed. First failure: " +
+              first_failure_->Message())));
+    }
+  }
+
+  std::mutex mutex_;
+  size_t remaining_;
+  const size_t count_;
+  size_t failed_ = 0;
+  std::unique_ptr<Exception> first_failure_;
+  std::function<void()> on_success_;
+  std::function<void(std::unique_ptr<Exception>)> on_failure_;
+};
+
+std::unique_ptr<Exception> NullSubscriptionException() {
+  return std::unique_ptr<Exception>(new Exception(
+      ExceptionType::kConferenceInvalidParam, "Subscription is nullptr."));
+}
+}  // namespace
+// Subscribes |requests| with at most |max_concurrency| of them in flight. A
+// request starts as soon as an earlier one completes. Runs on the event queue,
+// so callbacks are never invoked on the caller's thread.
+// Creating a channel blocks until the PeerConnection factory's thread created
+// its PeerConnection. The channel of the next request is created right after
+// a request is sent, while the requests in flight wait for the server, so a
+// request is sent as soon as a slot frees up.
+class ConferenceClient::SubscribeQueue
+    : public std::enable_shared_from_this<SubscribeQueue> {
+ public:
+  using Request = std::pair<std::shared_ptr<RemoteStream>, SubscribeOptions>;
+  SubscribeQueue(
+      std::weak_ptr<ConferenceClient> client,
+      std::shared_ptr<rtc::TaskQueue> event_queue,
+      const std::vector<Request>& requests,
+      std::function<void(std::shared_ptr<RemoteStream>,
+                         std::shared_ptr<ConferenceSubscription>)>
+          on_subscribed,
+      std::function<void(std::shared_ptr<RemoteStream>,
+                         std::unique_ptr<Exception>)> on_failed,
+      std::function<void()> on_complete)
+      : client_(client),
+        event_queue_(event_queue),
+        requests_(requests),
+        on_subscribed_(on_subscribed),
+        on_failed_(on_failed),
+        on_complete_(on_complete),
+        start_time_ms_(rtc::TimeMillis()) {}
+  void Start(size_t max_concurrency) {
+    if (max_concurrency == 0 || max_concurrency > requests_.size())
+      max_concurrency = requests_.size();
+    auto that = shared_from_this();
+    event_queue_->PostTask([that, max_concurrency]() {
+      for (size_t i = 0; i < max_concurrency; i++)
+        that->Next();
+    });
+  }
+
+ private:
+  // Methods below run on |event_queue_|.
+  void Next() {
+    if (next_ >= requests_.size())
+      return;
+    std::shared_ptr<ConferencePeerConnectionChannel> pcc;
+    pcc.swap(next_pcc_);
+    const Request& request = requests_[next_++];
+    std::shared_ptr<RemoteStream> stream = request.first;
+    auto client = client_.lock();
+    if (!client || !stream) {
+      Failed(stream, std::unique_ptr<Exception>(new Exception(
+                         ExceptionType::kConferenceInvalidParam,
+                         client ? "Remote stream cannot be nullptr."
+                                : "Conference client is destroyed.")));
+      return;
+    }
+    auto that = shared_from_this();
+    client->SubscribeWithChannel(
+        stream, request.second, pcc,
+        [that, stream](std::shared_ptr<ConferenceSubscription> subscription) {
+          that->event_queue_->PostTask([that, stream, subscription]() {
+            if (that->on_subscribed_)
+              that->on_subscribed_(stream, subscription);
+            that->Done();
+          });
+        },
+        [that, stream](std::unique_ptr<Exception> exception) {
+          ExceptionType type = exception->Type();
+          std::string message = exception->Message();
+          that->event_queue_->PostTask([that, stream, type, message]() {
+            that->Failed(stream, std::unique_ptr<Exception>(
+                                     new Exception(type, message)));
+          });
+        });
+    PrepareNext(client.get());
+  }
+  // Creates the channel of the next request.
+  void PrepareNext(ConferenceClient* client) {
+    if (next_ >= requests_.size())
+      return;
+    const Request& request = requests_[next_];
+    if (!request.first)
+      return;
+#ifdef OWT_ENABLE_QUIC
+    if (request.first->DataEnabled())
+      return;
+#endif
+    next_pcc_ = client->CreateSubscribeChannel(request.second);
+  }
+  void Failed(std::shared_ptr<RemoteStream> stream,
+              std::unique_ptr<Exception> exception) {
+    if (on_failed_)
+      on_failed_(stream, std::move(exception));
+    Done();
+  }
+  void Done() {
+    if (++completed_ < requests_.size()) {
+      Next();
+      return;
+    }
+    RTC_LOG(LS_INFO) << requests_.size() << " subscriptions completed in "
+                     << rtc::TimeMillis() - start_time_ms_ << " ms.";
+    if (on_complete_)
+      on_complete_();
+  }
+
+  std::weak_ptr<ConferenceClient> client_;
+  std::shared_ptr<rtc::TaskQueue> event_queue_;
+  const std::vector<Request> requests_;
+  std::function<void(std::shared_ptr<RemoteStream>,
+                     std::shared_ptr<ConferenceSubscription>)>
+      on_subscribed_;
+  std::function<void(std::shared_ptr<RemoteStream>,
+                     std::unique_ptr<Exception>)>
+      on_failed_;
+  std::function<void()> on_complete_;
+  const int64_t start_time_ms_;
+  size_t next_ = 0;
+  size_t completed_ = 0;
+  // Channel created for |requests_[next_]|.
+  std::shared_ptr<ConferencePeerConnectionChannel> next_pcc_;
+};
 void Participant::AddObserver(ParticipantObserver& observer) {
   const std::lock_guard<std::mutex> lock(observer_mutex_);
   std::vector<std::reference_wrapper<ParticipantObserver>>::iterator it =
@@ -177,7 +362,8 @@ std::shared_ptr<ConferenceClient> ConferenceClient::Create(
 ConferenceClient::ConferenceClient(
     const ConferenceClientConfiguration& configuration)
     : configuration_(configuration),
-      signaling_channel_(new ConferenceSocketSignalingChannel()),
+      memory_account_(std::make_shared<MemoryAccount>()),
+      signaling_channel_(new ConferenceSocketSignalingChannel(memory_account_)),
       signaling_channel_connected_(false) {
   auto task_queue_factory_ = webrtc::CreateDefaultTaskQueueFactory();
   event_queue_ =
@@ -342,6 +528,14 @@ void ConferenceClient::InitializeQuicClientIfSupported(const std::string& token_
 void ConferenceClient::CreateSendStream(
     std::function<void(std::shared_ptr<owt::base::LocalStream>)> on_success,
     std::function<void(std::unique_ptr<Exception>)> on_failure) {
+  CreateSendStream(owt::base::QuicStreamFramingMode::kRaw, on_success,
+                   on_failure);
+}
+
+void ConferenceClient::CreateSendStream(
+    owt::base::QuicStreamFramingMode framing_mode,
+    std::function<void(std::shared_ptr<owt::base::LocalStream>)> on_success,
+    std::function<void(std::unique_ptr<Exception>)> on_failure) {
   if (!on_success) {
     RTC_LOG(LS_WARNING) << "No success callback provided. Do nothing.";
     return;
@@ -358,7 +552,8 @@ void ConferenceClient::CreateSendStream(
     return;
   }
 
-  web_transport_channel_->CreateSendStream(on_success, on_failure);
+  web_transport_channel_->CreateSendStream(framing_mode, on_success,
+                                           on_failure);
 }
 #endif
 
@@ -609,7 +804,7 @@ void ConferenceClient::Publish(
   }
   std::shared_ptr<ConferencePeerConnectionChannel> pcc(
       new ConferencePeerConnectionChannel(config, signaling_channel_,
-                                          event_queue_));
+                                          event_queue_, memory_account_));
   pcc->AddObserver(*this);
   {
     std::lock_guard<std::mutex> lock(publish_pcs_mutex_);
@@ -643,6 +838,29 @@ void ConferenceClient::Subscribe(
     const SubscribeOptions& options,
     std::function<void(std::shared_ptr<ConferenceSubscription>)> on_success,
     std::function<void(std::unique_ptr<Exception>)> on_failure) {
+  SubscribeWithChannel(stream, options, nullptr, on_success, on_failure);
+}
+std::shared_ptr<ConferencePeerConnectionChannel>
+ConferenceClient::CreateSubscribeChannel(const SubscribeOptions& options) {
+  // Reorder SDP according to perference list.
+  PeerConnectionChannelConfiguration config =
+      GetPeerConnectionChannelConfiguration();
+  for (auto codec : options.video.codecs) {
+    config.video.push_back(VideoEncodingParameters(codec, 0, false));
+  }
+  for (auto codec : options.audio.codecs) {
+    config.audio.push_back(AudioEncodingParameters(codec, 0));
+  }
+  return std::shared_ptr<ConferencePeerConnectionChannel>(
+      new ConferencePeerConnectionChannel(config, signaling_channel_,
+                                          event_queue_, memory_account_));
+}
+void ConferenceClient::SubscribeWithChannel(
+    std::shared_ptr<RemoteStream> stream,
+    const SubscribeOptions& options,
+    std::shared_ptr<ConferencePeerConnectionChannel> pcc,
+    std::function<void(std::shared_ptr<ConferenceSubscription>)> on_success,
+    std::function<void(std::unique_ptr<Exception>)> on_failure) {
   if (!CheckSignalingChannelOnline(on_failure)) {
     return;
   }
@@ -750,18 +968,8 @@ void ConferenceClient::Subscribe(
       return;
     }
   }
-  // Reorder SDP according to perference list.
-  PeerConnectionChannelConfiguration config =
-      GetPeerConnectionChannelConfiguration();
-  for (auto codec : options.video.codecs) {
-    config.video.push_back(VideoEncodingParameters(codec, 0, false));
-  }
-  for (auto codec : options.audio.codecs) {
-    config.audio.push_back(AudioEncodingParameters(codec, 0));
-  }
-  std::shared_ptr<ConferencePeerConnectionChannel> pcc(
-      new ConferencePeerConnectionChannel(config, signaling_channel_,
-                                          event_queue_));
+  if (!pcc)
+    pcc = CreateSubscribeChannel(options);
   pcc->AddObserver(*this);
   {
     std::lock_guard<std::mutex> lock(subscribe_pcs_mutex_);
@@ -769,9 +977,12 @@ void ConferenceClient::Subscribe(
   }
   std::weak_ptr<ConferenceClient> weak_this = shared_from_this();
   std::string stream_id = stream->Id();
+  PublicationSettings settings = stream->Settings();
+  VideoSubscriptionConstraints video_constraints = options.video;
   pcc->Subscribe(
       stream, options,
-      [on_success, weak_this, stream_id](std::string session_id) {
+      [on_success, weak_this, stream_id, settings,
+       video_constraints](std::string session_id) {
         auto that = weak_this.lock();
         if (!that)
           return;
@@ -779,11 +990,34 @@ void ConferenceClient::Subscribe(
         if (on_success != nullptr) {
           std::shared_ptr<ConferenceSubscription> cp(
               new ConferenceSubscription(that, session_id, stream_id));
+          if (video_constraints.adaptive_layer_selection &&
+              !video_constraints.disabled) {
+            cp->StartLayerAdaptation(settings, video_constraints);
+          }
           on_success(cp);
         }
       },
       on_failure);
 }
+void ConferenceClient::SubscribeMany(
+    const std::vector<std::pair<std::shared_ptr<RemoteStream>,
+                                SubscribeOptions>>& requests,
+    size_t max_concurrency,
+    std::function<void(std::shared_ptr<RemoteStream>,
+                       std::shared_ptr<ConferenceSubscription>)> on_subscribed,
+    std::function<void(std::shared_ptr<RemoteStream>,
+                       std::unique_ptr<Exception>)> on_failed,
+    std::function<void()> on_complete) {
+  if (requests.empty()) {
+    if (on_complete)
+      event_queue_->PostTask(on_complete);
+    return;
+  }
+  auto queue = std::make_shared<SubscribeQueue>(
+      shared_from_this(), event_queue_, requests, on_subscribed, on_failed,
+      on_complete);
+  queue->Start(max_concurrency);
+}
 void ConferenceClient::UnPublish(
     const std::string& session_id,
     std::function<void()> on_success,
@@ -903,22 +1137,85 @@ void ConferenceClient::Send(
   signaling_channel_->SendCustomMessage(
       message, receiver, RunInEventQueue(on_success), on_failure);
 }
+void ConferenceClient::UpdateSubscriptions(
+    const std::vector<std::pair<std::shared_ptr<ConferenceSubscription>,
+                                SubscriptionUpdateOptions>>& updates,
+    std::function<void()> on_success,
+    std::function<void(std::unique_ptr<Exception>)> on_failure) {
+  if (updates.empty()) {
+    if (on_success)
+      event_queue_->PostTask(on_success);
+    return;
+  }
+  // Requests only wait for their own acks, so all of them are in flight at
+  // the same time.
+  auto completion =
+      std::make_shared<BatchCompletion>(updates.size(), on_success, on_failure);
+  for (const auto& update : updates) {
+    if (!update.first) {
+      auto on_null = completion->Failure();
+      event_queue_->PostTask(
+          [on_null]() { on_null(NullSubscriptionException()); });
+      continue;
+    }
+    update.first->ApplyOptions(update.second, completion->Success(),
+                               completion->Failure());
+  }
+}
+void ConferenceClient::MuteSubscriptions(
+    const std::vector<std::shared_ptr<ConferenceSubscription>>& subscriptions,
+    TrackKind track_kind,
+    std::function<void()> on_success,
+    std::function<void(std::unique_ptr<Exception>)> on_failure) {
+  if (subscriptions.empty()) {
+    if (on_success)
+      event_queue_->PostTask(on_success);
+    return;
+  }
+  auto completion = std::make_shared<BatchCompletion>(
+      subscriptions.size(), on_success, on_failure);
+  for (const auto& subscription : subscriptions) {
+    if (!subscription) {
+      auto on_null = completion->Failure();
+      event_queue_->PostTask(
+          [on_null]() { on_null(NullSubscriptionException()); });
+      continue;
+    }
+    subscription->Mute(track_kind, completion->Success(),
+                       completion->Failure());
+  }
+}
+void ConferenceClient::UnmuteSubscriptions(
+    const std::vector<std::shared_ptr<ConferenceSubscription>>& subscriptions,
+    TrackKind track_kind,
+    std::function<void()> on_success,
+    std::function<void(std::unique_ptr<Exception>)> on_failure) {
+  if (subscriptions.empty()) {
+    if (on_success)
+      event_queue_->PostTask(on_success);
+    return;
+  }
+  auto completion = std::make_shared<BatchCompletion>(
+      subscriptions.size(), on_success, on_failure);
+  for (const auto& subscription : subscriptions) {
+    if (!subscription) {
+      auto on_null = completion->Failure();
+      event_queue_->PostTask(
+          [on_null]() { on_null(NullSubscriptionException()); });
+      continue;
+    }
+    subscription->Unmute(track_kind, completion->Success(),
+                         completion->Failure());
+  }
+}
 void ConferenceClient::UpdateSubscription(
     const std::string& session_id,
     const std::string& stream_id,
     const SubscriptionUpdateOptions& option,
     std::function<void()> on_success,
     std::function<void(std::unique_ptr<Exception>)> on_failure) {
+  // |on_failure| is invoked by CheckSignalingChannelOnline, only once.
   if (!CheckSignalingChannelOnline(on_failure)) {
-    if (on_failure) {
-      event_queue_->PostTask([on_failure]() {
-        std::unique_ptr<Exception> e(
-            new Exception(ExceptionType::kConferenceUnknown,
-                          "Signaling channel stopped. Unable to send "
-                          "subscription update to server"));
-        on_failure(std::move(e));
-      });
-    }
     return;
   }
   sio::message::ptr update_message = sio::object_message::create();
@@ -953,6 +1250,10 @@ void ConferenceClient::UpdateSubscription(
   sio::message::ptr video_update = sio::object_message::create();
   video_update->get_map()["parameters"] = video_params;
   video_update->get_map()["from"] = sio::string_message::create(stream_id);
+  if (!option.video.rid.empty()) {
+    video_update->get_map()["simulcastRid"] =
+        sio::string_message::create(option.video.rid);
+  }
   update_option->get_map()["video"] = video_update;
   update_message->get_map()["data"] = update_option;
   signaling_channel_->SendSubscriptionUpdateMessage(update_message, on_success,
@@ -1105,6 +1406,27 @@ void ConferenceClient::GetConnectionStats(
   pcc->GetConnectionStats(on_success, on_failure);
 }
 
+void ConferenceClient::UpdateEncodings(
+    const std::string& session_id,
+    const std::vector<RtpEncodingParameters>& encodings,
+    std::function<void()> on_success,
+    std::function<void(std::unique_ptr<Exception>)> on_failure) {
+  auto pcc = GetConferencePeerConnectionChannel(session_id);
+  if (pcc == nullptr) {
+    if (on_failure) {
+      event_queue_->PostTask([on_failure]() {
+        std::unique_ptr<Exception> e(
+            new Exception(ExceptionType::kConferenceUnknown,
+                          "Stream is not published."));
+        on_failure(std::move(e));
+      });
+    }
+    RTC_LOG(LS_WARNING) << "Tried to update encodings of unknown stream.";
+    return;
+  }
+  pcc->UpdateEncodings(encodings, on_success, on_failure);
+}
+
 void ConferenceClient::GetStats(
     const std::string& session_id,
     std::function<void(const std::vector<const webrtc::StatsReport*>& reports)>
@@ -1220,11 +1542,92 @@ void ConferenceClient::OnServerDisconnected() {
     (*its).get().OnServerDisconnected();
   }
 }
+void ConferenceClient::OnServerReconnecting() {
+  if (!configuration_.resume_sessions)
+    return;
+  RTC_LOG(LS_INFO) << "Keeping sessions while signaling reconnects.";
+  std::vector<std::shared_ptr<ConferencePeerConnectionChannel>> pccs;
+  {
+    std::lock_guard<std::mutex> lock(publish_pcs_mutex_);
+    pccs.insert(pccs.end(), publish_pcs_.begin(), publish_pcs_.end());
+  }
+  {
+    std::lock_guard<std::mutex> lock(subscribe_pcs_mutex_);
+    pccs.insert(pccs.end(), subscribe_pcs_.begin(), subscribe_pcs_.end());
+  }
+  for (auto& pcc : pccs) {
+    pcc->SuspendSignaling();
+  }
+}
+void ConferenceClient::OnServerReconnected(sio::message::ptr room_info) {
+  if (!configuration_.resume_sessions)
+    return;
+  // Publication IDs are stream IDs in the room, and subscriptions are keyed
+  // by their source stream. Without room info, e.g. when the ack only has a
+  // reconnection ticket, every session is resumed. A session the server
+  // dropped then ends when the server rejects its ICE restart.
+  std::set<std::string> room_streams;
+  bool has_streams = false;
+  if (room_info && room_info->get_flag() == sio::message::flag_object) {
+    auto streams = room_info->get_map()["streams"];
+    if (streams && streams->get_flag() == sio::message::flag_array) {
+      has_streams = true;
+      for (const auto& stream : streams->get_vector()) {
+        auto id = stream->get_map()["id"];
+        if (id && id->get_flag() == sio::message::flag_string)
+          room_streams.insert(id->get_string());
+      }
+    }
+  }
+  auto in_room = [&](const std::string& stream_id) {
+    return !has_streams || room_streams.count(stream_id) > 0;
+  };
+  std::vector<std::shared_ptr<ConferencePeerConnectionChannel>> resumed;
+  // Streams of dropped sessions.
+  std::set<std::string> dropped;
+  {
+    std::lock_guard<std::mutex> lock(publish_pcs_mutex_);
+    for (auto& pcc : publish_pcs_) {
+      if (in_room(pcc->GetSessionId()))
+        resumed.push_back(pcc);
+      else
+        dropped.insert(pcc->GetSessionId());
+    }
+  }
+  {
+    std::lock_guard<std::mutex> lock(subscribe_pcs_mutex_);
+    for (auto& pcc : subscribe_pcs_) {
+      auto it = subscribe_id_label_map_.find(pcc->GetSessionId());
+      if (it == subscribe_id_label_map_.end() || in_room(it->second))
+        resumed.push_back(pcc);
+      else
+        dropped.insert(it->second);
+    }
+  }
+  RTC_LOG(LS_INFO) << "Resumed " << resumed.size() << " sessions, "
+                   << dropped.size() << " streams dropped by server.";
+  for (auto& pcc : resumed) {
+    pcc->ResumeSignaling();
+  }
+  // Their removal was notified while signaling was down. Replay it, so the
+  // publications and subscriptions of these streams end, and only them.
+  for (const auto& id : dropped) {
+    TriggerOnStreamRemoved(id);
+  }
+}
 void ConferenceClient::OnStreamError(
     std::shared_ptr<Stream> stream,
     std::shared_ptr<const Exception> exception) {
   TriggerOnStreamError(stream, exception);
 }
+void ConferenceClient::OnSessionDropped(const std::string& session_id) {
+  RTC_LOG(LS_INFO) << "Session " << session_id << " was dropped by server.";
+  const std::lock_guard<std::mutex> lock(stream_update_observer_mutex_);
+  for (auto its = stream_update_observers_.begin();
+       its != stream_update_observers_.end(); ++its) {
+    (*its).get().OnSessionEnded(session_id);
+  }
+}
 void ConferenceClient::OnStreamId(const std::string& id,
                                   const std::string& publish_stream_label) {
   {
@@ -1756,6 +2159,27 @@ bool ConferenceClient::ParseUser(sio::message::ptr user_message,
   *participant = new Participant(id, role, user_name);
   return true;
 }
+ClientMemoryReport ConferenceClient::GetMemoryReport() const {
+  ClientMemoryReport report;
+  report.client = memory_account_->Report();
+  {
+    std::lock_guard<std::mutex> lock(subscribe_pcs_mutex_);
+    for (const auto& pcc : subscribe_pcs_) {
+      std::string session_id = pcc->GetSessionId();
+      if (!session_id.empty())
+        report.channels[session_id] = pcc->GetMemoryReport();
+    }
+  }
+  {
+    std::lock_guard<std::mutex> lock(publish_pcs_mutex_);
+    for (const auto& pcc : publish_pcs_) {
+      std::string session_id = pcc->GetSessionId();
+      if (!session_id.empty())
+        report.channels[session_id] = pcc->GetMemoryReport();
+    }
+  }
+  return report;
+}
 std::shared_ptr<ConferencePeerConnectionChannel>
 ConferenceClient::GetConferencePeerConnectionChannel(
     const std::string& session_id) const {
@@ -1818,17 +2242,23 @@ void ConferenceClient::OnUserLeft(std::shared_ptr<sio::message> user) {
 }
 void ConferenceClient::TriggerOnStreamRemoved(sio::message::ptr stream_info) {
   std::string id = stream_info->get_map()["id"]->get_string();
-  auto stream_it = added_streams_.find(id);
-  auto stream_type = added_stream_type_.find(id);
-  if (stream_it == added_streams_.end() ||
-      stream_type == added_stream_type_.end()) {
+  if (added_streams_.find(id) == added_streams_.end() ||
+      added_stream_type_.find(id) == added_stream_type_.end()) {
     RTC_LOG(LS_WARNING) << "Invalid stream or type.";
     return;
   }
-  added_streams_.erase(stream_it);
-  added_stream_type_.erase(stream_type);
-  current_conference_info_->TriggerOnStreamEnded(id);
-  current_conference_info_->RemoveStreamById(id);
+  TriggerOnStreamRemoved(id);
+}
+void ConferenceClient::TriggerOnStreamRemoved(const std::string& id) {
+  auto stream_it = added_streams_.find(id);
+  auto stream_type = added_stream_type_.find(id);
+  if (stream_it != added_streams_.end() &&
+      stream_type != added_stream_type_.end()) {
+    added_streams_.erase(stream_it);
+    added_stream_type_.erase(stream_type);
+    current_conference_info_->TriggerOnStreamEnded(id);
+    current_conference_info_->RemoveStreamById(id);
+  }
   const std::lock_guard<std::mutex> lock(stream_update_observer_mutex_);
   for (auto its = stream_update_observers_.begin();
        its != stream_update_observers_.end(); ++its) {
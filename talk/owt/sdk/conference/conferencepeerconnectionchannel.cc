@@ -5,11 +5,15 @@
 #include <future>
 #include <thread>
 #include <vector>
+#include "talk/owt/sdk/base/encodedframeforwarder.h"
+#include "talk/owt/sdk/base/framelatencytracer.h"
 #include "talk/owt/sdk/base/functionalobserver.h"
 #include "talk/owt/sdk/base/mediautils.h"
 #include "talk/owt/sdk/base/peerconnectiondependencyfactory.h"
+#include "talk/owt/sdk/base/rtpencodingsettings.h"
 #include "talk/owt/sdk/base/sdputils.h"
 #include "talk/owt/sdk/include/cpp/owt/conference/remotemixedstream.h"
+#include "webrtc/api/rtp_parameters.h"
 #include "webrtc/rtc_base/logging.h"
 #include "webrtc/rtc_base/task_queue.h"
 #include "webrtc/system_wrappers/include/field_trial.h"
@@ -61,15 +65,20 @@ const string kIceCandidateSdpNameKey = "candidate";
 ConferencePeerConnectionChannel::ConferencePeerConnectionChannel(
     PeerConnectionChannelConfiguration& configuration,
     std::shared_ptr<ConferenceSocketSignalingChannel> signaling_channel,
-    std::shared_ptr<rtc::TaskQueue> event_queue)
+    std::shared_ptr<rtc::TaskQueue> event_queue,
+    std::shared_ptr<MemoryAccount> client_memory_account)
     : PeerConnectionChannel(configuration),
       signaling_channel_(signaling_channel),
       session_id_(""),
+      ice_candidates_bytes_(0),
       ice_restart_needed_(false),
+      signaling_suspended_(false),
+      resume_offer_pending_(false),
       connected_(false),
       sub_stream_added_(false),
       sub_server_ready_(false),
-      event_queue_(event_queue) {
+      event_queue_(event_queue),
+      memory_account_(std::make_shared<MemoryAccount>(client_memory_account)) {
   InitializePeerConnection();
   RTC_CHECK(signaling_channel_);
 }
@@ -117,6 +126,10 @@ void ConferencePeerConnectionChannel::CreateOffer() {
   auto offer_answer_options =
       webrtc::PeerConnectionInterface::RTCOfferAnswerOptions();
   offer_answer_options.use_rtp_mux = !rtp_no_mux;
+  if (FrameLatencyTracer::Enabled()) {
+    // Lets the receiver correlate frames with the sender's capture clock.
+    OfferVideoHeaderExtension(webrtc::RtpExtension::kAbsoluteCaptureTimeUri);
+  }
   peer_connection_->CreateOffer(observer.get(), offer_answer_options);
 }
 
@@ -131,8 +144,25 @@ void ConferencePeerConnectionChannel::DoIceRestart() {
   RTC_LOG(LS_INFO) << "ICE restart";
   RTC_DCHECK(SignalingState() ==
              webrtc::PeerConnectionInterface::SignalingState::kStable);
+  // Without this the next offer keeps current ICE credentials.
+  peer_connection_->RestartIce();
   this->CreateOffer();
 }
+void ConferencePeerConnectionChannel::SuspendSignaling() {
+  signaling_suspended_ = true;
+}
+void ConferencePeerConnectionChannel::ResumeSignaling() {
+  if (!signaling_suspended_.exchange(false))
+    return;
+  auto state = peer_connection_->ice_connection_state();
+  if (state == webrtc::PeerConnectionInterface::kIceConnectionFailed ||
+      state == webrtc::PeerConnectionInterface::kIceConnectionDisconnected) {
+    RTC_LOG(LS_INFO) << "Transport of " << session_id_
+                     << " was lost during signaling outage.";
+    resume_offer_pending_ = true;
+    IceRestart();
+  }
+}
 
 void ConferencePeerConnectionChannel::CreateAnswer() {
   RTC_LOG(LS_INFO) << "Create answer.";
@@ -161,6 +191,9 @@ void ConferencePeerConnectionChannel::OnSignalingChange(
       {
         std::lock_guard<std::mutex> lock(candidates_mutex_);
         ice_candidates_.clear();
+        memory_account_->Release(MemoryCategory::kPendingCandidates,
+                                 ice_candidates_bytes_);
+        ice_candidates_bytes_ = 0;
       }
       DoIceRestart();
     } else {
@@ -209,6 +242,11 @@ void ConferencePeerConnectionChannel::OnIceConnectionChange(
     connected_ = true;
   } else if (new_state ==
              webrtc::PeerConnectionInterface::kIceConnectionFailed) {
+    if (signaling_suspended_) {
+      // ICE is restarted in ResumeSignaling() instead.
+      RTC_LOG(LS_WARNING) << "ICE failed while signaling is reconnecting.";
+      return;
+    }
     // TODO(jianlin): Change trigger condition back to kIceConnectionClosed
     // once conference server re-enables IceRestart and client supports it as well.
     if (connected_) {
@@ -252,7 +290,11 @@ void ConferencePeerConnectionChannel::OnIceCandidate(
       webrtc::PeerConnectionInterface::SignalingState::kStable) {
     signaling_channel_->SendSdp(message, nullptr, nullptr);
   } else {
+    size_t size = ConferenceSocketSignalingChannel::MessageSize(message);
+    std::lock_guard<std::mutex> lock(candidates_mutex_);
     ice_candidates_.push_back(message);
+    ice_candidates_bytes_ += size;
+    memory_account_->Add(MemoryCategory::kPendingCandidates, size);
   }
 }
 void ConferencePeerConnectionChannel::OnIceCandidatesRemoved(
@@ -336,7 +378,30 @@ void ConferencePeerConnectionChannel::OnSetLocalSessionDescriptionSuccess() {
   sdp_message->get_map()["type"] = sio::string_message::create(desc->type());
   sdp_message->get_map()["sdp"] = sio::string_message::create(sdp);
   message->get_map()["signaling"] = sdp_message;
-  signaling_channel_->SendSdp(message, nullptr, nullptr);
+  std::function<void(std::unique_ptr<Exception>)> on_failure;
+  if (resume_offer_pending_.exchange(false)) {
+    // Server rejects the offer if it dropped the session while signaling was
+    // down. Only this session ends then.
+    std::weak_ptr<ConferencePeerConnectionChannel> weak_this =
+        shared_from_this();
+    on_failure = [weak_this](std::unique_ptr<Exception> e) {
+      auto that = weak_this.lock();
+      if (!that)
+        return;
+      RTC_LOG(LS_WARNING) << "Server rejected ICE restart of "
+                          << that->GetSessionId() << ": " << e->Message();
+      std::vector<
+          std::reference_wrapper<ConferencePeerConnectionChannelObserver>>
+          observers;
+      {
+        const std::lock_guard<std::mutex> lock(that->observers_mutex_);
+        observers = that->observers_;
+      }
+      for (auto& observer : observers)
+        observer.get().OnSessionDropped(that->GetSessionId());
+    };
+  }
+  signaling_channel_->SendSdp(message, nullptr, on_failure);
 }
 void ConferencePeerConnectionChannel::OnSetLocalSessionDescriptionFailure(
     const std::string& error) {
@@ -625,7 +690,15 @@ void ConferencePeerConnectionChannel::Subscribe(
   if (stream->has_video_ && !subscribe_options.video.disabled) {
     webrtc::RtpTransceiverInit transceiver_init;
     transceiver_init.direction = webrtc::RtpTransceiverDirection::kRecvOnly;
-    AddTransceiver(cricket::MediaType::MEDIA_TYPE_VIDEO, transceiver_init);
+    auto transceiver =
+        AddTransceiver(cricket::MediaType::MEDIA_TYPE_VIDEO, transceiver_init);
+    if (transceiver && subscribe_options.video.encoded_frame_observer) {
+      // Encoded frames are handed to application before reaching decoder.
+      encoded_frame_forwarder_ = EncodedFrameForwarder::Create(
+          subscribe_options.video.encoded_frame_observer);
+      transceiver->receiver()->SetDepacketizerToDecoderFrameTransformer(
+          encoded_frame_forwarder_);
+    }
     video_track_count = 1;
   }
   sio::message::ptr sio_options = sio::object_message::create();
@@ -844,6 +917,70 @@ void ConferencePeerConnectionChannel::GetConnectionStats(
   }
 }
 
+void ConferencePeerConnectionChannel::UpdateEncodings(
+    const std::vector<RtpEncodingParameters>& encodings,
+    std::function<void()> on_success,
+    std::function<void(std::unique_ptr<Exception>)> on_failure) {
+  auto fail = [this, on_failure](const std::string& message) {
+    RTC_LOG(LS_WARNING) << "Failed to update encodings: " << message;
+    if (on_failure == nullptr)
+      return;
+    event_queue_->PostTask([on_failure, message]() {
+      std::unique_ptr<Exception> e(
+          new Exception(ExceptionType::kConferenceInvalidParam, message));
+      on_failure(std::move(e));
+    });
+  };
+  if (!published_stream_) {
+    fail("No stream published in the session.");
+    return;
+  }
+  rtc::scoped_refptr<webrtc::RtpSenderInterface> video_sender;
+  for (const auto& sender : peer_connection_->GetSenders()) {
+    if (sender->media_type() == cricket::MEDIA_TYPE_VIDEO) {
+      video_sender = sender;
+      break;
+    }
+  }
+  if (!video_sender) {
+    fail("No video published in the session.");
+    return;
+  }
+  webrtc::RtpParameters parameters = video_sender->GetParameters();
+  std::vector<RtpEncodingParameters> previous_settings;
+  std::vector<RtpEncodingParameters> settings;
+  {
+    std::lock_guard<std::mutex> lock(encoding_settings_mutex_);
+    if (!configuration_.video.empty())
+      previous_settings = configuration_.video[0].rtp_encoding_parameters;
+  }
+  settings = previous_settings;
+  std::string error;
+  if (!UpdateEncodingSettings(encodings, &parameters, &settings, &error)) {
+    fail(error);
+    return;
+  }
+  // Renegotiation applies the stored settings again, so they are updated
+  // first, and restored if webrtc rejects them.
+  {
+    std::lock_guard<std::mutex> lock(encoding_settings_mutex_);
+    if (configuration_.video.empty())
+      configuration_.video.push_back(VideoEncodingParameters());
+    configuration_.video[0].rtp_encoding_parameters = settings;
+  }
+  webrtc::RTCError result = video_sender->SetParameters(parameters);
+  if (!result.ok()) {
+    {
+      std::lock_guard<std::mutex> lock(encoding_settings_mutex_);
+      configuration_.video[0].rtp_encoding_parameters = previous_settings;
+    }
+    fail(result.message());
+    return;
+  }
+  if (on_success != nullptr)
+    event_queue_->PostTask([on_success]() { on_success(); });
+}
+
 void ConferencePeerConnectionChannel::GetConnectionStats(
     std::function<void(std::shared_ptr<RTCStatsReport>)> on_success,
     std::function<void(std::unique_ptr<Exception>)> on_failure) {
@@ -969,6 +1106,12 @@ void ConferencePeerConnectionChannel::DrainIceCandidates() {
     signaling_channel_->SendSdp(*it, nullptr, nullptr);
   }
   ice_candidates_.clear();
+  memory_account_->Release(MemoryCategory::kPendingCandidates,
+                           ice_candidates_bytes_);
+  ice_candidates_bytes_ = 0;
+}
+MemoryReport ConferencePeerConnectionChannel::GetMemoryReport() const {
+  return memory_account_->Report();
 }
 std::string ConferencePeerConnectionChannel::GetSubStreamId() {
   if (subscribed_stream_) {
@@ -1010,36 +1153,11 @@ void ConferencePeerConnectionChannel::SendPublishMessage(
               webrtc::RtpEncodingParameters param;
               if (encoding.rid != "")
                 param.rid = encoding.rid;
-              if (encoding.max_bitrate_bps != 0)
-                param.max_bitrate_bps = encoding.max_bitrate_bps;
-              if (encoding.max_framerate != 0)
-                param.max_framerate = encoding.max_framerate;
-              if (encoding.scale_resolution_down_by > 0)
-                param.scale_resolution_down_by =
-                    encoding.scale_resolution_down_by;
               if (encoding.num_temporal_layers > 0 &&
                   encoding.num_temporal_layers <= 4) {
                 param.num_temporal_layers = encoding.num_temporal_layers;
               }
-              if (encoding.priority != owt::base::NetworkPriority::kDefault) {
-                switch (encoding.priority) {
-                  case owt::base::NetworkPriority::kVeryLow:
-                    param.network_priority = webrtc::Priority::kVeryLow;
-                    break;
-                  case owt::base::NetworkPriority::kLow:
-                    param.network_priority = webrtc::Priority::kLow;
-                    break;
-                  case owt::base::NetworkPriority::kMedium:
-                    param.network_priority = webrtc::Priority::kMedium;
-                    break;
-                  case owt::base::NetworkPriority::kHigh:
-                    param.network_priority = webrtc::Priority::kHigh;
-                    break;
-                  default:
-                    break;
-                }
-              }
-              param.active = encoding.active;
+              ApplyEncodingSettings(encoding, &param);
               transceiver_init.send_encodings.push_back(param);
             }
           }
@@ -1094,6 +1212,10 @@ void ConferencePeerConnectionChannel::ResetCallbacks() {
 void ConferencePeerConnectionChannel::ClosePeerConnection() {
   RTC_LOG(LS_INFO) << "Close peer connection.";
   std::lock_guard<std::mutex> locker(release_mutex_);
+  if (encoded_frame_forwarder_) {
+    encoded_frame_forwarder_->Detach();
+    encoded_frame_forwarder_ = nullptr;
+  }
   if (peer_connection_) {
     peer_connection_->Close();
     peer_connection_ = nullptr;
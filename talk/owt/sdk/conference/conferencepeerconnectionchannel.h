@@ -3,11 +3,13 @@
 // SPDX-License-Identifier: Apache-2.0
 #ifndef OWT_CONFERENCE_CONFERENCEPEERCONNECTIONCHANNEL_H_
 #define OWT_CONFERENCE_CONFERENCEPEERCONNECTIONCHANNEL_H_
+#include <atomic>
 #include <memory>
 #include <mutex>
 #include <unordered_map>
 #include <chrono>
 #include <random>
+#include "talk/owt/sdk/base/encodedframeforwarder.h"
 #include "talk/owt/sdk/base/peerconnectionchannel.h"
 #include "talk/owt/sdk/conference/conferencesocketsignalingchannel.h"
 #include "talk/owt/sdk/include/cpp/owt/base/stream.h"
@@ -25,7 +27,8 @@ class ConferencePeerConnectionChannel
   explicit ConferencePeerConnectionChannel(
       PeerConnectionChannelConfiguration& configuration,
       std::shared_ptr<ConferenceSocketSignalingChannel> signaling_channel,
-      std::shared_ptr<rtc::TaskQueue> event_queue);
+      std::shared_ptr<rtc::TaskQueue> event_queue,
+      std::shared_ptr<MemoryAccount> client_memory_account = nullptr);
   ~ConferencePeerConnectionChannel();
   // Add a ConferencePeerConnectionChannel observer so it will be notified when
   // this object have some events.
@@ -92,6 +95,13 @@ class ConferencePeerConnectionChannel
       std::function<void(std::unique_ptr<Exception>)> on_failure);
   // Initialize an ICE restarat.
   void IceRestart();
+  // Signaling is reconnecting. An ICE failure until ResumeSignaling() does not
+  // end the session.
+  void SuspendSignaling();
+  // Signaling is back. Restarts ICE if the transport failed or disconnected
+  // while it was down. If server rejects that offer, observers get
+  // OnSessionDropped().
+  void ResumeSignaling();
   // Get the associated stream id if it is a subscription channel.
   std::string GetSubStreamId();
   // Set stream's session ID. This ID is returned by MCU per publish/subscribe.
@@ -110,8 +120,15 @@ class ConferencePeerConnectionChannel
   void GetStats(
       std::function<void(const webrtc::StatsReports& reports)> on_success,
       std::function<void(std::unique_ptr<Exception>)> on_failure);
+  // Applies |encodings| to the published video without renegotiation.
+  void UpdateEncodings(
+      const std::vector<RtpEncodingParameters>& encodings,
+      std::function<void()> on_success,
+      std::function<void(std::unique_ptr<Exception>)> on_failure);
   // Called when MCU reports stream/connection is failed or ICE failed.
   void OnStreamError(const std::string& error_message);
+  // Memory held by this channel's pending candidates.
+  MemoryReport GetMemoryReport() const;
  protected:
   void CreateOffer() override;
   void CreateAnswer() override;
@@ -189,7 +206,13 @@ class ConferencePeerConnectionChannel
   // deep copy.
   std::vector<sio::message::ptr> ice_candidates_;
   std::mutex candidates_mutex_;
+  // Accounted size of |ice_candidates_|.
+  size_t ice_candidates_bytes_;
   bool ice_restart_needed_;
+  std::atomic<bool> signaling_suspended_;
+  // Set when ICE is restarted after signaling resumed, until the offer is
+  // sent.
+  std::atomic<bool> resume_offer_pending_;
   std::mutex observers_mutex_;
   std::vector<std::reference_wrapper<ConferencePeerConnectionChannelObserver>>
       observers_;
@@ -201,6 +224,10 @@ class ConferencePeerConnectionChannel
   // Queue for callbacks and events.
   std::shared_ptr<rtc::TaskQueue> event_queue_;
   std::mutex release_mutex_;
+  // Set when subscription delivers encoded frames instead of decoding them.
+  rtc::scoped_refptr<EncodedFrameForwarder> encoded_frame_forwarder_;
+  // Feeds the client's account.
+  std::shared_ptr<MemoryAccount> memory_account_;
 };
 }
 }
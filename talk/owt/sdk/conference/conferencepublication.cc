@@ -123,6 +123,24 @@ void ConferencePublication::GetNativeStats(
      that->GetStats(id_, on_success, on_failure);
    }
 }
+void ConferencePublication::UpdateEncodings(
+    const std::vector<RtpEncodingParameters>& encodings,
+    std::function<void()> on_success,
+    std::function<void(std::unique_ptr<Exception>)> on_failure) {
+  auto that = conference_client_.lock();
+  if (that == nullptr || ended_) {
+    std::string failure_message("Session ended.");
+    if (on_failure != nullptr && event_queue_.get()) {
+      event_queue_->PostTask([on_failure, failure_message]() {
+        std::unique_ptr<Exception> e(
+            new Exception(ExceptionType::kConferenceUnknown, failure_message));
+        on_failure(std::move(e));
+      });
+    }
+  } else {
+    that->UpdateEncodings(id_, encodings, on_success, on_failure);
+  }
+}
 void ConferencePublication::Stop() {
   auto that = conference_client_.lock();
   if (that == nullptr || ended_) {
@@ -156,6 +174,12 @@ void ConferencePublication::OnStreamRemoved(const std::string& stream_id) {
   Stop();
 }
 
+void ConferencePublication::OnSessionEnded(const std::string& session_id) {
+  if (ended_ || session_id != id_)
+    return;
+  Stop();
+}
+
 void ConferencePublication::OnStreamError(const std::string& error_msg) {
   for (auto its = observers_.begin(); its != observers_.end(); ++its) {
     std::unique_ptr<Exception> e(new Exception(
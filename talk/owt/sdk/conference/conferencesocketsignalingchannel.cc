@@ -9,6 +9,7 @@
 #include <CoreFoundation/CFDate.h>
 #endif
 #include "talk/owt/sdk/base/mediautils.h"
+#include "talk/owt/sdk/base/metricsregistry.h"
 #include "talk/owt/sdk/base/stringutils.h"
 #include "talk/owt/sdk/base/sysinfo.h"
 #include "talk/owt/sdk/conference/conferencesocketsignalingchannel.h"
@@ -65,13 +66,51 @@ const uint64_t kMachLinuxTimeDelta = 978307200;
 #endif
 const int kReconnectionAttempts = 10;
 const int kReconnectionDelay = 2000;
-ConferenceSocketSignalingChannel::ConferenceSocketSignalingChannel()
+namespace {
+owt::base::MetricCounter* MessagesCounter(bool sent) {
+  static owt::base::MetricCounter* sent_messages =
+      owt::base::MetricsRegistry::Get()->Counter(
+          "owt_signaling_messages_total", "Signaling messages.",
+          {{"client", "conference"}, {"direction", "sent"}});
+  static owt::base::MetricCounter* received_messages =
+      owt::base::MetricsRegistry::Get()->Counter(
+          "owt_signaling_messages_total", "Signaling messages.",
+          {{"client", "conference"}, {"direction", "received"}});
+  return sent ? sent_messages : received_messages;
+}
+owt::base::MetricHistogram* RequestDurations() {
+  static owt::base::MetricHistogram* histogram =
+      owt::base::MetricsRegistry::Get()->Histogram(
+          "owt_signaling_request_duration_ms",
+          "Time from sending a signaling message to its acknowledgement.",
+          owt::base::MetricsRegistry::DurationBoundsMs(),
+          {{"client", "conference"}});
+  return histogram;
+}
+owt::base::MetricCounter* ReconnectsCounter(bool attempt) {
+  static owt::base::MetricCounter* attempts =
+      owt::base::MetricsRegistry::Get()->Counter(
+          "owt_signaling_reconnect_attempts_total",
+          "Attempts to reconnect signaling.", {{"client", "conference"}});
+  static owt::base::MetricCounter* reconnects =
+      owt::base::MetricsRegistry::Get()->Counter(
+          "owt_signaling_reconnects_total",
+          "Signaling connections resumed after a loss.",
+          {{"client", "conference"}});
+  return attempt ? attempts : reconnects;
+}
+}  // namespace
+ConferenceSocketSignalingChannel::ConferenceSocketSignalingChannel(
+    std::shared_ptr<owt::base::MemoryAccount> memory_account)
     : socket_client_(new sio::client()),
       reconnection_ticket_(""),
       participant_id_(""),
       reconnection_attempted_(0),
       is_reconnection_(false),
-      outgoing_message_id_(1) {}
+      outgoing_message_id_(1),
+      memory_account_(memory_account
+                          ? memory_account
+                          : std::make_shared<owt::base::MemoryAccount>()) {}
 ConferenceSocketSignalingChannel::~ConferenceSocketSignalingChannel() {
   delete socket_client_;
 }
@@ -162,7 +201,10 @@ void ConferenceSocketSignalingChannel::Connect(
         // It will be reset when a reconnection is success (open listener) or
         // fail (fail listener).
         that->is_reconnection_ = true;
-        that->reconnection_attempted_++;
+        ReconnectsCounter(true)->Increment();
+        if (that->reconnection_attempted_++ == 0) {
+          that->TriggerOnServerReconnecting();
+        }
       }
     }
   });
@@ -269,14 +311,26 @@ void ConferenceSocketSignalingChannel::Connect(
               socket_client_->close();
               return;
             }
-            // The second element is room info, please refer to server's
-            // portal implementation for detailed message format.
+            // The second element is either a new reconnection ticket, or room
+            // info with the ticket in it, please refer to server's portal
+            // implementation for detailed message format.
             sio::message::ptr message = msg.at(1);
+            sio::message::ptr room_info;
             if (message->get_flag() == sio::message::flag_string) {
               OnReconnectionTicket(message->get_string());
+            } else if (message->get_flag() == sio::message::flag_object) {
+              auto ticket = message->get_map()["reconnectionTicket"];
+              if (ticket && ticket->get_flag() == sio::message::flag_string) {
+                OnReconnectionTicket(ticket->get_string());
+              }
+              room_info = message->get_map()["room"];
             }
             RTC_LOG(LS_VERBOSE) << "Reconnection success";
+            is_reconnection_ = false;
+            reconnection_attempted_ = 0;
+            ReconnectsCounter(false)->Increment();
             DrainQueuedMessages();
+            TriggerOnServerReconnected(room_info);
           });
     }
   });
@@ -330,6 +384,7 @@ void ConferenceSocketSignalingChannel::Disconnect(
 void ConferenceSocketSignalingChannel::OnNotificationFromServer(
     const std::string& name,
     sio::message::ptr const& data) {
+  MessagesCounter(false)->Increment();
   if (name == kEventNameStreamMessage) {
     RTC_LOG(LS_VERBOSE) << "Received stream event.";
     if (data->get_map()["status"] != nullptr &&
@@ -754,6 +809,19 @@ void ConferenceSocketSignalingChannel::TriggerOnServerDisconnected() {
     (*it)->OnServerDisconnected();
   }
 }
+void ConferenceSocketSignalingChannel::TriggerOnServerReconnecting() {
+  std::lock_guard<std::mutex> lock(observer_mutex_);
+  for (auto it = observers_.begin(); it != observers_.end(); ++it) {
+    (*it)->OnServerReconnecting();
+  }
+}
+void ConferenceSocketSignalingChannel::TriggerOnServerReconnected(
+    sio::message::ptr room_info) {
+  std::lock_guard<std::mutex> lock(observer_mutex_);
+  for (auto it = observers_.begin(); it != observers_.end(); ++it) {
+    (*it)->OnServerReconnected(room_info);
+  }
+}
 void ConferenceSocketSignalingChannel::Emit(
     const std::string& name,
     const sio::message::list& message,
@@ -761,10 +829,18 @@ void ConferenceSocketSignalingChannel::Emit(
     const std::function<void(std::unique_ptr<Exception>)>
         on_failure) {
   int message_id(0);
+  size_t bytes = name.size();
+  for (size_t i = 0; i < message.size(); i++)
+    bytes += MessageSize(message.at(i));
   {
+    // Acks of earlier messages pop |outgoing_messages_| on Socket.IO's
+    // thread while requests are pipelined.
     std::lock_guard<std::mutex> lock(outgoing_message_mutex_);
     message_id = outgoing_message_id_++;
+    outgoing_messages_.emplace_back(message_id, name, message, ack,
+                                    on_failure, bytes);
   }
+  memory_account_->Add(owt::base::MemoryCategory::kPendingMessages, bytes);
 #if 0
   std::string sio_name = "signaling";
   sio::message::ptr request_name = sio::string_message::create(name);
@@ -772,13 +848,15 @@ void ConferenceSocketSignalingChannel::Emit(
   new_message.insert(0, request_name);
 #endif
   // SioMessage sio_message(message_id, sio_name, new_message, ack, on_failure);
-  SioMessage sio_message(message_id, name, message, ack, on_failure);
-  outgoing_messages_.push(sio_message);
   std::weak_ptr<ConferenceSocketSignalingChannel> weak_this =
       shared_from_this();
+  MessagesCounter(true)->Increment();
+  int64_t sent_ms = rtc::TimeMillis();
   socket_client_->socket()->emit(
-      name, message, [weak_this, message_id](sio::message::list const& msg) {
+      name, message,
+      [weak_this, message_id, sent_ms](sio::message::list const& msg) {
         RTC_LOG(LS_INFO) << "Received ack for message ID: " << message_id;
+        RequestDurations()->Observe(rtc::TimeMillis() - sent_ms);
         auto that = weak_this.lock();
         if (!that) {
           RTC_LOG(LS_WARNING) << "Signaling channel was destroyed before ack.";
@@ -787,22 +865,21 @@ void ConferenceSocketSignalingChannel::Emit(
         std::function<void(sio::message::list const&)> callback(nullptr);
         {
           std::lock_guard<std::mutex> lock(that->outgoing_message_mutex_);
-          if (that->outgoing_messages_.empty()) {
-            //RTC_NOTREACHED();
-            return;
-          }
-          /*RTC_DCHECK_EQ(message_id, that->outgoing_messages_.front().id)
-              << "Unordered Socket.IO message.";*/
-          while (that->outgoing_messages_.front().id < message_id) {
-            RTC_LOG(LS_WARNING) << "Potential unordered Socket.IO message.";
-            that->outgoing_messages_.pop();
-          }
-          if (that->outgoing_messages_.front().id > message_id) {
+          // Server may ack pipelined messages out of order.
+          auto it = std::find_if(
+              that->outgoing_messages_.begin(), that->outgoing_messages_.end(),
+              [message_id](const SioMessage& outgoing) {
+                return outgoing.id == message_id;
+              });
+          if (it == that->outgoing_messages_.end()) {
             RTC_LOG(LS_ERROR) << "Original message for " << message_id
-                          << " is not found.";
+                              << " is not found.";
+            return;
           }
-          callback = that->outgoing_messages_.front().ack;
-          that->outgoing_messages_.pop();
+          callback = it->ack;
+          that->memory_account_->Release(
+              owt::base::MemoryCategory::kPendingMessages, it->bytes);
+          that->outgoing_messages_.erase(it);
         }
         if (callback) {
           callback(msg);
@@ -821,15 +898,22 @@ void ConferenceSocketSignalingChannel::DropQueuedMessages() {
           "Failed to delivery message."));
       outgoing_messages_.front().on_failure(std::move(e));
     }
-    outgoing_messages_.pop();
+    memory_account_->Release(owt::base::MemoryCategory::kPendingMessages,
+                             outgoing_messages_.front().bytes);
+    outgoing_messages_.pop_front();
   }
 }
 void ConferenceSocketSignalingChannel::DrainQueuedMessages() {
-  std::queue<SioMessage> temp_queue;
+  std::list<SioMessage> temp_queue;
   {
     std::lock_guard<std::mutex> lock(outgoing_message_mutex_);
     std::swap(temp_queue, outgoing_messages_);
   }
+  // Emit accounts them again.
+  for (const auto& sio_message : temp_queue) {
+    memory_account_->Release(owt::base::MemoryCategory::kPendingMessages,
+                             sio_message.bytes);
+  }
   RTC_LOG(LS_INFO) << "outgoing_messages_ number after swap: "
                << outgoing_messages_.size();
   while (!temp_queue.empty()) {
@@ -838,7 +922,29 @@ void ConferenceSocketSignalingChannel::DrainQueuedMessages() {
     // mutex.
     Emit(sio_message.name, sio_message.message, sio_message.ack,
          sio_message.on_failure);
-    temp_queue.pop();
+    temp_queue.pop_front();
+  }
+}
+size_t ConferenceSocketSignalingChannel::MessageSize(
+    const sio::message::ptr& message) {
+  if (!message)
+    return 0;
+  size_t size = 0;
+  switch (message->get_flag()) {
+    case sio::message::flag_string:
+      return message->get_string().size();
+    case sio::message::flag_binary:
+      return message->get_binary() ? message->get_binary()->size() : 0;
+    case sio::message::flag_array:
+      for (const auto& item : message->get_vector())
+        size += MessageSize(item);
+      return size;
+    case sio::message::flag_object:
+      for (const auto& item : message->get_map())
+        size += item.first.size() + MessageSize(item.second);
+      return size;
+    default:
+      return sizeof(int64_t);
   }
 }
 sio::message::ptr ConferenceSocketSignalingChannel::ResolutionMessage(
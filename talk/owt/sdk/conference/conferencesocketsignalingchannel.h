@@ -5,7 +5,7 @@
 #define conference_ConferenceSocketSignalingChannel_h
 #include <memory>
 #include <future>
-#include <queue>
+#include <list>
 #include <random>
 #include <unordered_map>
 #ifdef __clang__
@@ -18,6 +18,7 @@
 #ifdef __clang__
 #pragma clang diagnostic pop
 #endif
+#include "talk/owt/sdk/base/memoryaccount.h"
 #include "talk/owt/sdk/include/cpp/owt/conference/conferenceclient.h"
 #include "talk/owt/sdk/include/cpp/owt/conference/user.h"
 namespace owt {
@@ -32,7 +33,10 @@ struct SignalingSubscriptionAck {
 class ConferenceSocketSignalingChannel
     : public std::enable_shared_from_this<ConferenceSocketSignalingChannel> {
  public:
-  explicit ConferenceSocketSignalingChannel();
+  // Messages waiting for acks are accounted to |memory_account|, or to a new
+  // account if it is null.
+  explicit ConferenceSocketSignalingChannel(
+      std::shared_ptr<owt::base::MemoryAccount> memory_account = nullptr);
   virtual ~ConferenceSocketSignalingChannel();
   virtual void AddObserver(ConferenceSocketSignalingChannelObserver& observer);
   virtual void RemoveObserver(
@@ -87,6 +91,8 @@ class ConferenceSocketSignalingChannel
   virtual void Disconnect(
       std::function<void()> on_success,
       std::function<void(std::unique_ptr<Exception>)> on_failure);
+  // Payload bytes of |message|, for memory accounting.
+  static size_t MessageSize(const sio::message::ptr& message);
  protected:
   virtual void OnEmitAck(
       sio::message::list const& msg,
@@ -101,17 +107,21 @@ class ConferenceSocketSignalingChannel
         const sio::message::list& message,
         const std::function<void(sio::message::list const&)> ack,
         const std::function<void(std::unique_ptr<Exception>)>
-            on_failure)
+            on_failure,
+        const size_t bytes)
         : id(id),
           name(name),
           message(message),
           ack(ack),
-          on_failure(on_failure){}
+          on_failure(on_failure),
+          bytes(bytes) {}
     const int id;
     const std::string name;
     const sio::message::list message;
     const std::function<void(sio::message::list const&)> ack;
     const std::function<void(std::unique_ptr<Exception>)> on_failure;
+    // Accounted size of |name| and |message|.
+    const size_t bytes;
   };
   /// Fires upon a new ticket is received.
   void OnReconnectionTicket(const std::string& ticket);
@@ -120,6 +130,11 @@ class ConferenceSocketSignalingChannel
                                 sio::message::ptr const& data);
   void RefreshReconnectionTicket();
   void TriggerOnServerDisconnected();
+  // Fired when the first reconnection attempt of an outage starts.
+  void TriggerOnServerReconnecting();
+  // Fired after relogin succeeds. |room_info| is null if the server only
+  // returned a new ticket.
+  void TriggerOnServerReconnected(sio::message::ptr room_info);
   void Emit(const std::string& name,
             const sio::message::list& message,
             const std::function<void(sio::message::list const&)> ack,
@@ -144,9 +159,10 @@ class ConferenceSocketSignalingChannel
   bool is_reconnection_;
   // Messages may be lost if during Socket.IO reconnection. We maintain a
   // message queue here so we can emit un-acked messages after connected.
-  std::queue<SioMessage> outgoing_messages_;
+  std::list<SioMessage> outgoing_messages_;
   int outgoing_message_id_;
   std::mutex outgoing_message_mutex_;
+  std::shared_ptr<owt::base::MemoryAccount> memory_account_;
   std::string quic_transport_id_;
 };
 }
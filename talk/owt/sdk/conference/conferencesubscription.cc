@@ -6,6 +6,7 @@
 #include "webrtc/rtc_base/logging.h"
 #include "webrtc/rtc_base/task_queue.h"
 #include "talk/owt/sdk/base/stringutils.h"
+#include "talk/owt/sdk/conference/subscriptionlayeradapter.h"
 #include "talk/owt/sdk/include/cpp/owt/conference/conferenceclient.h"
 #include "talk/owt/sdk/include/cpp/owt/conference/conferencesubscription.h"
 
@@ -26,6 +27,8 @@ ConferenceSubscription::ConferenceSubscription(std::shared_ptr<ConferenceClient>
   }
 }
 ConferenceSubscription::~ConferenceSubscription() {
+  if (layer_adapter_)
+    layer_adapter_->Stop();
   auto that = conference_client_.lock();
   if (that != nullptr)
     that->RemoveStreamUpdateObserver(*this);
@@ -49,12 +52,13 @@ void ConferenceSubscription::Mute(
     that->Mute(id_, track_kind,
                [on_success, weak_this, track_kind]() {
                  auto that_cs = weak_this.lock();
-                 if (!that_cs || that_cs->Ended())
-                   return;
-                 for (auto its = that_cs->observers_.begin();
-                      its != that_cs->observers_.end(); ++its) {
-                   (*its).get().OnMute(track_kind);
+                 if (that_cs && !that_cs->Ended()) {
+                   for (auto its = that_cs->observers_.begin();
+                        its != that_cs->observers_.end(); ++its) {
+                     (*its).get().OnMute(track_kind);
+                   }
                  }
+                 // Completes the request even if subscription ended since.
                  if (on_success != nullptr)
                    on_success();
                },
@@ -81,12 +85,13 @@ void ConferenceSubscription::Unmute(
      that->Unmute(id_, track_kind,
        [on_success, weak_this, track_kind]() {
        auto that_cs = weak_this.lock();
-       if (!that_cs || that_cs->Ended())
-         return;
-       for (auto its = that_cs->observers_.begin();
-            its != that_cs->observers_.end(); ++its) {
-         (*its).get().OnUnmute(track_kind);
+       if (that_cs && !that_cs->Ended()) {
+         for (auto its = that_cs->observers_.begin();
+              its != that_cs->observers_.end(); ++its) {
+           (*its).get().OnUnmute(track_kind);
+         }
        }
+       // Completes the request even if subscription ended since.
        if (on_success != nullptr)
          on_success();
      }, on_failure);
@@ -169,11 +174,25 @@ void ConferenceSubscription::GetNativeStats(
      that->GetStats(id_, on_success, on_failure);
    }
 }
+void ConferenceSubscription::SetTargetResolution(const Resolution& target) {
+  if (layer_adapter_ && !ended_)
+    layer_adapter_->SetTargetResolution(target);
+}
+void ConferenceSubscription::StartLayerAdaptation(
+    const PublicationSettings& settings,
+    const VideoSubscriptionConstraints& constraints) {
+  layer_adapter_ = SubscriptionLayerAdapter::Create(
+      shared_from_this(), settings, constraints, event_queue_);
+  if (layer_adapter_)
+    layer_adapter_->Start();
+}
 void ConferenceSubscription::Stop() {
   auto that = conference_client_.lock();
   if (that == nullptr || ended_) {
     return;
   } else {
+    if (layer_adapter_)
+      layer_adapter_->Stop();
     that->UnSubscribe(id_, nullptr, nullptr);
     ended_ = true;
     const std::lock_guard<std::mutex> lock(observer_mutex_);
@@ -201,6 +220,12 @@ void ConferenceSubscription::OnStreamRemoved(const std::string& stream_id) {
   Stop();
 }
 
+void ConferenceSubscription::OnSessionEnded(const std::string& session_id) {
+  if (ended_ || session_id != id_)
+    return;
+  Stop();
+}
+
 void ConferenceSubscription::OnStreamError(const std::string& error_msg) {
   for (auto its = observers_.begin(); its != observers_.end(); ++its) {
     std::unique_ptr<Exception> e(
@@ -458,6 +458,7 @@ void ConferenceWebTransportChannel::OnStreamSessionId(const std::string& session
 }
 
 void ConferenceWebTransportChannel::CreateSendStream(
+    owt::base::QuicStreamFramingMode framing_mode,
     std::function<void(std::shared_ptr<owt::base::LocalStream>)> on_success,
     std::function<void(std::unique_ptr<Exception>)> on_failure) {
   if (!on_success) {
@@ -482,6 +483,7 @@ void ConferenceWebTransportChannel::CreateSendStream(
   std::shared_ptr<owt::base::QuicStream> writable_stream =
       std::make_shared<owt::base::QuicStream>(quic_stream, "0");
   writable_stream->SetVisitor(writable_stream.get());
+  writable_stream->SetFramingMode(framing_mode);
   int error_code = 0;
   on_success(owt::base::LocalStream::Create(writable_stream, error_code));
 }
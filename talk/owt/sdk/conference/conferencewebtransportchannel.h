@@ -85,8 +85,9 @@ class ConferenceWebTransportChannel: public owt::quic::WebTransportClientInterfa
   void Connect();
   // Authenticate the channel.
   void Authenticate();
-  // Create WritableStream
+  // Create WritableStream with |framing_mode|.
   void CreateSendStream(
+      owt::base::QuicStreamFramingMode framing_mode,
       std::function<void(std::shared_ptr<owt::base::LocalStream>)>
           on_success,
       std::function<void(std::unique_ptr<Exception>)> on_failure);
@@ -0,0 +1,216 @@
+// Copyright (C) <2026> Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+#include "talk/owt/sdk/conference/subscriptionlayeradapter.h"
+#include <utility>
+#include "talk/owt/sdk/include/cpp/owt/base/exception.h"
+#include "talk/owt/sdk/include/cpp/owt/conference/conferencesubscription.h"
+#include "webrtc/api/units/time_delta.h"
+#include "webrtc/rtc_base/logging.h"
+#include "webrtc/rtc_base/task_queue.h"
+#include "webrtc/rtc_base/time_utils.h"
+
+namespace owt {
+namespace conference {
+namespace {
+const int kPollIntervalMs = 1000;
+
+uint64_t Pixels(const owt::base::Resolution& resolution) {
+  return static_cast<uint64_t>(resolution.width) * resolution.height;
+}
+}  // namespace
+
+std::shared_ptr<SubscriptionLayerAdapter> SubscriptionLayerAdapter::Create(
+    std::weak_ptr<ConferenceSubscription> subscription,
+    const owt::base::PublicationSettings& settings,
+    const VideoSubscriptionConstraints& constraints,
+    std::shared_ptr<rtc::TaskQueue> event_queue) {
+  std::vector<owt::base::VideoLayer> layers;
+  for (const auto& video : settings.video) {
+    if (video.resolution.width == 0 || video.resolution.height == 0)
+      continue;
+    layers.push_back({video.resolution, video.rid});
+  }
+  if (layers.size() < 2)
+    return nullptr;
+  // Start from the layer subscribed to, which is the largest one by default.
+  size_t initial = 0;
+  for (size_t i = 0; i < layers.size(); i++) {
+    if (!constraints.rid.empty()) {
+      if (layers[i].rid == constraints.rid) {
+        initial = i;
+        break;
+      }
+    } else if (constraints.resolution.width != 0 &&
+               constraints.resolution.height != 0) {
+      if (layers[i].resolution == constraints.resolution) {
+        initial = i;
+        break;
+      }
+    } else if (Pixels(layers[i].resolution) >
+               Pixels(layers[initial].resolution)) {
+      initial = i;
+    }
+  }
+  return std::make_shared<SubscriptionLayerAdapter>(subscription, layers,
+                                                    initial, event_queue);
+}
+
+SubscriptionLayerAdapter::SubscriptionLayerAdapter(
+    std::weak_ptr<ConferenceSubscription> subscription,
+    const std::vector<owt::base::VideoLayer>& layers,
+    size_t initial,
+    std::shared_ptr<rtc::TaskQueue> event_queue)
+    : subscription_(subscription),
+      event_queue_(event_queue),
+      selector_(layers, initial, owt::base::VideoLayerSelector::Config()),
+      stopped_(false),
+      has_last_(false) {}
+
+void SubscriptionLayerAdapter::Start() {
+  SchedulePoll();
+}
+
+void SubscriptionLayerAdapter::Stop() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  stopped_ = true;
+}
+
+void SubscriptionLayerAdapter::SetTargetResolution(
+    const owt::base::Resolution& target) {
+  owt::base::VideoLayer layer;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (stopped_ || !selector_.SetTargetResolution(target))
+      return;
+    layer = selector_.CurrentLayer();
+  }
+  Apply(layer);
+}
+
+void SubscriptionLayerAdapter::SchedulePoll() {
+  if (!event_queue_)
+    return;
+  std::weak_ptr<SubscriptionLayerAdapter> weak_this = shared_from_this();
+  event_queue_->PostDelayedTask(
+      [weak_this] {
+        if (auto that = weak_this.lock())
+          that->Poll();
+      },
+      webrtc::TimeDelta::Millis(kPollIntervalMs));
+}
+
+void SubscriptionLayerAdapter::Poll() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (stopped_)
+      return;
+  }
+  auto subscription = subscription_.lock();
+  if (!subscription || subscription->Ended()) {
+    Stop();
+    return;
+  }
+  std::weak_ptr<SubscriptionLayerAdapter> weak_this = shared_from_this();
+  std::function<void(std::shared_ptr<owt::base::RTCStatsReport>)> on_success =
+      [weak_this](std::shared_ptr<owt::base::RTCStatsReport> report) {
+        if (auto that = weak_this.lock()) {
+          that->OnStats(report);
+          that->SchedulePoll();
+        }
+      };
+  subscription->GetStats(on_success,
+                         [weak_this](std::unique_ptr<Exception> exception) {
+                           RTC_LOG(LS_WARNING)
+                               << "Failed to get subscription stats: "
+                               << exception->Message();
+                           if (auto that = weak_this.lock())
+                             that->SchedulePoll();
+                         });
+}
+
+void SubscriptionLayerAdapter::OnStats(
+    std::shared_ptr<owt::base::RTCStatsReport> report) {
+  if (!report)
+    return;
+  Counters counters;
+  counters.time_ms = rtc::TimeMillis();
+  for (const owt::base::RTCStats& stats : *report) {
+    if (stats.type == owt::base::RTCStatsType::kInboundRTP) {
+      const auto& inbound =
+          stats.cast_to<owt::base::RTCInboundRTPStreamStats>();
+      if (inbound.kind != "video")
+        continue;
+      counters.packets_received += inbound.packets_received;
+      counters.packets_lost += inbound.packets_lost;
+      counters.frames_decoded += inbound.frames_decoded;
+      counters.total_decode_time += inbound.total_decode_time;
+    } else if (stats.type == owt::base::RTCStatsType::kTrack) {
+      const auto& track = stats.cast_to<owt::base::RTCMediaStreamTrackStats>();
+      if (track.kind != "video" || !track.remote_source)
+        continue;
+      counters.frames_received += track.frames_received;
+      counters.frames_dropped += track.frames_dropped;
+    }
+  }
+
+  owt::base::VideoLayer layer;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (stopped_)
+      return;
+    const Counters last = last_;
+    const bool has_last = has_last_;
+    last_ = counters;
+    has_last_ = true;
+    const int64_t elapsed_ms = counters.time_ms - last.time_ms;
+    if (!has_last || elapsed_ms <= 0)
+      return;
+    owt::base::VideoLayerSample sample;
+    sample.time_ms = counters.time_ms;
+    const int64_t received = counters.packets_received - last.packets_received;
+    const int64_t lost = counters.packets_lost - last.packets_lost;
+    if (received + lost > 0 && lost > 0)
+      sample.loss_fraction = static_cast<double>(lost) / (received + lost);
+    const uint32_t decoded = counters.frames_decoded - last.frames_decoded;
+    if (decoded > 0) {
+      sample.frames_per_second = decoded * 1000.0 / elapsed_ms;
+      sample.decode_ms_per_frame =
+          (counters.total_decode_time - last.total_decode_time) * 1000 /
+          decoded;
+    }
+    const uint32_t frames = counters.frames_received - last.frames_received;
+    if (frames > 0) {
+      sample.frame_drop_fraction =
+          static_cast<double>(counters.frames_dropped - last.frames_dropped) /
+          frames;
+    }
+    if (!selector_.OnSample(sample))
+      return;
+    layer = selector_.CurrentLayer();
+  }
+  Apply(layer);
+}
+
+void SubscriptionLayerAdapter::Apply(const owt::base::VideoLayer& layer) {
+  auto subscription = subscription_.lock();
+  if (!subscription || subscription->Ended())
+    return;
+  RTC_LOG(LS_INFO) << "Switching subscription " << subscription->Id()
+                   << " to " << layer.resolution.width << "x"
+                   << layer.resolution.height << " rid " << layer.rid;
+  // Simulcast layers are selected by rid. Layers without one, e.g. from a
+  // transcoding room, are selected by resolution.
+  SubscriptionUpdateOptions options;
+  if (!layer.rid.empty())
+    options.video.rid = layer.rid;
+  else
+    options.video.resolution = layer.resolution;
+  subscription->ApplyOptions(
+      options, nullptr, [](std::unique_ptr<Exception> exception) {
+        RTC_LOG(LS_WARNING) << "Failed to switch simulcast layer: "
+                            << exception->Message();
+      });
+}
+}  // namespace conference
+}  // namespace owt
@@ -0,0 +1,64 @@
+// Copyright (C) <2026> Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef OWT_CONFERENCE_SUBSCRIPTIONLAYERADAPTER_H_
+#define OWT_CONFERENCE_SUBSCRIPTIONLAYERADAPTER_H_
+#include <memory>
+#include <mutex>
+#include <vector>
+#include "talk/owt/sdk/base/videolayerselector.h"
+#include "talk/owt/sdk/include/cpp/owt/base/connectionstats.h"
+#include "talk/owt/sdk/include/cpp/owt/base/options.h"
+#include "talk/owt/sdk/include/cpp/owt/conference/subscribeoptions.h"
+namespace rtc {
+class TaskQueue;
+}
+namespace owt {
+namespace conference {
+class ConferenceSubscription;
+// Polls the stats of a subscription to a simulcast stream and switches the
+// subscription between layers chosen by a VideoLayerSelector.
+class SubscriptionLayerAdapter
+    : public std::enable_shared_from_this<SubscriptionLayerAdapter> {
+ public:
+  // Returns nullptr if the stream published less than two video layers.
+  static std::shared_ptr<SubscriptionLayerAdapter> Create(
+      std::weak_ptr<ConferenceSubscription> subscription,
+      const owt::base::PublicationSettings& settings,
+      const VideoSubscriptionConstraints& constraints,
+      std::shared_ptr<rtc::TaskQueue> event_queue);
+  SubscriptionLayerAdapter(std::weak_ptr<ConferenceSubscription> subscription,
+                           const std::vector<owt::base::VideoLayer>& layers,
+                           size_t initial,
+                           std::shared_ptr<rtc::TaskQueue> event_queue);
+  void Start();
+  void Stop();
+  void SetTargetResolution(const owt::base::Resolution& target);
+
+ private:
+  // Cumulative counters of a stats report.
+  struct Counters {
+    int64_t time_ms = 0;
+    int64_t packets_received = 0;
+    int64_t packets_lost = 0;
+    uint32_t frames_decoded = 0;
+    double total_decode_time = 0;
+    uint32_t frames_received = 0;
+    uint32_t frames_dropped = 0;
+  };
+  void SchedulePoll();
+  void Poll();
+  void OnStats(std::shared_ptr<owt::base::RTCStatsReport> report);
+  void Apply(const owt::base::VideoLayer& layer);
+
+  std::weak_ptr<ConferenceSubscription> subscription_;
+  std::shared_ptr<rtc::TaskQueue> event_queue_;
+  std::mutex mutex_;
+  owt::base::VideoLayerSelector selector_;
+  bool stopped_;
+  bool has_last_;
+  Counters last_;
+};
+}  // namespace conference
+}  // namespace owt
+#endif  // OWT_CONFERENCE_SUBSCRIPTIONLAYERADAPTER_H_
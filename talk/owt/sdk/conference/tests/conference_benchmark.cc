@@ -0,0 +1,392 @@
+// Copyright (C) <2026> Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+
+// Drives N ConferenceClients against an in-process FakeConferenceServer and
+// reports join latency, publish latency, subscribe latency, time until every
+// client subscribed to every remote stream, and throughput of text messages
+// fanned out by the server.
+//
+// Subscribe latency of a stream is counted from the start of its client's
+// SubscribeMany call, so with --subscribe_concurrency it includes the time
+// spent waiting for a free slot.
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include "absl/flags/flag.h"
+#include "absl/flags/parse.h"
+#include "owt/base/framegeneratorinterface.h"
+#include "owt/base/globalconfiguration.h"
+#include "owt/base/localcamerastreamparameters.h"
+#include "owt/base/stream.h"
+#include "owt/conference/conferenceclient.h"
+#include "owt/conference/conferencepublication.h"
+#include "owt/conference/conferencesubscription.h"
+#include "talk/owt/sdk/conference/tests/fake_conference_server.h"
+#include "third_party/webrtc/rtc_base/event.h"
+#include "third_party/webrtc/rtc_base/logging.h"
+#include "third_party/webrtc/rtc_base/time_utils.h"
+
+ABSL_FLAG(int, clients, 8, "Number of conference clients.");
+ABSL_FLAG(int, publishers, 2, "Number of clients publishing a stream.");
+ABSL_FLAG(int,
+          subscribe_concurrency,
+          0,
+          "Subscriptions in progress per client. 0 subscribes all at once.");
+ABSL_FLAG(int, messages, 1000, "Text messages broadcast by the first client.");
+ABSL_FLAG(int, width, 320, "Width of synthetic video.");
+ABSL_FLAG(int, height, 240, "Height of synthetic video.");
+ABSL_FLAG(int, fps, 15, "Frame rate of synthetic video.");
+ABSL_FLAG(bool, audio, false, "Publish synthetic audio along with video.");
+ABSL_FLAG(int, setup_timeout_s, 30, "Seconds to wait for each phase.");
+
+namespace owt {
+namespace conference {
+namespace test {
+namespace {
+// I420 gradient moving every frame, so encoders have work to do.
+class GradientFrameGenerator : public owt::base::VideoFrameGeneratorInterface {
+ public:
+  GradientFrameGenerator(int width, int height, int fps)
+      : width_(width), height_(height), fps_(fps) {}
+  uint32_t GenerateNextFrame(uint8_t* buffer,
+                             const uint32_t capacity) override {
+    uint32_t size = GetNextFrameSize();
+    if (capacity < size)
+      return 0;
+    for (int row = 0; row < height_; row++) {
+      for (int col = 0; col < width_; col++)
+        buffer[row * width_ + col] =
+            static_cast<uint8_t>(row + col + frame_ * 4);
+    }
+    memset(buffer + width_ * height_, 128, size - width_ * height_);
+    frame_++;
+    return size;
+  }
+  uint32_t GetNextFrameSize() override {
+    return width_ * height_ + 2 * ((width_ + 1) / 2) * ((height_ + 1) / 2);
+  }
+  int GetHeight() override { return height_; }
+  int GetWidth() override { return width_; }
+  int GetFps() override { return fps_; }
+  VideoFrameCodec GetType() override { return VideoFrameCodec::I420; }
+
+ private:
+  const int width_;
+  const int height_;
+  const int fps_;
+  int frame_ = 0;
+};
+
+// 48 kHz mono 440 Hz tone.
+class ToneAudioGenerator : public owt::base::AudioFrameGeneratorInterface {
+ public:
+  uint32_t GenerateFramesForNext10Ms(uint8_t* buffer,
+                                     const uint32_t capacity) override {
+    const int samples = kSampleRate / 100;
+    if (capacity < samples * sizeof(int16_t))
+      return 0;
+    int16_t* pcm = reinterpret_cast<int16_t*>(buffer);
+    for (int i = 0; i < samples; i++, sample_++) {
+      pcm[i] = static_cast<int16_t>(
+          8000 * std::sin(2 * 3.14159265358979 * 440 * sample_ / kSampleRate));
+    }
+    return samples * sizeof(int16_t);
+  }
+  int GetSampleRate() override { return kSampleRate; }
+  int GetChannelNumber() override { return 1; }
+
+ private:
+  static const int kSampleRate = 48000;
+  int64_t sample_ = 0;
+};
+
+struct Client : public ConferenceClientObserver {
+  void OnStreamAdded(std::shared_ptr<RemoteStream> stream) override {
+    std::lock_guard<std::mutex> lock(mutex);
+    streams.push_back(stream);
+  }
+  void OnMessageReceived(std::string& message,
+                         std::string& sender_id,
+                         std::string& to) override {
+    if (++messages == expected_messages)
+      last_message_ms = rtc::TimeMillis();
+  }
+  // Streams published by other clients.
+  std::vector<std::shared_ptr<RemoteStream>> RemoteStreams() {
+    std::lock_guard<std::mutex> lock(mutex);
+    std::vector<std::shared_ptr<RemoteStream>> remote;
+    for (const auto& stream : streams) {
+      if (stream->Origin() != participant_id)
+        remote.push_back(stream);
+    }
+    return remote;
+  }
+
+  std::shared_ptr<ConferenceClient> client;
+  std::string participant_id;
+  std::atomic<int64_t> joined_ms{-1};
+  std::shared_ptr<owt::base::LocalStream> local_stream;
+  std::atomic<int64_t> published_ms{-1};
+  std::mutex mutex;
+  std::vector<std::shared_ptr<RemoteStream>> streams;
+  std::vector<std::shared_ptr<ConferenceSubscription>> subscriptions;
+  std::vector<double> subscribe_ms;
+  int subscribe_failures = 0;
+  std::atomic<int64_t> all_subscribed_ms{-1};
+  std::atomic<int> messages{0};
+  int expected_messages = 0;
+  std::atomic<int64_t> last_message_ms{-1};
+};
+
+double Percentile(std::vector<double> values, double quantile) {
+  if (values.empty())
+    return 0;
+  std::sort(values.begin(), values.end());
+  size_t index = static_cast<size_t>(std::ceil(quantile * values.size()));
+  return values[std::min(values.size() - 1, index > 0 ? index - 1 : 0)];
+}
+
+void PrintResult(const char* name, double value, const char* unit) {
+  printf("RESULT %s: conference_benchmark= %.2f %s\n", name, value, unit);
+}
+
+// Waits until |done| returns true. Returns false on timeout.
+bool WaitFor(std::function<bool()> done) {
+  rtc::Event wait;
+  int64_t deadline_ms =
+      rtc::TimeMillis() + absl::GetFlag(FLAGS_setup_timeout_s) * 1000;
+  while (!done()) {
+    if (rtc::TimeMillis() > deadline_ms)
+      return false;
+    wait.Wait(10);
+  }
+  return true;
+}
+
+int RunBenchmark() {
+  const int client_count = absl::GetFlag(FLAGS_clients);
+  const int publishers =
+      std::min(absl::GetFlag(FLAGS_publishers), client_count);
+  const int message_count = absl::GetFlag(FLAGS_messages);
+  const int width = absl::GetFlag(FLAGS_width);
+  const int height = absl::GetFlag(FLAGS_height);
+  const int fps = absl::GetFlag(FLAGS_fps);
+  const bool audio = absl::GetFlag(FLAGS_audio);
+  if (audio) {
+    owt::base::GlobalConfiguration::SetCustomizedAudioInputEnabled(
+        true, std::make_unique<ToneAudioGenerator>());
+  }
+  FakeConferenceServer server;
+  if (!server.Start()) {
+    RTC_LOG(LS_ERROR) << "Failed to start conference server.";
+    return 1;
+  }
+
+  ConferenceClientConfiguration configuration;
+  std::vector<std::unique_ptr<Client>> clients;
+  int64_t join_start_ms = rtc::TimeMillis();
+  for (int i = 0; i < client_count; i++) {
+    auto client = std::make_unique<Client>();
+    Client* raw_client = client.get();
+    client->client = ConferenceClient::Create(configuration);
+    client->client->AddObserver(*client);
+    client->client->Join(
+        server.CreateToken("user" + std::to_string(i)),
+        [raw_client](std::shared_ptr<ConferenceInfo> info) {
+          {
+            std::lock_guard<std::mutex> lock(raw_client->mutex);
+            raw_client->participant_id = info->Self()->Id();
+          }
+          raw_client->joined_ms = rtc::TimeMillis();
+        },
+        [](std::unique_ptr<Exception> e) {
+          RTC_LOG(LS_ERROR) << "Join failed: " << e->Message();
+        });
+    clients.push_back(std::move(client));
+  }
+  auto count = [&clients](std::function<bool(Client*)> predicate) {
+    int matched = 0;
+    for (auto& client : clients)
+      matched += predicate(client.get()) ? 1 : 0;
+    return matched;
+  };
+  bool ok = WaitFor([&] {
+    return count([](Client* c) { return c->joined_ms >= 0; }) == client_count;
+  });
+  std::vector<double> join_ms;
+  for (auto& client : clients) {
+    if (client->joined_ms >= 0)
+      join_ms.push_back(client->joined_ms - join_start_ms);
+  }
+
+  std::vector<double> publish_ms;
+  if (ok) {
+    int64_t publish_start_ms = rtc::TimeMillis();
+    for (int i = 0; i < publishers; i++) {
+      Client* client = clients[i].get();
+      auto parameters =
+          std::make_shared<owt::base::LocalCustomizedStreamParameters>(audio,
+                                                                       true);
+      parameters->Resolution(width, height);
+      parameters->Fps(fps);
+      client->local_stream = owt::base::LocalStream::Create(
+          parameters,
+          std::make_unique<GradientFrameGenerator>(width, height, fps));
+      client->client->Publish(
+          client->local_stream,
+          [client](std::shared_ptr<ConferencePublication>) {
+            client->published_ms = rtc::TimeMillis();
+          },
+          [](std::unique_ptr<Exception> e) {
+            RTC_LOG(LS_ERROR) << "Publish failed: " << e->Message();
+          });
+    }
+    // Publishers see the streams of other publishers only.
+    ok = WaitFor([&] {
+      return count([](Client* c) { return c->published_ms >= 0; }) ==
+                 publishers &&
+             count([publishers](Client* c) {
+               return static_cast<int>(c->RemoteStreams().size()) >=
+                      publishers - (c->local_stream ? 1 : 0);
+             }) == client_count;
+    });
+    for (auto& client : clients) {
+      if (client->published_ms >= 0)
+        publish_ms.push_back(client->published_ms - publish_start_ms);
+    }
+  }
+
+  int expected_subscriptions = 0;
+  int64_t subscribe_start_ms = rtc::TimeMillis();
+  if (ok) {
+    for (auto& client : clients) {
+      Client* raw_client = client.get();
+      std::vector<std::pair<std::shared_ptr<RemoteStream>, SubscribeOptions>>
+          requests;
+      for (const auto& stream : client->RemoteStreams()) {
+        SubscribeOptions options;
+        options.audio.disabled = !audio;
+        requests.emplace_back(stream, options);
+      }
+      expected_subscriptions += static_cast<int>(requests.size());
+      client->client->SubscribeMany(
+          requests, absl::GetFlag(FLAGS_subscribe_concurrency),
+          [raw_client, subscribe_start_ms](
+              std::shared_ptr<RemoteStream>,
+              std::shared_ptr<ConferenceSubscription> subscription) {
+            std::lock_guard<std::mutex> lock(raw_client->mutex);
+            raw_client->subscriptions.push_back(subscription);
+            raw_client->subscribe_ms.push_back(rtc::TimeMillis() -
+                                               subscribe_start_ms);
+          },
+          [raw_client](std::shared_ptr<RemoteStream> stream,
+                       std::unique_ptr<Exception> e) {
+            RTC_LOG(LS_ERROR) << "Subscribing " << stream->Id()
+                              << " failed: " << e->Message();
+            std::lock_guard<std::mutex> lock(raw_client->mutex);
+            raw_client->subscribe_failures++;
+          },
+          [raw_client] { raw_client->all_subscribed_ms = rtc::TimeMillis(); });
+    }
+    ok = WaitFor([&] {
+      return count([](Client* c) { return c->all_subscribed_ms >= 0; }) ==
+             client_count;
+    });
+  }
+  std::vector<double> subscribe_ms;
+  double all_subscribed_ms = 0;
+  int subscribed = 0;
+  int subscribe_failures = 0;
+  for (auto& client : clients) {
+    std::lock_guard<std::mutex> lock(client->mutex);
+    subscribe_failures += client->subscribe_failures;
+    subscribe_ms.insert(subscribe_ms.end(), client->subscribe_ms.begin(),
+                        client->subscribe_ms.end());
+    subscribed += static_cast<int>(client->subscriptions.size());
+    if (client->all_subscribed_ms >= 0) {
+      all_subscribed_ms = std::max(
+          all_subscribed_ms,
+          static_cast<double>(client->all_subscribed_ms - subscribe_start_ms));
+    }
+  }
+
+  double message_rate = 0;
+  double message_ms = 0;
+  if (ok && client_count > 1) {
+    for (auto& client : clients)
+      client->expected_messages = message_count;
+    int64_t send_start_ms = rtc::TimeMillis();
+    // Sent without waiting for acknowledgements, as chat bursts are.
+    for (int i = 0; i < message_count; i++) {
+      clients[0]->client->Send("message " + std::to_string(i), nullptr,
+                               [](std::unique_ptr<Exception> e) {
+                                 RTC_LOG(LS_ERROR)
+                                     << "Send failed: " << e->Message();
+                               });
+    }
+    ok = WaitFor([&] {
+      return count([](Client* c) { return c->last_message_ms >= 0; }) ==
+             client_count - 1;
+    });
+    int64_t last_ms = send_start_ms;
+    int delivered = 0;
+    for (auto& client : clients) {
+      delivered += client->messages;
+      last_ms = std::max<int64_t>(last_ms, client->last_message_ms);
+    }
+    message_ms = static_cast<double>(last_ms - send_start_ms);
+    if (message_ms > 0)
+      message_rate = delivered * 1000.0 / message_ms;
+  }
+
+  FakeConferenceServer::Stats stats = server.GetStats();
+  printf(
+      "%d clients, %d publishers, %dx%d@%d%s, %d of %d subscribed, %d "
+      "failed.\n",
+      client_count, publishers, width, height, fps, audio ? " + audio" : "",
+      subscribed, expected_subscriptions, subscribe_failures);
+  PrintResult("join_ms_p50", Percentile(join_ms, 0.5), "ms");
+  PrintResult("join_ms_max", Percentile(join_ms, 1), "ms");
+  PrintResult("publish_ms_p50", Percentile(publish_ms, 0.5), "ms");
+  PrintResult("publish_ms_max", Percentile(publish_ms, 1), "ms");
+  PrintResult("subscribe_ms_p50", Percentile(subscribe_ms, 0.5), "ms");
+  PrintResult("subscribe_ms_p90", Percentile(subscribe_ms, 0.9), "ms");
+  PrintResult("subscribe_ms_max", Percentile(subscribe_ms, 1), "ms");
+  PrintResult("all_subscribed_ms", all_subscribed_ms, "ms");
+  PrintResult("message_fanout_ms", message_ms, "ms");
+  PrintResult("message_throughput", message_rate, "messages/s");
+  PrintResult("server_requests", static_cast<double>(stats.requests),
+              "requests");
+  PrintResult("server_notifications",
+              static_cast<double>(stats.notifications), "notifications");
+  fflush(stdout);
+
+  for (auto& client : clients) {
+    rtc::Event left;
+    client->client->Leave([&left] { left.Set(); },
+                          [&left](std::unique_ptr<Exception>) { left.Set(); });
+    left.Wait(5000);
+    client->client->RemoveObserver(*client);
+  }
+  server.Stop();
+  return ok && subscribed == expected_subscriptions ? 0 : 1;
+}
+}  // namespace
+}  // namespace test
+}  // namespace conference
+}  // namespace owt
+
+int main(int argc, char* argv[]) {
+  absl::ParseCommandLine(argc, argv);
+  rtc::LogMessage::LogToDebug(rtc::LS_WARNING);
+  return owt::conference::test::RunBenchmark();
+}
@@ -0,0 +1,352 @@
+// Copyright (C) <2026> Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+#include "owt/base/framegeneratorinterface.h"
+#include "owt/base/localcamerastreamparameters.h"
+#include "owt/base/stream.h"
+#include "owt/conference/conferenceclient.h"
+#include "owt/conference/conferencepublication.h"
+#include "talk/owt/sdk/conference/tests/fake_conference_server.h"
+#include "testing/gtest/include/gtest/gtest.h"
+#include "third_party/webrtc/rtc_base/event.h"
+#include "third_party/webrtc/rtc_base/time_utils.h"
+
+namespace owt {
+namespace conference {
+namespace test {
+namespace {
+// Publish, relogin and ICE timeouts are all a few seconds, ICE failure up to
+// half a minute.
+const int kTimeoutMs = 60000;
+
+const int kWidth = 320;
+const int kHeight = 240;
+const int kFps = 15;
+
+// Gray I420 frames.
+class GrayFrameGenerator : public owt::base::VideoFrameGeneratorInterface {
+ public:
+  uint32_t GenerateNextFrame(uint8_t* buffer,
+                             const uint32_t capacity) override {
+    uint32_t size = GetNextFrameSize();
+    if (capacity < size)
+      return 0;
+    memset(buffer, 128, size);
+    return size;
+  }
+  uint32_t GetNextFrameSize() override { return kWidth * kHeight * 3 / 2; }
+  int GetHeight() override { return kHeight; }
+  int GetWidth() override { return kWidth; }
+  int GetFps() override { return kFps; }
+  VideoFrameCodec GetType() override { return VideoFrameCodec::I420; }
+};
+
+class PublicationRecorder : public owt::base::PublicationObserver {
+ public:
+  void OnEnded() override { ended = true; }
+  void OnMute(owt::base::TrackKind track_kind) override {}
+  void OnUnmute(owt::base::TrackKind track_kind) override {}
+  void OnError(std::unique_ptr<owt::base::Exception> failure) override {
+    errors++;
+  }
+  std::atomic<bool> ended{false};
+  std::atomic<int> errors{0};
+};
+
+// Waits until |done| returns true. Returns false on timeout.
+bool WaitFor(std::function<bool()> done) {
+  rtc::Event wait;
+  int64_t deadline_ms = rtc::TimeMillis() + kTimeoutMs;
+  while (!done()) {
+    if (rtc::TimeMillis() > deadline_ms)
+      return false;
+    wait.Wait(10);
+  }
+  return true;
+}
+}  // namespace
+
+class ConferenceClientTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    ASSERT_TRUE(server_.Start());
+    client_ = Join("user", nullptr);
+    ASSERT_TRUE(client_);
+  }
+  void TearDown() override {
+    for (const auto& client : {client_, other_client_}) {
+      if (client)
+        client->Leave(nullptr, nullptr);
+    }
+    server_.Stop();
+  }
+  // Returns a client joined as |user|, and sets |*info| to the conference
+  // info it got. Null on failure.
+  std::shared_ptr<ConferenceClient> Join(
+      const std::string& user,
+      std::shared_ptr<ConferenceInfo>* info) {
+    ConferenceClientConfiguration configuration;
+    configuration.resume_sessions = true;
+    auto client = ConferenceClient::Create(configuration);
+    std::mutex mutex;
+    std::shared_ptr<ConferenceInfo> joined_info;
+    client->Join(
+        server_.CreateToken(user),
+        [&](std::shared_ptr<ConferenceInfo> result) {
+          std::lock_guard<std::mutex> lock(mutex);
+          joined_info = result;
+        },
+        [](std::unique_ptr<owt::base::Exception> e) {
+          ADD_FAILURE() << "Join failed: " << e->Message();
+        });
+    bool joined = WaitFor([&] {
+      std::lock_guard<std::mutex> lock(mutex);
+      return joined_info != nullptr;
+    });
+    if (!joined)
+      return nullptr;
+    if (info)
+      *info = joined_info;
+    return client;
+  }
+  std::shared_ptr<ConferencePublication> Publish(
+      PublicationRecorder* recorder) {
+    auto parameters =
+        std::make_shared<owt::base::LocalCustomizedStreamParameters>(false,
+                                                                     true);
+    parameters->Resolution(kWidth, kHeight);
+    parameters->Fps(kFps);
+    auto stream = owt::base::LocalStream::Create(
+        parameters, std::make_unique<GrayFrameGenerator>());
+    streams_.push_back(stream);
+    std::mutex mutex;
+    std::shared_ptr<ConferencePublication> publication;
+    client_->Publish(
+        stream,
+        [&](std::shared_ptr<ConferencePublication> result) {
+          std::lock_guard<std::mutex> lock(mutex);
+          publication = result;
+        },
+        [](std::unique_ptr<owt::base::Exception> e) {
+          ADD_FAILURE() << "Publish failed: " << e->Message();
+        });
+    bool published = WaitFor([&] {
+      std::lock_guard<std::mutex> lock(mutex);
+      return publication != nullptr;
+    });
+    if (published)
+      publication->AddObserver(*recorder);
+    return published ? publication : nullptr;
+  }
+
+  FakeConferenceServer server_;
+  std::shared_ptr<ConferenceClient> client_;
+  // Second participant of tests that need one.
+  std::shared_ptr<ConferenceClient> other_client_;
+  std::vector<std::shared_ptr<owt::base::LocalStream>> streams_;
+};
+
+class ConferenceReconnectionTest : public ConferenceClientTest {
+ protected:
+  // Publishes two streams, and has the server drop one of them during an
+  // outage of signaling and media. After relogin, the dropped one must end
+  // and the other one restart ICE and keep going.
+  void RunOutageWithDroppedSession() {
+    PublicationRecorder kept_recorder;
+    PublicationRecorder dropped_recorder;
+    auto kept = Publish(&kept_recorder);
+    auto dropped = Publish(&dropped_recorder);
+    ASSERT_TRUE(kept && dropped);
+    ASSERT_TRUE(WaitFor(
+        [this] { return server_.GetStats().connected_sessions == 2; }));
+
+    // Signaling and media go down together. The server ends |dropped| while
+    // the client cannot hear about it.
+    server_.SetSignalingBlocked(true);
+    server_.SetMediaBlocked(true);
+    server_.DropConnections({dropped->Id()});
+    // The transport fails while signaling is still down. The server's ICE
+    // times out like the client's.
+    ASSERT_TRUE(
+        WaitFor([this] { return server_.GetStats().failed_sessions == 1; }));
+    EXPECT_FALSE(kept_recorder.ended);
+    EXPECT_FALSE(dropped_recorder.ended);
+
+    // After relogin, the session the server dropped ends, and the other one
+    // restarts ICE, which succeeds once media flows again.
+    server_.SetSignalingBlocked(false);
+    ASSERT_TRUE(WaitFor([&] { return dropped_recorder.ended.load(); }));
+    ASSERT_TRUE(
+        WaitFor([this] { return server_.GetStats().ice_restarts >= 1; }));
+    server_.SetMediaBlocked(false);
+    ASSERT_TRUE(WaitFor(
+        [this] { return server_.GetStats().connected_sessions == 1; }));
+    FakeConferenceServer::Stats stats = server_.GetStats();
+    EXPECT_EQ(1, stats.publications);
+    EXPECT_FALSE(kept_recorder.ended);
+    EXPECT_EQ(0, kept_recorder.errors);
+    EXPECT_EQ(0, dropped_recorder.errors);
+    kept->RemoveObserver(kept_recorder);
+    dropped->RemoveObserver(dropped_recorder);
+  }
+};
+
+class ConferenceSubscribeManyTest : public ConferenceClientTest {
+ protected:
+  // Results of SubscribeMany in the order they were reported.
+  struct Results {
+    std::mutex mutex;
+    std::vector<std::shared_ptr<owt::base::RemoteStream>> subscribed;
+    std::vector<std::shared_ptr<owt::base::RemoteStream>> failed;
+    bool completed = false;
+    // Whether any result was reported after completion, or on the thread
+    // that called SubscribeMany.
+    bool reported_after_completion = false;
+    bool reported_on_caller_thread = false;
+  };
+
+  // Publishes |count| streams from |client_| and returns them as
+  // |other_client_| sees them.
+  std::vector<std::shared_ptr<owt::base::RemoteStream>> PublishStreams(
+      size_t count) {
+    for (size_t i = 0; i < count; i++) {
+      auto publication = Publish(&recorder_);
+      if (!publication)
+        return {};
+      publications_.push_back(publication);
+    }
+    if (!WaitFor([this, count] {
+          return server_.GetStats().connected_sessions ==
+                 static_cast<int>(count);
+        })) {
+      return {};
+    }
+    std::shared_ptr<ConferenceInfo> info;
+    other_client_ = Join("subscriber", &info);
+    if (!other_client_)
+      return {};
+    return info->RemoteStreams();
+  }
+
+  void SubscribeMany(
+      const std::vector<std::shared_ptr<owt::base::RemoteStream>>& streams,
+      size_t max_concurrency,
+      Results* results) {
+    std::vector<std::pair<std::shared_ptr<owt::base::RemoteStream>,
+                          SubscribeOptions>>
+        requests;
+    for (const auto& stream : streams)
+      requests.push_back(std::make_pair(stream, SubscribeOptions()));
+    std::thread::id caller = std::this_thread::get_id();
+    auto reported = [results, caller]() {
+      if (results->completed)
+        results->reported_after_completion = true;
+      if (std::this_thread::get_id() == caller)
+        results->reported_on_caller_thread = true;
+    };
+    other_client_->SubscribeMany(
+        requests, max_concurrency,
+        [results, reported](std::shared_ptr<owt::base::RemoteStream> stream,
+                            std::shared_ptr<ConferenceSubscription>) {
+          std::lock_guard<std::mutex> lock(results->mutex);
+          reported();
+          results->subscribed.push_back(stream);
+        },
+        [results, reported](std::shared_ptr<owt::base::RemoteStream> stream,
+                            std::unique_ptr<owt::base::Exception>) {
+          std::lock_guard<std::mutex> lock(results->mutex);
+          reported();
+          results->failed.push_back(stream);
+        },
+        [results, reported]() {
+          std::lock_guard<std::mutex> lock(results->mutex);
+          reported();
+          results->completed = true;
+        });
+  }
+
+  PublicationRecorder recorder_;
+  std::vector<std::shared_ptr<ConferencePublication>> publications_;
+};
+
+TEST_F(ConferenceReconnectionTest, RestartsFailedSessionsAndEndsDropped) {
+  // Relogin ack lists the streams of the room.
+  RunOutageWithDroppedSession();
+}
+
+TEST_F(ConferenceReconnectionTest, EndsDroppedSessionWithTicketOnlyRelogin) {
+  // Relogin ack is the ticket only, so the client learns about the dropped
+  // session from the rejected ICE restart.
+  server_.SetReloginRoomInfo(false);
+  RunOutageWithDroppedSession();
+}
+
+TEST_F(ConferenceSubscribeManyTest, LimitsSubscriptionsInFlight) {
+  auto streams = PublishStreams(3);
+  ASSERT_EQ(3u, streams.size());
+  // The null request fails, and the next one takes its place.
+  std::vector<std::shared_ptr<owt::base::RemoteStream>> requests = {
+      streams[0], nullptr, streams[1], streams[2]};
+  server_.SetSubscriptionsHeld(true);
+  Results results;
+  SubscribeMany(requests, 2, &results);
+  ASSERT_TRUE(WaitFor(
+      [this] { return server_.GetStats().held_subscriptions == 2; }));
+  // No further request is sent while two are in flight.
+  rtc::Event().Wait(1000);
+  EXPECT_EQ(2, server_.GetStats().held_subscriptions);
+  {
+    std::lock_guard<std::mutex> lock(results.mutex);
+    EXPECT_TRUE(results.subscribed.empty());
+    EXPECT_EQ(1u, results.failed.size());
+    EXPECT_FALSE(results.completed);
+  }
+
+  server_.SetSubscriptionsHeld(false);
+  ASSERT_TRUE(WaitFor([&results] {
+    std::lock_guard<std::mutex> lock(results.mutex);
+    return results.completed;
+  }));
+  std::lock_guard<std::mutex> lock(results.mutex);
+  // Each stream is reported once.
+  EXPECT_EQ(3u, results.subscribed.size());
+  for (const auto& stream : streams) {
+    EXPECT_EQ(1, std::count(results.subscribed.begin(),
+                            results.subscribed.end(), stream));
+  }
+  ASSERT_EQ(1u, results.failed.size());
+  EXPECT_EQ(nullptr, results.failed[0]);
+  EXPECT_FALSE(results.reported_after_completion);
+  EXPECT_FALSE(results.reported_on_caller_thread);
+  EXPECT_EQ(3, server_.GetStats().subscriptions);
+}
+
+TEST_F(ConferenceSubscribeManyTest, SubscribesInRequestOrder) {
+  auto streams = PublishStreams(3);
+  ASSERT_EQ(3u, streams.size());
+  Results results;
+  SubscribeMany(streams, 1, &results);
+  ASSERT_TRUE(WaitFor([&results] {
+    std::lock_guard<std::mutex> lock(results.mutex);
+    return results.completed;
+  }));
+  std::lock_guard<std::mutex> lock(results.mutex);
+  EXPECT_EQ(streams, results.subscribed);
+  EXPECT_TRUE(results.failed.empty());
+  EXPECT_FALSE(results.reported_after_completion);
+  EXPECT_FALSE(results.reported_on_caller_thread);
+}
+}  // namespace test
+}  // namespace conference
+}  // namespace owt
@@ -0,0 +1,976 @@
+// Copyright (C) <2026> Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "talk/owt/sdk/conference/tests/fake_conference_server.h"
+#include <algorithm>
+#include <cctype>
+#include "third_party/webrtc/api/audio_codecs/builtin_audio_decoder_factory.h"
+#include "third_party/webrtc/api/audio_codecs/builtin_audio_encoder_factory.h"
+#include "third_party/webrtc/api/create_peerconnection_factory.h"
+#include "third_party/webrtc/api/jsep.h"
+#include "third_party/webrtc/api/task_queue/default_task_queue_factory.h"
+#include "third_party/webrtc/api/video_codecs/builtin_video_decoder_factory.h"
+#include "third_party/webrtc/api/video_codecs/builtin_video_encoder_factory.h"
+#include "third_party/webrtc/modules/audio_device/include/test_audio_device.h"
+#include "third_party/webrtc/pc/session_description.h"
+#include "third_party/webrtc/rtc_base/logging.h"
+#include "third_party/webrtc/rtc_base/ref_counted_object.h"
+#include "third_party/webrtc/rtc_base/third_party/base64/base64.h"
+#include "third_party/webrtc/rtc_base/time_utils.h"
+
+namespace owt {
+namespace conference {
+namespace test {
+namespace {
+const char kRoomId[] = "fake-room";
+const char kRole[] = "presenter";
+// How long a participant whose connection is lost can relogin.
+const int kReconnectionWindowMs = 60000;
+const int kTicketLifetimeMs = 10 * 60000;
+const int kSamplingFrequencyHz = 48000;
+const int16_t kMaxAmplitude = 10000;
+
+Json::Value Ok(const Json::Value& data = Json::Value()) {
+  Json::Value args(Json::arrayValue);
+  args.append("ok");
+  if (!data.isNull())
+    args.append(data);
+  return args;
+}
+
+Json::Value Error(const std::string& reason) {
+  Json::Value args(Json::arrayValue);
+  args.append("error");
+  args.append(reason);
+  return args;
+}
+
+void Reply(const SocketIoServer::Ack& ack, const Json::Value& args) {
+  if (ack)
+    ack(args);
+}
+
+std::string ToLower(std::string value) {
+  std::transform(value.begin(), value.end(), value.begin(),
+                 [](unsigned char c) { return std::tolower(c); });
+  return value;
+}
+
+class RemoteDescriptionCallback
+    : public webrtc::SetRemoteDescriptionObserverInterface {
+ public:
+  explicit RemoteDescriptionCallback(
+      std::function<void(webrtc::RTCError)> callback)
+      : callback_(std::move(callback)) {}
+  void OnSetRemoteDescriptionComplete(webrtc::RTCError error) override {
+    callback_(std::move(error));
+  }
+
+ private:
+  std::function<void(webrtc::RTCError)> callback_;
+};
+
+class LocalDescriptionCallback
+    : public webrtc::SetLocalDescriptionObserverInterface {
+ public:
+  explicit LocalDescriptionCallback(
+      std::function<void(webrtc::RTCError)> callback)
+      : callback_(std::move(callback)) {}
+  void OnSetLocalDescriptionComplete(webrtc::RTCError error) override {
+    callback_(std::move(error));
+  }
+
+ private:
+  std::function<void(webrtc::RTCError)> callback_;
+};
+}  // namespace
+
+// A publication or subscription. Lives on the server thread; PeerConnection
+// callbacks are posted there and dropped if the session is gone by then, so
+// they never refer to the session itself.
+class FakeConferenceServer::Session : public webrtc::PeerConnectionObserver {
+ public:
+  // |from| is the publication a subscription subscribes to, and is empty for
+  // publications. |tracks| are the tracks a subscription sends.
+  Session(FakeConferenceServer* server,
+          const std::string& id,
+          const std::string& owner,
+          const std::string& from,
+          const Json::Value& options,
+          std::vector<rtc::scoped_refptr<webrtc::MediaStreamTrackInterface>>
+              tracks)
+      : server_(server),
+        id_(id),
+        owner_(owner),
+        from_(from),
+        options_(options),
+        tracks_(std::move(tracks)) {}
+  ~Session() override {
+    // No callback is invoked after Close() returns.
+    if (peer_connection_)
+      peer_connection_->Close();
+  }
+  bool Initialize() {
+    peer_connection_ = server_->CreatePeerConnection(this);
+    return peer_connection_ != nullptr;
+  }
+  const std::string& id() const { return id_; }
+  const std::string& owner() const { return owner_; }
+  const std::string& from() const { return from_; }
+  bool is_publication() const { return from_.empty(); }
+  bool ready() const { return ready_; }
+  bool connected() const {
+    return ice_state_ ==
+               webrtc::PeerConnectionInterface::kIceConnectionConnected ||
+           ice_state_ ==
+               webrtc::PeerConnectionInterface::kIceConnectionCompleted;
+  }
+  bool failed() const {
+    return ice_state_ == webrtc::PeerConnectionInterface::kIceConnectionFailed;
+  }
+  // Video tracks received by a publication.
+  const std::vector<rtc::scoped_refptr<webrtc::MediaStreamTrackInterface>>&
+  tracks() const {
+    return tracks_;
+  }
+
+  void OnOffer(const std::string& sdp) {
+    webrtc::SdpParseError error;
+    std::unique_ptr<webrtc::SessionDescriptionInterface> offer =
+        webrtc::CreateSessionDescription(webrtc::SdpType::kOffer, sdp, &error);
+    if (!offer) {
+      RTC_LOG(LS_WARNING) << "Invalid offer for " << id_ << ": "
+                          << error.description;
+      server_->OnSessionFailed(this);
+      return;
+    }
+    const auto& transports = offer->description()->transport_infos();
+    if (!transports.empty()) {
+      const std::string& ufrag = transports[0].description.ice_ufrag;
+      if (!ice_ufrag_.empty() && ufrag != ice_ufrag_)
+        server_->stats_.ice_restarts++;
+      ice_ufrag_ = ufrag;
+    }
+    answer_pending_ = true;
+    peer_connection_->SetRemoteDescription(
+        std::move(offer),
+        rtc::make_ref_counted<RemoteDescriptionCallback>(
+            [server = server_, id = id_](webrtc::RTCError error) {
+              Post(server, id, [error](Session* session) {
+                session->OnRemoteDescriptionSet(error);
+              });
+            }));
+  }
+
+  void OnCandidate(const Json::Value& candidate) {
+    std::string sdp = candidate["candidate"].asString();
+    // The client prefixes candidates with "a=".
+    if (sdp.compare(0, 2, "a=") == 0)
+      sdp.erase(0, 2);
+    webrtc::SdpParseError error;
+    std::unique_ptr<webrtc::IceCandidateInterface> ice_candidate(
+        webrtc::CreateIceCandidate(candidate["sdpMid"].asString(),
+                                   candidate["sdpMLineIndex"].asInt(), sdp,
+                                   &error));
+    if (!ice_candidate) {
+      RTC_LOG(LS_WARNING) << "Invalid candidate: " << error.description;
+      return;
+    }
+    peer_connection_->AddIceCandidate(
+        std::move(ice_candidate), [](webrtc::RTCError error) {
+          if (!error.ok())
+            RTC_LOG(LS_WARNING) << "Failed to add candidate: "
+                                << error.message();
+        });
+  }
+
+  // Stream info of a publication, as in "stream" notifications.
+  Json::Value StreamInfo() const {
+    Json::Value stream;
+    stream["id"] = id_;
+    stream["type"] = "forward";
+    Json::Value tracks(Json::arrayValue);
+    for (const auto& option : options_["media"]["tracks"]) {
+      std::string type = option["type"].asString();
+      Json::Value track;
+      track["type"] = type;
+      track["source"] = option["source"];
+      webrtc::RtpCodecParameters codec;
+      for (const auto& transceiver : peer_connection_->GetTransceivers()) {
+        auto codecs = transceiver->receiver()->GetParameters().codecs;
+        if (transceiver->mid() == option["mid"].asString() && !codecs.empty())
+          codec = codecs[0];
+      }
+      Json::Value format;
+      format["codec"] = ToLower(codec.name);
+      if (type == "audio") {
+        format["sampleRate"] = codec.clock_rate.value_or(kSamplingFrequencyHz);
+        format["channelNum"] = codec.num_channels.value_or(2);
+      }
+      track["format"] = format;
+      tracks.append(track);
+    }
+    stream["media"]["tracks"] = tracks;
+    Json::Value info;
+    info["owner"] = owner_;
+    info["type"] = "webrtc";
+    info["attributes"] = options_["attributes"].isObject()
+                             ? options_["attributes"]
+                             : Json::Value(Json::objectValue);
+    info["inViews"] = Json::Value(Json::arrayValue);
+    stream["info"] = info;
+    return stream;
+  }
+
+  // webrtc::PeerConnectionObserver, on the signaling thread.
+  void OnSignalingChange(
+      webrtc::PeerConnectionInterface::SignalingState new_state) override {}
+  void OnDataChannel(
+      rtc::scoped_refptr<webrtc::DataChannelInterface> channel) override {}
+  void OnIceCandidate(const webrtc::IceCandidateInterface* candidate) override {
+  }
+  void OnIceGatheringChange(
+      webrtc::PeerConnectionInterface::IceGatheringState new_state) override {
+    if (new_state != webrtc::PeerConnectionInterface::kIceGatheringComplete)
+      return;
+    PostToServer([](Session* session) {
+      if (session->answer_pending_ && session->local_description_set_)
+        session->SendAnswer();
+    });
+  }
+  void OnIceConnectionChange(
+      webrtc::PeerConnectionInterface::IceConnectionState new_state) override {
+    PostToServer(
+        [new_state](Session* session) { session->ice_state_ = new_state; });
+    if (new_state == webrtc::PeerConnectionInterface::kIceConnectionConnected) {
+      PostToServer([](Session* session) {
+        if (session->ready_)
+          return;
+        session->ready_ = true;
+        session->server_->OnSessionReady(session);
+      });
+    } else if (new_state ==
+               webrtc::PeerConnectionInterface::kIceConnectionFailed) {
+      PostToServer(
+          [](Session* session) { session->server_->OnSessionFailed(session); });
+    }
+  }
+  void OnTrack(rtc::scoped_refptr<webrtc::RtpTransceiverInterface>
+                   transceiver) override {
+    rtc::scoped_refptr<webrtc::MediaStreamTrackInterface> track =
+        transceiver->receiver()->track();
+    if (!is_publication() ||
+        track->kind() != webrtc::MediaStreamTrackInterface::kVideoKind) {
+      return;
+    }
+    PostToServer(
+        [track](Session* session) { session->tracks_.push_back(track); });
+  }
+
+ private:
+  // Runs |task| on the server thread if session |id| still exists by then.
+  static void Post(FakeConferenceServer* server,
+                   const std::string& id,
+                   std::function<void(Session*)> task) {
+    server->thread_->PostTask(
+        webrtc::SafeTask(server->safety_flag_, [server, id, task] {
+          if (Session* session = server->FindSession(id))
+            task(session);
+        }));
+  }
+  void PostToServer(std::function<void(Session*)> task) {
+    Post(server_, id_, std::move(task));
+  }
+
+  void OnRemoteDescriptionSet(webrtc::RTCError error) {
+    if (!error.ok()) {
+      RTC_LOG(LS_WARNING) << "Failed to set offer for " << id_ << ": "
+                          << error.message();
+      server_->OnSessionFailed(this);
+      return;
+    }
+    if (!is_publication()) {
+      // Loopback forwarding: send what the publication receives, under the
+      // publication's ID so the client can tell which stream it is.
+      for (const auto& transceiver : peer_connection_->GetTransceivers()) {
+        for (const auto& track : tracks_) {
+          if ((transceiver->media_type() == cricket::MEDIA_TYPE_AUDIO) !=
+              (track->kind() == webrtc::MediaStreamTrackInterface::kAudioKind))
+            continue;
+          transceiver->sender()->SetTrack(track.get());
+          transceiver->sender()->SetStreams({from_});
+          transceiver->SetDirectionWithError(
+              webrtc::RtpTransceiverDirection::kSendOnly);
+          break;
+        }
+      }
+    }
+    local_description_set_ = false;
+    peer_connection_->SetLocalDescription(
+        rtc::make_ref_counted<LocalDescriptionCallback>(
+            [server = server_, id = id_](webrtc::RTCError error) {
+              Post(server, id, [error](Session* session) {
+                session->OnLocalDescriptionSet(error);
+              });
+            }));
+  }
+
+  void OnLocalDescriptionSet(webrtc::RTCError error) {
+    if (!error.ok()) {
+      RTC_LOG(LS_WARNING) << "Failed to set answer for " << id_ << ": "
+                          << error.message();
+      server_->OnSessionFailed(this);
+      return;
+    }
+    local_description_set_ = true;
+    // The server does not trickle candidates, so the answer waits for all of
+    // them. An ICE restart clears candidates of the previous answer.
+    const webrtc::SessionDescriptionInterface* answer =
+        peer_connection_->local_description();
+    if (peer_connection_->ice_gathering_state() ==
+            webrtc::PeerConnectionInterface::kIceGatheringComplete &&
+        answer->number_of_mediasections() > 0 &&
+        answer->candidates(0)->count() > 0) {
+      SendAnswer();
+    }
+  }
+
+  void SendAnswer() {
+    answer_pending_ = false;
+    std::string sdp;
+    peer_connection_->local_description()->ToString(&sdp);
+    Json::Value progress;
+    progress["id"] = id_;
+    progress["status"] = "soac";
+    progress["data"]["type"] = "answer";
+    progress["data"]["sdp"] = sdp;
+    auto owner = server_->participants_.find(owner_);
+    if (owner != server_->participants_.end())
+      server_->Notify(owner->second->connection, "progress", progress);
+  }
+
+  FakeConferenceServer* const server_;
+  const std::string id_;
+  const std::string owner_;
+  const std::string from_;
+  const Json::Value options_;
+  std::vector<rtc::scoped_refptr<webrtc::MediaStreamTrackInterface>> tracks_;
+  rtc::scoped_refptr<webrtc::PeerConnectionInterface> peer_connection_;
+  bool answer_pending_ = false;
+  bool local_description_set_ = false;
+  bool ready_ = false;
+  webrtc::PeerConnectionInterface::IceConnectionState ice_state_ =
+      webrtc::PeerConnectionInterface::kIceConnectionNew;
+  // Of the last offer, to tell ICE restarts.
+  std::string ice_ufrag_;
+};
+
+FakeConferenceServer::FakeConferenceServer() = default;
+
+FakeConferenceServer::~FakeConferenceServer() {
+  Stop();
+}
+
+bool FakeConferenceServer::Start() {
+  RTC_CHECK(!thread_);
+  thread_ = rtc::Thread::CreateWithSocketServer();
+  thread_->SetName("fake_conference_server", nullptr);
+  socket_server_ = std::make_unique<rtc::PhysicalSocketServer>();
+  firewall_ = std::make_unique<rtc::FirewallSocketServer>(socket_server_.get());
+  network_thread_ = std::make_unique<rtc::Thread>(firewall_.get());
+  network_thread_->SetName("fake_conference_server_network", nullptr);
+  worker_thread_ = rtc::Thread::Create();
+  worker_thread_->SetName("fake_conference_server_worker", nullptr);
+  signaling_thread_ = rtc::Thread::Create();
+  signaling_thread_->SetName("fake_conference_server_signaling", nullptr);
+  RTC_CHECK(thread_->Start() && network_thread_->Start() &&
+            worker_thread_->Start() && signaling_thread_->Start())
+      << "Failed to start threads";
+  task_queue_factory_ = webrtc::CreateDefaultTaskQueueFactory();
+  rtc::scoped_refptr<webrtc::AudioDeviceModule> adm =
+      worker_thread_->BlockingCall([this] {
+        return webrtc::TestAudioDeviceModule::Create(
+            task_queue_factory_.get(),
+            webrtc::TestAudioDeviceModule::CreatePulsedNoiseCapturer(
+                kMaxAmplitude, kSamplingFrequencyHz),
+            webrtc::TestAudioDeviceModule::CreateDiscardRenderer(
+                kSamplingFrequencyHz));
+      });
+  pc_factory_ = webrtc::CreatePeerConnectionFactory(
+      network_thread_.get(), worker_thread_.get(), signaling_thread_.get(), adm,
+      webrtc::CreateBuiltinAudioEncoderFactory(),
+      webrtc::CreateBuiltinAudioDecoderFactory(),
+      webrtc::CreateBuiltinVideoEncoderFactory(),
+      webrtc::CreateBuiltinVideoDecoderFactory(), nullptr, nullptr);
+  if (!pc_factory_) {
+    RTC_LOG(LS_ERROR) << "Failed to create PeerConnection factory.";
+    return false;
+  }
+  audio_track_ = pc_factory_->CreateAudioTrack(
+      "fake-conference-audio",
+      pc_factory_->CreateAudioSource(cricket::AudioOptions()).get());
+  port_ = thread_->BlockingCall([this] {
+    safety_flag_ = webrtc::PendingTaskSafetyFlag::Create();
+    socketio_server_ = std::make_unique<SocketIoServer>(thread_.get(), this);
+    return socketio_server_->Start();
+  });
+  return port_ != 0;
+}
+
+void FakeConferenceServer::Stop() {
+  if (!thread_)
+    return;
+  thread_->BlockingCall([this] {
+    if (safety_flag_)
+      safety_flag_->SetNotAlive();
+    if (socketio_server_)
+      socketio_server_->Stop();
+    held_subscriptions_.clear();
+    sessions_.clear();
+    participants_.clear();
+    connection_participants_.clear();
+    socketio_server_.reset();
+  });
+  audio_track_ = nullptr;
+  pc_factory_ = nullptr;
+  thread_->Stop();
+  signaling_thread_->Stop();
+  worker_thread_->Stop();
+  network_thread_->Stop();
+  network_thread_.reset();
+  firewall_.reset();
+  socket_server_.reset();
+  thread_.reset();
+}
+
+std::string FakeConferenceServer::CreateToken(const std::string& user) const {
+  Json::Value token;
+  token["host"] = "127.0.0.1:" + std::to_string(port_);
+  token["secure"] = false;
+  token["tokenId"] = user;
+  token["signature"] = "";
+  token["user"] = user;
+  return rtc::Base64::Encode(WriteJson(token));
+}
+
+void FakeConferenceServer::DropConnections(
+    const std::vector<std::string>& lost_sessions) {
+  thread_->BlockingCall([this, &lost_sessions] {
+    for (auto& participant : participants_) {
+      if (participant.second->connection)
+        participant.second->connection->Close();
+    }
+    // Disconnections are handled by tasks posted on Close(), so this runs
+    // once no participant has a connection.
+    thread_->PostTask(webrtc::SafeTask(safety_flag_, [this, lost_sessions] {
+      for (const auto& id : lost_sessions)
+        EndSession(id);
+    }));
+  });
+}
+
+void FakeConferenceServer::SetSignalingBlocked(bool blocked) {
+  thread_->BlockingCall([this, blocked] { signaling_blocked_ = blocked; });
+}
+
+void FakeConferenceServer::SetMediaBlocked(bool blocked) {
+  firewall_->ClearRules();
+  if (blocked)
+    firewall_->AddRule(false);
+}
+
+void FakeConferenceServer::SetReloginRoomInfo(bool with_room) {
+  thread_->BlockingCall([this, with_room] { relogin_room_info_ = with_room; });
+}
+
+void FakeConferenceServer::SetSubscriptionsHeld(bool held) {
+  thread_->BlockingCall([this, held] {
+    subscriptions_held_ = held;
+    if (held)
+      return;
+    std::vector<HeldSubscription> requests;
+    requests.swap(held_subscriptions_);
+    for (auto& request : requests) {
+      auto participant = participants_.find(request.participant_id);
+      if (participant == participants_.end()) {
+        Reply(request.ack, Error("Not logged in."));
+        continue;
+      }
+      OnSubscribe(participant->second.get(), request.options, request.ack);
+    }
+  });
+}
+
+FakeConferenceServer::Stats FakeConferenceServer::GetStats() {
+  return thread_->BlockingCall([this] {
+    Stats stats = stats_;
+    stats.participants = static_cast<int>(participants_.size());
+    stats.held_subscriptions = static_cast<int>(held_subscriptions_.size());
+    for (const auto& session : sessions_) {
+      if (session.second->is_publication())
+        stats.publications++;
+      else
+        stats.subscriptions++;
+      if (session.second->connected())
+        stats.connected_sessions++;
+      if (session.second->failed())
+        stats.failed_sessions++;
+    }
+    return stats;
+  });
+}
+
+void FakeConferenceServer::OnConnected(SocketIoServer::Connection* connection) {
+  if (signaling_blocked_) {
+    RTC_LOG(LS_INFO) << "Connection " << connection->id() << " refused.";
+    connection->Close();
+    return;
+  }
+  RTC_LOG(LS_INFO) << "Connection " << connection->id() << " opened.";
+}
+
+void FakeConferenceServer::OnEvent(SocketIoServer::Connection* connection,
+                                   const std::string& event,
+                                   const Json::Value& args,
+                                   SocketIoServer::Ack ack) {
+  stats_.requests++;
+  const Json::Value& message = args.empty() ? Json::Value() : args[0];
+  if (event == "login") {
+    OnLogin(connection, args, ack);
+    return;
+  }
+  if (event == "relogin") {
+    OnRelogin(connection, args, ack);
+    return;
+  }
+  Participant* participant = FindParticipant(connection);
+  if (!participant) {
+    Reply(ack, Error("Not logged in."));
+    return;
+  }
+  if (event == "logout") {
+    Reply(ack, Ok());
+    Leave(participant->id);
+  } else if (event == "publish") {
+    OnPublish(participant, message, ack);
+  } else if (event == "subscribe" && subscriptions_held_) {
+    held_subscriptions_.push_back({participant->id, message, ack});
+  } else if (event == "subscribe") {
+    OnSubscribe(participant, message, ack);
+  } else if (event == "soac") {
+    OnSoac(participant, message, ack);
+  } else if (event == "unpublish" || event == "unsubscribe") {
+    Session* session = FindSession(message["id"].asString());
+    if (!session || session->owner() != participant->id ||
+        session->is_publication() != (event == "unpublish")) {
+      Reply(ack, Error("Session not found."));
+      return;
+    }
+    EndSession(session->id());
+    Reply(ack, Ok());
+  } else if (event == "stream-control") {
+    OnStreamControl(participant, message, ack);
+  } else if (event == "subscription-control") {
+    // Subscriptions always get the publication as it is.
+    Session* session = FindSession(message["id"].asString());
+    Reply(ack, session && session->owner() == participant->id
+                   ? Ok()
+                   : Error("Subscription not found."));
+  } else if (event == "text") {
+    Json::Value text;
+    text["from"] = participant->id;
+    text["message"] = message["message"];
+    std::string to = message["to"].asString();
+    if (to == "all") {
+      text["to"] = "all";
+      for (const auto& other : participants_) {
+        if (other.second.get() != participant)
+          Notify(other.second->connection, "text", text);
+      }
+    } else {
+      auto receiver = participants_.find(to);
+      if (receiver == participants_.end()) {
+        Reply(ack, Error("Receiver not found."));
+        return;
+      }
+      text["to"] = "me";
+      Notify(receiver->second->connection, "text", text);
+    }
+    Reply(ack, Ok());
+  } else if (event == "refreshReconnectionTicket") {
+    Reply(ack, Ok(CreateTicket(participant->id)));
+  } else {
+    Reply(ack, Error("Not supported."));
+  }
+}
+
+void FakeConferenceServer::OnDisconnected(
+    SocketIoServer::Connection* connection) {
+  auto it = connection_participants_.find(connection);
+  if (it == connection_participants_.end())
+    return;
+  std::string participant_id = it->second;
+  connection_participants_.erase(it);
+  Participant* participant = participants_[participant_id].get();
+  participant->connection = nullptr;
+  int drops = ++participant->drops;
+  thread_->PostDelayedTask(
+      webrtc::SafeTask(safety_flag_,
+                       [this, participant_id, drops] {
+                         auto it = participants_.find(participant_id);
+                         if (it != participants_.end() &&
+                             it->second->drops == drops &&
+                             !it->second->connection) {
+                           Leave(participant_id);
+                         }
+                       }),
+      webrtc::TimeDelta::Millis(kReconnectionWindowMs));
+}
+
+void FakeConferenceServer::OnLogin(SocketIoServer::Connection* connection,
+                                   const Json::Value& args,
+                                   SocketIoServer::Ack ack) {
+  std::string token_string;
+  Json::Value token;
+  Json::Reader reader;
+  if (args.empty() ||
+      !rtc::Base64::Decode(args[0]["token"].asString(),
+                           rtc::Base64::DO_STRICT, &token_string, nullptr) ||
+      !reader.parse(token_string, token)) {
+    Reply(ack, Error("Invalid token."));
+    return;
+  }
+  if (FindParticipant(connection)) {
+    Reply(ack, Error("Already logged in."));
+    return;
+  }
+  auto participant = std::make_unique<Participant>();
+  participant->id = NextId();
+  participant->user = token["user"].asString();
+  participant->connection = connection;
+  Json::Value joined;
+  joined["id"] = participant->id;
+  joined["user"] = participant->user;
+  joined["role"] = kRole;
+  Json::Value presence;
+  presence["action"] = "join";
+  presence["data"] = joined;
+  Broadcast("participant", presence);
+  connection_participants_[connection] = participant->id;
+  std::string id = participant->id;
+  participants_[id] = std::move(participant);
+
+  Json::Value info = joined;
+  Json::Value permission;
+  permission["publish"]["audio"] = true;
+  permission["publish"]["video"] = true;
+  permission["subscribe"]["audio"] = true;
+  permission["subscribe"]["video"] = true;
+  info["permission"] = permission;
+  info["room"] = RoomInfo();
+  info["reconnectionTicket"] = CreateTicket(id);
+  Reply(ack, Ok(info));
+}
+
+void FakeConferenceServer::OnRelogin(SocketIoServer::Connection* connection,
+                                     const Json::Value& args,
+                                     SocketIoServer::Ack ack) {
+  std::string ticket_string;
+  Json::Value ticket;
+  Json::Reader reader;
+  if (args.empty() ||
+      !rtc::Base64::Decode(args[0].asString(), rtc::Base64::DO_STRICT,
+                           &ticket_string, nullptr) ||
+      !reader.parse(ticket_string, ticket)) {
+    Reply(ack, Error("Invalid reconnection ticket."));
+    return;
+  }
+  auto it = participants_.find(ticket["participantId"].asString());
+  if (it == participants_.end() || it->second->connection ||
+      FindParticipant(connection)) {
+    Reply(ack, Error("Participant cannot relogin."));
+    return;
+  }
+  it->second->connection = connection;
+  connection_participants_[connection] = it->first;
+  if (!relogin_room_info_) {
+    Reply(ack, Ok(CreateTicket(it->first)));
+    return;
+  }
+  Json::Value info;
+  info["reconnectionTicket"] = CreateTicket(it->first);
+  info["room"] = RoomInfo();
+  Reply(ack, Ok(info));
+}
+
+void FakeConferenceServer::OnPublish(Participant* participant,
+                                     const Json::Value& options,
+                                     SocketIoServer::Ack ack) {
+  if (options["transport"]["type"].asString() != "webrtc" ||
+      options["media"]["tracks"].empty()) {
+    Reply(ack, Error("Only WebRTC publications are supported."));
+    return;
+  }
+  std::string id = NextId();
+  auto session = std::make_unique<Session>(
+      this, id, participant->id, "", options,
+      std::vector<rtc::scoped_refptr<webrtc::MediaStreamTrackInterface>>());
+  if (!session->Initialize()) {
+    Reply(ack, Error("Failed to create PeerConnection."));
+    return;
+  }
+  sessions_[id] = std::move(session);
+  Json::Value result;
+  result["id"] = id;
+  result["transportId"] = id;
+  Reply(ack, Ok(result));
+}
+
+void FakeConferenceServer::OnSubscribe(Participant* participant,
+                                       const Json::Value& options,
+                                       SocketIoServer::Ack ack) {
+  const Json::Value& requested = options["media"]["tracks"];
+  if (options["transport"]["type"].asString() != "webrtc" ||
+      requested.empty()) {
+    Reply(ack, Error("Only WebRTC subscriptions are supported."));
+    return;
+  }
+  std::string from = requested[0]["from"].asString();
+  Session* publication = FindSession(from);
+  if (!publication || !publication->is_publication() ||
+      !publication->ready()) {
+    Reply(ack, Error("Stream not found."));
+    return;
+  }
+  std::vector<rtc::scoped_refptr<webrtc::MediaStreamTrackInterface>> tracks;
+  for (const auto& track : requested) {
+    if (track["type"].asString() == "audio") {
+      tracks.push_back(audio_track_);
+    } else if (!publication->tracks().empty()) {
+      tracks.push_back(publication->tracks()[0]);
+    }
+  }
+  std::string id = NextId();
+  auto session = std::make_unique<Session>(this, id, participant->id, from,
+                                           options, std::move(tracks));
+  if (!session->Initialize()) {
+    Reply(ack, Error("Failed to create PeerConnection."));
+    return;
+  }
+  sessions_[id] = std::move(session);
+  Json::Value result;
+  result["id"] = id;
+  result["transportId"] = id;
+  Reply(ack, Ok(result));
+}
+
+void FakeConferenceServer::OnSoac(Participant* participant,
+                                  const Json::Value& message,
+                                  SocketIoServer::Ack ack) {
+  Session* session = FindSession(message["id"].asString());
+  if (!session || session->owner() != participant->id) {
+    Reply(ack, Error("Session not found."));
+    return;
+  }
+  const Json::Value& signaling = message["signaling"];
+  std::string type = signaling["type"].asString();
+  if (type == "offer") {
+    session->OnOffer(signaling["sdp"].asString());
+  } else if (type == "candidate") {
+    session->OnCandidate(signaling["candidate"]);
+  } else if (type != "removed-candidates") {
+    Reply(ack, Error("Unknown signaling message."));
+    return;
+  }
+  Reply(ack, Ok());
+}
+
+void FakeConferenceServer::OnStreamControl(Participant* participant,
+                                           const Json::Value& message,
+                                           SocketIoServer::Ack ack) {
+  Session* session = FindSession(message["id"].asString());
+  std::string operation = message["operation"].asString();
+  if (!session || !session->is_publication() ||
+      session->owner() != participant->id) {
+    Reply(ack, Error("Stream not found."));
+    return;
+  }
+  if (operation != "pause" && operation != "play") {
+    Reply(ack, Error("Not supported."));
+    return;
+  }
+  std::string kind = message["data"].asString();
+  for (const char* track : {"audio", "video"}) {
+    if (kind != "av" && kind != track)
+      continue;
+    Json::Value update;
+    update["id"] = session->id();
+    update["status"] = "update";
+    update["data"]["field"] = std::string(track) + ".status";
+    update["data"]["value"] = operation == "pause" ? "inactive" : "active";
+    Broadcast("stream", update);
+  }
+  Reply(ack, Ok());
+}
+
+void FakeConferenceServer::OnSessionReady(Session* session) {
+  auto owner = participants_.find(session->owner());
+  if (owner != participants_.end()) {
+    Json::Value progress;
+    progress["id"] = session->id();
+    progress["status"] = "ready";
+    Notify(owner->second->connection, "progress", progress);
+  }
+  if (session->is_publication()) {
+    Json::Value added;
+    added["id"] = session->id();
+    added["status"] = "add";
+    added["data"] = session->StreamInfo();
+    Broadcast("stream", added);
+  }
+}
+
+void FakeConferenceServer::OnSessionFailed(Session* session) {
+  if (session->ready()) {
+    // The client restarts ICE to recover.
+    RTC_LOG(LS_WARNING) << "ICE failed on session " << session->id();
+    return;
+  }
+  auto owner = participants_.find(session->owner());
+  if (owner != participants_.end()) {
+    Json::Value progress;
+    progress["id"] = session->id();
+    progress["status"] = "error";
+    progress["data"] = "Failed to establish the session.";
+    Notify(owner->second->connection, "progress", progress);
+  }
+  EndSession(session->id());
+}
+
+void FakeConferenceServer::Leave(const std::string& participant_id) {
+  auto it = participants_.find(participant_id);
+  if (it == participants_.end())
+    return;
+  std::vector<std::string> owned;
+  for (const auto& session : sessions_) {
+    if (session.second->owner() == participant_id)
+      owned.push_back(session.first);
+  }
+  for (const auto& id : owned)
+    EndSession(id);
+  if (it->second->connection)
+    connection_participants_.erase(it->second->connection);
+  participants_.erase(it);
+  Json::Value presence;
+  presence["action"] = "leave";
+  presence["data"] = participant_id;
+  Broadcast("participant", presence);
+}
+
+rtc::scoped_refptr<webrtc::PeerConnectionInterface>
+FakeConferenceServer::CreatePeerConnection(
+    webrtc::PeerConnectionObserver* observer) {
+  webrtc::PeerConnectionInterface::RTCConfiguration configuration;
+  configuration.sdp_semantics = webrtc::SdpSemantics::kUnifiedPlan;
+  auto result = pc_factory_->CreatePeerConnectionOrError(
+      configuration, webrtc::PeerConnectionDependencies(observer));
+  if (!result.ok()) {
+    RTC_LOG(LS_ERROR) << "Failed to create PeerConnection: "
+                      << result.error().message();
+    return nullptr;
+  }
+  return result.MoveValue();
+}
+
+void FakeConferenceServer::EndSession(const std::string& id) {
+  auto it = sessions_.find(id);
+  if (it == sessions_.end())
+    return;
+  std::unique_ptr<Session> session = std::move(it->second);
+  sessions_.erase(it);
+  if (!session->is_publication())
+    return;
+  std::vector<std::string> subscriptions;
+  for (const auto& other : sessions_) {
+    if (other.second->from() == id)
+      subscriptions.push_back(other.first);
+  }
+  for (const auto& subscription : subscriptions)
+    EndSession(subscription);
+  if (session->ready()) {
+    Json::Value removed;
+    removed["id"] = id;
+    removed["status"] = "remove";
+    Broadcast("stream", removed);
+  }
+}
+
+FakeConferenceServer::Participant* FakeConferenceServer::FindParticipant(
+    SocketIoServer::Connection* connection) {
+  auto it = connection_participants_.find(connection);
+  return it == connection_participants_.end()
+             ? nullptr
+             : participants_[it->second].get();
+}
+
+FakeConferenceServer::Session* FakeConferenceServer::FindSession(
+    const std::string& id) {
+  auto it = sessions_.find(id);
+  return it == sessions_.end() ? nullptr : it->second.get();
+}
+
+Json::Value FakeConferenceServer::RoomInfo() const {
+  Json::Value room;
+  room["id"] = kRoomId;
+  room["views"] = Json::Value(Json::arrayValue);
+  room["streams"] = Json::Value(Json::arrayValue);
+  for (const auto& session : sessions_) {
+    if (session.second->is_publication() && session.second->ready())
+      room["streams"].append(session.second->StreamInfo());
+  }
+  room["participants"] = Json::Value(Json::arrayValue);
+  for (const auto& participant : participants_) {
+    Json::Value info;
+    info["id"] = participant.second->id;
+    info["user"] = participant.second->user;
+    info["role"] = kRole;
+    room["participants"].append(info);
+  }
+  return room;
+}
+
+std::string FakeConferenceServer::CreateTicket(
+    const std::string& participant_id) const {
+  Json::Value ticket;
+  ticket["participantId"] = participant_id;
+  ticket["ticketId"] = participant_id;
+  // Same clock as the client compares it with.
+  ticket["notAfter"] = std::to_string(rtc::TimeMillis() + kTicketLifetimeMs);
+  ticket["signature"] = "";
+  return rtc::Base64::Encode(WriteJson(ticket));
+}
+
+void FakeConferenceServer::Notify(SocketIoServer::Connection* connection,
+                                  const std::string& event,
+                                  const Json::Value& data) {
+  // Notifications to participants reconnecting are lost, as they are with
+  // the real server.
+  if (!connection)
+    return;
+  stats_.notifications++;
+  connection->Emit(event, data);
+}
+
+void FakeConferenceServer::Broadcast(const std::string& event,
+                                     const Json::Value& data) {
+  for (const auto& participant : participants_)
+    Notify(participant.second->connection, event, data);
+}
+
+std::string FakeConferenceServer::NextId() {
+  return "fake-" + std::to_string(next_id_++);
+}
+}  // namespace test
+}  // namespace conference
+}  // namespace owt
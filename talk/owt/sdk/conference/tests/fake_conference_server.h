@@ -0,0 +1,173 @@
+// Copyright (C) <2026> Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef OWT_CONFERENCE_TESTS_FAKE_CONFERENCE_SERVER_H_
+#define OWT_CONFERENCE_TESTS_FAKE_CONFERENCE_SERVER_H_
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+#include "talk/owt/sdk/conference/tests/socketio_server.h"
+#include "third_party/webrtc/api/peer_connection_interface.h"
+#include "third_party/webrtc/api/task_queue/task_queue_factory.h"
+#include "third_party/webrtc/rtc_base/firewall_socket_server.h"
+#include "third_party/webrtc/rtc_base/physical_socket_server.h"
+
+namespace owt {
+namespace conference {
+namespace test {
+// In-process stand-in for an OWT conference server, for driving
+// ConferenceClient without an MCU. It speaks the client's signaling protocol
+// over SocketIoServer: login, relogin, logout, publish, subscribe, soac,
+// unpublish, unsubscribe, stream-control, subscription-control, text and
+// refreshReconnectionTicket, and notifies participant and stream changes.
+//
+// There is one room and no authentication; every token is accepted. Each
+// publication and subscription terminates on a PeerConnection of the server,
+// and subscriptions send the video track received by the publication they
+// subscribe to, so video is decoded and encoded again on the way. Audio of
+// subscriptions is synthetic. Mixed streams, simulcast and recording are not
+// supported.
+class FakeConferenceServer : public SocketIoServer::Observer {
+ public:
+  struct Stats {
+    int participants = 0;
+    int publications = 0;
+    int subscriptions = 0;
+    // Sessions whose transport is connected, and whose transport failed.
+    int connected_sessions = 0;
+    int failed_sessions = 0;
+    // Offers that changed the ICE credentials of a session.
+    uint64_t ice_restarts = 0;
+    // Subscribe requests not answered yet, see SetSubscriptionsHeld.
+    int held_subscriptions = 0;
+    // Requests and notifications over signaling since start.
+    uint64_t requests = 0;
+    uint64_t notifications = 0;
+  };
+  FakeConferenceServer();
+  ~FakeConferenceServer() override;
+  // Listens on a loopback port. Returns false on failure.
+  bool Start();
+  void Stop();
+  // Token for ConferenceClient::Join.
+  std::string CreateToken(const std::string& user) const;
+  // Closes all signaling connections without ending their sessions, as a
+  // network outage would. Clients can relogin with their tickets. Sessions in
+  // |lost_sessions| end while the connections are down, so their owners
+  // only learn it from the room info at relogin, or when their ICE restart
+  // is rejected.
+  void DropConnections(const std::vector<std::string>& lost_sessions = {});
+  // While |blocked| is true, new signaling connections are closed as soon as
+  // they open, so clients keep reconnecting. Open connections are kept.
+  void SetSignalingBlocked(bool blocked);
+  // While |blocked| is true, media packets to and from the server are
+  // dropped. Signaling is not affected.
+  void SetMediaBlocked(bool blocked);
+  // If |with_room| is false, relogin is acknowledged with the reconnection
+  // ticket only, as the OWT portal does, instead of an object that also has
+  // the room info. Default is true.
+  void SetReloginRoomInfo(bool with_room);
+  // While |held| is true, subscribe requests are not answered, so clients
+  // cannot tell how many they may have in flight. Held requests are handled
+  // in the order they arrived when |held| becomes false.
+  void SetSubscriptionsHeld(bool held);
+  Stats GetStats();
+
+  // SocketIoServer::Observer.
+  void OnConnected(SocketIoServer::Connection* connection) override;
+  void OnEvent(SocketIoServer::Connection* connection,
+               const std::string& event,
+               const Json::Value& args,
+               SocketIoServer::Ack ack) override;
+  void OnDisconnected(SocketIoServer::Connection* connection) override;
+
+ private:
+  class Session;
+  struct Participant {
+    std::string id;
+    std::string user;
+    SocketIoServer::Connection* connection = nullptr;
+    // Number of times the connection was lost, so a removal scheduled for an
+    // earlier loss can tell it is stale.
+    int drops = 0;
+  };
+  struct HeldSubscription {
+    std::string participant_id;
+    Json::Value options;
+    SocketIoServer::Ack ack;
+  };
+
+  void OnLogin(SocketIoServer::Connection* connection,
+               const Json::Value& args,
+               SocketIoServer::Ack ack);
+  void OnRelogin(SocketIoServer::Connection* connection,
+                 const Json::Value& args,
+                 SocketIoServer::Ack ack);
+  void OnPublish(Participant* participant,
+                 const Json::Value& options,
+                 SocketIoServer::Ack ack);
+  void OnSubscribe(Participant* participant,
+                   const Json::Value& options,
+                   SocketIoServer::Ack ack);
+  void OnSoac(Participant* participant,
+              const Json::Value& message,
+              SocketIoServer::Ack ack);
+  void OnStreamControl(Participant* participant,
+                       const Json::Value& message,
+                       SocketIoServer::Ack ack);
+  // Session callbacks, on |thread_|.
+  void OnSessionReady(Session* session);
+  void OnSessionFailed(Session* session);
+
+  void Leave(const std::string& participant_id);
+  // Null on failure.
+  rtc::scoped_refptr<webrtc::PeerConnectionInterface> CreatePeerConnection(
+      webrtc::PeerConnectionObserver* observer);
+  // Closes session |id| and everything subscribing to it.
+  void EndSession(const std::string& id);
+  Participant* FindParticipant(SocketIoServer::Connection* connection);
+  Session* FindSession(const std::string& id);
+  Json::Value RoomInfo() const;
+  std::string CreateTicket(const std::string& participant_id) const;
+  void Notify(SocketIoServer::Connection* connection,
+              const std::string& event,
+              const Json::Value& data);
+  void Broadcast(const std::string& event, const Json::Value& data);
+  std::string NextId();
+
+  std::unique_ptr<rtc::Thread> thread_;
+  // Sockets of |network_thread_|, which carry all media.
+  std::unique_ptr<rtc::PhysicalSocketServer> socket_server_;
+  std::unique_ptr<rtc::FirewallSocketServer> firewall_;
+  std::unique_ptr<rtc::Thread> network_thread_;
+  std::unique_ptr<rtc::Thread> worker_thread_;
+  std::unique_ptr<rtc::Thread> signaling_thread_;
+  std::unique_ptr<webrtc::TaskQueueFactory> task_queue_factory_;
+  rtc::scoped_refptr<webrtc::PeerConnectionFactoryInterface> pc_factory_;
+  // Sent to subscribers of audio. Received audio is not forwarded, because
+  // senders of remote audio tracks also send what the audio device records.
+  rtc::scoped_refptr<webrtc::AudioTrackInterface> audio_track_;
+  std::unique_ptr<SocketIoServer> socketio_server_;
+  int port_ = 0;
+  int next_id_ = 1;
+  bool signaling_blocked_ = false;
+  bool relogin_room_info_ = true;
+  bool subscriptions_held_ = false;
+  std::vector<HeldSubscription> held_subscriptions_;
+  // Keyed by participant ID.
+  std::map<std::string, std::unique_ptr<Participant>> participants_;
+  std::map<SocketIoServer::Connection*, std::string> connection_participants_;
+  // Publications and subscriptions, keyed by session ID.
+  std::map<std::string, std::unique_ptr<Session>> sessions_;
+  Stats stats_;
+  // Guards tasks posted to |thread_|. Created and invalidated there.
+  rtc::scoped_refptr<webrtc::PendingTaskSafetyFlag> safety_flag_;
+};
+}  // namespace test
+}  // namespace conference
+}  // namespace owt
+
+#endif  // OWT_CONFERENCE_TESTS_FAKE_CONFERENCE_SERVER_H_
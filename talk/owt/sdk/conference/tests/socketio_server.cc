@@ -0,0 +1,391 @@
+// Copyright (C) <2026> Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "talk/owt/sdk/conference/tests/socketio_server.h"
+#include <algorithm>
+#include <cctype>
+#include "third_party/webrtc/rtc_base/logging.h"
+#include "third_party/webrtc/rtc_base/message_digest.h"
+#include "third_party/webrtc/rtc_base/socket_address.h"
+#include "third_party/webrtc/rtc_base/third_party/base64/base64.h"
+
+namespace owt {
+namespace conference {
+namespace test {
+namespace {
+const char kWebSocketGuid[] = "258EAFA5-E914-47DA-95CA-C5AB0DC85B11";
+const size_t kMaxHeaderSize = 16 * 1024;
+const uint64_t kMaxMessageSize = 16 * 1024 * 1024;
+const int kPingIntervalMs = 25000;
+const int kPingTimeoutMs = 20000;
+enum Opcode : uint8_t {
+  kContinuation = 0x0,
+  kText = 0x1,
+  kClose = 0x8,
+  kPing = 0x9,
+  kPong = 0xa,
+};
+
+std::string ToLower(std::string value) {
+  std::transform(value.begin(), value.end(), value.begin(),
+                 [](unsigned char c) { return std::tolower(c); });
+  return value;
+}
+
+std::string Trim(const std::string& value) {
+  size_t begin = value.find_first_not_of(" \t");
+  if (begin == std::string::npos)
+    return "";
+  return value.substr(begin, value.find_last_not_of(" \t") - begin + 1);
+}
+
+std::string WebSocketAccept(const std::string& key) {
+  std::string input = key + kWebSocketGuid;
+  uint8_t digest[20];
+  size_t length = rtc::ComputeDigest(rtc::DIGEST_SHA_1, input.data(),
+                                     input.size(), digest, sizeof(digest));
+  std::string accept;
+  rtc::Base64::EncodeFromArray(digest, length, &accept);
+  return accept;
+}
+}  // namespace
+
+std::string WriteJson(const Json::Value& value) {
+  Json::StreamWriterBuilder builder;
+  builder["indentation"] = "";
+  return Json::writeString(builder, value);
+}
+
+SocketIoServer::Connection::Connection(SocketIoServer* server,
+                                       std::unique_ptr<rtc::Socket> socket,
+                                       const std::string& id)
+    : server_(server), socket_(std::move(socket)), id_(id) {
+  socket_->SignalReadEvent.connect(this, &Connection::OnRead);
+  socket_->SignalWriteEvent.connect(this, &Connection::OnWrite);
+  socket_->SignalCloseEvent.connect(this, &Connection::OnClose);
+}
+
+void SocketIoServer::Connection::Emit(const std::string& event,
+                                      const Json::Value& data) {
+  Json::Value packet(Json::arrayValue);
+  packet.append(event);
+  packet.append(data);
+  SendEngineIoPacket("42" + WriteJson(packet));
+}
+
+void SocketIoServer::Connection::Close() {
+  if (state_ == State::kClosed)
+    return;
+  state_ = State::kClosed;
+  socket_->Close();
+  server_->Remove(this);
+}
+
+void SocketIoServer::Connection::OnRead(rtc::Socket* socket) {
+  char buffer[4096];
+  int read;
+  while ((read = socket_->Recv(buffer, sizeof(buffer), nullptr)) > 0)
+    input_.append(buffer, read);
+  bool valid = true;
+  if (state_ == State::kHandshake)
+    valid = HandleHandshake();
+  if (valid && state_ == State::kOpen)
+    valid = HandleFrames();
+  if (!valid)
+    Close();
+}
+
+void SocketIoServer::Connection::OnWrite(rtc::Socket* socket) {
+  while (!output_.empty() && state_ != State::kClosed) {
+    int sent = socket_->Send(output_.data(), output_.size());
+    if (sent <= 0) {
+      if (!socket_->IsBlocking())
+        Close();
+      return;
+    }
+    output_.erase(0, sent);
+  }
+}
+
+void SocketIoServer::Connection::OnClose(rtc::Socket* socket, int error) {
+  Close();
+}
+
+bool SocketIoServer::Connection::HandleHandshake() {
+  size_t end = input_.find("\r\n\r\n");
+  if (end == std::string::npos)
+    return input_.size() < kMaxHeaderSize;
+  std::string request = input_.substr(0, end + 2);
+  input_.erase(0, end + 4);
+  size_t line_end = request.find("\r\n");
+  std::string request_line = request.substr(0, line_end);
+  std::string key;
+  for (size_t begin = line_end + 2; begin < request.size();) {
+    size_t next = request.find("\r\n", begin);
+    std::string line = request.substr(begin, next - begin);
+    begin = next + 2;
+    size_t colon = line.find(':');
+    if (colon != std::string::npos &&
+        ToLower(Trim(line.substr(0, colon))) == "sec-websocket-key") {
+      key = Trim(line.substr(colon + 1));
+    }
+  }
+  if (request_line.compare(0, 4, "GET ") != 0 ||
+      request_line.find("transport=websocket") == std::string::npos ||
+      key.empty()) {
+    // Long polling is not implemented.
+    RTC_LOG(LS_WARNING) << "Rejected request " << request_line;
+    Write("HTTP/1.1 400 Bad Request\r\nContent-Length: 0\r\n\r\n");
+    return false;
+  }
+  size_t version = request_line.find("EIO=");
+  if (version != std::string::npos && version + 4 < request_line.size())
+    engine_io_version_ = request_line[version + 4] - '0';
+  Write(
+      "HTTP/1.1 101 Switching Protocols\r\nUpgrade: websocket\r\n"
+      "Connection: Upgrade\r\nSec-WebSocket-Accept: " +
+      WebSocketAccept(key) + "\r\n\r\n");
+  state_ = State::kOpen;
+  Json::Value open;
+  open["sid"] = id_;
+  open["upgrades"] = Json::Value(Json::arrayValue);
+  open["pingInterval"] = kPingIntervalMs;
+  open["pingTimeout"] = kPingTimeoutMs;
+  if (engine_io_version_ >= 4)
+    open["maxPayload"] = static_cast<Json::UInt64>(kMaxMessageSize);
+  SendEngineIoPacket("0" + WriteJson(open));
+  if (engine_io_version_ < 4) {
+    // Socket.IO 2 servers connect the default namespace on their own.
+    connected_ = true;
+    SendEngineIoPacket("40");
+    server_->observer_->OnConnected(this);
+  }
+  return true;
+}
+
+bool SocketIoServer::Connection::HandleFrames() {
+  while (state_ == State::kOpen && input_.size() >= 2) {
+    const uint8_t* data = reinterpret_cast<const uint8_t*>(input_.data());
+    bool fin = data[0] & 0x80;
+    uint8_t opcode = data[0] & 0x0f;
+    uint64_t length = data[1] & 0x7f;
+    size_t offset = 2;
+    if (length == 126) {
+      if (input_.size() < 4)
+        return true;
+      length = (data[2] << 8) | data[3];
+      offset = 4;
+    } else if (length == 127) {
+      if (input_.size() < 10)
+        return true;
+      length = 0;
+      for (int i = 0; i < 8; i++)
+        length = (length << 8) | data[2 + i];
+      offset = 10;
+    }
+    // Clients must mask their frames.
+    if (!(data[1] & 0x80) || length > kMaxMessageSize)
+      return false;
+    if (input_.size() < offset + 4 + length)
+      return true;
+    const uint8_t* mask = data + offset;
+    std::string payload = input_.substr(offset + 4, length);
+    for (size_t i = 0; i < payload.size(); i++)
+      payload[i] ^= mask[i % 4];
+    input_.erase(0, offset + 4 + length);
+    if (opcode == kClose) {
+      SendFrame(kClose, "");
+      Close();
+    } else if (opcode == kPing) {
+      SendFrame(kPong, payload);
+    } else if (opcode < kClose) {
+      if (opcode != kContinuation)
+        message_opcode_ = opcode;
+      message_ += payload;
+      if (fin) {
+        std::string message;
+        message.swap(message_);
+        // Binary attachments are not used by the conference protocol.
+        if (message_opcode_ == kText)
+          HandleEngineIoPacket(message);
+      }
+    }
+  }
+  return true;
+}
+
+void SocketIoServer::Connection::HandleEngineIoPacket(
+    const std::string& packet) {
+  if (packet.empty())
+    return;
+  switch (packet[0]) {
+    case '1':
+      Close();
+      break;
+    case '2':
+      // Engine.IO 3 clients ping the server.
+      SendEngineIoPacket("3" + packet.substr(1));
+      break;
+    case '4':
+      HandleSocketIoPacket(packet.substr(1));
+      break;
+    default:
+      break;
+  }
+}
+
+void SocketIoServer::Connection::HandleSocketIoPacket(
+    const std::string& packet) {
+  if (packet.empty())
+    return;
+  size_t position = 1;
+  if (position < packet.size() && packet[position] == '/') {
+    size_t comma = packet.find(',', position);
+    std::string name_space = packet.substr(position, comma - position);
+    if (name_space != "/") {
+      SendEngineIoPacket("44" + name_space +
+                         ",{\"message\":\"Invalid namespace\"}");
+      return;
+    }
+    position = comma == std::string::npos ? packet.size() : comma + 1;
+  }
+  size_t id_end = position;
+  while (id_end < packet.size() && std::isdigit(packet[id_end]))
+    id_end++;
+  std::string ack_id = packet.substr(position, id_end - position);
+  switch (packet[0]) {
+    case '0':
+      if (!connected_) {
+        connected_ = true;
+        SendEngineIoPacket("40{\"sid\":\"" + id_ + "\"}");
+        server_->observer_->OnConnected(this);
+      }
+      break;
+    case '1':
+      Close();
+      break;
+    case '2': {
+      Json::Value event;
+      Json::Reader reader;
+      if (!connected_ || !reader.parse(packet.substr(id_end), event) ||
+          !event.isArray() || event.empty() || !event[0].isString()) {
+        RTC_LOG(LS_WARNING) << "Ignored invalid event " << packet;
+        return;
+      }
+      Json::Value args(Json::arrayValue);
+      for (Json::ArrayIndex i = 1; i < event.size(); i++)
+        args.append(event[i]);
+      Ack ack;
+      if (!ack_id.empty()) {
+        SocketIoServer* server = server_;
+        Connection* connection = this;
+        ack = [server, connection, ack_id](const Json::Value& args) {
+          // The connection may be gone by the time a request completes.
+          if (server->Contains(connection))
+            connection->SendEngineIoPacket("43" + ack_id + WriteJson(args));
+        };
+      }
+      server_->observer_->OnEvent(this, event[0].asString(), args, ack);
+      break;
+    }
+    default:
+      break;
+  }
+}
+
+void SocketIoServer::Connection::SendEngineIoPacket(
+    const std::string& packet) {
+  SendFrame(kText, packet);
+}
+
+void SocketIoServer::Connection::SendFrame(uint8_t opcode,
+                                           const std::string& payload) {
+  std::string frame(1, static_cast<char>(0x80 | opcode));
+  uint64_t length = payload.size();
+  if (length < 126) {
+    frame.push_back(static_cast<char>(length));
+  } else if (length <= 0xffff) {
+    frame.push_back(126);
+    frame.push_back(static_cast<char>(length >> 8));
+    frame.push_back(static_cast<char>(length & 0xff));
+  } else {
+    frame.push_back(127);
+    for (int shift = 56; shift >= 0; shift -= 8)
+      frame.push_back(static_cast<char>((length >> shift) & 0xff));
+  }
+  Write(frame + payload);
+}
+
+void SocketIoServer::Connection::Write(const std::string& data) {
+  if (state_ == State::kClosed)
+    return;
+  output_ += data;
+  OnWrite(socket_.get());
+}
+
+void SocketIoServer::Connection::Ping() {
+  if (state_ == State::kOpen && engine_io_version_ >= 4)
+    SendEngineIoPacket("2");
+}
+
+SocketIoServer::SocketIoServer(rtc::Thread* thread, Observer* observer)
+    : thread_(thread), observer_(observer) {}
+
+SocketIoServer::~SocketIoServer() {
+  Stop();
+}
+
+int SocketIoServer::Start() {
+  RTC_DCHECK(thread_->IsCurrent());
+  listen_socket_.reset(
+      thread_->socketserver()->CreateSocket(AF_INET, SOCK_STREAM));
+  if (!listen_socket_ ||
+      listen_socket_->Bind(rtc::SocketAddress("127.0.0.1", 0)) != 0 ||
+      listen_socket_->Listen(64) != 0) {
+    RTC_LOG(LS_ERROR) << "Failed to listen on loopback.";
+    listen_socket_.reset();
+    return 0;
+  }
+  listen_socket_->SignalReadEvent.connect(this, &SocketIoServer::OnAccept);
+  ping_task_ = webrtc::RepeatingTaskHandle::DelayedStart(
+      thread_, webrtc::TimeDelta::Millis(kPingIntervalMs), [this] {
+        for (auto& connection : connections_)
+          connection.second->Ping();
+        return webrtc::TimeDelta::Millis(kPingIntervalMs);
+      });
+  return listen_socket_->GetLocalAddress().port();
+}
+
+void SocketIoServer::Stop() {
+  RTC_DCHECK(thread_->IsCurrent());
+  ping_task_.Stop();
+  listen_socket_.reset();
+  connections_.clear();
+}
+
+void SocketIoServer::OnAccept(rtc::Socket* socket) {
+  rtc::SocketAddress address;
+  std::unique_ptr<rtc::Socket> accepted(listen_socket_->Accept(&address));
+  if (!accepted)
+    return;
+  auto connection = std::make_unique<Connection>(
+      this, std::move(accepted),
+      "connection-" + std::to_string(next_connection_id_++));
+  connections_[connection.get()] = std::move(connection);
+}
+
+void SocketIoServer::Remove(Connection* connection) {
+  thread_->PostTask(webrtc::SafeTask(safety_.flag(), [this, connection] {
+    auto it = connections_.find(connection);
+    if (it == connections_.end())
+      return;
+    std::unique_ptr<Connection> closed = std::move(it->second);
+    connections_.erase(it);
+    if (closed->connected_)
+      observer_->OnDisconnected(closed.get());
+  }));
+}
+}  // namespace test
+}  // namespace conference
+}  // namespace owt
@@ -0,0 +1,116 @@
+// Copyright (C) <2026> Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef OWT_CONFERENCE_TESTS_SOCKETIO_SERVER_H_
+#define OWT_CONFERENCE_TESTS_SOCKETIO_SERVER_H_
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include "third_party/webrtc/api/task_queue/pending_task_safety_flag.h"
+#include "third_party/webrtc/rtc_base/socket.h"
+#include "third_party/webrtc/rtc_base/strings/json.h"
+#include "third_party/webrtc/rtc_base/task_utils/repeating_task.h"
+#include "third_party/webrtc/rtc_base/third_party/sigslot/sigslot.h"
+#include "third_party/webrtc/rtc_base/thread.h"
+
+namespace owt {
+namespace conference {
+namespace test {
+// Compact JSON text of |value|.
+std::string WriteJson(const Json::Value& value);
+
+// Socket.IO server on a loopback port, just enough for the Socket.IO C++
+// client used by ConferenceSocketSignalingChannel: WebSocket transport only,
+// Engine.IO protocol 3 and 4, default namespace, text events and acks.
+// Everything, including observer callbacks, runs on the thread passed in.
+class SocketIoServer : public sigslot::has_slots<> {
+ public:
+  class Connection;
+  // Acknowledges an event with |args|, which must be an array.
+  using Ack = std::function<void(const Json::Value& args)>;
+  class Observer {
+   public:
+    virtual ~Observer() = default;
+    // The client connected to the default namespace.
+    virtual void OnConnected(Connection* connection) = 0;
+    // |args| is the array of arguments after the event name. |ack| is null if
+    // the client does not expect one.
+    virtual void OnEvent(Connection* connection,
+                         const std::string& event,
+                         const Json::Value& args,
+                         Ack ack) = 0;
+    // |connection| is destroyed after this returns.
+    virtual void OnDisconnected(Connection* connection) = 0;
+  };
+  class Connection : public sigslot::has_slots<> {
+   public:
+    Connection(SocketIoServer* server,
+               std::unique_ptr<rtc::Socket> socket,
+               const std::string& id);
+    const std::string& id() const { return id_; }
+    void Emit(const std::string& event, const Json::Value& data);
+    // Closes the transport. The observer is notified asynchronously.
+    void Close();
+
+   private:
+    friend class SocketIoServer;
+    enum class State { kHandshake, kOpen, kClosed };
+    void OnRead(rtc::Socket* socket);
+    void OnWrite(rtc::Socket* socket);
+    void OnClose(rtc::Socket* socket, int error);
+    bool HandleHandshake();
+    // Returns false if the input is malformed.
+    bool HandleFrames();
+    void HandleEngineIoPacket(const std::string& packet);
+    void HandleSocketIoPacket(const std::string& packet);
+    void SendEngineIoPacket(const std::string& packet);
+    void SendFrame(uint8_t opcode, const std::string& payload);
+    void Write(const std::string& data);
+    void Ping();
+
+    SocketIoServer* const server_;
+    std::unique_ptr<rtc::Socket> socket_;
+    const std::string id_;
+    State state_ = State::kHandshake;
+    int engine_io_version_ = 4;
+    bool connected_ = false;
+    std::string input_;
+    std::string output_;
+    // Payload and opcode of a fragmented message.
+    std::string message_;
+    uint8_t message_opcode_ = 0;
+  };
+
+  SocketIoServer(rtc::Thread* thread, Observer* observer);
+  ~SocketIoServer();
+  // Listens on 127.0.0.1. Returns the port, or 0 on failure.
+  int Start();
+  // Closes the listening socket and all connections without notifying the
+  // observer.
+  void Stop();
+
+ private:
+  void OnAccept(rtc::Socket* socket);
+  bool Contains(Connection* connection) const {
+    return connections_.find(connection) != connections_.end();
+  }
+  // Removes |connection| once the current task is done with it.
+  void Remove(Connection* connection);
+
+  rtc::Thread* const thread_;
+  Observer* const observer_;
+  std::unique_ptr<rtc::Socket> listen_socket_;
+  std::map<Connection*, std::unique_ptr<Connection>> connections_;
+  int next_connection_id_ = 1;
+  // Engine.IO 4 servers ping their clients.
+  webrtc::RepeatingTaskHandle ping_task_;
+  webrtc::ScopedTaskSafety safety_;
+};
+}  // namespace test
+}  // namespace conference
+}  // namespace owt
+
+#endif  // OWT_CONFERENCE_TESTS_SOCKETIO_SERVER_H_
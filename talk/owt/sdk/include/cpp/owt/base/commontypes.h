@@ -102,10 +102,13 @@ struct OWT_EXPORT RtpEncodingParameters {
   // number of temporal layers requested to encoder, if supported.
   int num_temporal_layers = 1;
 
-  //  Currently this is implemented for the entire rtp sender by using
-  // the value of the first encoding parameter..
+  // Maximum bitrate of this encoding. 0 falls back to the max_bitrate of the
+  // stream's encoding parameters.
   int max_bitrate_bps = 0;
 
+  // Minimum bitrate of this encoding. 0 for default.
+  int min_bitrate_bps = 0;
+
   // Specifies the maximum framerate in fps for video. ignored by audio
   // Not supported for screencast.
   int max_framerate = 0;
@@ -151,6 +154,21 @@ struct OWT_EXPORT VideoCodecParameters {
   std::string profile;
 };
 
+/// Video encoder selection policy of a publication.
+enum class VideoEncoderPolicy : int {
+  /// Encoded frames are passed through. Raw frames use hardware encoder if
+  /// hardware acceleration is enabled, otherwise software encoder.
+  kAuto = 0,
+  /// Only encoded frames from an encoded stream provider are accepted.
+  kPassThrough,
+  /// Raw frames are encoded by software encoders sharing a bounded worker
+  /// pool.
+  kSoftware,
+  /// Raw frames are encoded by hardware encoder. Falls back to software
+  /// encoder if no hardware encoder can be initialized.
+  kHardware
+};
+
 /// Video encoding parameters. Used to specify the video encoding settings when
 /// publishing the video.
 struct OWT_EXPORT VideoEncodingParameters {
@@ -163,7 +181,12 @@ struct OWT_EXPORT VideoEncodingParameters {
   VideoCodecParameters codec;
   std::vector<RtpEncodingParameters> rtp_encoding_parameters;
   unsigned long max_bitrate;
+  /// Bitrate in kbps the bandwidth estimation starts from, 0 for default.
+  unsigned long start_bitrate;
   bool hardware_accelerated;
+  /// Encoder selection for this publication. Only applies to conference
+  /// publications.
+  VideoEncoderPolicy encoder_policy;
 };
 /// Audio source info.
 ///
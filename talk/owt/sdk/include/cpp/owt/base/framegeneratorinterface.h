@@ -39,16 +39,30 @@ class OWT_EXPORT AudioFrameGeneratorInterface {
 */
 class OWT_EXPORT VideoFrameGeneratorInterface {
  public:
+  /**
+   @brief Layout of frames generated.
+   @details Raw frames are tightly packed: every plane follows the previous
+   one, and a row's stride equals its width (rounded up for chroma).
+   - I420: Y, then U and V subsampled 2x2.
+   - NV12: Y, then interleaved UV subsampled 2x2.
+   - I444: Y, U and V, all full size.
+   - I010: as I420, with 16 bit little-endian samples holding 10 bit values.
+   Frames are handed to the encoder in the generated layout, and only
+   converted if the encoder cannot take it.
+   */
   enum VideoFrameCodec {
     I420,
     VP8,
     H264,
+    NV12,
+    I444,
+    I010,
   };
   /**
    @brief This function generates one frame data.
    @param buffer Points to the start address for frame data. The memory is
    allocated and owned by SDK. Implementations should fill frame data to the
-   memory starts from |buffer|.
+   memory starts from |buffer|, in the layout GetType() returns.
    @param capacity Buffer's capacity. It will be equal or greater to expected
    frame buffer size.
    @return The size of actually frame buffer size.
@@ -5,6 +5,7 @@
 #define OWT_BASE_GLOBALCONFIGURATION_H_
 
 #include <memory>
+#include <string>
 #include "owt/base/framegeneratorinterface.h"
 #if defined(WEBRTC_WIN) || defined(WEBRTC_LINUX)
 #include "owt/base/videodecoderinterface.h"
@@ -63,6 +64,9 @@ struct OWT_EXPORT IcePortRange {
 */
 class OWT_EXPORT GlobalConfiguration {
   friend class PeerConnectionDependencyFactory;
+  friend class SoftwareEncoderPool;
+  friend class FrameLatencyTracer;
+  friend class BitstreamDumpWriter;
 
  public:
 #if defined(WEBRTC_WIN) || defined(WEBRTC_LINUX)
@@ -149,6 +153,15 @@ class OWT_EXPORT GlobalConfiguration {
   static void SetLatencyLoggingEnabled(bool enabled) {
     log_latency_to_file_enabled_ = enabled;
   }
+  /**
+   @brief This function enables per-frame latency tracing.
+   @details Measurements are read with LatencyTracer::GetStatistics. Must be
+   called before any PeerConnection is created.
+   @param enabled Enable latency tracing or not.
+  */
+  static void SetLatencyTracingEnabled(bool enabled) {
+    latency_tracing_enabled_ = enabled;
+  }
 #if defined(WEBRTC_WIN)
   /**
    @brief Enable driver-based super resolution(SR) for video rendering if underlying
@@ -215,22 +228,50 @@ class OWT_EXPORT GlobalConfiguration {
 
 
   /**
-   @brief This function enables stream dump before decoder to
-   application's current working directory. This API is for debugging
-   purpose and should not be called in production.
+   @brief This function enables stream dump before decoder.
+   @details Each received stream is written to its own file in the directory
+   set by SetBitstreamDumpDirectory, application's current working directory
+   by default. VP8, VP9 and AV1 are written as IVF, H.264 and H.265 as Annex-B.
+   On Windows and Linux files are written by a background thread with a
+   bounded queue, so dumping does not stall decoding.
   */
   static void SetPreDecodeDumpEnabled(bool enabled) {
     pre_decode_dump_enabled_ = enabled;
   }
 
   /**
-   @brief This function enables stream dump after encoder to
-   application's current working directory. This API is for debugging
-   purpose and should not be called in production.
+   @brief This function enables stream dump after encoder.
+   @details Each encoded stream, one per simulcast layer, is written to its own
+   file in the directory set by SetBitstreamDumpDirectory. Spatial layers of a
+   VP9 or AV1 SVC stream are written to one file, with all layers of a picture
+   in one IVF frame. On Windows and Linux files are written by a background
+   thread with a bounded queue, so dumping does not stall encoding.
+   Only encoders created by the SDK's own encoder factory on Windows and Linux
+   are dumped, including hardware, software and pass-through encoders. Other
+   platforms rely on WebRTC's dump field trial instead.
   */
   static void SetPostEncodeDumpEnabled(bool enabled) {
     post_encode_dump_enabled_ = enabled;
   }
+  /**
+   @brief This function sets the directory of pre-decode and post-encode
+   dumps. Must be called before any PeerConnection is created.
+   @param directory Existing directory. Empty string means current working
+   directory.
+  */
+  static void SetBitstreamDumpDirectory(const std::string& directory) {
+    bitstream_dump_directory_ = directory;
+  }
+  /**
+   @brief This function sets how many bytes of encoded frames may wait for
+   the dump writer. Frames beyond this budget are dropped from the dump,
+   which then resumes at the next key frame. Encoding and decoding are never
+   blocked by dumping.
+   @param bytes Byte budget. 0 resets to default, which is 16 MB.
+  */
+  static void SetBitstreamDumpMaxQueuedBytes(size_t bytes) {
+    bitstream_dump_max_queued_bytes_ = bytes;
+  }
   /**
    @brief This function sets the temporal layers for H.264.
 
@@ -255,6 +296,30 @@ class OWT_EXPORT GlobalConfiguration {
       std::unique_ptr<VideoDecoderInterface> external_video_decoder) {
     video_decoder_ = std::move(external_video_decoder);
   }
+  /**
+   @brief This function sets the asynchronous video decoder to decode the
+   encoded images. Frames returned by the decoder are rendered like frames from
+   built-in decoders. Takes precedence over SetCustomizedVideoDecoderEnabled.
+   @param Asynchronous video decoder
+   */
+  static void SetAsyncVideoDecoderEnabled(
+      std::unique_ptr<AsyncVideoDecoderInterface> async_video_decoder) {
+    async_video_decoder_ = std::move(async_video_decoder);
+  }
+  /**
+   @brief This function sets the number of threads shared by software video
+   encoders.
+   @details Software encoders of publications with
+   VideoEncoderPolicy::kSoftware always run on this pool, which has as many
+   threads as CPU cores, up to 4, by default. Setting a size also moves
+   software encoders of all other publications from their own threads to the
+   pool. Must be called before any PeerConnection is created.
+   @param threads Number of encoder threads. 0, the default, keeps software
+   encoders of other publications on their own threads.
+   */
+  static void SetSoftwareEncoderPoolSize(size_t threads) {
+    software_encoder_pool_size_ = threads;
+  }
 #endif
   /**
   @breif This function disables/enables auto echo cancellation.
@@ -375,6 +440,10 @@ class OWT_EXPORT GlobalConfiguration {
     return log_latency_to_file_enabled_;
   }
   static bool log_latency_to_file_enabled_;
+  static bool GetLatencyTracingEnabled() {
+    return latency_tracing_enabled_;
+  }
+  static bool latency_tracing_enabled_;
   /**
    @brief This function gets whether encoded video frame input is enabled or not.
    @return true or false.
@@ -407,6 +476,14 @@ class OWT_EXPORT GlobalConfiguration {
   }
 
   static bool post_encode_dump_enabled_;
+  static std::string GetBitstreamDumpDirectory() {
+    return bitstream_dump_directory_;
+  }
+  static std::string bitstream_dump_directory_;
+  static size_t GetBitstreamDumpMaxQueuedBytes() {
+    return bitstream_dump_max_queued_bytes_;
+  }
+  static size_t bitstream_dump_max_queued_bytes_;
 
   /**
    @brief This function gets whether auto echo cancellation is enabled or not.
@@ -475,6 +552,20 @@ class OWT_EXPORT GlobalConfiguration {
    * Customized video decoder. Default is nullptr.
    */
   static std::unique_ptr<VideoDecoderInterface> video_decoder_;
+  static bool GetAsyncVideoDecoderEnabled() {
+    return async_video_decoder_ ? true : false;
+  }
+  static std::unique_ptr<AsyncVideoDecoderInterface> GetAsyncVideoDecoder() {
+    return std::move(async_video_decoder_);
+  }
+  /**
+   * Asynchronous video decoder. Default is nullptr.
+   */
+  static std::unique_ptr<AsyncVideoDecoderInterface> async_video_decoder_;
+  static size_t GetSoftwareEncoderPoolSize() {
+    return software_encoder_pool_size_;
+  }
+  static size_t software_encoder_pool_size_;
 #endif
 
   static AudioProcessingSettings audio_processing_settings_;
@@ -0,0 +1,63 @@
+// Copyright (C) <2026> Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef OWT_BASE_LATENCYTRACER_H_
+#define OWT_BASE_LATENCYTRACER_H_
+
+#include <cstdint>
+#include <vector>
+#include "owt/base/export.h"
+
+namespace owt {
+namespace base {
+/**
+ @brief Points of a video frame's path where latency is measured.
+ @details Every stage is measured from the frame's capture time. Sender
+ stages use the local capture time. Receiver stages use the sender's capture
+ time carried by the absolute capture time RTP header extension, or estimated
+ from RTCP sender reports when the extension is not negotiated.
+*/
+enum class LatencyStage : int {
+  /// Frame handed to the encoder.
+  kEncodeStart = 0,
+  /// Encoder produced the encoded frame.
+  kEncodeEnd,
+  /// Encoded frame packetized and queued for sending.
+  kPacketized,
+  /// Last packet of the frame received.
+  kReceived,
+  /// Frame handed to the decoder.
+  kDecodeStart,
+  /// Decoder produced the frame.
+  kDecodeEnd,
+  /// Frame delivered to the renderer. This is the glass-to-glass latency.
+  kRendered,
+};
+
+/// Latency distribution of one stage, in milliseconds.
+struct OWT_EXPORT LatencyStageStatistics {
+  LatencyStage stage;
+  /// Number of frames measured.
+  uint64_t count;
+  double p50_ms;
+  double p90_ms;
+  double p99_ms;
+  double max_ms;
+};
+
+/**
+ @brief Per-frame latency tracing across capture, encode, network, decode and
+ render for all streams of the process.
+ @details Enable it with GlobalConfiguration::SetLatencyTracingEnabled before
+ creating any PeerConnection.
+*/
+class OWT_EXPORT LatencyTracer {
+ public:
+  /// Returns statistics of stages with at least one measurement.
+  static std::vector<LatencyStageStatistics> GetStatistics();
+  /// Clears all measurements.
+  static void Reset();
+};
+}  // namespace base
+}  // namespace owt
+#endif  // OWT_BASE_LATENCYTRACER_H_
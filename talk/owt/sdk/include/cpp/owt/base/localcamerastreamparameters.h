@@ -51,12 +51,21 @@ class OWT_EXPORT LocalCameraStreamParameters final {
     @param fps The frame rate of the video.
   */
   void Fps(int fps);
+  /**
+    @brief Set how frames are fit to the resolution of this stream.
+    When the camera is already open at another aspect ratio for another
+    stream, frames are stretched to the resolution by default.
+    @param crop If true, frames are center cropped to the aspect ratio of the
+    resolution instead.
+  */
+  void CropToAspectRatio(bool crop);
   /** @cond */
   std::string CameraId() const { return camera_id_; }
   std::string StreamName() const { return stream_name_; }
   int ResolutionWidth() const { return resolution_width_; }
   int ResolutionHeight() const { return resolution_height_; }
   int Fps() const { return fps_; }
+  bool CropToAspectRatio() const { return crop_to_aspect_ratio_; }
   bool VideoEnabled() const { return video_enabled_; }
   bool AudioEnabled() const { return audio_enabled_; }
   /** @endcond */
@@ -66,6 +75,7 @@ class OWT_EXPORT LocalCameraStreamParameters final {
   int resolution_width_;
   int resolution_height_;
   int fps_;
+  bool crop_to_aspect_ratio_;
   bool video_enabled_;
   bool audio_enabled_;
 };
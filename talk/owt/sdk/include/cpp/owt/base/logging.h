@@ -4,6 +4,8 @@
 #ifndef OWT_BASE_LOGGING_H_
 #define OWT_BASE_LOGGING_H_
 
+#include <cstdint>
+#include <string>
 #include "owt/base/export.h"
 
 namespace owt {
@@ -41,6 +43,9 @@ class OWT_EXPORT Logging final {
                               const std::string& dir,
                               const std::string& prefix,
                               size_t max_log_size);
+  /// Number of messages not written to the log file because they were logged
+  /// faster than the file could be written.
+  static uint64_t DroppedFileLogMessages();
 
  private:
   static LoggingSeverity min_severity_;
@@ -0,0 +1,65 @@
+// Copyright (C) <2026> Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef OWT_BASE_MEMORYACCOUNTING_H_
+#define OWT_BASE_MEMORYACCOUNTING_H_
+
+#include <cstddef>
+#include <string>
+#include <unordered_map>
+#include "owt/base/export.h"
+
+namespace owt {
+namespace base {
+/// Bytes currently held for one kind of allocation, and the most held at once.
+struct OWT_EXPORT MemoryUsage {
+  size_t bytes = 0;
+  size_t peak_bytes = 0;
+};
+
+/**
+ @brief Memory held by the SDK, by category.
+ @details Sizes are payload sizes of the queued items and buffers, so they
+ slightly underestimate what the allocator hands out.
+*/
+struct OWT_EXPORT MemoryReport {
+  /// Sum of all categories. Its peak is the peak of the sum.
+  MemoryUsage total;
+  /// Messages queued until a data channel opens, and signaling messages
+  /// waiting for the server's acknowledgement.
+  MemoryUsage pending_messages;
+  /// Remote candidates waiting for the remote description, and local
+  /// candidates waiting for the signaling state to become stable.
+  MemoryUsage pending_candidates;
+  /// Frame buffers of customized frame capturers.
+  MemoryUsage capturer_frame_buffers;
+  /// Buffers converted for VideoRendererInterface, until the renderer frees
+  /// them.
+  MemoryUsage renderer_buffers;
+  /// Encoded frames pushed by EncodedStreamProvider, until the encoder proxy
+  /// releases them.
+  MemoryUsage encoded_frames;
+};
+
+/// Memory held by a ConferenceClient or a P2PClient.
+struct OWT_EXPORT ClientMemoryReport {
+  /// Everything the client holds, including its channels.
+  MemoryReport client;
+  /// Channels keyed by remote user ID for P2PClient, and by publication or
+  /// subscription ID for ConferenceClient.
+  std::unordered_map<std::string, MemoryReport> channels;
+};
+
+/**
+ @brief Memory accounting of the whole process.
+ @details Capturer, renderer and encoded frame buffers belong to streams,
+ which may be shared by clients, so they are only reported here.
+*/
+class OWT_EXPORT MemoryAccounting {
+ public:
+  /// Returns memory held by all clients and streams of the process.
+  static MemoryReport GetProcessReport();
+};
+}  // namespace base
+}  // namespace owt
+#endif  // OWT_BASE_MEMORYACCOUNTING_H_
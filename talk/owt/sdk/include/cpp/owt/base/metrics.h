@@ -0,0 +1,43 @@
+// Copyright (C) <2026> Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef OWT_BASE_METRICS_H_
+#define OWT_BASE_METRICS_H_
+
+#include <functional>
+#include <string>
+#include "owt/base/export.h"
+
+namespace owt {
+namespace base {
+/**
+ @brief Operational metrics of all clients and streams of the process.
+ @details Metrics include frames captured and dropped by customized
+ capturers, encoded frame sizes of customized encoders, renderer conversions,
+ signaling message counts and latencies, and signaling reconnections. They are
+ always collected; exporting them is optional.
+*/
+class OWT_EXPORT Metrics {
+ public:
+  /// Returns all metrics in the Prometheus text exposition format 0.0.4.
+  static std::string GetPrometheusText();
+  /**
+   @brief Calls |exporter| with the output of GetPrometheusText every
+   |interval_ms|, on a thread of the SDK. Replaces the current exporter.
+  */
+  static void StartExporter(
+      std::function<void(const std::string& text)> exporter,
+      int interval_ms);
+  static void StopExporter();
+  /**
+   @brief Serves the output of GetPrometheusText for HTTP GET /metrics on
+   127.0.0.1:|port|, for a Prometheus server or agent on the same host.
+   @param port Port to listen on. 0 picks a free port.
+   @return The port listened on, or 0 on failure.
+  */
+  static int StartHttpExporter(int port);
+  static void StopHttpExporter();
+};
+}  // namespace base
+}  // namespace owt
+#endif  // OWT_BASE_METRICS_H_
@@ -4,6 +4,7 @@
 #ifndef OWT_BASE_STREAM_H_
 #define OWT_BASE_STREAM_H_
 #include <atomic>
+#include <memory>
 #include <mutex>
 #include <string>
 #include <unordered_map>
@@ -46,6 +47,9 @@ class ObjcVideoCapturerInterface;
 class VideoRenderWindow;
 class VideoRendererInterface;
 class VideoRendererVaInterface;
+#ifdef OWT_ENABLE_QUIC
+class RecordReassembler;
+#endif
 using webrtc::MediaStreamInterface;
 /// Observer for Stream
 class OWT_EXPORT StreamObserver {
@@ -177,6 +181,24 @@ class OWT_EXPORT Stream {
 };
 
 #ifdef OWT_ENABLE_QUIC
+/// Framing applied by SDK to data written to or read from a QuicStream.
+enum class QuicStreamFramingMode : int {
+  kRaw = 0,  ///< Plain byte stream. Application handles message boundaries.
+  kRecord,   ///< Each record is prefixed with a varint payload length.
+  kRecordWithTimestamp  ///< Like kRecord, plus a varint timestamp in
+                        ///< microseconds per record.
+};
+
+/// A complete record read from a QuicStream in record framing mode.
+struct OWT_EXPORT QuicStreamRecord {
+  /// Points to SDK owned memory. Valid until next call to ReadRecord() on the
+  /// same stream.
+  const uint8_t* data = nullptr;
+  size_t size = 0;
+  /// Timestamp attached by the writer. 0 if stream is in kRecord mode.
+  int64_t timestamp_us = 0;
+};
+
 /// A QuicStream can be fetched from a published LocalStream for data,
 /// on which you can write to server;
 /// Or from a subscription from server for data, on which you can read.
@@ -214,6 +236,40 @@ class OWT_EXPORT QuicStream : public owt::quic::WebTransportStreamInterface::Vis
    @return Bytes of data pending to be sent.
   */
   uint64_t BufferedDataBytes() const;
+  /**
+   @brief Set framing mode of the stream.
+   @details Both ends must use the same mode. Switching mode discards any
+   partially received record. Default mode is kRaw.
+   @param mode Framing mode to use for WriteRecord() and ReadRecord().
+   @param max_record_size Largest record payload accepted by ReadRecord().
+  */
+  void SetFramingMode(QuicStreamFramingMode mode,
+                      size_t max_record_size = 16 * 1024 * 1024);
+  QuicStreamFramingMode FramingMode() const { return framing_mode_; }
+  /**
+   @brief Write a record to server.
+   @details Only valid in record framing modes. Header and payload are
+   passed to the transport in one write. If the transport accepts only part
+   of a record, the stream is marked as failed and all later calls return
+   false, since the peer can no longer find record boundaries.
+   @param data Pointer to record payload.
+   @param length Size of record payload.
+   @param timestamp_us Timestamp to be carried with the record. Ignored in
+   kRecord mode.
+   @return true if the whole record was accepted by the transport.
+  */
+  bool WriteRecord(const uint8_t* data, size_t length, int64_t timestamp_us = 0);
+  /**
+   @brief Read next complete record.
+   @details Only valid in record framing modes. Reads all available bytes
+   from the transport, and returns next complete record if there is one.
+   Memory referenced by record is owned by the stream. Do not mix with
+   Read().
+   @param record Filled with the record on success.
+   @return true if a record is returned. false if more data is needed, or the
+   stream is malformed.
+  */
+  bool ReadRecord(QuicStreamRecord& record);
   void SetVisitor(owt::quic::WebTransportStreamInterface::Visitor* visitor) {
     if (quic_stream_ && visitor) {
       quic_stream_->SetVisitor(visitor);
@@ -240,6 +296,11 @@ class OWT_EXPORT QuicStream : public owt::quic::WebTransportStreamInterface::Vis
   std::atomic<bool> can_read_;
   std::atomic<bool> can_write_;
   std::atomic<bool> fin_read_;
+  QuicStreamFramingMode framing_mode_ = QuicStreamFramingMode::kRaw;
+  std::unique_ptr<RecordReassembler> reassembler_;
+  // Header and payload of the record being written. Reused across writes.
+  std::vector<uint8_t> write_buffer_;
+  bool write_failed_ = false;
 };
 #endif // OWT_ENABLE_QUIC
 
@@ -288,7 +349,9 @@ class OWT_EXPORT LocalStream : public Stream {
   /**
    @brief Create a local camera stream.
    @detail This creates a local camera stream with specified device
-   settings.
+   settings. Streams of the same camera share one capture. The camera is
+   opened with the settings of the first stream, and later streams get them
+   scaled down to their own resolution and frame rate.
    @param parameters Local camera stream settings for stream creation.
    @param error_code Error code will be set if creation fails.
    @return Pointer to created LocalStream.
@@ -345,6 +408,21 @@ class OWT_EXPORT LocalStream : public Stream {
   static std::shared_ptr<LocalStream> Create(
       std::shared_ptr<LocalCustomizedStreamParameters> parameters,
       std::unique_ptr<VideoFrameGeneratorInterface> framer);
+  /**
+    @brief Initialize a LocalCustomizedStream sharing a frame generator with
+    other streams.
+    @details All streams created with the same generator share one capture:
+    frames are generated once and fanned out to every stream, each adapting
+    them to its own consumers. The resolution and frame rate in |parameters|
+    cap what this stream gets, and 0 takes frames as generated.
+    @param parameters Parameters for creating the stream.
+    @param framer Generator shared by streams. The SDK keeps a reference until
+    the last stream using it is closed.
+    @return Pointer to created LocalStream.
+  */
+  static std::shared_ptr<LocalStream> CreateWithSharedGenerator(
+      std::shared_ptr<LocalCustomizedStreamParameters> parameters,
+      std::shared_ptr<VideoFrameGeneratorInterface> framer);
   /**
     @briefInitialize a local customized stream with parameters and encoder
     interface.
@@ -387,6 +465,9 @@ class OWT_EXPORT LocalStream : public Stream {
   explicit LocalStream(
       std::shared_ptr<LocalCustomizedStreamParameters> parameters,
       std::unique_ptr<VideoFrameGeneratorInterface> framer);
+  explicit LocalStream(
+      std::shared_ptr<LocalCustomizedStreamParameters> parameters,
+      std::shared_ptr<VideoFrameGeneratorInterface> framer);
   explicit LocalStream(
       std::shared_ptr<LocalCustomizedStreamParameters> parameters,
       std::shared_ptr<EncodedStreamProvider> encoder);
@@ -3,7 +3,9 @@
 // SPDX-License-Identifier: Apache-2.0
 #ifndef OWT_BASE_VIDEODECODERINTERFACE_H_
 #define OWT_BASE_VIDEODECODERINTERFACE_H_
+#include <functional>
 #include <memory>
+#include <vector>
 #include "owt/base/commontypes.h"
 namespace owt {
 namespace base {
@@ -19,6 +21,66 @@ struct OWT_EXPORT VideoEncodedFrame {
   uint32_t time_stamp;
   /// Key frame flag
   bool is_key_frame;
+  /// Keeps |buffer| valid after the call that delivered this frame returns.
+  /// Always set for frames passed to AsyncVideoDecoderInterface.
+  std::shared_ptr<const void> buffer_holder;
+};
+/**
+ @brief Metadata of an encoded frame received from remote endpoint.
+ @details Fields not carried by the RTP stream are set to -1.
+*/
+struct OWT_EXPORT VideoReceivedEncodedFrameInfo {
+  /// Codec of the frame.
+  VideoCodec codec = VideoCodec::kUnknown;
+  /// RTP timestamp (90kHz).
+  uint32_t rtp_timestamp = 0;
+  /// SSRC of the RTP stream carrying the frame.
+  uint32_t ssrc = 0;
+  /// Key frame flag
+  bool is_key_frame = false;
+  /// Frame resolution. Only set on key frames for most codecs.
+  int width = 0;
+  int height = 0;
+  /// Frame ID from dependency descriptor or generic frame info.
+  int64_t frame_id = -1;
+  /// Spatial and temporal layer indices.
+  int spatial_index = -1;
+  int temporal_index = -1;
+  /// IDs of frames this frame references.
+  std::vector<int64_t> dependencies;
+  /// VP8/VP9 picture ID and TL0PICIDX.
+  int picture_id = -1;
+  int tl0_pic_idx = -1;
+};
+/**
+ @brief Encoded frame received from remote endpoint without being decoded.
+ @details Buffer is owned by the frame and stays valid as long as the frame is
+ referenced by application. No copy of the bitstream is made by SDK.
+*/
+class OWT_EXPORT VideoReceivedEncodedFrame {
+ public:
+  virtual ~VideoReceivedEncodedFrame() {}
+  /// Encoded frame buffer
+  virtual const uint8_t* Data() const = 0;
+  /// Encoded frame buffer length
+  virtual size_t Size() const = 0;
+  /// Frame metadata
+  virtual const VideoReceivedEncodedFrameInfo& Info() const = 0;
+};
+/**
+ @brief Observer for receiving encoded frames of a subscription.
+ @details When set in subscribe options, video frames of the subscription are
+ delivered to this observer and are not decoded or rendered by SDK.
+ OnEncodedFrame is invoked on WebRTC's worker thread, so implementation should
+ return quickly. Release frames promptly as well. A frame is returned to
+ WebRTC when its last reference is released, and a receiver that gets no
+ frames back for a few seconds requests a key frame from the sender.
+*/
+class OWT_EXPORT VideoEncodedFrameObserver {
+ public:
+  virtual ~VideoEncodedFrameObserver() {}
+  virtual void OnEncodedFrame(
+      std::shared_ptr<VideoReceivedEncodedFrame> frame) = 0;
 };
 /**
  @brief Video decoder interface
@@ -52,6 +114,91 @@ class OWT_EXPORT VideoDecoderInterface {
    */
   virtual VideoDecoderInterface* Copy() = 0;
 };
+
+/// Buffer type of a frame produced by AsyncVideoDecoderInterface.
+enum class VideoDecodedFrameFormat : int {
+  kI420 = 0,  ///< 3 planes: Y, U, V.
+  kNV12,      ///< 2 planes: Y, interleaved UV.
+  kNative     ///< Platform surface passed through native_handle.
+};
+/**
+ @brief Decoded frame returned by AsyncVideoDecoderInterface.
+ @details Planes are not copied by SDK. |release| is invoked once SDK and all
+ renderers no longer reference the memory.
+*/
+struct OWT_EXPORT VideoDecodedFrame {
+  VideoDecodedFrameFormat format = VideoDecodedFrameFormat::kI420;
+  int width = 0;
+  int height = 0;
+  /// Plane pointers and strides. Unused entries are ignored.
+  const uint8_t* planes[3] = {nullptr, nullptr, nullptr};
+  int strides[3] = {0, 0, 0};
+  /// Surface handle for kNative frames.
+  void* native_handle = nullptr;
+  /// Timestamp of the encoded frame this frame is decoded from (90kHz).
+  uint32_t time_stamp = 0;
+  /// Time spent on decoding in milliseconds, or -1 if unknown.
+  int decode_time_ms = -1;
+  /// Invoked when frame memory can be reused by decoder.
+  std::function<void()> release;
+};
+/**
+ @brief Receives frames from an AsyncVideoDecoderInterface.
+ @details Can be invoked on any thread.
+*/
+class OWT_EXPORT VideoDecodeCompleteCallback {
+ public:
+  virtual ~VideoDecodeCompleteCallback() {}
+  virtual void OnFrameDecoded(std::unique_ptr<VideoDecodedFrame> frame) = 0;
+};
+/**
+ @brief Asynchronous video decoder interface
+ @details Unlike VideoDecoderInterface, decoded frames are returned to SDK and
+ go through WebRTC's render and stats pipeline. Decode() only queues the frame,
+ so decoding can run on decoder's own threads and overlap with receiving of
+ following frames.
+*/
+class OWT_EXPORT AsyncVideoDecoderInterface {
+ public:
+  virtual ~AsyncVideoDecoderInterface() {}
+  /**
+   @brief Initialize the decoder.
+   @param video_codec Video codec of the encoded video stream.
+   @param number_of_cores Number of CPU cores WebRTC allows decoder to use.
+   @param callback Receives decoded frames. Valid until Release() returns.
+   @return true if successful or false if failed
+  */
+  virtual bool InitDecodeContext(VideoCodec video_codec,
+                                 int number_of_cores,
+                                 VideoDecodeCompleteCallback* callback) = 0;
+  /**
+   @brief Queue an encoded frame for decoding.
+   @details Must not wait for decoding. |frame->buffer_holder| keeps the
+   bitstream alive as long as decoder holds the frame.
+   @return false if frame is rejected, e.g., decoder queue is full. A key frame
+   will be requested by SDK.
+  */
+  virtual bool Decode(std::unique_ptr<VideoEncodedFrame> frame) = 0;
+  /**
+   @brief Stop decoding and drop queued frames. No frames should be delivered
+   to callback after this returns.
+  */
+  virtual bool Release() = 0;
+  /**
+   @brief Creates a decoder instance for each peer connection.
+  */
+  virtual AsyncVideoDecoderInterface* Copy() = 0;
+  /**
+   @brief Create SDK's reference implementation.
+   @details Decodes VP8, VP9 and AV1 with built-in software decoders on a
+   dedicated thread, so depacketization and decoding of consecutive frames are
+   pipelined. Decoder internal threading is enabled according to
+   number_of_cores.
+   @param max_pending_frames Capacity of the decode queue.
+  */
+  static std::unique_ptr<AsyncVideoDecoderInterface> CreateBuiltin(
+      size_t max_pending_frames = 8);
+};
 }
 }
 #endif // OWT_BASE_VIDEODECODERINTERFACE_H_
@@ -195,19 +195,61 @@ class OWT_EXPORT EncoderEventCallback {
   virtual void RequestLossNotification(DependencyNotification notification) = 0;
 };
 
+/// Key frame request counters of an EncodedStreamProvider.
+struct OWT_EXPORT KeyFrameRequestStatistics {
+  /// Key frame requests received from the stack.
+  uint64_t requested = 0;
+  /// Requests passed to encoder observers after coalescing.
+  uint64_t forwarded = 0;
+  /// Key frames sent.
+  uint64_t key_frames = 0;
+};
+
+class BitrateLadder;
+class KeyFrameRequestLimiter;
+
 /**
   @brief Encoded stream provider
+  @details In bitrate ladder mode, the application registers renditions of the
+  same content encoded at different bitrates with AddRendition, and sends the
+  frames of all of them with the SendOneFrame overload taking a rendition
+  index. The provider sends the rendition that fits the bandwidth estimate,
+  switching at key frames and keeping picture IDs continuous. Renditions
+  should have the resolution the stream is created with. At a switch, the
+  previous rendition's frame of the same capture time is also sent if it was
+  passed to SendOneFrame before the key frame of the new rendition.
   */
 class OWT_EXPORT EncodedStreamProvider final
     : public std::enable_shared_from_this<EncodedStreamProvider> {
  public:
   static std::shared_ptr<EncodedStreamProvider> Create();
 
-  virtual ~EncodedStreamProvider() {}
+  virtual ~EncodedStreamProvider();
 
   void SendOneFrame(const std::vector<uint8_t>& buffer,
                     const EncodedImageMetaData& meta_data);
 
+  /// Registers a rendition encoded at |bitrate_kbps| and returns its index.
+  int AddRendition(uint32_t bitrate_kbps);
+
+  /// Sends one frame of rendition |rendition|. Frames of renditions other
+  /// than the selected one are dropped.
+  void SendOneFrame(int rendition,
+                    const std::vector<uint8_t>& buffer,
+                    const EncodedImageMetaData& meta_data);
+
+  /// Returns the index of the rendition being sent, or -1 if none is.
+  int CurrentRendition() const;
+
+  /// Sets the minimum interval between key frames requested from encoder
+  /// observers. Requests inside the interval are merged into one forwarded
+  /// when it ends, unless a key frame is sent first. Key frames are detected
+  /// by EncodedImageMetaData::is_keyframe. 0, the default, forwards every
+  /// request.
+  void SetKeyFrameRequestMinInterval(int interval_ms);
+
+  KeyFrameRequestStatistics GetKeyFrameRequestStatistics() const;
+
   // Not intented to be called by application. May move to private later.
   void RequestKeyFrame();
 
@@ -231,14 +273,21 @@ class OWT_EXPORT EncodedStreamProvider final
   void DeRegisterEncoderObserver(EncoderObserver& observer);
 
  protected:
-  EncodedStreamProvider() {}
+  EncodedStreamProvider();
 
  private:
+  void NotifyKeyFrameRequest();
+  void OnFrameSent(bool key_frame);
+
   bool streaming_started_ = false;
   EncodedStreamProviderSink* sink_ = nullptr;
   std::vector<std::reference_wrapper<EncoderObserver>>
       stream_provider_observers_;
   mutable std::mutex observer_mutex_;
+  std::unique_ptr<BitrateLadder> ladder_;
+  mutable std::mutex ladder_mutex_;
+  std::unique_ptr<KeyFrameRequestLimiter> key_frame_limiter_;
+  mutable std::mutex key_frame_mutex_;
 };
 
 /**
@@ -3,6 +3,7 @@
 // SPDX-License-Identifier: Apache-2.0
 #ifndef OWT_BASE_VIDEORENDERERINTERFACE_H_
 #define OWT_BASE_VIDEORENDERERINTERFACE_H_
+#include <functional>
 #include <memory>
 #include "owt/base/commontypes.h"
 #if defined(WEBRTC_WIN)
@@ -58,11 +59,15 @@ struct OWT_EXPORT VideoBuffer {
   Resolution resolution;
   // Buffer type
   VideoBufferType type;
+  /// Invoked when the buffer is freed, if set by the SDK.
+  std::function<void()> on_release;
   ~VideoBuffer() {
     if (type != VideoBufferType::kD3D11)
       delete[] buffer;
     else
       delete buffer;
+    if (on_release)
+      on_release();
   }
 };
 /// VideoRenderWindow wraps a native Window handle
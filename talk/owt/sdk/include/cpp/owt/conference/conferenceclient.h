@@ -14,6 +14,7 @@
 #include "owt/base/clientconfiguration.h"
 #include "owt/base/connectionstats.h"
 #include "owt/base/macros.h"
+#include "owt/base/memoryaccounting.h"
 #include "owt/base/options.h"
 #include "owt/base/stream.h"
 #include "owt/base/exception.h"
@@ -33,6 +34,7 @@ namespace webrtc{
 namespace owt {
 namespace base {
   struct PeerConnectionChannelConfiguration;
+  class MemoryAccount;
 }
 }
 namespace owt {
@@ -52,6 +54,22 @@ typedef std::string cert_fingerprint_t;
   created.
 */
 struct OWT_EXPORT ConferenceClientConfiguration : public ClientConfiguration {
+  ConferenceClientConfiguration() : resume_sessions(false) {}
+  /**
+   @brief Keep publications and subscriptions through signaling outages.
+   @details By default, media sessions are kept while signaling reconnects,
+   but an ICE failure in the meantime ends its session. When this is true, a
+   session whose transport fails during the outage is kept, and ICE restarted
+   after relogin. Sessions the server no longer has after relogin are ended.
+   If relogin fails, all sessions end as before.
+
+   The relogin ack may be the new reconnection ticket as a string, or an
+   object with `reconnectionTicket` and `room`, like the login ack. If it has
+   `room.streams`, sessions whose stream is not listed end right away.
+   Otherwise a session the server dropped ends when the server rejects the
+   offer that restarts its ICE. Only that publication or subscription ends.
+   */
+  bool resume_sessions;
 #ifdef OWT_ENABLE_QUIC
  public:
   // This function sets trusted server certificate fingerprints for
@@ -177,6 +195,11 @@ class OWT_EXPORT ConferenceSocketSignalingChannelObserver {
   virtual void OnStreamRemoved(std::shared_ptr<sio::message> stream) = 0;
   virtual void OnStreamUpdated(std::shared_ptr<sio::message> stream) = 0;
   virtual void OnServerDisconnected() = 0;
+  // Signaling is lost and being re-established with the reconnection ticket.
+  virtual void OnServerReconnecting() = 0;
+  // Relogin succeeded. |room_info| is the room as the server sees it now, or
+  // null if it was not returned.
+  virtual void OnServerReconnected(std::shared_ptr<sio::message> room_info) = 0;
   virtual void OnCustomMessage(std::string& from, std::string& message, std::string& to) = 0;
   virtual void OnSignalingMessage(std::shared_ptr<sio::message> message) = 0;
   virtual void OnStreamError(std::shared_ptr<sio::message> stream) = 0;
@@ -196,6 +219,9 @@ class OWT_EXPORT ConferencePeerConnectionChannelObserver {
   virtual void OnStreamError(
       std::shared_ptr<Stream> stream,
       std::shared_ptr<const Exception> exception) = 0;
+  // Triggered when server rejects the ICE restart of a session resumed after
+  // signaling reconnected, because it dropped the session meanwhile.
+  virtual void OnSessionDropped(const std::string& session_id) {}
 };
 #ifdef OWT_ENABLE_QUIC
 // The visitor interface for QuicTransportClientInterface
@@ -325,6 +351,65 @@ class OWT_EXPORT ConferenceClient final
       const SubscribeOptions& options,
       std::function<void(std::shared_ptr<ConferenceSubscription>)> on_success,
       std::function<void(std::unique_ptr<Exception>)> on_failure);
+  /**
+    @brief Subscribe many streams from the current room.
+    @details At most |max_concurrency| subscriptions are in progress at a
+    time, and the next one starts when one of them completes. 0 subscribes to
+    all streams at once. Each stream's result is reported through
+    |on_subscribed| or |on_failed|.
+    @param requests Streams and the options to subscribe each of them with.
+    @param on_subscribed Invoked when a stream is subscribed.
+    @param on_failed Invoked when subscribing a stream failed.
+    @param on_complete Invoked once after all subscriptions completed.
+  */
+  void SubscribeMany(
+      const std::vector<std::pair<std::shared_ptr<RemoteStream>,
+                                  SubscribeOptions>>& requests,
+      size_t max_concurrency,
+      std::function<void(std::shared_ptr<RemoteStream>,
+                         std::shared_ptr<ConferenceSubscription>)>
+          on_subscribed,
+      std::function<void(std::shared_ptr<RemoteStream>,
+                         std::unique_ptr<Exception>)> on_failed,
+      std::function<void()> on_complete);
+  /**
+    @brief Update many subscriptions at once.
+    @details Requests for all subscriptions are sent without waiting for the
+    server's acknowledgement of previous ones. Subscriptions' observers are
+    notified as if ConferenceSubscription::ApplyOptions was called.
+    @param updates Subscriptions and the options to apply to each of them.
+    @param on_success Invoked once after all updates succeeded.
+    @param on_failure Invoked once after all updates completed, if any of them
+    failed. Updates that succeeded are not reverted.
+  */
+  void UpdateSubscriptions(
+      const std::vector<std::pair<std::shared_ptr<ConferenceSubscription>,
+                                  SubscriptionUpdateOptions>>& updates,
+      std::function<void()> on_success,
+      std::function<void(std::unique_ptr<Exception>)> on_failure);
+  /**
+    @brief Mute |track_kind| of many subscriptions at once.
+    @details Same as ConferenceSubscription::Mute for each subscription, with
+    requests sent without waiting for each other and one completion callback.
+  */
+  void MuteSubscriptions(
+      const std::vector<std::shared_ptr<ConferenceSubscription>>&
+          subscriptions,
+      TrackKind track_kind,
+      std::function<void()> on_success,
+      std::function<void(std::unique_ptr<Exception>)> on_failure);
+  /**
+    @brief Unmute |track_kind| of many subscriptions at once.
+    @details Same as ConferenceSubscription::Unmute for each subscription,
+    with requests sent without waiting for each other and one completion
+    callback.
+  */
+  void UnmuteSubscriptions(
+      const std::vector<std::shared_ptr<ConferenceSubscription>>&
+          subscriptions,
+      TrackKind track_kind,
+      std::function<void()> on_success,
+      std::function<void(std::unique_ptr<Exception>)> on_failure);
   /**
     @brief Send messsage to all participants in the conference.
     @param message The message to be sent.
@@ -354,6 +439,17 @@ class OWT_EXPORT ConferenceClient final
   void CreateSendStream(
       std::function<void(std::shared_ptr<owt::base::LocalStream>)> on_success,
       std::function<void(std::unique_ptr<Exception>)> on_failure);
+  /**
+   @brief Creates a LocalStream for WebTransport with SDK record framing.
+   @details Records written with QuicStream::WriteRecord() are length
+   prefixed so subscribers can call QuicStream::ReadRecord() after setting the
+   same framing mode on the subscribed stream.
+   @param framing_mode Framing mode of the QuicStream created.
+  */
+  void CreateSendStream(
+      owt::base::QuicStreamFramingMode framing_mode,
+      std::function<void(std::shared_ptr<owt::base::LocalStream>)> on_success,
+      std::function<void(std::unique_ptr<Exception>)> on_failure);
 #endif
  protected:
   ConferenceClient(const ConferenceClientConfiguration& configuration);
@@ -370,6 +466,9 @@ class OWT_EXPORT ConferenceClient final
   virtual void OnStreamUpdated(std::shared_ptr<sio::message> stream) override;
   virtual void OnStreamError(std::shared_ptr<sio::message> stream) override;
   virtual void OnServerDisconnected() override;
+  virtual void OnServerReconnecting() override;
+  virtual void OnServerReconnected(
+      std::shared_ptr<sio::message> room_info) override;
   virtual void OnStreamId(const std::string& id,
                           const std::string& publish_stream_label) override;
   virtual void OnSubscriptionId(const std::string& subscription_id,
@@ -378,6 +477,7 @@ class OWT_EXPORT ConferenceClient final
   virtual void OnStreamError(
       std::shared_ptr<Stream> stream,
       std::shared_ptr<const Exception> exception) override;
+  virtual void OnSessionDropped(const std::string& session_id) override;
   // Provide access for Publication and Subscription instances.
   /**
     @brief Un-publish the stream from the current room.
@@ -439,6 +539,20 @@ class OWT_EXPORT ConferenceClient final
       TrackKind track_kind,
       std::function<void()> on_success,
       std::function<void(std::unique_ptr<Exception>)> on_failure);
+  /**
+    @brief Apply |encodings| to a publication's video without renegotiation.
+  */
+  void UpdateEncodings(
+      const std::string& session_id,
+      const std::vector<RtpEncodingParameters>& encodings,
+      std::function<void()> on_success,
+      std::function<void(std::unique_ptr<Exception>)> on_failure);
+  /**
+    @brief Get memory held by pending signaling messages and candidates.
+    @details Channels are keyed by publication or subscription ID. Channels
+    not acknowledged by the server yet only count towards the client.
+  */
+  ClientMemoryReport GetMemoryReport() const;
  private:
 #ifdef OWT_ENABLE_QUIC
   // Overrides WebTransportChannelObserver
@@ -463,6 +577,18 @@ class OWT_EXPORT ConferenceClient final
       std::function<void(std::unique_ptr<Exception>)> on_failure);
   PeerConnectionChannelConfiguration GetPeerConnectionChannelConfiguration()
       const;
+  // Subscribes |stream| on |pcc|, or on a new channel if |pcc| is nullptr.
+  // |pcc| must be created by CreateSubscribeChannel with the same |options|.
+  void SubscribeWithChannel(
+      std::shared_ptr<RemoteStream> stream,
+      const SubscribeOptions& options,
+      std::shared_ptr<ConferencePeerConnectionChannel> pcc,
+      std::function<void(std::shared_ptr<ConferenceSubscription>)> on_success,
+      std::function<void(std::unique_ptr<Exception>)> on_failure);
+  // Creates a channel for subscribing with |options|. Blocks until its
+  // PeerConnection is created.
+  std::shared_ptr<ConferencePeerConnectionChannel> CreateSubscribeChannel(
+      const SubscribeOptions& options);
   // Get the |ConferencePeerConnectionChannel| instance associated with specific
   // |session_id|. Return |nullptr| if not found.
   std::shared_ptr<ConferencePeerConnectionChannel>
@@ -471,6 +597,9 @@ class OWT_EXPORT ConferenceClient final
   void TriggerOnUserLeft(std::shared_ptr<sio::message> user_info);
   void TriggerOnStreamAdded(std::shared_ptr<sio::message> stream_info, bool joining = false);
   void TriggerOnStreamRemoved(std::shared_ptr<sio::message> stream_info);
+  // Removes stream |id| if it was added, and ends publications and
+  // subscriptions of it.
+  void TriggerOnStreamRemoved(const std::string& id);
   void TriggerOnStreamUpdated(std::shared_ptr<sio::message> stream_info);
   void TriggerOnStreamError(std::shared_ptr<Stream> stream,
                             std::shared_ptr<const Exception> exception);
@@ -497,10 +626,14 @@ class OWT_EXPORT ConferenceClient final
   bool ParseWebTransportToken();
 #endif
   enum StreamType: int;
+  class SubscribeQueue;
   ConferenceClientConfiguration configuration_;
   // Queue for callbacks and events. Shared among ConferenceClient and all of
   // it's ConferencePeerConnectionChannels or ConferenceWebTransportChannels
   std::shared_ptr<rtc::TaskQueue> event_queue_;
+  // Parent of the signaling channel's and all peer connection channels'
+  // accounts.
+  std::shared_ptr<MemoryAccount> memory_account_;
   std::shared_ptr<ConferenceSocketSignalingChannel> signaling_channel_;
   std::mutex observer_mutex_;
   bool signaling_channel_connected_;
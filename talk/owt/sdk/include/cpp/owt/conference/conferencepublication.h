@@ -50,6 +50,23 @@ class OWT_EXPORT ConferencePublication : public Publication, public ConferenceSt
         std::function<void(
             const std::vector<const webrtc::StatsReport*>& reports)> on_success,
         std::function<void(std::unique_ptr<Exception>)> on_failure);
+    /**
+     @brief Update the video encodings of this publication while it is live.
+     @details Applied through the RTP sender without renegotiation, so viewers
+     see no gap. Each entry updates the encoding with the same rid, or the
+     only encoding of a publication without simulcast when rid is empty.
+     Fields left at 0 and the default priority keep their current values;
+     |active| is always applied. Rids and temporal layers cannot change. An
+     unknown rid or invalid value fails without changing any encoding.
+     @param encodings New settings for one or more encodings.
+     @param on_success Invoked when the settings are applied.
+     @param on_failure Invoked with kConferenceInvalidParam if the settings
+     are rejected.
+    */
+    void UpdateEncodings(
+        const std::vector<RtpEncodingParameters>& encodings,
+        std::function<void()> on_success,
+        std::function<void(std::unique_ptr<Exception>)> on_failure);
     /// Stop current publication.
     void Stop() override;
     /// Check if the publication is stopped or not
@@ -62,6 +79,7 @@ class OWT_EXPORT ConferencePublication : public Publication, public ConferenceSt
     void OnStreamMuteOrUnmute(const std::string& stream_id, TrackKind track_kind, bool muted) override;
     void OnStreamRemoved(const std::string& stream_id) override;
     void OnStreamError(const std::string& error_msg) override;
+    void OnSessionEnded(const std::string& session_id) override;
     std::string id_;
     std::string stream_id_;
     bool ended_;
@@ -8,6 +8,7 @@
 #include "owt/base/commontypes.h"
 #include "owt/base/macros.h"
 #include "owt/base/mediaconstraints.h"
+#include "owt/base/options.h"
 #include "owt/base/subscription.h"
 #include "owt/base/connectionstats.h"
 #include "owt/base/exception.h"
@@ -28,6 +29,7 @@ class QuicTransportStreamInterface;
   namespace owt {
 namespace conference {
 class ConferenceClient;
+class SubscriptionLayerAdapter;
 using namespace owt::base;
 class OWT_EXPORT ConferenceSubscription : public ConferenceStreamUpdateObserver,
                                public std::enable_shared_from_this<ConferenceSubscription> {
@@ -55,6 +57,13 @@ class OWT_EXPORT ConferenceSubscription : public ConferenceStreamUpdateObserver,
     void GetStats(
         std::function<void(std::shared_ptr<RTCStatsReport>)> on_success,
         std::function<void(std::unique_ptr<Exception>)> on_failure);
+    /**
+     @brief Set the size the video of current subscription is rendered at.
+     @details Only takes effect if the subscription was created with
+     adaptive_layer_selection enabled. Layers larger than needed for |target|
+     are not received. 0x0 removes the limit.
+    */
+    void SetTargetResolution(const Resolution& target);
     /// Stop current subscription.
     void Stop();
     /// If the Subscription is stopped or not.
@@ -74,9 +83,13 @@ class OWT_EXPORT ConferenceSubscription : public ConferenceStreamUpdateObserver,
     /// Remove observer on the subscription.
     void RemoveObserver(SubscriptionObserver& observer);
   private:
+    friend class ConferenceClient;
+    void StartLayerAdaptation(const PublicationSettings& settings,
+                              const VideoSubscriptionConstraints& constraints);
     void OnStreamMuteOrUnmute(const std::string& stream_id, TrackKind track_kind, bool muted);
     void OnStreamRemoved(const std::string& stream_id);
     void OnStreamError(const std::string& error_msg);
+    void OnSessionEnded(const std::string& session_id);
 #ifdef OWT_ENABLE_QUIC
     void OnIncomingStream(const std::string& session_id, owt::quic::WebTransportStreamInterface* stream);
 #endif
@@ -87,6 +100,7 @@ class OWT_EXPORT ConferenceSubscription : public ConferenceStreamUpdateObserver,
     std::vector<std::reference_wrapper<SubscriptionObserver>> observers_;
     std::weak_ptr<ConferenceClient>  conference_client_;   // Weak ref to associated conference client
     std::shared_ptr<rtc::TaskQueue> event_queue_;
+    std::shared_ptr<SubscriptionLayerAdapter> layer_adapter_;
 #ifdef OWT_ENABLE_QUIC
     std::shared_ptr<owt::base::QuicStream> quic_stream_;
 #endif
@@ -20,6 +20,11 @@ public:
     owt::base::TrackKind track_kind, bool muted) {}
   virtual void OnStreamRemoved(const std::string& stream_id) {}
   virtual void OnStreamError(const std::string& error_msg){}
+  /**
+  @brief Triggers when server no longer has publication or subscription
+  |session_id| after signaling reconnected.
+  */
+  virtual void OnSessionEnded(const std::string& session_id) {}
 #ifdef OWT_ENABLE_QUIC
   virtual void OnIncomingStream(
       const std::string& session_id, owt::quic::WebTransportStreamInterface* stream) {}
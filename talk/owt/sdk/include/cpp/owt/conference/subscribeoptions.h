@@ -4,7 +4,9 @@
 
 #ifndef OWT_CONFERENCE_SUBSCRIBEOPTIONS_H_
 #define OWT_CONFERENCE_SUBSCRIBEOPTIONS_H_
+#include <memory>
 #include "owt/base/commontypes.h"
+#include "owt/base/videodecoderinterface.h"
 namespace owt {
 namespace conference {
 /// Audio subscription contraints.
@@ -24,6 +26,13 @@ struct OWT_EXPORT VideoSubscriptionConstraints {
    @brief Construct VideoSubscriptionConstraints with default values.
    @details By default the publication settings of stream is used.
    if rid is specified, other fields will be ignored.
+   If encoded_frame_observer is set, received video frames are delivered to it
+   without decoding, and the video track of remote stream will not render
+   anything.
+   If adaptive_layer_selection is true and the stream is published with
+   simulcast, the subscription switches between layers according to its
+   connection stats and the size set by ConferenceSubscription's
+   SetTargetResolution.
   */
   explicit VideoSubscriptionConstraints()
       : disabled(false),
@@ -31,7 +40,8 @@ struct OWT_EXPORT VideoSubscriptionConstraints {
         frameRate(0),
         bitrateMultiplier(0),
         keyFrameInterval(0),
-        rid("") {}
+        rid(""),
+        adaptive_layer_selection(false) {}
   bool disabled;
   std::vector<owt::base::VideoCodecParameters> codecs;
   owt::base::Resolution resolution;
@@ -39,6 +49,8 @@ struct OWT_EXPORT VideoSubscriptionConstraints {
   double bitrateMultiplier;
   unsigned long keyFrameInterval;
   std::string rid;
+  bool adaptive_layer_selection;
+  std::shared_ptr<owt::base::VideoEncodedFrameObserver> encoded_frame_observer;
 };
 
 #ifdef OWT_ENABLE_QUIC
@@ -67,11 +79,14 @@ struct OWT_EXPORT VideoSubscriptionUpdateConstraints {
       : resolution(0, 0),
         frameRate(0),
         bitrateMultiplier(0),
-        keyFrameInterval(0) {}
+        keyFrameInterval(0),
+        rid("") {}
   owt::base::Resolution resolution;
   double frameRate;
   double bitrateMultiplier;
   unsigned long keyFrameInterval;
+  /// Simulcast layer to switch to. Empty to keep the current layer.
+  std::string rid;
 };
 /// Subscription update option used by subscription's ApplyOptions API.
 struct OWT_EXPORT SubscriptionUpdateOptions {
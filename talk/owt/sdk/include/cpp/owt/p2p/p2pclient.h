@@ -12,6 +12,7 @@
 #include "owt/base/commontypes.h"
 #include "owt/base/connectionstats.h"
 #include "owt/base/macros.h"
+#include "owt/base/memoryaccounting.h"
 #include "owt/base/stream.h"
 #include "owt/base/export.h"
 #include "owt/p2p/p2ppublication.h"
@@ -25,6 +26,7 @@ namespace rtc {
 namespace owt {
 namespace base {
   struct PeerConnectionChannelConfiguration;
+  class MemoryAccount;
 }
 namespace p2p{
 
@@ -38,6 +40,25 @@ class P2PPeerConnectionChannelObserver;
 struct OWT_EXPORT P2PClientConfiguration : owt::base::ClientConfiguration {
   std::vector<AudioEncodingParameters> audio_encodings;
   std::vector<VideoEncodingParameters> video_encodings;
+  /**
+   @brief Encode each published video track once for all remote users.
+   Encoded frames are sent to every remote user the track is published to.
+   The first entry of video_encodings, or VP8 if empty, is used, so remote
+   users must support it. Windows and Linux only.
+   */
+  bool shared_video_encoding = false;
+  /**
+   @brief Remote user whose bandwidth estimation drives the shared encoder.
+   Empty to follow the remote user with the lowest estimation.
+   */
+  std::string shared_video_encoding_rate_peer;
+  /**
+   @brief Send signaling messages in a compact binary encoding instead of
+   JSON to remote users supporting it. Only enable it if the signaling
+   channel delivers messages with arbitrary bytes, including zero bytes,
+   unmodified. Messages from remote users are accepted in both encodings.
+   */
+  bool compact_signaling = false;
 };
 class P2PPeerConnectionChannelObserverCppImpl;
 class P2PPeerConnectionChannel;
@@ -237,6 +258,11 @@ class OWT_EXPORT P2PClient final
       std::function<void(std::shared_ptr<owt::base::RTCStatsReport>)>
           on_success,
       std::function<void(std::unique_ptr<Exception>)> on_failure);
+  /**
+   @brief Get memory held by this client's pending messages and candidates.
+   @details Channels are keyed by remote user ID.
+   */
+  owt::base::ClientMemoryReport GetMemoryReport();
   /** @cond */
   void SetLocalId(const std::string& local_id);
   /** @endcond */
@@ -276,6 +302,8 @@ class OWT_EXPORT P2PClient final
   // P2PPeerConnectionChannel.
   std::shared_ptr<rtc::TaskQueue> event_queue_;
   std::shared_ptr<rtc::TaskQueue> signaling_queue_;
+  // Parent of all channels' accounts.
+  std::shared_ptr<owt::base::MemoryAccount> memory_account_;
   std::shared_ptr<P2PSignalingChannelInterface> signaling_channel_;
   std::unique_ptr<P2PSignalingSenderInterface> signaling_sender_;
   std::unique_ptr<P2PPeerConnectionChannelObserver> pcc_observer_adapter_;
@@ -12,13 +12,17 @@
 #include "webrtc/rtc_base/strings/json.h"
 #include "webrtc/rtc_base/task_queue.h"
 #include "webrtc/rtc_base/third_party/base64/base64.h"
+#include "webrtc/rtc_base/time_utils.h"
 #include "talk/owt/sdk/base/eventtrigger.h"
+#include "talk/owt/sdk/base/memoryaccount.h"
+#include "talk/owt/sdk/base/metricsregistry.h"
 #include "talk/owt/sdk/base/stringutils.h"
 #include "talk/owt/sdk/include/cpp/owt/base/stream.h"
 #include "talk/owt/sdk/include/cpp/owt/p2p/p2pclient.h"
 #include "talk/owt/sdk/p2p/p2ppeerconnectionchannel.h"
 #include "talk/owt/sdk/p2p/p2ppeerconnectionchannelobservercppimpl.h"
 #include "talk/owt/sdk/p2p/p2psignalingsenderimpl.h"
+#include "talk/owt/sdk/p2p/signalingcodec.h"
 
 using namespace rtc;
 namespace owt {
@@ -30,11 +34,34 @@ const std::string kSessionDescriptionTypeKey = "type";
 const std::string kChatClosed = "chat-closed";
 const std::string kChatSignal = "chat-signal";
 const std::string kSdpTypeOffer = "offer";
+namespace {
+owt::base::MetricCounter* MessagesCounter(bool sent) {
+  static owt::base::MetricCounter* sent_messages =
+      owt::base::MetricsRegistry::Get()->Counter(
+          "owt_signaling_messages_total", "Signaling messages.",
+          {{"client", "p2p"}, {"direction", "sent"}});
+  static owt::base::MetricCounter* received_messages =
+      owt::base::MetricsRegistry::Get()->Counter(
+          "owt_signaling_messages_total", "Signaling messages.",
+          {{"client", "p2p"}, {"direction", "received"}});
+  return sent ? sent_messages : received_messages;
+}
+owt::base::MetricHistogram* RequestDurations() {
+  static owt::base::MetricHistogram* histogram =
+      owt::base::MetricsRegistry::Get()->Histogram(
+          "owt_signaling_request_duration_ms",
+          "Time from sending a signaling message to its acknowledgement.",
+          owt::base::MetricsRegistry::DurationBoundsMs(),
+          {{"client", "p2p"}});
+  return histogram;
+}
+}  // namespace
 
 P2PClient::P2PClient(
     P2PClientConfiguration& configuration,
     std::shared_ptr<P2PSignalingChannelInterface> signaling_channel)
-    : signaling_channel_(signaling_channel),
+    : memory_account_(std::make_shared<MemoryAccount>()),
+      signaling_channel_(signaling_channel),
       signaling_sender_(std::make_unique<P2PSignalingSenderImpl>(this)),
       pcc_observer_adapter_(
           std::make_unique<P2PPeerConnectionChannelObserverCppImpl>(*this)),
@@ -244,6 +271,7 @@ void P2PClient::SetLocalId(const std::string& local_id) {
 void P2PClient::OnSignalingMessage(const std::string& message,
                                    const std::string& remote_id) {
   RTC_LOG(LS_VERBOSE) << "Receiving signaling message from remote:" << message;
+  MessagesCounter(false)->Increment();
   std::weak_ptr<P2PClient> weak_this = shared_from_this();
   signaling_queue_->PostTask([weak_this, remote_id, message]() {
     auto that = weak_this.lock();
@@ -255,11 +283,18 @@ void P2PClient::OnSignalingMessage(const std::string& message,
           << "Chat cannot be setup since the remote user is not allowed.";
       return;
     }
-    Json::Reader reader;
     Json::Value json_message;
-    if (!reader.parse(message, json_message)) {
-      RTC_LOG(LS_WARNING) << "Cannot parse incoming message.";
-      return;
+    if (SignalingCodec::IsCompact(message)) {
+      if (!SignalingCodec::Decode(message, &json_message)) {
+        RTC_LOG(LS_WARNING) << "Cannot decode incoming message.";
+        return;
+      }
+    } else {
+      Json::Reader reader;
+      if (!reader.parse(message, json_message)) {
+        RTC_LOG(LS_WARNING) << "Cannot parse incoming message.";
+        return;
+      }
     }
     std::string message_type;
     rtc::GetStringFromJsonObject(json_message, kMessageTypeKey, &message_type);
@@ -312,7 +347,16 @@ void P2PClient::SendSignalingMessage(
     const std::string& remote_id,
     std::function<void()> on_success,
     std::function<void(std::unique_ptr<Exception>)> on_failure) {
-  signaling_channel_->SendMessage(message, remote_id, on_success, on_failure);
+  MessagesCounter(true)->Increment();
+  int64_t sent_ms = rtc::TimeMillis();
+  signaling_channel_->SendMessage(
+      message, remote_id,
+      [on_success, sent_ms]() {
+        RequestDurations()->Observe(rtc::TimeMillis() - sent_ms);
+        if (on_success)
+          on_success();
+      },
+      on_failure);
 }
 void P2PClient::AddObserver(P2PClientObserver& observer) {
   observers_.push_back(observer);
@@ -349,6 +393,14 @@ bool P2PClient::IsPeerConnectionChannelCreated(const std::string& target_id) {
     return false;
   return true;
 }
+owt::base::ClientMemoryReport P2PClient::GetMemoryReport() {
+  owt::base::ClientMemoryReport report;
+  report.client = memory_account_->Report();
+  const std::lock_guard<std::mutex> lock(pc_channels_mutex_);
+  for (const auto& pcc : pc_channels_)
+    report.channels[pcc.first] = pcc.second->GetMemoryReport();
+  return report;
+}
 std::shared_ptr<P2PPeerConnectionChannel> P2PClient::GetPeerConnectionChannel(
     const std::string& target_id,
     bool replace) {
@@ -368,7 +420,7 @@ std::shared_ptr<P2PPeerConnectionChannel> P2PClient::GetPeerConnectionChannel(
     std::shared_ptr<P2PPeerConnectionChannel> pcc =
         std::shared_ptr<P2PPeerConnectionChannel>(new P2PPeerConnectionChannel(
             config, local_id_, target_id, signaling_sender_.get(),
-            event_queue_));
+            event_queue_, memory_account_));
     pcc->AddObserver(pcc_observer_adapter_.get());
     auto pcc_pair =
         std::pair<std::string, std::shared_ptr<P2PPeerConnectionChannel>>(
@@ -405,6 +457,10 @@ P2PClient::GetPeerConnectionChannelConfiguration() {
   for (auto codec : configuration_.audio_encodings) {
     config.audio.push_back(AudioEncodingParameters(codec));
   }
+  config.shared_video_encoding = configuration_.shared_video_encoding;
+  config.shared_video_encoding_rate_peer =
+      configuration_.shared_video_encoding_rate_peer;
+  config.compact_signaling = configuration_.compact_signaling;
   // TODO(jianlin): For publisher, peerconnection is created before UA info is
   // received. so signaling protocol change is needed if we would like to remove
   // this HC.
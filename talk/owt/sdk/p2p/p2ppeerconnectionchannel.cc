@@ -4,10 +4,16 @@
 #include <thread>
 #include <vector>
 #include "talk/owt/sdk/base/eventtrigger.h"
+#include "talk/owt/sdk/base/framelatencytracer.h"
 #include "talk/owt/sdk/base/functionalobserver.h"
 #include "talk/owt/sdk/base/sdputils.h"
+#if defined(WEBRTC_WIN) || defined(WEBRTC_LINUX)
+#include "talk/owt/sdk/base/sharedvideoencoder.h"
+#endif
 #include "talk/owt/sdk/base/sysinfo.h"
 #include "talk/owt/sdk/p2p/p2ppeerconnectionchannel.h"
+#include "talk/owt/sdk/p2p/signalingcodec.h"
+#include "webrtc/api/rtp_parameters.h"
 #include "webrtc/rtc_base/logging.h"
 #include "webrtc/api/task_queue/default_task_queue_factory.h"
 #include "webrtc/system_wrappers/include/field_trial.h"
@@ -73,6 +79,7 @@ const string kUaContinualGatheringKey = "continualIceGathering";
 const string kUaUnifiedPlanKey = "unifiedPlan";
 const string kUaStreamRemovableKey = "streamRemovable";
 const string kUaIgnoresDataChannelAcksKey = "ignoreDataChannelAcks";
+const string kUaCompactSignalingKey = "compactSignaling";
 // Text message sent through data channel
 const string kDataChannelLabelForTextMessage = "message";
 const string kDataChannelLabelForControlMessage = "control";
@@ -83,7 +90,8 @@ P2PPeerConnectionChannel::P2PPeerConnectionChannel(
     const std::string& local_id,
     const std::string& remote_id,
     P2PSignalingSenderInterface* sender,
-    std::shared_ptr<rtc::TaskQueue> event_queue)
+    std::shared_ptr<rtc::TaskQueue> event_queue,
+    std::shared_ptr<MemoryAccount> client_memory_account)
     : PeerConnectionChannel(configuration),
       signaling_sender_(sender),
       local_id_(local_id),
@@ -95,12 +103,15 @@ P2PPeerConnectionChannel::P2PPeerConnectionChannel(
           std::chrono::time_point<std::chrono::system_clock>::max()),
       reconnect_timeout_(10),
       message_seq_num_(0),
+      pending_remote_candidates_bytes_(0),
+      memory_account_(std::make_shared<MemoryAccount>(client_memory_account)),
       remote_side_supports_plan_b_(false),
       remote_side_supports_remove_stream_(false),
       remote_side_supports_unified_plan_(true),
       is_creating_offer_(false),
       remote_side_supports_continual_ice_gathering_(true),
       remote_side_ignores_datachannel_acks_(false),
+      remote_side_supports_compact_signaling_(false),
       ua_sent_(false),
       stop_send_needed_(true),
       remote_side_offline_(false),
@@ -255,6 +266,8 @@ void P2PPeerConnectionChannel::Send(
         std::lock_guard<std::mutex> lock(pending_messages_mutex_);
         std::shared_ptr<std::string> data_copy(
             std::make_shared<std::string>(data));
+        memory_account_->Add(MemoryCategory::kPendingMessages,
+                             data_copy->size());
         pending_messages_.push_back(
             std::tuple<std::shared_ptr<std::string>, std::function<void()>,
                        std::function<void(std::unique_ptr<Exception>)>>{
@@ -273,6 +286,8 @@ void P2PPeerConnectionChannel::Send(
         std::lock_guard<std::mutex> lock(pending_control_messages_mutex_);
         std::shared_ptr<std::string> data_copy(
             std::make_shared<std::string>(data));
+        memory_account_->Add(MemoryCategory::kPendingMessages,
+                             data_copy->size());
         pending_control_messages_.push_back(
             std::tuple<std::shared_ptr<std::string>, std::function<void()>,
                        std::function<void(std::unique_ptr<Exception>)>>{
@@ -323,6 +338,10 @@ void P2PPeerConnectionChannel::CreateOffer() {
   auto offer_answer_options =
       webrtc::PeerConnectionInterface::RTCOfferAnswerOptions();
   offer_answer_options.use_rtp_mux = !rtp_no_mux;
+  if (FrameLatencyTracer::Enabled()) {
+    // Lets the receiver correlate frames with the sender's capture clock.
+    OfferVideoHeaderExtension(webrtc::RtpExtension::kAbsoluteCaptureTimeUri);
+  }
   peer_connection_->CreateOffer(observer.get(), offer_answer_options);
 }
 void P2PPeerConnectionChannel::CreateAnswer() {
@@ -347,9 +366,11 @@ void P2PPeerConnectionChannel::SendSignalingMessage(
     std::function<void(std::unique_ptr<Exception>)> on_failure) {
   if (!signaling_sender_)
     return;
-  std::string json_string = rtc::JsonValueToString(data);
+  std::string message = remote_side_supports_compact_signaling_
+                            ? SignalingCodec::Encode(data)
+                            : rtc::JsonValueToString(data);
   signaling_sender_->SendSignalingMessage(
-      json_string, remote_id_, on_success,
+      message, remote_id_, on_success,
       [=](std::unique_ptr<Exception> exception) {
         if (exception->Type() == ExceptionType::kP2PMessageTargetUnreachable) {
           remote_side_offline_ = true;
@@ -457,8 +478,11 @@ void P2PPeerConnectionChannel::OnMessageStop() {
     std::lock_guard<std::mutex> lock(pending_messages_mutex_);
     for (auto it = pending_messages_.begin(); it != pending_messages_.end();
          ++it) {
+      std::shared_ptr<std::string> message;
       std::function<void(std::unique_ptr<Exception>)> on_failure;
-      std::tie(std::ignore, std::ignore, on_failure) = *it;
+      std::tie(message, std::ignore, on_failure) = *it;
+      memory_account_->Release(MemoryCategory::kPendingMessages,
+                               message->size());
       if (on_failure) {
         event_queue_->PostTask([on_failure] {
           std::unique_ptr<Exception> e(
@@ -474,8 +498,11 @@ void P2PPeerConnectionChannel::OnMessageStop() {
     std::lock_guard<std::mutex> lock(pending_control_messages_mutex_);
     for (auto it = pending_control_messages_.begin(); it != pending_control_messages_.end();
          ++it) {
+      std::shared_ptr<std::string> message;
       std::function<void(std::unique_ptr<Exception>)> on_failure;
-      std::tie(std::ignore, std::ignore, on_failure) = *it;
+      std::tie(message, std::ignore, on_failure) = *it;
+      memory_account_->Release(MemoryCategory::kPendingMessages,
+                               message->size());
       if (on_failure) {
         event_queue_->PostTask([on_failure] {
           std::unique_ptr<Exception> e(
@@ -551,6 +578,9 @@ void P2PPeerConnectionChannel::OnMessageSignal(Json::Value& message) {
       webrtc::MutexLock lock(&pending_remote_candidates_crit_);
       pending_remote_candidates_.push_back(
           std::unique_ptr<webrtc::IceCandidateInterface>(ice_candidate));
+      size_t candidate_size = sdp_mid.size() + candidate.size();
+      pending_remote_candidates_bytes_ += candidate_size;
+      memory_account_->Add(MemoryCategory::kPendingCandidates, candidate_size);
       RTC_LOG(LS_VERBOSE) << "Remote candidate is stored because remote "
                              "session description is missing.";
     }
@@ -1123,6 +1153,10 @@ void P2PPeerConnectionChannel::GetStats(
       webrtc::PeerConnectionInterface::kStatsOutputLevelDebug);
 }
 
+MemoryReport P2PPeerConnectionChannel::GetMemoryReport() const {
+  return memory_account_->Report();
+}
+
 bool P2PPeerConnectionChannel::HaveLocalOffer() {
   return SignalingState() == webrtc::PeerConnectionInterface::kHaveLocalOffer;
 }
@@ -1183,6 +1217,22 @@ void P2PPeerConnectionChannel::DrainPendingStreams() {
         track_info[kTrackIdKey] = track->id();
         track_info[kTrackSourceKey] = video_track_source;
         track_sources.append(track_info);
+#if defined(WEBRTC_WIN) || defined(WEBRTC_LINUX)
+        if (configuration_.shared_video_encoding) {
+          // Send frames encoded once for all remote endpoints.
+          auto encoder = SharedVideoEncoder::ForTrack(
+              track,
+              configuration_.video.empty() ? VideoEncodingParameters()
+                                           : configuration_.video[0],
+              configuration_.shared_video_encoding_rate_peer);
+          auto result = peer_connection_->AddTrack(
+              SharedVideoEncoder::CreatePeerTrack(encoder, remote_id_),
+              {media_stream->id()});
+          if (result.ok())
+            shared_video_senders_[track->id()] = result.MoveValue();
+          continue;
+        }
+#endif
         peer_connection_->AddTrack(track, {media_stream->id()});
       }
       // The second signaling message of track sources to remote peer.
@@ -1211,6 +1261,13 @@ void P2PPeerConnectionChannel::DrainPendingStreams() {
       std::shared_ptr<LocalStream> stream = *it;
       webrtc::MediaStreamInterface* media_stream = stream->MediaStream();
       RTC_CHECK(peer_connection_);
+      for (const auto& track : media_stream->GetVideoTracks()) {
+        auto sender = shared_video_senders_.find(track->id());
+        if (sender == shared_video_senders_.end())
+          continue;
+        peer_connection_->RemoveTrackOrError(sender->second);
+        shared_video_senders_.erase(sender);
+      }
       // TODO: Stop sender instead.
       peer_connection_->RemoveStream(media_stream);
       negotiation_needed = true;
@@ -1237,6 +1294,7 @@ void P2PPeerConnectionChannel::ClosePeerConnection() {
   if (peer_connection_) {
     peer_connection_->Close();
     peer_connection_ = nullptr;
+    shared_video_senders_.clear();
   }
 }
 void P2PPeerConnectionChannel::CheckWaitedList() {
@@ -1320,6 +1378,8 @@ void P2PPeerConnectionChannel::DrainPendingMessages() {
       std::function<void()> on_success;
       std::tie(message, on_success, std::ignore)=*it;
       data_channel_->Send(CreateDataBuffer(*message));
+      memory_account_->Release(MemoryCategory::kPendingMessages,
+                               message->size());
       if (on_success) {
         event_queue_->PostTask([on_success] { on_success(); });
       }
@@ -1336,6 +1396,9 @@ void P2PPeerConnectionChannel::DrainPendingRemoteCandidates() {
     }
   }
   pending_remote_candidates_.clear();
+  memory_account_->Release(MemoryCategory::kPendingCandidates,
+                           pending_remote_candidates_bytes_);
+  pending_remote_candidates_bytes_ = 0;
 }
 
 void P2PPeerConnectionChannel::DrainPendingControlMessages() {
@@ -1350,6 +1413,8 @@ void P2PPeerConnectionChannel::DrainPendingControlMessages() {
       std::function<void()> on_success;
       std::tie(message, on_success, std::ignore) = *it;
       control_data_channel_->Send(CreateDataBuffer(*message));
+      memory_account_->Release(MemoryCategory::kPendingMessages,
+                               message->size());
       if (on_success) {
         on_success();
       }
@@ -1381,6 +1446,8 @@ Json::Value P2PPeerConnectionChannel::UaInfo() {
   capabilities[kUaUnifiedPlanKey] = true;
   capabilities[kUaStreamRemovableKey] = true;
   capabilities[kUaIgnoresDataChannelAcksKey] = true;
+  if (configuration_.compact_signaling)
+    capabilities[kUaCompactSignalingKey] = true;
   ua[kUaSdkKey] = sdk;
   ua[kUaRuntimeKey] = runtime;
   ua[kUaOsKey] = os;
@@ -1399,6 +1466,13 @@ void P2PPeerConnectionChannel::HandleRemoteCapability(Json::Value& ua) {
                              &remote_side_supports_remove_stream_);
   rtc::GetBoolFromJsonObject(capabilities, kUaIgnoresDataChannelAcksKey,
                              &remote_side_ignores_datachannel_acks_);
+  bool compact_signaling = false;
+  rtc::GetBoolFromJsonObject(capabilities, kUaCompactSignalingKey,
+                             &compact_signaling);
+  // Only switch once both sides announced it. Remote endpoints without the
+  // capability keep receiving JSON.
+  remote_side_supports_compact_signaling_ =
+      configuration_.compact_signaling && compact_signaling;
   RTC_LOG(LS_INFO) << "Remote side supports removing stream? "
                    << remote_side_supports_remove_stream_;
   RTC_LOG(LS_INFO) << "Remote side supports WebRTC Plan B? "
@@ -1407,6 +1481,8 @@ void P2PPeerConnectionChannel::HandleRemoteCapability(Json::Value& ua) {
                    << remote_side_supports_unified_plan_;
   RTC_LOG(LS_INFO) << "Remote side ignores data channel acks?"
                    << remote_side_ignores_datachannel_acks_;
+  RTC_LOG(LS_INFO) << "Signaling messages are sent in compact encoding? "
+                   << remote_side_supports_compact_signaling_;
 }
 void P2PPeerConnectionChannel::SendUaInfo() {
   Json::Value json;
@@ -3,11 +3,13 @@
 // SPDX-License-Identifier: Apache-2.0
 #ifndef WOOGEEN_P2P_P2PPEERCONNECTIONCHANNEL_H_
 #define WOOGEEN_P2P_P2PPEERCONNECTIONCHANNEL_H_
+#include <atomic>
 #include <memory>
 #include <mutex>
 #include <unordered_map>
 #include <unordered_set>
 #include <chrono>
+#include "talk/owt/sdk/base/memoryaccount.h"
 #include "talk/owt/sdk/base/peerconnectiondependencyfactory.h"
 #include "talk/owt/sdk/base/peerconnectionchannel.h"
 #include "talk/owt/sdk/include/cpp/owt/base/stream.h"
@@ -47,7 +49,8 @@ class P2PPeerConnectionChannel : public PeerConnectionChannel {
       const std::string& local_id,
       const std::string& remote_id,
       P2PSignalingSenderInterface* sender,
-      std::shared_ptr<rtc::TaskQueue> event_queue);
+      std::shared_ptr<rtc::TaskQueue> event_queue,
+      std::shared_ptr<MemoryAccount> client_memory_account = nullptr);
   // If event_queue is not provided, a new event queue will be used. That means,
   // a new thread will be created for each P2PPeerConnection. Currently, iOS
   // SDK's RTCP2PPeerConnection is a pure Obj-C file, so it does not maintain
@@ -93,6 +96,8 @@ class P2PPeerConnectionChannel : public PeerConnectionChannel {
   void GetStats(
       std::function<void(const webrtc::StatsReports& reports)> on_success,
       std::function<void(std::unique_ptr<Exception>)> on_failure);
+  // Memory held by this channel's pending messages and candidates.
+  MemoryReport GetMemoryReport() const;
   bool HaveLocalOffer();
   std::shared_ptr<LocalStream> GetLatestLocalStream();
   std::function<void()> GetLatestPublishSuccessCallback();
@@ -193,6 +198,11 @@ class P2PPeerConnectionChannel : public PeerConnectionChannel {
   std::vector<std::shared_ptr<LocalStream>> pending_publish_streams_;
   // Streams need to be unpublished.
   std::vector<std::shared_ptr<LocalStream>> pending_unpublish_streams_;
+  // Key is local video track's id, value is the sender of its shared encoder
+  // track. Only used when shared video encoding is enabled.
+  std::unordered_map<std::string,
+                     rtc::scoped_refptr<webrtc::RtpSenderInterface>>
+      shared_video_senders_;
   // A set of labels for streams published to remote side.
   // |Publish| adds its argument to this vector, |Unpublish| removes it.
   std::unordered_set<std::string> published_streams_;
@@ -227,6 +237,11 @@ class P2PPeerConnectionChannel : public PeerConnectionChannel {
   std::vector<std::unique_ptr<webrtc::IceCandidateInterface>>
       pending_remote_candidates_
           RTC_GUARDED_BY(pending_remote_candidates_crit_);
+  // Accounted size of |pending_remote_candidates_|.
+  size_t pending_remote_candidates_bytes_
+      RTC_GUARDED_BY(pending_remote_candidates_crit_);
+  // Feeds the client's account.
+  std::shared_ptr<MemoryAccount> memory_account_;
   // Indicates whether remote client supports WebRTC Plan B
   // (https://tools.ietf.org/html/draft-uberti-rtcweb-plan-00).
   // If plan B is not supported, at most one audio/video track is supported.
@@ -239,6 +254,9 @@ class P2PPeerConnectionChannel : public PeerConnectionChannel {
   // |remote_side_ignores_datachannel_ack_| is true, don't send acks.
   // https://github.com/open-webrtc-toolkit/owt-server-p2p/issues/17.
   bool remote_side_ignores_datachannel_acks_;
+  // Both sides announced compact signaling. Read when sending signaling
+  // messages from any thread.
+  std::atomic<bool> remote_side_supports_compact_signaling_;
   std::mutex is_creating_offer_mutex_;
   // Queue for callbacks and events.
   std::shared_ptr<rtc::TaskQueue> event_queue_;
@@ -0,0 +1,371 @@
+// Copyright (C) <2026> Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "talk/owt/sdk/p2p/signalingcodec.h"
+#include <cstring>
+#include "webrtc/rtc_base/checks.h"
+
+namespace owt {
+namespace p2p {
+namespace {
+const uint8_t kMagic = 0x00;
+const uint8_t kVersion = 1;
+// Nesting deeper than this is rejected when decoding.
+const int kMaxDepth = 32;
+
+// Type tags of a message.
+const uint8_t kNoTypeTag = 0x00;
+const uint8_t kLiteralTypeTag = 0x7f;
+// Value tags.
+enum ValueTag : uint8_t {
+  kNullTag = 0,
+  kFalseTag,
+  kTrueTag,
+  kIntTag,
+  kUIntTag,
+  kDoubleTag,
+  kStringTag,
+  kKnownStringTag,
+  kArrayTag,
+  kObjectTag,
+};
+
+// The tables below are part of the wire format of version 1. Changing them
+// requires a new version.
+const char* const kMessageTypes[] = {
+    "chat-ua",
+    "chat-signal",
+    "chat-track-sources",
+    "chat-stream-info",
+    "chat-tracks-added",
+    "chat-tracks-removed",
+    "chat-data-received",
+    "chat-closed",
+};
+const char* const kKeys[] = {
+    "type",
+    "data",
+    "sdp",
+    "candidate",
+    "sdpMid",
+    "sdpMLineIndex",
+    "id",
+    "source",
+    "tracks",
+    "audio",
+    "video",
+    "sdk",
+    "version",
+    "runtime",
+    "name",
+    "os",
+    "capabilities",
+    "continualIceGathering",
+    "unifiedPlan",
+    "streamRemovable",
+    "ignoreDataChannelAcks",
+    "compactSignaling",
+};
+const char* const kStrings[] = {
+    "offer",  "answer",      "pranswer", "rollback", "mic",
+    "camera", "screen-cast", "audio",    "video",
+};
+
+template <size_t N>
+int IndexOf(const char* const (&table)[N], const std::string& value) {
+  for (size_t i = 0; i < N; i++) {
+    if (value == table[i])
+      return static_cast<int>(i);
+  }
+  return -1;
+}
+
+class Writer {
+ public:
+  explicit Writer(std::string* out) : out_(out) {}
+  void Byte(uint8_t value) { out_->push_back(static_cast<char>(value)); }
+  void Varint(uint64_t value) {
+    while (value >= 0x80) {
+      Byte(static_cast<uint8_t>(value | 0x80));
+      value >>= 7;
+    }
+    Byte(static_cast<uint8_t>(value));
+  }
+  void Bytes(const std::string& value) {
+    Varint(value.size());
+    out_->append(value);
+  }
+  void Key(const std::string& key) {
+    int index = IndexOf(kKeys, key);
+    if (index >= 0) {
+      Varint((static_cast<uint64_t>(index) << 1) | 1);
+    } else {
+      Varint(static_cast<uint64_t>(key.size()) << 1);
+      out_->append(key);
+    }
+  }
+  void Members(const Json::Value& object, const char* skip) {
+    Json::ArrayIndex count = object.size();
+    if (skip && object.isMember(skip))
+      count--;
+    Varint(count);
+    for (auto it = object.begin(); it != object.end(); ++it) {
+      const std::string name = it.name();
+      if (skip && name == skip)
+        continue;
+      Key(name);
+      Value(*it);
+    }
+  }
+  void Value(const Json::Value& value) {
+    switch (value.type()) {
+      case Json::nullValue:
+        Byte(kNullTag);
+        break;
+      case Json::booleanValue:
+        Byte(value.asBool() ? kTrueTag : kFalseTag);
+        break;
+      case Json::intValue: {
+        int64_t v = value.asLargestInt();
+        Byte(kIntTag);
+        // Zigzag so small negative values stay short.
+        Varint((static_cast<uint64_t>(v) << 1) ^
+               static_cast<uint64_t>(v >> 63));
+        break;
+      }
+      case Json::uintValue:
+        Byte(kUIntTag);
+        Varint(value.asLargestUInt());
+        break;
+      case Json::realValue: {
+        double v = value.asDouble();
+        uint64_t bits;
+        memcpy(&bits, &v, sizeof(bits));
+        Byte(kDoubleTag);
+        for (int i = 0; i < 8; i++)
+          Byte(static_cast<uint8_t>(bits >> (i * 8)));
+        break;
+      }
+      case Json::stringValue: {
+        const std::string v = value.asString();
+        int index = IndexOf(kStrings, v);
+        if (index >= 0) {
+          Byte(kKnownStringTag);
+          Byte(static_cast<uint8_t>(index));
+        } else {
+          Byte(kStringTag);
+          Bytes(v);
+        }
+        break;
+      }
+      case Json::arrayValue:
+        Byte(kArrayTag);
+        Varint(value.size());
+        for (Json::ArrayIndex i = 0; i < value.size(); i++)
+          Value(value[i]);
+        break;
+      case Json::objectValue:
+        Byte(kObjectTag);
+        Members(value, nullptr);
+        break;
+    }
+  }
+
+ private:
+  std::string* out_;
+};
+
+class Reader {
+ public:
+  explicit Reader(const std::string& data)
+      : cursor_(reinterpret_cast<const uint8_t*>(data.data())),
+        end_(cursor_ + data.size()) {}
+  bool AtEnd() const { return cursor_ == end_; }
+  bool Byte(uint8_t* value) {
+    if (cursor_ == end_)
+      return false;
+    *value = *cursor_++;
+    return true;
+  }
+  bool Varint(uint64_t* value) {
+    *value = 0;
+    for (int shift = 0; shift < 64; shift += 7) {
+      uint8_t byte;
+      if (!Byte(&byte))
+        return false;
+      *value |= static_cast<uint64_t>(byte & 0x7f) << shift;
+      if (!(byte & 0x80))
+        return true;
+    }
+    return false;
+  }
+  bool Bytes(uint64_t size, std::string* value) {
+    if (size > static_cast<uint64_t>(end_ - cursor_))
+      return false;
+    value->assign(reinterpret_cast<const char*>(cursor_), size);
+    cursor_ += size;
+    return true;
+  }
+  bool Key(std::string* key) {
+    uint64_t k;
+    if (!Varint(&k))
+      return false;
+    if (k & 1) {
+      uint64_t index = k >> 1;
+      if (index >= sizeof(kKeys) / sizeof(kKeys[0]))
+        return false;
+      *key = kKeys[index];
+      return true;
+    }
+    return Bytes(k >> 1, key);
+  }
+  bool Members(Json::Value* object, int depth) {
+    uint64_t count;
+    if (!Varint(&count))
+      return false;
+    // Each member takes two bytes at least.
+    if (count > static_cast<uint64_t>(end_ - cursor_) / 2)
+      return false;
+    std::string key;
+    for (uint64_t i = 0; i < count; i++) {
+      if (!Key(&key) || !Value(&(*object)[key], depth))
+        return false;
+    }
+    return true;
+  }
+  bool Value(Json::Value* value, int depth) {
+    if (depth > kMaxDepth)
+      return false;
+    uint8_t tag;
+    if (!Byte(&tag))
+      return false;
+    switch (tag) {
+      case kNullTag:
+        *value = Json::Value();
+        return true;
+      case kFalseTag:
+      case kTrueTag:
+        *value = Json::Value(tag == kTrueTag);
+        return true;
+      case kIntTag: {
+        uint64_t v;
+        if (!Varint(&v))
+          return false;
+        *value = Json::Value(static_cast<Json::LargestInt>(
+            static_cast<int64_t>(v >> 1) ^ -static_cast<int64_t>(v & 1)));
+        return true;
+      }
+      case kUIntTag: {
+        uint64_t v;
+        if (!Varint(&v))
+          return false;
+        *value = Json::Value(static_cast<Json::LargestUInt>(v));
+        return true;
+      }
+      case kDoubleTag: {
+        uint64_t bits = 0;
+        for (int i = 0; i < 8; i++) {
+          uint8_t byte;
+          if (!Byte(&byte))
+            return false;
+          bits |= static_cast<uint64_t>(byte) << (i * 8);
+        }
+        double v;
+        memcpy(&v, &bits, sizeof(v));
+        *value = Json::Value(v);
+        return true;
+      }
+      case kStringTag: {
+        uint64_t size;
+        std::string v;
+        if (!Varint(&size) || !Bytes(size, &v))
+          return false;
+        *value = Json::Value(v);
+        return true;
+      }
+      case kKnownStringTag: {
+        uint8_t index;
+        if (!Byte(&index) || index >= sizeof(kStrings) / sizeof(kStrings[0]))
+          return false;
+        *value = Json::Value(kStrings[index]);
+        return true;
+      }
+      case kArrayTag: {
+        uint64_t count;
+        if (!Varint(&count) ||
+            count > static_cast<uint64_t>(end_ - cursor_)) {
+          return false;
+        }
+        *value = Json::Value(Json::arrayValue);
+        for (uint64_t i = 0; i < count; i++) {
+          if (!Value(&(*value)[static_cast<Json::ArrayIndex>(i)], depth + 1))
+            return false;
+        }
+        return true;
+      }
+      case kObjectTag:
+        *value = Json::Value(Json::objectValue);
+        return Members(value, depth + 1);
+      default:
+        return false;
+    }
+  }
+
+ private:
+  const uint8_t* cursor_;
+  const uint8_t* end_;
+};
+}  // namespace
+
+bool SignalingCodec::IsCompact(const std::string& data) {
+  return data.size() >= 2 && static_cast<uint8_t>(data[0]) == kMagic;
+}
+
+std::string SignalingCodec::Encode(const Json::Value& message) {
+  RTC_DCHECK(message.isObject());
+  std::string out;
+  Writer writer(&out);
+  writer.Byte(kMagic);
+  writer.Byte(kVersion);
+  const Json::Value& type = message["type"];
+  if (type.isString()) {
+    int index = IndexOf(kMessageTypes, type.asString());
+    if (index >= 0) {
+      writer.Byte(static_cast<uint8_t>(index + 1));
+    } else {
+      writer.Byte(kLiteralTypeTag);
+      writer.Bytes(type.asString());
+    }
+    writer.Members(message, "type");
+  } else {
+    // A non-string type, if any, is kept as a member.
+    writer.Byte(kNoTypeTag);
+    writer.Members(message, nullptr);
+  }
+  return out;
+}
+
+bool SignalingCodec::Decode(const std::string& data, Json::Value* message) {
+  Reader reader(data);
+  uint8_t magic, version, type_tag;
+  if (!reader.Byte(&magic) || magic != kMagic || !reader.Byte(&version) ||
+      version != kVersion || !reader.Byte(&type_tag)) {
+    return false;
+  }
+  *message = Json::Value(Json::objectValue);
+  if (type_tag == kLiteralTypeTag) {
+    uint64_t size;
+    std::string type;
+    if (!reader.Varint(&size) || !reader.Bytes(size, &type))
+      return false;
+    (*message)["type"] = type;
+  } else if (type_tag != kNoTypeTag) {
+    if (type_tag > sizeof(kMessageTypes) / sizeof(kMessageTypes[0]))
+      return false;
+    (*message)["type"] = kMessageTypes[type_tag - 1];
+  }
+  return reader.Members(message, 1) && reader.AtEnd();
+}
+}  // namespace p2p
+}  // namespace owt
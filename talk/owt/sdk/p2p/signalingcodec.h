@@ -0,0 +1,34 @@
+// Copyright (C) <2026> Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef OWT_P2P_SIGNALINGCODEC_H_
+#define OWT_P2P_SIGNALINGCODEC_H_
+
+#include <string>
+#include "webrtc/rtc_base/strings/json.h"
+
+namespace owt {
+namespace p2p {
+// Compact binary encoding of P2P signaling messages, used instead of JSON text
+// when both endpoints announce the "compactSignaling" capability.
+//
+// A message starts with a zero byte, which never starts JSON text, and a
+// version byte. The message type follows as a one byte tag, then the other
+// members of the message as length-delimited fields. Well-known member names,
+// message types and string values are sent as one byte indexes. Strings such
+// as SDP are sent as is, without JSON escaping.
+class SignalingCodec {
+ public:
+  // Returns true if |data| is a compact encoded message rather than JSON.
+  static bool IsCompact(const std::string& data);
+  // Encodes a JSON object with a string "type" member. Members of any JSON
+  // type are supported, so new message types do not need codec changes.
+  static std::string Encode(const Json::Value& message);
+  // Decodes |data| into the JSON object it was encoded from. Returns false if
+  // |data| is malformed or of an unknown version.
+  static bool Decode(const std::string& data, Json::Value* message);
+};
+}  // namespace p2p
+}  // namespace owt
+#endif  // OWT_P2P_SIGNALINGCODEC_H_
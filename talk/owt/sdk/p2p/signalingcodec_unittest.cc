@@ -0,0 +1,101 @@
+// Copyright (C) <2026> Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+#include <string>
+#include "talk/owt/sdk/p2p/signalingcodec.h"
+#include "testing/gtest/include/gtest/gtest.h"
+namespace owt {
+namespace p2p {
+namespace {
+Json::Value Offer() {
+  Json::Value signal;
+  signal["type"] = "offer";
+  signal["sdp"] =
+      "v=0\r\no=- 4611731400430051336 2 IN IP4 127.0.0.1\r\ns=-\r\n"
+      "a=\"quoted\"\\backslash\r\n";
+  Json::Value message;
+  message["type"] = "chat-signal";
+  message["data"] = signal;
+  return message;
+}
+
+Json::Value Parse(const std::string& text) {
+  Json::Reader reader;
+  Json::Value value;
+  EXPECT_TRUE(reader.parse(text, value));
+  return value;
+}
+}  // namespace
+
+TEST(SignalingCodecTest, RoundTripsChatMessages) {
+  const std::string messages[] = {
+      rtc::JsonValueToString(Offer()),
+      R"({"type":"chat-signal","data":{"candidate":"candidate:1 1 udp 2122)"
+      R"(260223 192.168.1.2 54400 typ host","sdpMid":"0","sdpMLineIndex":0}})",
+      R"({"type":"chat-track-sources","data":[{"id":"a","source":"mic"},)"
+      R"({"id":"v","source":"screen-cast"}]})",
+      R"({"type":"chat-ua","data":{"sdk":{"type":"C++","version":"5.0"},)"
+      R"("capabilities":{"unifiedPlan":true,"compactSignaling":false}}})",
+      R"({"type":"chat-data-received","data":"42"})",
+      R"({"type":"chat-closed"})",
+  };
+  for (const auto& text : messages) {
+    Json::Value message = Parse(text);
+    std::string encoded = SignalingCodec::Encode(message);
+    EXPECT_TRUE(SignalingCodec::IsCompact(encoded));
+    EXPECT_LT(encoded.size(), text.size());
+    Json::Value decoded;
+    ASSERT_TRUE(SignalingCodec::Decode(encoded, &decoded)) << text;
+    EXPECT_EQ(message, decoded) << text;
+  }
+}
+
+TEST(SignalingCodecTest, RoundTripsUnknownTypesAndValues) {
+  Json::Value message;
+  message["type"] = "chat-future";
+  message["negative"] = -70000;
+  message["large"] = Json::Value(static_cast<Json::LargestUInt>(1) << 40);
+  message["ratio"] = 0.25;
+  message["nothing"] = Json::Value();
+  message["nested"]["list"].append(Json::Value(false));
+  message["nested"]["list"].append(Json::Value(Json::objectValue));
+  Json::Value decoded;
+  ASSERT_TRUE(
+      SignalingCodec::Decode(SignalingCodec::Encode(message), &decoded));
+  EXPECT_EQ(message, decoded);
+
+  Json::Value untyped;
+  untyped["data"] = "no type";
+  ASSERT_TRUE(
+      SignalingCodec::Decode(SignalingCodec::Encode(untyped), &decoded));
+  EXPECT_EQ(untyped, decoded);
+}
+
+TEST(SignalingCodecTest, JsonIsNotCompact) {
+  EXPECT_FALSE(SignalingCodec::IsCompact(rtc::JsonValueToString(Offer())));
+  EXPECT_FALSE(SignalingCodec::IsCompact(""));
+}
+
+TEST(SignalingCodecTest, RejectsMalformedInput) {
+  std::string encoded = SignalingCodec::Encode(Offer());
+  Json::Value decoded;
+  // Every truncation is detected.
+  for (size_t size = 0; size < encoded.size(); size++) {
+    EXPECT_FALSE(SignalingCodec::Decode(encoded.substr(0, size), &decoded))
+        << size;
+  }
+  EXPECT_FALSE(SignalingCodec::Decode(encoded + '\0', &decoded));
+  std::string future_version = encoded;
+  future_version[1] = 2;
+  EXPECT_FALSE(SignalingCodec::Decode(future_version, &decoded));
+  // A member count larger than the remaining input.
+  EXPECT_FALSE(SignalingCodec::Decode(std::string("\0\1\2\x7f", 4), &decoded));
+  // Nesting beyond the limit.
+  std::string deep("\0\1\0\1\x03", 5);
+  for (int i = 0; i < 64; i++)
+    deep += "\x08\x01";
+  deep += '\0';
+  EXPECT_FALSE(SignalingCodec::Decode(deep, &decoded));
+}
+}  // namespace p2p
+}  // namespace owt
@@ -0,0 +1,408 @@
+// Copyright (C) <2026> Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+
+// Runs N publisher/subscriber pairs over loopback and reports sustained frame
+// rate, glass-to-glass latency, connection setup time, CPU per stream and RSS
+// growth. Each pair uses its own FakeSignalingChannel, so pairs only share
+// the SDK's threads and codec factories, as streams of one application do.
+//
+// Glass-to-glass latency is measured by stamping the capture time into the
+// luma plane of every synthetic frame and reading it back in the renderer.
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+#if defined(WEBRTC_WIN)
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#include <unistd.h>
+#endif
+#include "absl/flags/flag.h"
+#include "absl/flags/parse.h"
+#include "owt/base/framegeneratorinterface.h"
+#include "owt/base/globalconfiguration.h"
+#include "owt/base/localcamerastreamparameters.h"
+#include "owt/base/stream.h"
+#include "owt/base/videorendererinterface.h"
+#include "owt/p2p/p2pclient.h"
+#include "talk/owt/sdk/base/framelatencytracer.h"
+#include "talk/owt/sdk/p2p/tests/fake_signaling_channel.h"
+#include "third_party/webrtc/api/task_queue/default_task_queue_factory.h"
+#include "third_party/webrtc/rtc_base/event.h"
+#include "third_party/webrtc/rtc_base/logging.h"
+#include "third_party/webrtc/rtc_base/time_utils.h"
+
+ABSL_FLAG(int, pairs, 4, "Number of publisher/subscriber pairs.");
+ABSL_FLAG(int, width, 640, "Width of synthetic video.");
+ABSL_FLAG(int, height, 480, "Height of synthetic video.");
+ABSL_FLAG(int, fps, 30, "Frame rate of synthetic video.");
+ABSL_FLAG(std::string, codec, "vp8", "Video codec: vp8, vp9, h264 or av1.");
+ABSL_FLAG(int, bitrate_kbps, 0, "Max video bitrate. 0 keeps SDK default.");
+ABSL_FLAG(bool, audio, true, "Publish synthetic audio along with video.");
+ABSL_FLAG(int, warmup_s, 5, "Seconds to wait after setup before measuring.");
+ABSL_FLAG(int, duration_s, 30, "Seconds to measure.");
+ABSL_FLAG(int, setup_timeout_s, 30, "Seconds to wait for first frames.");
+
+namespace owt {
+namespace p2p {
+namespace test {
+namespace {
+// Number of bits of capture time stamped into each frame.
+const int kStampBits = 32;
+// Height of the stamp band at the top of the luma plane.
+const int kStampHeight = 16;
+
+// I420 frames with capture time in milliseconds stamped as black and white
+// blocks on the top rows, and a moving gradient below so encoders have work
+// to do.
+class StampedFrameGenerator : public owt::base::VideoFrameGeneratorInterface {
+ public:
+  StampedFrameGenerator(int width, int height, int fps)
+      : width_(width), height_(height), fps_(fps) {}
+  uint32_t GenerateNextFrame(uint8_t* buffer,
+                             const uint32_t capacity) override {
+    uint32_t size = GetNextFrameSize();
+    if (capacity < size)
+      return 0;
+    uint8_t* y = buffer;
+    for (int row = kStampHeight; row < height_; row++) {
+      for (int col = 0; col < width_; col++)
+        y[row * width_ + col] = static_cast<uint8_t>(row + col + frame_ * 4);
+    }
+    uint32_t stamp = static_cast<uint32_t>(rtc::TimeMillis());
+    int block = width_ / kStampBits;
+    for (int bit = 0; bit < kStampBits; bit++) {
+      uint8_t value = (stamp >> bit) & 1 ? 235 : 16;
+      for (int row = 0; row < kStampHeight; row++)
+        memset(y + row * width_ + bit * block, value, block);
+    }
+    memset(buffer + width_ * height_, 128, size - width_ * height_);
+    frame_++;
+    return size;
+  }
+  uint32_t GetNextFrameSize() override {
+    return width_ * height_ + 2 * ((width_ + 1) / 2) * ((height_ + 1) / 2);
+  }
+  int GetHeight() override { return height_; }
+  int GetWidth() override { return width_; }
+  int GetFps() override { return fps_; }
+  VideoFrameCodec GetType() override { return VideoFrameCodec::I420; }
+
+ private:
+  const int width_;
+  const int height_;
+  const int fps_;
+  int frame_ = 0;
+};
+
+// 48 kHz mono 440 Hz tone.
+class ToneAudioGenerator : public owt::base::AudioFrameGeneratorInterface {
+ public:
+  uint32_t GenerateFramesForNext10Ms(uint8_t* buffer,
+                                     const uint32_t capacity) override {
+    const int samples = kSampleRate / 100;
+    if (capacity < samples * sizeof(int16_t))
+      return 0;
+    int16_t* pcm = reinterpret_cast<int16_t*>(buffer);
+    for (int i = 0; i < samples; i++, sample_++) {
+      pcm[i] = static_cast<int16_t>(
+          8000 * std::sin(2 * 3.14159265358979 * 440 * sample_ / kSampleRate));
+    }
+    return samples * sizeof(int16_t);
+  }
+  int GetSampleRate() override { return kSampleRate; }
+  int GetChannelNumber() override { return 1; }
+
+ private:
+  static const int kSampleRate = 48000;
+  int64_t sample_ = 0;
+};
+
+// Counts frames and reads capture time stamped by StampedFrameGenerator.
+class StampReadingRenderer : public owt::base::VideoRendererInterface {
+ public:
+  void RenderFrame(std::unique_ptr<owt::base::VideoBuffer> buffer) override {
+    int64_t now_ms = rtc::TimeMillis();
+    int64_t expected = -1;
+    first_frame_ms_.compare_exchange_strong(expected, now_ms);
+    frames_++;
+    int width = buffer->resolution.width;
+    int block = width / kStampBits;
+    if (buffer->resolution.height < kStampHeight || block == 0)
+      return;
+    const uint8_t* center_row = buffer->buffer + (kStampHeight / 2) * width;
+    uint32_t stamp = 0;
+    for (int bit = 0; bit < kStampBits; bit++) {
+      if (center_row[bit * block + block / 2] >= 128)
+        stamp |= 1u << bit;
+    }
+    uint32_t latency_ms = static_cast<uint32_t>(now_ms) - stamp;
+    // Stamps damaged by compression decode to nonsense.
+    if (latency_ms < 10000)
+      latency_.Add(static_cast<int64_t>(latency_ms) * 1000);
+  }
+  owt::base::VideoRendererType Type() override {
+    return owt::base::VideoRendererType::kI420;
+  }
+  uint64_t Frames() const { return frames_.load(); }
+  int64_t FirstFrameMs() const { return first_frame_ms_.load(); }
+  owt::base::LatencyHistogram& Latency() { return latency_; }
+
+ private:
+  std::atomic<uint64_t> frames_{0};
+  std::atomic<int64_t> first_frame_ms_{-1};
+  owt::base::LatencyHistogram latency_;
+};
+
+class RendererAttacher : public P2PClientObserver {
+ public:
+  explicit RendererAttacher(StampReadingRenderer* renderer)
+      : renderer_(renderer) {}
+  void OnStreamAdded(std::shared_ptr<owt::base::RemoteStream> stream) override {
+    stream->AttachVideoRenderer(*renderer_);
+    stream_ = stream;
+  }
+
+ private:
+  StampReadingRenderer* renderer_;
+  std::shared_ptr<owt::base::RemoteStream> stream_;
+};
+
+struct Pair {
+  std::shared_ptr<FakeSignalingChannel> signaling;
+  std::shared_ptr<P2PClient> publisher;
+  std::shared_ptr<P2PClient> subscriber;
+  std::shared_ptr<owt::base::LocalStream> stream;
+  std::unique_ptr<StampReadingRenderer> renderer;
+  std::unique_ptr<RendererAttacher> attacher;
+  int64_t publish_start_ms = 0;
+  std::atomic<int64_t> published_ms{-1};
+};
+
+int64_t ProcessCpuTimeUs() {
+#if defined(WEBRTC_WIN)
+  FILETIME creation, exit, kernel, user;
+  if (!GetProcessTimes(GetCurrentProcess(), &creation, &exit, &kernel, &user))
+    return 0;
+  auto to_us = [](const FILETIME& time) {
+    return ((static_cast<int64_t>(time.dwHighDateTime) << 32) |
+            time.dwLowDateTime) / 10;
+  };
+  return to_us(kernel) + to_us(user);
+#else
+  rusage usage;
+  if (getrusage(RUSAGE_SELF, &usage) != 0)
+    return 0;
+  return (usage.ru_utime.tv_sec + usage.ru_stime.tv_sec) * 1000000ll +
+         usage.ru_utime.tv_usec + usage.ru_stime.tv_usec;
+#endif
+}
+
+double ProcessRssMb() {
+#if defined(WEBRTC_WIN)
+  PROCESS_MEMORY_COUNTERS counters;
+  if (!GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+    return 0;
+  return counters.WorkingSetSize / 1048576.0;
+#else
+  FILE* statm = fopen("/proc/self/statm", "r");
+  if (!statm)
+    return 0;
+  long pages = 0, resident = 0;
+  int fields = fscanf(statm, "%ld %ld", &pages, &resident);
+  fclose(statm);
+  return fields == 2 ? resident * sysconf(_SC_PAGESIZE) / 1048576.0 : 0;
+#endif
+}
+
+owt::base::VideoCodec CodecFromName(const std::string& name) {
+  if (name == "vp9")
+    return owt::base::VideoCodec::kVp9;
+  if (name == "h264")
+    return owt::base::VideoCodec::kH264;
+  if (name == "av1")
+    return owt::base::VideoCodec::kAv1;
+  return owt::base::VideoCodec::kVp8;
+}
+
+double Percentile(std::vector<double> values, double quantile) {
+  if (values.empty())
+    return 0;
+  std::sort(values.begin(), values.end());
+  size_t index = static_cast<size_t>(std::ceil(quantile * values.size()));
+  return values[std::min(values.size() - 1, index > 0 ? index - 1 : 0)];
+}
+
+void PrintResult(const char* name, double value, const char* unit) {
+  printf("RESULT %s: p2p_benchmark= %.2f %s\n", name, value, unit);
+}
+
+int RunBenchmark() {
+  const int pairs = absl::GetFlag(FLAGS_pairs);
+  const int width = absl::GetFlag(FLAGS_width);
+  const int height = absl::GetFlag(FLAGS_height);
+  const int fps = absl::GetFlag(FLAGS_fps);
+  const bool audio = absl::GetFlag(FLAGS_audio);
+  if (audio) {
+    owt::base::GlobalConfiguration::SetCustomizedAudioInputEnabled(
+        true, std::make_unique<ToneAudioGenerator>());
+  }
+  P2PClientConfiguration configuration;
+  owt::base::VideoEncodingParameters video(
+      owt::base::VideoCodecParameters(
+          CodecFromName(absl::GetFlag(FLAGS_codec)), ""),
+      absl::GetFlag(FLAGS_bitrate_kbps), false);
+  configuration.video_encodings.push_back(video);
+
+  double rss_start_mb = ProcessRssMb();
+  std::unique_ptr<webrtc::TaskQueueFactory> task_queue_factory =
+      webrtc::CreateDefaultTaskQueueFactory();
+  std::vector<std::unique_ptr<Pair>> all_pairs;
+  for (int i = 0; i < pairs; i++) {
+    auto pair = std::make_unique<Pair>();
+    pair->signaling = std::make_shared<FakeSignalingChannel>(
+        task_queue_factory->CreateTaskQueue(
+            "fake_signaling_channel",
+            webrtc::TaskQueueFactory::Priority::NORMAL));
+    pair->publisher =
+        std::make_shared<P2PClient>(configuration, pair->signaling);
+    pair->subscriber =
+        std::make_shared<P2PClient>(configuration, pair->signaling);
+    pair->renderer = std::make_unique<StampReadingRenderer>();
+    pair->attacher = std::make_unique<RendererAttacher>(pair->renderer.get());
+    pair->subscriber->AddObserver(*pair->attacher);
+    pair->publisher->Connect("", "client1", nullptr, nullptr);
+    pair->subscriber->Connect("", "client2", nullptr, nullptr);
+    pair->publisher->AddAllowedRemoteId("client2");
+    pair->subscriber->AddAllowedRemoteId("client1");
+    auto parameters =
+        std::make_shared<owt::base::LocalCustomizedStreamParameters>(audio,
+                                                                     true);
+    parameters->Resolution(width, height);
+    parameters->Fps(fps);
+    pair->stream = owt::base::LocalStream::Create(
+        parameters,
+        std::make_unique<StampedFrameGenerator>(width, height, fps));
+    if (!pair->stream) {
+      RTC_LOG(LS_ERROR) << "Failed to create local stream.";
+      return 1;
+    }
+    all_pairs.push_back(std::move(pair));
+  }
+
+  int64_t setup_start_ms = rtc::TimeMillis();
+  for (auto& pair : all_pairs) {
+    Pair* raw_pair = pair.get();
+    pair->publish_start_ms = rtc::TimeMillis();
+    pair->publisher->Publish(
+        "client2", pair->stream,
+        [raw_pair](std::shared_ptr<P2PPublication>) {
+          raw_pair->published_ms = rtc::TimeMillis();
+        },
+        [](std::unique_ptr<owt::base::Exception> e) {
+          RTC_LOG(LS_ERROR) << "Publish failed: " << e->Message();
+        });
+  }
+  rtc::Event wait;
+  int64_t deadline_ms =
+      setup_start_ms + absl::GetFlag(FLAGS_setup_timeout_s) * 1000;
+  int connected = 0;
+  while (rtc::TimeMillis() < deadline_ms) {
+    connected = 0;
+    for (auto& pair : all_pairs)
+      connected += pair->renderer->FirstFrameMs() >= 0 ? 1 : 0;
+    if (connected == pairs)
+      break;
+    wait.Wait(100);
+  }
+  std::vector<double> publish_ms, first_frame_ms;
+  for (auto& pair : all_pairs) {
+    if (pair->published_ms >= 0)
+      publish_ms.push_back(pair->published_ms - pair->publish_start_ms);
+    if (pair->renderer->FirstFrameMs() >= 0) {
+      first_frame_ms.push_back(pair->renderer->FirstFrameMs() -
+                               pair->publish_start_ms);
+    }
+  }
+  double rss_connected_mb = ProcessRssMb();
+
+  wait.Wait(absl::GetFlag(FLAGS_warmup_s) * 1000);
+  std::vector<uint64_t> frames_before;
+  for (auto& pair : all_pairs) {
+    frames_before.push_back(pair->renderer->Frames());
+    pair->renderer->Latency().Reset();
+  }
+  double rss_before_mb = ProcessRssMb();
+  int64_t cpu_before_us = ProcessCpuTimeUs();
+  int64_t measure_start_ms = rtc::TimeMillis();
+  wait.Wait(absl::GetFlag(FLAGS_duration_s) * 1000);
+  double elapsed_s = (rtc::TimeMillis() - measure_start_ms) / 1000.0;
+  int64_t cpu_us = ProcessCpuTimeUs() - cpu_before_us;
+  double rss_after_mb = ProcessRssMb();
+
+  std::vector<double> stream_fps, latency_p50, latency_p90, latency_p99;
+  double latency_max = 0;
+  for (size_t i = 0; i < all_pairs.size(); i++) {
+    StampReadingRenderer* renderer = all_pairs[i]->renderer.get();
+    stream_fps.push_back((renderer->Frames() - frames_before[i]) / elapsed_s);
+    if (renderer->Latency().Count() == 0)
+      continue;
+    latency_p50.push_back(renderer->Latency().Percentile(0.5));
+    latency_p90.push_back(renderer->Latency().Percentile(0.9));
+    latency_p99.push_back(renderer->Latency().Percentile(0.99));
+    latency_max = std::max(latency_max, renderer->Latency().MaxMs());
+  }
+
+  printf("%d pairs, %dx%d@%d %s%s, %.1f s measured, %d of %d connected.\n",
+         pairs, width, height, fps, absl::GetFlag(FLAGS_codec).c_str(),
+         audio ? " + audio" : "", elapsed_s, connected, pairs);
+  PrintResult("publish_ms_p50", Percentile(publish_ms, 0.5), "ms");
+  PrintResult("publish_ms_max", Percentile(publish_ms, 1), "ms");
+  PrintResult("first_frame_ms_p50", Percentile(first_frame_ms, 0.5), "ms");
+  PrintResult("first_frame_ms_max", Percentile(first_frame_ms, 1), "ms");
+  PrintResult("fps_min", Percentile(stream_fps, 0), "fps");
+  PrintResult("fps_p50", Percentile(stream_fps, 0.5), "fps");
+  // Worst stream for each percentile.
+  PrintResult("glass_to_glass_p50", Percentile(latency_p50, 1), "ms");
+  PrintResult("glass_to_glass_p90", Percentile(latency_p90, 1), "ms");
+  PrintResult("glass_to_glass_p99", Percentile(latency_p99, 1), "ms");
+  PrintResult("glass_to_glass_max", latency_max, "ms");
+  // Publisher and subscriber of a pair run in this process, so a stream's
+  // share covers both ends.
+  PrintResult("cpu_per_stream", 100.0 * cpu_us / 1e6 / elapsed_s / pairs,
+              "%core");
+  PrintResult("rss_setup_per_stream",
+              (rss_connected_mb - rss_start_mb) / pairs, "MB");
+  PrintResult("rss_growth", rss_after_mb - rss_before_mb, "MB");
+  PrintResult("rss_growth_rate",
+              (rss_after_mb - rss_before_mb) * 60 / elapsed_s, "MB/min");
+  fflush(stdout);
+
+  for (auto& pair : all_pairs) {
+    rtc::Event stopped;
+    pair->publisher->Stop("client2", [&stopped] { stopped.Set(); },
+                          [&stopped](std::unique_ptr<owt::base::Exception>) {
+                            stopped.Set();
+                          });
+    stopped.Wait(5000);
+  }
+  return connected == pairs ? 0 : 1;
+}
+}  // namespace
+}  // namespace test
+}  // namespace p2p
+}  // namespace owt
+
+int main(int argc, char* argv[]) {
+  absl::ParseCommandLine(argc, argv);
+  rtc::LogMessage::LogToDebug(rtc::LS_WARNING);
+  return owt::p2p::test::RunBenchmark();
+}
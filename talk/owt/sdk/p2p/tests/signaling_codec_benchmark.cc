@@ -0,0 +1,152 @@
+// Copyright (C) <2026> Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+
+// Measures encode and decode throughput of P2P signaling messages in JSON
+// text and in the compact encoding of SignalingCodec. Messages are built as
+// P2PPeerConnectionChannel builds them, so both paths start from and end at
+// a Json::Value.
+
+#include <cstdio>
+#include <string>
+#include <vector>
+#include "absl/flags/flag.h"
+#include "absl/flags/parse.h"
+#include "talk/owt/sdk/p2p/signalingcodec.h"
+#include "third_party/webrtc/rtc_base/strings/json.h"
+#include "third_party/webrtc/rtc_base/time_utils.h"
+
+ABSL_FLAG(int, iterations, 20000, "Encode/decode round trips per message.");
+
+namespace owt {
+namespace p2p {
+namespace test {
+namespace {
+struct Sample {
+  const char* name;
+  Json::Value message;
+};
+
+// An offer with one audio and one video section, similar in size and shape
+// to what the SDK creates.
+std::string OfferSdp() {
+  std::string sdp =
+      "v=0\r\no=- 4611731400430051336 2 IN IP4 127.0.0.1\r\ns=-\r\nt=0 0\r\n"
+      "a=group:BUNDLE 0 1\r\na=extmap-allow-mixed\r\n"
+      "a=msid-semantic: WMS stream\r\n";
+  const char* kinds[] = {"audio", "video"};
+  for (int section = 0; section < 2; section++) {
+    sdp += std::string("m=") + kinds[section] +
+           " 9 UDP/TLS/RTP/SAVPF 96 97 98 99 100 101 102 103\r\n"
+           "c=IN IP4 0.0.0.0\r\na=rtcp:9 IN IP4 0.0.0.0\r\n"
+           "a=ice-ufrag:8hhY\r\na=ice-pwd:asd88fgpdd777uzjYhagZg1234\r\n"
+           "a=ice-options:trickle\r\na=fingerprint:sha-256 "
+           "D2:FA:0E:C3:22:59:5E:14:95:69:92:3D:13:B4:84:24:2C:C2:A2:C0:3E:FD:"
+           "34:8E:5E:EA:6F:AF:52:CE:E6:0F\r\na=setup:actpass\r\n"
+           "a=mid:" +
+           std::to_string(section) + "\r\na=sendrecv\r\na=rtcp-mux\r\n";
+    for (int pt = 96; pt < 104; pt++) {
+      std::string p = std::to_string(pt);
+      sdp += "a=rtpmap:" + p + " VP8/90000\r\na=rtcp-fb:" + p +
+             " goog-remb\r\na=rtcp-fb:" + p + " transport-cc\r\na=rtcp-fb:" +
+             p + " ccm fir\r\na=rtcp-fb:" + p + " nack\r\na=rtcp-fb:" + p +
+             " nack pli\r\n";
+    }
+    sdp += "a=ssrc:1001 cname:4TOk42mSjXCkVIa6\r\n"
+           "a=ssrc:1001 msid:stream track\r\n";
+  }
+  return sdp;
+}
+
+std::vector<Sample> Samples() {
+  std::vector<Sample> samples;
+  Json::Value offer;
+  offer["type"] = "chat-signal";
+  offer["data"]["type"] = "offer";
+  offer["data"]["sdp"] = OfferSdp();
+  samples.push_back({"offer", offer});
+
+  Json::Value candidate;
+  candidate["type"] = "chat-signal";
+  candidate["data"]["candidate"] =
+      "candidate:842163049 1 udp 1677729535 203.0.113.7 46154 typ srflx "
+      "raddr 192.168.1.2 rport 46154 generation 0 ufrag 8hhY network-cost 50";
+  candidate["data"]["sdpMid"] = "0";
+  candidate["data"]["sdpMLineIndex"] = 0;
+  samples.push_back({"candidate", candidate});
+
+  Json::Value track_sources;
+  track_sources["type"] = "chat-track-sources";
+  Json::Value audio;
+  audio["id"] = "e4b8f3a0-audio";
+  audio["source"] = "mic";
+  Json::Value video;
+  video["id"] = "e4b8f3a0-video";
+  video["source"] = "camera";
+  track_sources["data"].append(audio);
+  track_sources["data"].append(video);
+  samples.push_back({"track_sources", track_sources});
+
+  Json::Value ack;
+  ack["type"] = "chat-data-received";
+  ack["data"] = "1024";
+  samples.push_back({"ack", ack});
+  return samples;
+}
+
+void PrintResult(const std::string& name, double value, const char* unit) {
+  printf("RESULT %s: signaling_codec_benchmark= %.2f %s\n", name.c_str(),
+         value, unit);
+}
+
+// Returns round trips per second.
+template <typename RoundTrip>
+double Measure(int iterations, RoundTrip round_trip) {
+  int64_t start = rtc::TimeNanos();
+  for (int i = 0; i < iterations; i++)
+    round_trip();
+  int64_t elapsed = rtc::TimeNanos() - start;
+  return elapsed > 0 ? iterations * 1e9 / elapsed : 0;
+}
+
+int RunBenchmark() {
+  const int iterations = absl::GetFlag(FLAGS_iterations);
+  bool ok = true;
+  for (const auto& sample : Samples()) {
+    const std::string json = rtc::JsonValueToString(sample.message);
+    const std::string compact = SignalingCodec::Encode(sample.message);
+    Json::Value decoded;
+    if (!SignalingCodec::Decode(compact, &decoded) ||
+        decoded != sample.message) {
+      fprintf(stderr, "%s does not survive a round trip.\n", sample.name);
+      ok = false;
+      continue;
+    }
+    double json_rate = Measure(iterations, [&sample] {
+      Json::Reader reader;
+      Json::Value parsed;
+      reader.parse(rtc::JsonValueToString(sample.message), parsed);
+    });
+    double compact_rate = Measure(iterations, [&sample] {
+      Json::Value parsed;
+      SignalingCodec::Decode(SignalingCodec::Encode(sample.message), &parsed);
+    });
+    const std::string name(sample.name);
+    PrintResult(name + "_json_size", json.size(), "bytes");
+    PrintResult(name + "_compact_size", compact.size(), "bytes");
+    PrintResult(name + "_json_round_trips", json_rate, "msgs/s");
+    PrintResult(name + "_compact_round_trips", compact_rate, "msgs/s");
+    PrintResult(name + "_speedup", json_rate > 0 ? compact_rate / json_rate : 0,
+                "x");
+  }
+  return ok ? 0 : 1;
+}
+}  // namespace
+}  // namespace test
+}  // namespace p2p
+}  // namespace owt
+
+int main(int argc, char* argv[]) {
+  absl::ParseCommandLine(argc, argv);
+  return owt::p2p::test::RunBenchmark();
+}